@@ -25,6 +25,7 @@
 #include "cpl_conv.h"
 #include "cpl_error_internal.h"
 #include "cpl_string.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_srs_api.h"
 #include "ogr_geometry.h"
@@ -564,6 +565,14 @@ mode.
  * A negative value means a single transaction. The function takes care of
  * issuing the starting transaction and committing the final one.
  *
+ *   NUM_THREADS=num|ALL_CPUS
+ *
+ * (GDAL >= 3.13) Number of worker threads. Defaults to 1, or to the value of
+ * the GDAL_NUM_THREADS configuration option. When greater than 1, bands of
+ * lines are contoured in parallel, and their segments are stitched together
+ * in the same order as in the single-threaded mode, so the output is
+ * identical.
+ *
  * @return CE_None on success or CE_Failure if an error occurs.
  */
 CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
@@ -681,6 +690,10 @@ CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
 
     bool polygonize = CPLFetchBool(options, "POLYGONIZE", false);
 
+    const int nThreads =
+        GDALGetNumThreads(options, "NUM_THREADS", GDAL_DEFAULT_MAX_THREAD_COUNT,
+                          /* bDefaultAllCPUs = */ false);
+
     int bSuccessMin = FALSE;
     double dfMinimum = GDALGetRasterMinimum(hBand, &bSuccessMin);
     int bSuccessMax = FALSE;
@@ -894,7 +907,7 @@ CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
                 ContourGeneratorFromRaster<decltype(writer),
                                            FixedLevelRangeIterator>
                     cg(hBand, useNoData, noDataValue, writer, levels);
-                ok = cg.process(pfnProgress, pProgressArg);
+                ok = cg.process(pfnProgress, pProgressArg, nThreads);
             }
         }
         else
@@ -937,7 +950,7 @@ CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
                 ContourGeneratorFromRaster<decltype(writer),
                                            FixedLevelRangeIterator>
                     cg(hBand, useNoData, noDataValue, writer, levels);
-                ok = cg.process(pfnProgress, pProgressArg);
+                ok = cg.process(pfnProgress, pProgressArg, nThreads);
             }
         }
     }
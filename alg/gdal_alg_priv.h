@@ -180,6 +180,7 @@ void CPL_DLL *GDALCloneTransformer(void *pTransformerArg);
 
 void GDALRefreshGenImgProjTransformer(void *hTransformArg);
 void GDALRefreshApproxTransformer(void *hTransformArg);
+void GDALApproxTransformerSetGridStep(void *hTransformArg, int nGridStep);
 
 int GDALTransformLonLatToDestGenImgProjTransformer(void *hTransformArg,
                                                    double *pdfX, double *pdfY);
@@ -280,6 +281,8 @@ struct GDALReprojectionTransformInfo
 /* ==================================================================== */
 /************************************************************************/
 
+struct GDALApproxTransformGrid;
+
 struct GDALApproxTransformInfo
 {
     GDALTransformerInfo sTI;
@@ -291,6 +294,9 @@ struct GDALApproxTransformInfo
 
     int bOwnSubtransformer = 0;
 
+    // Set in 2-D grid mode, see GDALApproxTransformerSetGridStep()
+    GDALApproxTransformGrid *poGrid = nullptr;
+
     GDALApproxTransformInfo() : sTI()
     {
         memset(&sTI, 0, sizeof(sTI));
@@ -18,13 +18,16 @@
 #include <cstdlib>
 
 #include <algorithm>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
+#include "gdal_thread_pool.h"
 
 static CPLErr ProcessProximityLine(GInt32 *panSrcScanline, int *panNearX,
                                    int *panNearY, int bForward, int iLine,
@@ -33,6 +36,32 @@ static CPLErr ProcessProximityLine(GInt32 *panSrcScanline, int *panNearX,
                                    double *pdfSrcNoDataValue, int nTargetValues,
                                    int *panTargetValues);
 
+namespace
+{
+/* Parameters of the exact Euclidean distance transform */
+struct GDALProximityEDTParams
+{
+    int nXSize = 0;
+    int nYSize = 0;
+    double dfMaxDist = 0;
+    double dfDistMult = 1;
+    const double *pdfSrcNoDataValue = nullptr;
+    float fNoDataValue = 0;
+    bool bFixedBufVal = false;
+    double dfFixedBufVal = 0;
+    int nTargetValues = 0;
+    const int *panTargetValues = nullptr;
+    int nThreads = 1;
+};
+}  // namespace
+
+static CPLErr ComputeProximityEDT(GDALRasterBandH hSrcBand,
+                                  GDALRasterBandH hWorkProximityBand,
+                                  GDALRasterBandH hProximityBand,
+                                  const GDALProximityEDTParams &sParams,
+                                  GDALProgressFunc pfnProgress,
+                                  void *pProgressArg);
+
 /************************************************************************/
 /*                        GDALComputeProximity()                        */
 /************************************************************************/
@@ -89,6 +118,21 @@ the proximity output.
 
 If this option is set, all pixels within the MAXDIST threshold are
 set to this fixed value instead of to a proximity distance.
+
+  ALGORITHM=[SCANLINE]/EDT
+
+(GDAL >= 3.13) Algorithm used to compute distances. SCANLINE, the default,
+propagates the nearest target pixel in a top-down and a bottom-up pass.
+EDT computes an exact Euclidean distance transform, separable in a column
+and a row pass, whose rows are processed in parallel when NUM_THREADS is
+set. Both algorithms give the same result in most cases, but EDT returns
+the true nearest distance in the rare configurations where the propagation
+of SCANLINE misses the nearest target.
+
+  NUM_THREADS=n/ALL_CPUS
+
+(GDAL >= 3.13) Number of worker threads used by ALGORITHM=EDT. Defaults to
+the GDAL_NUM_THREADS configuration option, or 1.
 */
 
 CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
@@ -204,6 +248,27 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
         bFixedBufVal = true;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Which algorithm should be used?                                 */
+    /* -------------------------------------------------------------------- */
+    bool bEDT = false;
+    pszOpt = CSLFetchNameValue(papszOptions, "ALGORITHM");
+    if (pszOpt)
+    {
+        if (EQUAL(pszOpt, "EDT"))
+        {
+            bEDT = true;
+        }
+        else if (!EQUAL(pszOpt, "SCANLINE"))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Unrecognized ALGORITHM value '%s', should be SCANLINE "
+                     "or EDT.",
+                     pszOpt);
+            return CE_Failure;
+        }
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Get the target value(s).                                        */
     /* -------------------------------------------------------------------- */
@@ -252,8 +317,11 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
     GInt32 *panSrcScanline = nullptr;
     bool bTempFileAlreadyDeleted = false;
 
+    // The EDT stores vertical distances, which must not be clamped.
     if (eProxType == GDT_UInt8 || eProxType == GDT_UInt16 ||
-        eProxType == GDT_UInt32)
+        eProxType == GDT_UInt32 ||
+        (bEDT && eProxType != GDT_Int32 && eProxType != GDT_Int64 &&
+         eProxType != GDT_Float32 && eProxType != GDT_Float64))
     {
         GDALDriverH hDriver = GDALGetDriverByName("GTiff");
         if (hDriver == nullptr)
@@ -278,6 +346,27 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
         hWorkProximityBand = GDALGetRasterBand(hWorkProximityDS, 1);
     }
 
+    if (bEDT)
+    {
+        GDALProximityEDTParams sParams;
+        sParams.nXSize = nXSize;
+        sParams.nYSize = nYSize;
+        sParams.dfMaxDist = dfMaxDist;
+        sParams.dfDistMult = dfDistMult;
+        sParams.pdfSrcNoDataValue = pdfSrcNoData;
+        sParams.fNoDataValue = fNoDataValue;
+        sParams.bFixedBufVal = bFixedBufVal;
+        sParams.dfFixedBufVal = dfFixedBufVal;
+        sParams.nTargetValues = nTargetValues;
+        sParams.panTargetValues = panTargetValues;
+        sParams.nThreads = GDALGetNumThreads(papszOptions, "NUM_THREADS",
+                                             GDAL_DEFAULT_MAX_THREAD_COUNT,
+                                             /* bDefaultAllCPUs = */ false);
+        eErr = ComputeProximityEDT(hSrcBand, hWorkProximityBand, hProximityBand,
+                                   sParams, pfnProgress, pProgressArg);
+        goto end;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Allocate buffer for two scanlines of distances as floats        */
     /*      (the current and last line).                                    */
@@ -575,3 +664,291 @@ static CPLErr ProcessProximityLine(GInt32 *panSrcScanline, int *panNearX,
 
     return CE_None;
 }
+
+/************************************************************************/
+/*                           IsTargetPixel()                            */
+/************************************************************************/
+
+static bool IsTargetPixel(GInt32 nValue, const GDALProximityEDTParams &sParams)
+{
+    if (sParams.nTargetValues == 0)
+        return nValue != 0;
+    for (int i = 0; i < sParams.nTargetValues; i++)
+    {
+        if (nValue == sParams.panTargetValues[i])
+            return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                        ProcessProximityRowEDT()                      */
+/*                                                                      */
+/*      Row pass of the distance transform (Meijster et al., "A         */
+/*      general algorithm for computing distance transforms in linear   */
+/*      time"), from the vertical distance to the nearest target of     */
+/*      each column, or -1 if there is none within MAXDIST.             */
+/************************************************************************/
+
+static void ProcessProximityRowEDT(const GInt32 *panSrcScanline,
+                                   const GInt32 *panVertDist,
+                                   float *pafProximity, GIntBig *panSite,
+                                   GIntBig *panStart,
+                                   const GDALProximityEDTParams &sParams)
+{
+    const int nXSize = sParams.nXSize;
+
+    // Squared distance between pixel iX and the target of column iSite
+    const auto Dist2 = [panVertDist](GIntBig iX, GIntBig iSite)
+    {
+        const GIntBig nVert = panVertDist[iSite];
+        return (iX - iSite) * (iX - iSite) + nVert * nVert;
+    };
+
+    // Lower envelope of the parabolas of the columns with a target:
+    // panSite[k] is nearest for pixels from panStart[k] to panStart[k+1] - 1
+    int k = -1;
+    for (int iX = 0; iX < nXSize; iX++)
+    {
+        if (panVertDist[iX] < 0)
+            continue;
+        while (k >= 0 &&
+               Dist2(panStart[k], panSite[k]) > Dist2(panStart[k], iX))
+            k--;
+        if (k < 0)
+        {
+            k = 0;
+            panSite[0] = iX;
+            panStart[0] = 0;
+        }
+        else
+        {
+            // First pixel for which iX is nearer than panSite[k]
+            const GIntBig nSite = panSite[k];
+            const GIntBig nVertSite = panVertDist[nSite];
+            const GIntBig nVert = panVertDist[iX];
+            const GIntBig nStart =
+                1 + (static_cast<GIntBig>(iX) * iX - nSite * nSite +
+                     nVert * nVert - nVertSite * nVertSite) /
+                        (2 * (iX - nSite));
+            if (nStart < nXSize)
+            {
+                k++;
+                panSite[k] = iX;
+                panStart[k] = nStart;
+            }
+        }
+    }
+
+    const double dfMaxDist2 = sParams.dfMaxDist * sParams.dfMaxDist;
+    for (int iX = nXSize - 1; iX >= 0; iX--)
+    {
+        float fProximity = -1.0f;
+        if (k >= 0)
+        {
+            const GIntBig nDist2 = Dist2(iX, panSite[k]);
+            if (iX == panStart[k])
+                k--;
+            if (nDist2 == 0)
+            {
+                fProximity = 0.0f;
+            }
+            else if ((sParams.pdfSrcNoDataValue == nullptr ||
+                      panSrcScanline[iX] != *sParams.pdfSrcNoDataValue) &&
+                     static_cast<double>(nDist2) <= dfMaxDist2)
+            {
+                fProximity =
+                    static_cast<float>(sqrt(static_cast<double>(nDist2)));
+            }
+        }
+
+        // Final post processing of distances, as in the scanline algorithm
+        if (fProximity < 0.0f)
+            fProximity = sParams.fNoDataValue;
+        else if (fProximity > 0.0f)
+        {
+            if (sParams.bFixedBufVal)
+                fProximity = static_cast<float>(sParams.dfFixedBufVal);
+            else
+                fProximity =
+                    fProximity * static_cast<float>(sParams.dfDistMult);
+        }
+        pafProximity[iX] = fProximity;
+    }
+}
+
+/************************************************************************/
+/*                        ComputeProximityEDT()                         */
+/*                                                                      */
+/*      Exact Euclidean distance transform. A top-down pass stores in   */
+/*      the work band the vertical distance to the nearest target       */
+/*      above each pixel. A bottom-up pass combines it with the         */
+/*      nearest target below, and runs the row pass on batches of       */
+/*      lines, which are independent and split between threads.        */
+/************************************************************************/
+
+static CPLErr ComputeProximityEDT(GDALRasterBandH hSrcBand,
+                                  GDALRasterBandH hWorkProximityBand,
+                                  GDALRasterBandH hProximityBand,
+                                  const GDALProximityEDTParams &sParams,
+                                  GDALProgressFunc pfnProgress,
+                                  void *pProgressArg)
+{
+    const int nXSize = sParams.nXSize;
+    const int nYSize = sParams.nYSize;
+    const int nThreads = std::max(1, std::min(sParams.nThreads, nYSize));
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    const int nBatchLines = std::min(nYSize, 16 * nThreads);
+
+    std::vector<GInt32> anSrc;
+    std::vector<GInt32> anVertDist;
+    std::vector<float> afProximity;
+    std::vector<int> anNearY;
+    // Lower envelope of each thread in the row pass
+    std::vector<GIntBig> anSite;
+    std::vector<GIntBig> anStart;
+    try
+    {
+        anSrc.resize(static_cast<size_t>(nXSize) * nBatchLines);
+        anVertDist.resize(static_cast<size_t>(nXSize) * nBatchLines);
+        afProximity.resize(static_cast<size_t>(nXSize) * nBatchLines);
+        anNearY.resize(nXSize, -1);
+        anSite.resize(static_cast<size_t>(nXSize) * nThreads);
+        anStart.resize(static_cast<size_t>(nXSize) * nThreads);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in GDALComputeProximity()");
+        return CE_Failure;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Loop from top to bottom of the image, storing the vertical      */
+    /*      distance to the nearest target above.                          */
+    /* -------------------------------------------------------------------- */
+    CPLErr eErr = CE_None;
+    for (int iLine = 0; eErr == CE_None && iLine < nYSize; iLine++)
+    {
+        eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iLine, nXSize, 1,
+                            anSrc.data(), nXSize, 1, GDT_Int32, 0, 0);
+        if (eErr != CE_None)
+            break;
+
+        for (int i = 0; i < nXSize; i++)
+        {
+            if (IsTargetPixel(anSrc[i], sParams))
+                anNearY[i] = iLine;
+            afProximity[i] =
+                anNearY[i] >= 0 && iLine - anNearY[i] <= sParams.dfMaxDist
+                    ? static_cast<float>(iLine - anNearY[i])
+                    : -1.0f;
+        }
+
+        eErr = GDALRasterIO(hWorkProximityBand, GF_Write, 0, iLine, nXSize, 1,
+                            afProximity.data(), nXSize, 1, GDT_Float32, 0, 0);
+        if (eErr != CE_None)
+            break;
+
+        if (!pfnProgress(0.5 * (iLine + 1) / static_cast<double>(nYSize), "",
+                         pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Loop from bottom to top of the image, by batches of lines.      */
+    /* -------------------------------------------------------------------- */
+    std::fill(anNearY.begin(), anNearY.end(), -1);
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+    for (int iEndLine = nYSize; eErr == CE_None && iEndLine > 0;
+         iEndLine -= nBatchLines)
+    {
+        const int iStartLine = std::max(0, iEndLine - nBatchLines);
+        const int nLines = iEndLine - iStartLine;
+
+        eErr = GDALRasterIO(hWorkProximityBand, GF_Read, 0, iStartLine, nXSize,
+                            nLines, afProximity.data(), nXSize, nLines,
+                            GDT_Float32, 0, 0);
+        if (eErr == CE_None)
+            eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iStartLine, nXSize,
+                                nLines, anSrc.data(), nXSize, nLines,
+                                GDT_Int32, 0, 0);
+        if (eErr != CE_None)
+            break;
+
+        // Column pass: nearest of the targets above and below
+        for (int iLine = iEndLine - 1; iLine >= iStartLine; iLine--)
+        {
+            const size_t nOffset =
+                static_cast<size_t>(iLine - iStartLine) * nXSize;
+            for (int i = 0; i < nXSize; i++)
+            {
+                if (IsTargetPixel(anSrc[nOffset + i], sParams))
+                    anNearY[i] = iLine;
+                GInt32 nVertDist = static_cast<GInt32>(afProximity[nOffset + i]);
+                if (anNearY[i] >= 0 &&
+                    anNearY[i] - iLine <= sParams.dfMaxDist &&
+                    (nVertDist < 0 || anNearY[i] - iLine < nVertDist))
+                {
+                    nVertDist = anNearY[i] - iLine;
+                }
+                anVertDist[nOffset + i] = nVertDist;
+            }
+        }
+
+        // Row pass
+        const auto ProcessLines =
+            [&anSrc, &anVertDist, &afProximity, &anSite, &anStart, &sParams,
+             nXSize](int iFirst, int iLast, int iThread)
+        {
+            const size_t nThreadOffset = static_cast<size_t>(iThread) * nXSize;
+            for (int i = iFirst; i < iLast; i++)
+            {
+                const size_t nOffset = static_cast<size_t>(i) * nXSize;
+                ProcessProximityRowEDT(
+                    anSrc.data() + nOffset, anVertDist.data() + nOffset,
+                    afProximity.data() + nOffset, anSite.data() + nThreadOffset,
+                    anStart.data() + nThreadOffset, sParams);
+            }
+        };
+
+        if (poJobQueue)
+        {
+            const int nLinesPerJob = (nLines + nThreads - 1) / nThreads;
+            for (int iThread = 0; iThread * nLinesPerJob < nLines; iThread++)
+            {
+                const int iFirst = iThread * nLinesPerJob;
+                const int iLast = std::min(nLines, iFirst + nLinesPerJob);
+                poJobQueue->SubmitJob([&ProcessLines, iFirst, iLast, iThread]
+                                      { ProcessLines(iFirst, iLast, iThread); });
+            }
+            poJobQueue->WaitCompletion();
+        }
+        else
+        {
+            ProcessLines(0, nLines, 0);
+        }
+
+        // Write out results.
+        eErr = GDALRasterIO(hProximityBand, GF_Write, 0, iStartLine, nXSize,
+                            nLines, afProximity.data(), nXSize, nLines,
+                            GDT_Float32, 0, 0);
+        if (eErr != CE_None)
+            break;
+
+        if (!pfnProgress(0.5 + 0.5 * (nYSize - iStartLine) /
+                                   static_cast<double>(nYSize),
+                         "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+
+    return eErr;
+}
@@ -15,12 +15,17 @@
 #include "gdal_alg.h"
 #include "gdal_alg_priv.h"
 
+#include <atomic>
 #include <climits>
+#include <cmath>
 #include <cstddef>
 #include <cstdlib>
 #include <cstring>
 #include <cfloat>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
 #include <vector>
 #include <algorithm>
 
@@ -29,9 +34,11 @@
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -925,6 +932,17 @@ static CPLErr GDALRasterizeGeometriesInternal(
  * with tiled images to be efficient. The auto mode (the default) will chose
  * the algorithm based on input and output properties.
  * </li>
+ * <li>"NUM_THREADS": (GDAL >= 3.13) Number of worker threads, or "ALL_CPUS".
+ * Defaults to 1, or to the value of the GDAL_NUM_THREADS configuration option.
+ * When greater than 1, chunks are burnt concurrently, each of them only
+ * visiting the geometries that intersect it. This only applies to the raster
+ * optim: in OPTIM=AUTO mode, the same heuristics as in single-threaded mode
+ * select it or the vector optim. In that mode, the default chunk size is
+ * divided by the number of threads. Results are identical to the
+ * single-threaded mode.
+ * The transformer must be clonable with GDALCloneTransformer() (which is the
+ * case of the default one), otherwise a single thread is used.
+ * </li>
  * </ul>
  * @param pfnProgress the progress function to report completion.
  * @param pProgressArg callback data for progress function.
@@ -1016,6 +1034,326 @@ CPLErr GDALRasterizeGeometriesInt64(
         pfnProgress, pProgressArg);
 }
 
+/************************************************************************/
+/*                 GDALRasterizeGeometriesMultiThreaded()               */
+/*                                                                      */
+/*      Multi-threaded version of the raster optimized mode. The        */
+/*      pixel-space line range of each geometry is computed once, so    */
+/*      that each chunk only visits the geometries that may touch it.   */
+/*      Chunks are then burnt concurrently, each worker using its own   */
+/*      buffer and transformer. Geometries are still burnt in their     */
+/*      original order within a chunk, so the result is identical to    */
+/*      the single-threaded mode.                                       */
+/************************************************************************/
+
+static CPLErr GDALRasterizeGeometriesMultiThreaded(
+    GDALDataset *poDS, int nBandCount, const int *panBandList, int nGeomCount,
+    const OGRGeometryH *pahGeometries, GDALTransformerFunc pfnTransformer,
+    const std::vector<void *> &apTransformArgs, GDALDataType eBurnValueType,
+    const double *padfGeomBurnValues, const int64_t *panGeomBurnValues,
+    GDALDataType eType, size_t nScanlineBytes, int nYChunkSize,
+    int bAllTouched, GDALBurnValueSrc eBurnValueSource,
+    GDALRasterMergeAlg eMergeAlg, GDALProgressFunc pfnProgress,
+    void *pProgressArg)
+{
+    const int nXSize = poDS->GetRasterXSize();
+    const int nYSize = poDS->GetRasterYSize();
+    const int nThreads = static_cast<int>(apTransformArgs.size());
+    const int nChunks = DIV_ROUND_UP(nYSize, nYChunkSize);
+
+    // Per worker context: a transformer and a chunk buffer. At most nThreads
+    // jobs run at the same time, so a job can always grab a free one.
+    struct WorkerContext
+    {
+        void *pTransformArg = nullptr;
+        GByte *pabyChunkBuf = nullptr;
+    };
+
+    std::vector<WorkerContext> aoContexts(nThreads);
+    std::vector<std::unique_ptr<GByte, VSIFreeReleaser>> apabyBuffers;
+    for (int i = 0; i < nThreads; ++i)
+    {
+        aoContexts[i].pTransformArg = apTransformArgs[i];
+        aoContexts[i].pabyChunkBuf = static_cast<GByte *>(
+            VSI_MALLOC2_VERBOSE(nYChunkSize, nScanlineBytes));
+        if (aoContexts[i].pabyChunkBuf == nullptr)
+            return CE_Failure;
+        apabyBuffers.emplace_back(aoContexts[i].pabyChunkBuf);
+    }
+
+    std::mutex oMutex;
+    std::vector<WorkerContext *> apoFreeContexts;
+    for (auto &oContext : aoContexts)
+        apoFreeContexts.push_back(&oContext);
+
+    const auto AcquireContext = [&]()
+    {
+        std::lock_guard oLock(oMutex);
+        CPLAssert(!apoFreeContexts.empty());
+        auto poContext = apoFreeContexts.back();
+        apoFreeContexts.pop_back();
+        return poContext;
+    };
+    const auto ReleaseContext = [&](WorkerContext *poContext)
+    {
+        std::lock_guard oLock(oMutex);
+        apoFreeContexts.push_back(poContext);
+    };
+
+    std::atomic<bool> bStop = false;
+    std::atomic<bool> bFailed = false;
+    CPLErr eErr = CE_None;
+
+    auto poJobQueue = GDALGetGlobalThreadPool(nThreads)->CreateJobQueue();
+
+    // Run nJobs jobs, reporting progress between dfMin and dfMax according
+    // to the amount of work units (as counted by Job()) done.
+    std::atomic<GIntBig> nWorkDone = 0;
+    const auto RunJobs = [&](int nJobs, GIntBig nTotalWork, double dfMin,
+                             double dfMax, const auto &Job)
+    {
+        nWorkDone = 0;
+        for (int iJob = 0; iJob < nJobs; ++iJob)
+        {
+            poJobQueue->SubmitJob(
+                [&, iJob]
+                {
+                    if (bStop)
+                        return;
+                    auto poContext = AcquireContext();
+                    try
+                    {
+                        if (!Job(iJob, poContext))
+                            bFailed = true;
+                    }
+                    catch (const std::bad_alloc &e)
+                    {
+                        CPLError(CE_Failure, CPLE_OutOfMemory,
+                                 "Out of memory in rasterization: %s",
+                                 e.what());
+                        bFailed = true;
+                    }
+                    catch (const std::exception &e)
+                    {
+                        CPLError(CE_Failure, CPLE_AppDefined,
+                                 "Error in rasterization: %s", e.what());
+                        bFailed = true;
+                    }
+                    if (bFailed)
+                        bStop = true;
+                    ReleaseContext(poContext);
+                });
+        }
+        while (poJobQueue->WaitEvent())
+        {
+            if (!bStop &&
+                !pfnProgress(dfMin + (dfMax - dfMin) *
+                                         static_cast<double>(nWorkDone) /
+                                         static_cast<double>(nTotalWork),
+                             "", pProgressArg))
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                eErr = CE_Failure;
+                bStop = true;
+            }
+        }
+        poJobQueue->WaitCompletion();
+        if (bFailed)
+            eErr = CE_Failure;
+        return eErr == CE_None;
+    };
+
+    pfnProgress(0.0, nullptr, pProgressArg);
+
+    /* -------------------------------------------------------------------- */
+    /*      First pass: compute the range of chunks each geometry may       */
+    /*      touch. A margin of one line is taken on each side to account    */
+    /*      for the rounding done by the low level rasterization functions. */
+    /* -------------------------------------------------------------------- */
+    std::vector<int> anMinChunk(nGeomCount, -1);
+    std::vector<int> anMaxChunk(nGeomCount, -1);
+    const int nGeomJobs = std::min(nGeomCount, 4 * nThreads);
+    if (!RunJobs(
+            nGeomJobs, nGeomCount, 0.0, 0.1,
+            [&](int iJob, WorkerContext *poContext)
+            {
+                const int iStart = static_cast<int>(
+                    static_cast<GIntBig>(nGeomCount) * iJob / nGeomJobs);
+                const int iEnd = static_cast<int>(
+                    static_cast<GIntBig>(nGeomCount) * (iJob + 1) / nGeomJobs);
+                std::vector<double> aPointX;
+                std::vector<double> aPointY;
+                std::vector<double> aPointVariant;
+                std::vector<int> aPartSize;
+                std::vector<int> anSuccess;
+                for (int iShape = iStart; iShape < iEnd && !bStop; ++iShape)
+                {
+                    const OGRGeometry *poShape =
+                        OGRGeometry::FromHandle(pahGeometries[iShape]);
+                    if (poShape == nullptr || poShape->IsEmpty())
+                        continue;
+
+                    aPointX.clear();
+                    aPointY.clear();
+                    aPointVariant.clear();
+                    aPartSize.clear();
+                    GDALCollectRingsFromGeometry(poShape, aPointX, aPointY,
+                                                 aPointVariant, aPartSize,
+                                                 eBurnValueSource);
+                    if (aPointX.empty())
+                        continue;
+
+                    if (pfnTransformer != nullptr)
+                    {
+                        anSuccess.resize(aPointX.size());
+                        pfnTransformer(poContext->pTransformArg, FALSE,
+                                       static_cast<int>(aPointX.size()),
+                                       aPointX.data(), aPointY.data(), nullptr,
+                                       anSuccess.data());
+                    }
+
+                    double dfMinX = aPointX[0];
+                    double dfMaxX = aPointX[0];
+                    double dfMinY = aPointY[0];
+                    double dfMaxY = aPointY[0];
+                    bool bValid = true;
+                    for (size_t i = 0; i < aPointX.size(); ++i)
+                    {
+                        if (!std::isfinite(aPointX[i]) ||
+                            !std::isfinite(aPointY[i]))
+                        {
+                            bValid = false;
+                            break;
+                        }
+                        dfMinX = std::min(dfMinX, aPointX[i]);
+                        dfMaxX = std::max(dfMaxX, aPointX[i]);
+                        dfMinY = std::min(dfMinY, aPointY[i]);
+                        dfMaxY = std::max(dfMaxY, aPointY[i]);
+                    }
+
+                    if (!bValid)
+                    {
+                        // Let the rasterization functions deal with it
+                        anMinChunk[iShape] = 0;
+                        anMaxChunk[iShape] = nChunks - 1;
+                    }
+                    else if (dfMaxX >= -1 && dfMinX <= nXSize + 1 &&
+                             dfMaxY >= -1 && dfMinY <= nYSize + 1)
+                    {
+                        const double dfMinLine =
+                            std::max(0.0, std::floor(dfMinY) - 1);
+                        const double dfMaxLine = std::min<double>(
+                            nYSize - 1, std::floor(dfMaxY) + 1);
+                        anMinChunk[iShape] =
+                            static_cast<int>(dfMinLine) / nYChunkSize;
+                        anMaxChunk[iShape] =
+                            static_cast<int>(dfMaxLine) / nYChunkSize;
+                    }
+                }
+                nWorkDone += iEnd - iStart;
+                return true;
+            }))
+    {
+        return CE_Failure;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Build the list of geometries of each chunk, in their original   */
+    /*      order.                                                          */
+    /* -------------------------------------------------------------------- */
+    std::vector<size_t> anChunkStart(nChunks + 1, 0);
+    for (int iShape = 0; iShape < nGeomCount; ++iShape)
+    {
+        for (int iChunk = anMinChunk[iShape];
+             iChunk >= 0 && iChunk <= anMaxChunk[iShape]; ++iChunk)
+        {
+            ++anChunkStart[iChunk + 1];
+        }
+    }
+    for (int iChunk = 0; iChunk < nChunks; ++iChunk)
+        anChunkStart[iChunk + 1] += anChunkStart[iChunk];
+
+    std::vector<int> anChunkGeoms(anChunkStart[nChunks]);
+    {
+        std::vector<size_t> anChunkPos(anChunkStart.begin(),
+                                       anChunkStart.end() - 1);
+        for (int iShape = 0; iShape < nGeomCount; ++iShape)
+        {
+            for (int iChunk = anMinChunk[iShape];
+                 iChunk >= 0 && iChunk <= anMaxChunk[iShape]; ++iChunk)
+            {
+                anChunkGeoms[anChunkPos[iChunk]++] = iShape;
+            }
+        }
+    }
+    anMinChunk.clear();
+    anMaxChunk.clear();
+
+    /* -------------------------------------------------------------------- */
+    /*      Second pass: burn the chunks.                                   */
+    /* -------------------------------------------------------------------- */
+    std::mutex oIOMutex;
+    RunJobs(
+        nChunks, nYSize, 0.1, 1.0,
+        [&](int iChunk, WorkerContext *poContext)
+        {
+            const int iY = iChunk * nYChunkSize;
+            const int nThisYChunkSize = std::min(nYChunkSize, nYSize - iY);
+            GByte *pabyChunkBuf = poContext->pabyChunkBuf;
+
+            {
+                std::lock_guard oLock(oIOMutex);
+                if (poDS->RasterIO(GF_Read, 0, iY, nXSize, nThisYChunkSize,
+                                   pabyChunkBuf, nXSize, nThisYChunkSize,
+                                   eType, nBandCount, panBandList, 0, 0, 0,
+                                   nullptr) != CE_None)
+                {
+                    return false;
+                }
+            }
+
+            for (size_t i = anChunkStart[iChunk];
+                 i < anChunkStart[iChunk + 1] && !bStop; ++i)
+            {
+                const int iShape = anChunkGeoms[i];
+                gv_rasterize_one_shape(
+                    pabyChunkBuf, 0, iY, nXSize, nThisYChunkSize, nBandCount,
+                    eType, 0, 0, 0, bAllTouched,
+                    OGRGeometry::FromHandle(pahGeometries[iShape]),
+                    eBurnValueType,
+                    padfGeomBurnValues
+                        ? padfGeomBurnValues +
+                              static_cast<size_t>(iShape) * nBandCount
+                        : nullptr,
+                    panGeomBurnValues
+                        ? panGeomBurnValues +
+                              static_cast<size_t>(iShape) * nBandCount
+                        : nullptr,
+                    eBurnValueSource, eMergeAlg, pfnTransformer,
+                    poContext->pTransformArg);
+            }
+            if (bStop)
+                return true;
+
+            {
+                std::lock_guard oLock(oIOMutex);
+                if (poDS->RasterIO(GF_Write, 0, iY, nXSize, nThisYChunkSize,
+                                   pabyChunkBuf, nXSize, nThisYChunkSize,
+                                   eType, nBandCount, panBandList, 0, 0, 0,
+                                   nullptr) != CE_None)
+                {
+                    return false;
+                }
+            }
+            nWorkDone += nThisYChunkSize;
+            return true;
+        });
+
+    if (eErr == CE_None)
+        pfnProgress(1.0, "", pProgressArg);
+    return eErr;
+}
+
 static CPLErr GDALRasterizeGeometriesInternal(
     GDALDatasetH hDS, int nBandCount, const int *panBandList, int nGeomCount,
     const OGRGeometryH *pahGeometries, GDALTransformerFunc pfnTransformer,
@@ -1115,6 +1453,9 @@ static CPLErr GDALRasterizeGeometriesInternal(
     int nXBlockSize, nYBlockSize;
     poBand->GetBlockSize(&nXBlockSize, &nYBlockSize);
 
+    const int nThreads = GDALGetNumThreads(papszOptions, "NUM_THREADS",
+                                           GDAL_DEFAULT_MAX_THREAD_COUNT,
+                                           /* bDefaultAllCPUs = */ false);
     if (eOptim == GRO_Auto)
     {
         eOptim = GRO_Raster;
@@ -1180,6 +1521,69 @@ static CPLErr GDALRasterizeGeometriesInternal(
         if (nYChunkSize > poDS->GetRasterYSize())
             nYChunkSize = poDS->GetRasterYSize();
 
+        /* ------------------------------------------------------------------ */
+        /*      In multi-threaded mode, each worker has its own chunk         */
+        /*      buffer and its own transformer.                               */
+        /* ------------------------------------------------------------------ */
+        std::vector<void *> apTransformArgs;
+        if (nThreads > 1 && poDS->GetRasterYSize() > 1 &&
+            GDALGetGlobalThreadPool(nThreads))
+        {
+            apTransformArgs.push_back(pTransformArg);
+            if (pfnTransformer != nullptr)
+            {
+                CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+                for (int i = 1; i < nThreads; ++i)
+                {
+                    void *pClonedTransformArg =
+                        GDALCloneTransformer(pTransformArg);
+                    if (pClonedTransformArg == nullptr)
+                        break;
+                    apTransformArgs.push_back(pClonedTransformArg);
+                }
+            }
+            if (static_cast<int>(apTransformArgs.size()) < nThreads)
+            {
+                CPLDebug("GDAL", "Cannot clone the transformer. Rasterizing "
+                                 "with a single thread");
+                for (size_t i = 1; i < apTransformArgs.size(); ++i)
+                    GDALDestroyTransformer(apTransformArgs[i]);
+                apTransformArgs.clear();
+            }
+        }
+
+        if (!apTransformArgs.empty())
+        {
+            // Share the chunk budget among workers, and make sure there are
+            // enough chunks to keep all of them busy.
+            if (!CSLFetchNameValue(papszOptions, "CHUNKYSIZE"))
+            {
+                nYChunkSize = std::max(
+                    1, std::min(nYChunkSize / nThreads,
+                                DIV_ROUND_UP(poDS->GetRasterYSize(),
+                                             4 * nThreads)));
+            }
+
+            CPLDebug("GDAL",
+                     "Rasterizer operating on %d swaths of %d scanlines "
+                     "with %d threads.",
+                     DIV_ROUND_UP(poDS->GetRasterYSize(), nYChunkSize),
+                     nYChunkSize, nThreads);
+
+            eErr = GDALRasterizeGeometriesMultiThreaded(
+                poDS, nBandCount, panBandList, nGeomCount, pahGeometries,
+                pfnTransformer, apTransformArgs, eBurnValueType,
+                padfGeomBurnValues, panGeomBurnValues, eType,
+                static_cast<size_t>(nScanlineBytes), nYChunkSize, bAllTouched,
+                eBurnValueSource, eMergeAlg, pfnProgress, pProgressArg);
+
+            for (size_t i = 1; i < apTransformArgs.size(); ++i)
+                GDALDestroyTransformer(apTransformArgs[i]);
+            if (bNeedToFreeTransformer)
+                GDALDestroyTransformer(pTransformArg);
+            return eErr;
+        }
+
         CPLDebug("GDAL", "Rasterizer operating on %d swaths of %d scanlines.",
                  DIV_ROUND_UP(poDS->GetRasterYSize(), nYChunkSize),
                  nYChunkSize);
@@ -17,6 +17,11 @@
 #include <cstring>
 
 #include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
 #include <set>
 #include <vector>
 #include <utility>
@@ -24,9 +29,12 @@
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_progress.h"
+#include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_alg_priv.h"
+#include "gdal_thread_pool.h"
 
 #define MY_MAX_INT 2147483647
 
@@ -47,6 +55,13 @@
  *
  * 5) Make another pass with the polygon enumerator. This time we remap
  *    the actual pixel values of all polygons to be merged.
+ *
+ * In multi-threaded mode, the raster is split in bands of lines, each of
+ * them enumerated independently in passes 1, 3 and 5. The polygon ids of
+ * all bands are then merged across band boundaries after pass 1, and the
+ * largest neighbour candidates of pass 3 are applied in the order in which
+ * the single-threaded mode would have met them, so that the result is the
+ * same.
  */
 
 /************************************************************************/
@@ -125,6 +140,774 @@ static inline void CompareNeighbour(int nPolyId1, int nPolyId2,
         anBigNeighbour[nPolyId2] = nPolyId1;
 }
 
+/************************************************************************/
+/*                       GSResolveBigNeighbours()                       */
+/*                                                                      */
+/*      If our biggest neighbour is still smaller than the              */
+/*      threshold, then try tracking to that polygons biggest           */
+/*      neighbour, and so forth. Only the polygons for which            */
+/*      IsValidPolygon() is true are considered.                        */
+/************************************************************************/
+
+template <class IsValidPolygonFunc>
+static void GSResolveBigNeighbours(const std::vector<int> &anPolySizes,
+                                   std::vector<int> &anBigNeighbour,
+                                   int nSizeThreshold,
+                                   IsValidPolygonFunc IsValidPolygon)
+{
+    int nFailedMerges = 0;
+    int nIsolatedSmall = 0;
+    int nSieveTargets = 0;
+
+    for (int iPoly = 0; iPoly < static_cast<int>(anPolySizes.size()); iPoly++)
+    {
+        // Ignore merged and nodata polygons.
+        if (!IsValidPolygon(iPoly))
+            continue;
+
+        // Don't try to merge polygons larger than the threshold.
+        if (anPolySizes[iPoly] >= nSizeThreshold)
+        {
+            anBigNeighbour[iPoly] = -1;
+            continue;
+        }
+
+        nSieveTargets++;
+
+        // if we have no neighbours but we are small, what shall we do?
+        if (anBigNeighbour[iPoly] == -1)
+        {
+            nIsolatedSmall++;
+            continue;
+        }
+
+        std::set<int> oSetVisitedPoly;
+        oSetVisitedPoly.insert(iPoly);
+
+        // Walk through our neighbours until we find a polygon large enough.
+        int iFinalId = iPoly;
+        bool bFoundBigEnoughPoly = false;
+        while (true)
+        {
+            iFinalId = anBigNeighbour[iFinalId];
+            if (iFinalId < 0)
+            {
+                break;
+            }
+            // If the biggest neighbour is larger than the threshold
+            // then we are golden.
+            if (anPolySizes[iFinalId] >= nSizeThreshold)
+            {
+                bFoundBigEnoughPoly = true;
+                break;
+            }
+            // Check that we don't cycle on an already visited polygon.
+            if (oSetVisitedPoly.find(iFinalId) != oSetVisitedPoly.end())
+                break;
+            oSetVisitedPoly.insert(iFinalId);
+        }
+
+        if (!bFoundBigEnoughPoly)
+        {
+            nFailedMerges++;
+            anBigNeighbour[iPoly] = -1;
+            continue;
+        }
+
+        // Map the whole intermediate chain to it.
+        int iPolyCur = iPoly;
+        while (anBigNeighbour[iPolyCur] != iFinalId)
+        {
+            int iNextPoly = anBigNeighbour[iPolyCur];
+            anBigNeighbour[iPolyCur] = iFinalId;
+            iPolyCur = iNextPoly;
+        }
+    }
+
+    CPLDebug("GDALSieveFilter",
+             "Small Polygons: %d, Isolated: %d, Unmergable: %d", nSieveTargets,
+             nIsolatedSmall, nFailedMerges);
+}
+
+/************************************************************************/
+/*                           GDALSieveBand                              */
+/************************************************************************/
+
+// Minimum number of lines of the row bands processed in parallel
+constexpr int GS_MIN_BAND_HEIGHT = 16;
+
+namespace
+{
+/* Largest neighbour of a polygon, as met in a band of lines */
+struct GDALSieveCandidate
+{
+    GIntBig nEventIdx = 0;  // order in which the neighbour has been met
+    int nPolyId = 0;
+    int nBigNeighbour = 0;
+};
+
+/* Row band processed independently by the multi-threaded implementation */
+struct GDALSieveBand
+{
+    int nFirstLine = 0;
+    int nEndLine = 0;
+    CPLErr eErr = CE_None;
+
+    // First pass: polygon enumeration of the band, polygon sizes, and first
+    // and last lines with their final polygon id in the band.
+    std::unique_ptr<GDALRasterPolygonEnumerator> poEnum{};
+    std::vector<int> anPolySizes{};
+    int nIdOffset = 0;
+    std::vector<std::int64_t> anFirstLineVal{};
+    std::vector<GInt32> anFirstLineId{};
+    std::vector<std::int64_t> anLastLineVal{};
+    std::vector<GInt32> anLastLineId{};
+
+    // Second pass: largest neighbours, ordered by nEventIdx
+    std::vector<GDALSieveCandidate> aoCandidates{};
+};
+}  // namespace
+
+/************************************************************************/
+/*                           GSEnumerateBand()                          */
+/************************************************************************/
+
+template <class ReadLineFunc>
+static void GSEnumerateBand(GDALSieveBand &oBand, int nXSize,
+                            int nConnectedness, ReadLineFunc &ReadLine,
+                            const std::atomic<bool> &bStop)
+{
+    try
+    {
+        oBand.poEnum =
+            std::make_unique<GDALRasterPolygonEnumerator>(nConnectedness);
+        auto &oEnum = *(oBand.poEnum);
+        std::vector<std::int64_t> anLastLineVal(nXSize);
+        std::vector<std::int64_t> anThisLineVal(nXSize);
+        std::vector<GInt32> anLastLineId(nXSize);
+        std::vector<GInt32> anThisLineId(nXSize);
+
+        for (int iY = oBand.nFirstLine; iY < oBand.nEndLine; iY++)
+        {
+            if (bStop || ReadLine(iY, anThisLineVal.data(), nullptr) != CE_None)
+            {
+                oBand.eErr = CE_Failure;
+                return;
+            }
+
+            const bool bFirstLine = iY == oBand.nFirstLine;
+            if (!oEnum.ProcessLine(bFirstLine ? nullptr : anLastLineVal.data(),
+                                   anThisLineVal.data(),
+                                   bFirstLine ? nullptr : anLastLineId.data(),
+                                   anThisLineId.data(), nXSize))
+            {
+                oBand.eErr = CE_Failure;
+                return;
+            }
+
+            if (oEnum.nNextPolygonId > static_cast<int>(oBand.anPolySizes.size()))
+                oBand.anPolySizes.resize(oEnum.nNextPolygonId);
+            for (int iX = 0; iX < nXSize; iX++)
+            {
+                const int iPoly = anThisLineId[iX];
+                if (iPoly >= 0 && oBand.anPolySizes[iPoly] < MY_MAX_INT)
+                    oBand.anPolySizes[iPoly] += 1;
+            }
+
+            if (bFirstLine)
+            {
+                oBand.anFirstLineVal = anThisLineVal;
+                oBand.anFirstLineId = anThisLineId;
+            }
+
+            std::swap(anLastLineVal, anThisLineVal);
+            std::swap(anLastLineId, anThisLineId);
+        }
+
+        oEnum.CompleteMerges();
+
+        oBand.anLastLineVal = std::move(anLastLineVal);
+        oBand.anLastLineId = std::move(anLastLineId);
+        for (auto *panLineId : {&oBand.anFirstLineId, &oBand.anLastLineId})
+        {
+            for (auto &nId : *panLineId)
+            {
+                if (nId >= 0)
+                    nId = oEnum.panPolyIdMap[nId];
+            }
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in GDALSieveFilter()");
+        oBand.eErr = CE_Failure;
+    }
+}
+
+/************************************************************************/
+/*                       GSMergeBandPolygonIds()                        */
+/*                                                                      */
+/*      Assign to the polygons of all bands a global id, merging        */
+/*      those connected across band boundaries, and compute their      */
+/*      sizes and values.                                               */
+/************************************************************************/
+
+static bool GSMergeBandPolygonIds(std::vector<GDALSieveBand> &aoBands,
+                                  int nXSize, int nConnectedness,
+                                  std::vector<int> &anGlobalId,
+                                  std::vector<int> &anPolySizes,
+                                  std::vector<std::int64_t> &anPolyValue)
+{
+    GIntBig nTotalIds = 0;
+    for (auto &oBand : aoBands)
+    {
+        oBand.nIdOffset = static_cast<int>(nTotalIds);
+        nTotalIds += oBand.poEnum->nNextPolygonId;
+        if (nTotalIds > MY_MAX_INT)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "GDALSieveFilter(): maximum number of polygons reached");
+            return false;
+        }
+    }
+
+    try
+    {
+        anGlobalId.resize(static_cast<size_t>(nTotalIds));
+        anPolySizes.resize(static_cast<size_t>(nTotalIds));
+        anPolyValue.resize(static_cast<size_t>(nTotalIds));
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in GDALSieveFilter()");
+        return false;
+    }
+
+    // Union-find where the root of a set is its smallest id
+    std::iota(anGlobalId.begin(), anGlobalId.end(), 0);
+    const auto Find = [&anGlobalId](int nId)
+    {
+        while (anGlobalId[nId] != nId)
+        {
+            anGlobalId[nId] = anGlobalId[anGlobalId[nId]];
+            nId = anGlobalId[nId];
+        }
+        return nId;
+    };
+    const auto Union = [&anGlobalId, &Find](int nId1, int nId2)
+    {
+        const int nRoot1 = Find(nId1);
+        const int nRoot2 = Find(nId2);
+        if (nRoot1 < nRoot2)
+            anGlobalId[nRoot2] = nRoot1;
+        else
+            anGlobalId[nRoot1] = nRoot2;
+    };
+
+    for (size_t iBand = 0; iBand < aoBands.size(); ++iBand)
+    {
+        auto &oBand = aoBands[iBand];
+        const auto &oEnum = *(oBand.poEnum);
+        for (int iPoly = 0; iPoly < oEnum.nNextPolygonId; iPoly++)
+        {
+            if (oEnum.panPolyIdMap[iPoly] != iPoly)
+                Union(oBand.nIdOffset + iPoly,
+                      oBand.nIdOffset + oEnum.panPolyIdMap[iPoly]);
+        }
+
+        if (iBand == 0)
+            continue;
+        const auto &oAbove = aoBands[iBand - 1];
+        for (int i = 0; i < nXSize; i++)
+        {
+            const GInt32 nId = oBand.anFirstLineId[i];
+            if (nId < 0)
+                continue;
+            const int iStart = nConnectedness == 8 ? std::max(0, i - 1) : i;
+            const int iEnd =
+                nConnectedness == 8 ? std::min(nXSize - 1, i + 1) : i;
+            for (int j = iStart; j <= iEnd; j++)
+            {
+                const GInt32 nAboveId = oAbove.anLastLineId[j];
+                if (nAboveId >= 0 &&
+                    oAbove.anLastLineVal[j] == oBand.anFirstLineVal[i])
+                {
+                    Union(oAbove.nIdOffset + nAboveId, oBand.nIdOffset + nId);
+                }
+            }
+        }
+        oBand.anFirstLineVal = std::vector<std::int64_t>();
+        oBand.anFirstLineId = std::vector<GInt32>();
+    }
+
+    // As a parent has always a smaller id than its children, a single pass
+    // maps every id to its root.
+    for (auto &nId : anGlobalId)
+        nId = anGlobalId[nId];
+
+    // Push the sizes of merged polygon fragments into the merged polygon
+    // id's count.
+    for (auto &oBand : aoBands)
+    {
+        const auto &oEnum = *(oBand.poEnum);
+        for (int iPoly = 0; iPoly < oEnum.nNextPolygonId; iPoly++)
+        {
+            const int nId = anGlobalId[oBand.nIdOffset + iPoly];
+            const GIntBig nSize = static_cast<GIntBig>(anPolySizes[nId]) +
+                                  oBand.anPolySizes[iPoly];
+            anPolySizes[nId] = static_cast<int>(
+                std::min<GIntBig>(nSize, MY_MAX_INT));
+            anPolyValue[nId] = oEnum.panPolyValue[iPoly];
+        }
+        oBand.anPolySizes = std::vector<int>();
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                       GSFindBandNeighbours()                         */
+/*                                                                      */
+/*      Second pass over a band: find the largest neighbour of the      */
+/*      polygons, as met in the band.                                   */
+/************************************************************************/
+
+template <class ReadLineFunc>
+static void GSFindBandNeighbours(GDALSieveBand &oBand,
+                                 const GDALSieveBand *poPrevBand, int nXSize,
+                                 int nConnectedness,
+                                 const std::vector<int> &anGlobalId,
+                                 const std::vector<int> &anPolySizes,
+                                 ReadLineFunc &ReadLine,
+                                 const std::atomic<bool> &bStop)
+{
+    try
+    {
+        const auto &oFirstEnum = *(oBand.poEnum);
+        GDALRasterPolygonEnumerator oEnum(nConnectedness);
+        std::vector<std::int64_t> anLastLineVal(nXSize);
+        std::vector<std::int64_t> anThisLineVal(nXSize);
+        std::vector<GInt32> anLastLineId(nXSize);
+        std::vector<GInt32> anThisLineId(nXSize);
+        // Final id of the polygons in the band, and global id
+        std::vector<GInt32> anLastLineBandId(nXSize, -1);
+        std::vector<GInt32> anThisLineBandId(nXSize);
+        std::vector<GInt32> anLastLineGlobalId(nXSize, -1);
+        std::vector<GInt32> anThisLineGlobalId(nXSize);
+
+        // Largest neighbour of the polygons of the band, by final id in the
+        // band, and of those of the last line of the previous band.
+        std::vector<GDALSieveCandidate> aoBandCandidates(
+            oFirstEnum.nNextPolygonId, GDALSieveCandidate{0, -1, -1});
+        std::map<int, GDALSieveCandidate> oPrevBandCandidates;
+
+        if (poPrevBand)
+        {
+            for (int iX = 0; iX < nXSize; iX++)
+            {
+                const GInt32 nId = poPrevBand->anLastLineId[iX];
+                anLastLineGlobalId[iX] =
+                    nId < 0 ? -1 : anGlobalId[poPrevBand->nIdOffset + nId];
+            }
+        }
+
+        const auto UpdateCandidate =
+            [&anPolySizes](GDALSieveCandidate &oCandidate, int nPolyId,
+                           int nNeighbour, GIntBig nEventIdx)
+        {
+            if (oCandidate.nBigNeighbour == -1 ||
+                anPolySizes[oCandidate.nBigNeighbour] < anPolySizes[nNeighbour])
+            {
+                oCandidate.nEventIdx = nEventIdx;
+                oCandidate.nPolyId = nPolyId;
+                oCandidate.nBigNeighbour = nNeighbour;
+            }
+        };
+
+        // Same as CompareNeighbour(), iThis being in the current line
+        GIntBig nEventIdx = 0;
+        const auto Compare = [&](int iThis, int iOther, bool bOtherInLastLine)
+        {
+            ++nEventIdx;
+            const int nPolyId1 = anThisLineGlobalId[iThis];
+            const int nPolyId2 = bOtherInLastLine ? anLastLineGlobalId[iOther]
+                                                  : anThisLineGlobalId[iOther];
+            if (nPolyId1 < 0 || nPolyId2 < 0 || nPolyId1 == nPolyId2)
+                return;
+
+            UpdateCandidate(aoBandCandidates[anThisLineBandId[iThis]],
+                            nPolyId1, nPolyId2, nEventIdx);
+
+            const int nBandId2 = bOtherInLastLine ? anLastLineBandId[iOther]
+                                                  : anThisLineBandId[iOther];
+            if (nBandId2 >= 0)
+            {
+                UpdateCandidate(aoBandCandidates[nBandId2], nPolyId2, nPolyId1,
+                                nEventIdx);
+            }
+            else
+            {
+                auto oIter = oPrevBandCandidates.find(nPolyId2);
+                if (oIter == oPrevBandCandidates.end())
+                    oIter = oPrevBandCandidates
+                                .emplace(nPolyId2,
+                                         GDALSieveCandidate{0, nPolyId2, -1})
+                                .first;
+                UpdateCandidate(oIter->second, nPolyId2, nPolyId1, nEventIdx);
+            }
+        };
+
+        for (int iY = oBand.nFirstLine; iY < oBand.nEndLine; iY++)
+        {
+            if (bStop || ReadLine(iY, anThisLineVal.data(), nullptr) != CE_None)
+            {
+                oBand.eErr = CE_Failure;
+                return;
+            }
+
+            const bool bFirstLine = iY == oBand.nFirstLine;
+            if (!oEnum.ProcessLine(bFirstLine ? nullptr : anLastLineVal.data(),
+                                   anThisLineVal.data(),
+                                   bFirstLine ? nullptr : anLastLineId.data(),
+                                   anThisLineId.data(), nXSize))
+            {
+                oBand.eErr = CE_Failure;
+                return;
+            }
+
+            for (int iX = 0; iX < nXSize; iX++)
+            {
+                const GInt32 nId = anThisLineId[iX];
+                anThisLineBandId[iX] =
+                    nId < 0 ? -1 : oFirstEnum.panPolyIdMap[nId];
+                anThisLineGlobalId[iX] =
+                    nId < 0 ? -1
+                            : anGlobalId[oBand.nIdOffset + anThisLineBandId[iX]];
+            }
+
+            const bool bHasLastLine = iY > 0;
+            for (int iX = 0; iX < nXSize; iX++)
+            {
+                if (bHasLastLine)
+                {
+                    Compare(iX, iX, true);
+                    if (iX > 0 && nConnectedness == 8)
+                        Compare(iX, iX - 1, true);
+                    if (iX < nXSize - 1 && nConnectedness == 8)
+                        Compare(iX, iX + 1, true);
+                }
+                if (iX > 0)
+                    Compare(iX, iX - 1, false);
+            }
+
+            std::swap(anLastLineVal, anThisLineVal);
+            std::swap(anLastLineId, anThisLineId);
+            std::swap(anLastLineBandId, anThisLineBandId);
+            std::swap(anLastLineGlobalId, anThisLineGlobalId);
+        }
+
+        for (const auto &oCandidate : aoBandCandidates)
+        {
+            if (oCandidate.nBigNeighbour >= 0)
+                oBand.aoCandidates.push_back(oCandidate);
+        }
+        for (const auto &oIter : oPrevBandCandidates)
+        {
+            if (oIter.second.nBigNeighbour >= 0)
+                oBand.aoCandidates.push_back(oIter.second);
+        }
+        std::sort(oBand.aoCandidates.begin(), oBand.aoCandidates.end(),
+                  [](const GDALSieveCandidate &a, const GDALSieveCandidate &b)
+                  { return a.nEventIdx < b.nEventIdx; });
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in GDALSieveFilter()");
+        oBand.eErr = CE_Failure;
+    }
+}
+
+/************************************************************************/
+/*                           GSSieveBand()                              */
+/*                                                                      */
+/*      Third pass over a band: apply the merges.                       */
+/************************************************************************/
+
+template <class ReadLineFunc, class WriteLineFunc>
+static void GSSieveBand(GDALSieveBand &oBand, int nXSize, int nConnectedness,
+                        const std::vector<int> &anGlobalId,
+                        const std::vector<int> &anBigNeighbour,
+                        const std::vector<std::int64_t> &anPolyValue,
+                        ReadLineFunc &ReadLine, WriteLineFunc &WriteLine,
+                        const std::atomic<bool> &bStop)
+{
+    try
+    {
+        const auto &oFirstEnum = *(oBand.poEnum);
+        GDALRasterPolygonEnumerator oEnum(nConnectedness);
+        std::vector<std::int64_t> anLastLineVal(nXSize);
+        std::vector<std::int64_t> anThisLineVal(nXSize);
+        std::vector<GInt32> anLastLineId(nXSize);
+        std::vector<GInt32> anThisLineId(nXSize);
+        std::vector<std::int64_t> anThisLineWriteVal(nXSize);
+
+        for (int iY = oBand.nFirstLine; iY < oBand.nEndLine; iY++)
+        {
+            if (bStop || ReadLine(iY, anThisLineVal.data(),
+                                  anThisLineWriteVal.data()) != CE_None)
+            {
+                oBand.eErr = CE_Failure;
+                return;
+            }
+
+            const bool bFirstLine = iY == oBand.nFirstLine;
+            if (!oEnum.ProcessLine(bFirstLine ? nullptr : anLastLineVal.data(),
+                                   anThisLineVal.data(),
+                                   bFirstLine ? nullptr : anLastLineId.data(),
+                                   anThisLineId.data(), nXSize))
+            {
+                oBand.eErr = CE_Failure;
+                return;
+            }
+
+            for (int iX = 0; iX < nXSize; iX++)
+            {
+                const GInt32 nId = anThisLineId[iX];
+                if (nId >= 0)
+                {
+                    const int iThisPoly =
+                        anGlobalId[oBand.nIdOffset +
+                                   oFirstEnum.panPolyIdMap[nId]];
+                    if (anBigNeighbour[iThisPoly] != -1)
+                    {
+                        anThisLineWriteVal[iX] =
+                            anPolyValue[anBigNeighbour[iThisPoly]];
+                    }
+                }
+            }
+
+            if (WriteLine(iY, anThisLineWriteVal.data()) != CE_None)
+            {
+                oBand.eErr = CE_Failure;
+                return;
+            }
+
+            std::swap(anLastLineVal, anThisLineVal);
+            std::swap(anLastLineId, anThisLineId);
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in GDALSieveFilter()");
+        oBand.eErr = CE_Failure;
+    }
+}
+
+/************************************************************************/
+/*                    GDALSieveFilterMultiThreaded()                    */
+/*                                                                      */
+/*      The raster is split in bands of lines processed by jobs of      */
+/*      the global thread pool, for each of the three passes.           */
+/************************************************************************/
+
+static CPLErr GDALSieveFilterMultiThreaded(
+    GDALRasterBandH hSrcBand, GDALRasterBandH hMaskBand,
+    GDALRasterBandH hDstBand, int nSizeThreshold, int nConnectedness,
+    int nThreads, GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poThreadPool)
+        return CE_Failure;
+
+    const int nXSize = GDALGetRasterBandXSize(hSrcBand);
+    const int nYSize = GDALGetRasterBandYSize(hSrcBand);
+
+    // Enough bands to balance the load between threads, while keeping them
+    // high enough for the cost of merging boundaries to be negligible.
+    const int nBandHeight = std::max(
+        GS_MIN_BAND_HEIGHT, static_cast<int>((static_cast<GIntBig>(nYSize) +
+                                              16 * nThreads - 1) /
+                                             (16 * nThreads)));
+    const int nBands = (nYSize + nBandHeight - 1) / nBandHeight;
+    std::vector<GDALSieveBand> aoBands(nBands);
+    for (int iBand = 0; iBand < nBands; ++iBand)
+    {
+        aoBands[iBand].nFirstLine = iBand * nBandHeight;
+        aoBands[iBand].nEndLine = std::min(nYSize, (iBand + 1) * nBandHeight);
+    }
+    CPLDebug("GDALSieveFilter", "Using %d threads on %d bands of %d lines",
+             nThreads, nBands, nBandHeight);
+
+    // Datasets are not thread-safe: serialize I/O. The values before masking
+    // are returned in panUnmaskedVal if not null.
+    std::mutex oIOMutex;
+    auto ReadLine = [hSrcBand, hMaskBand, nXSize,
+                     &oIOMutex](int iY, std::int64_t *panLineVal,
+                                std::int64_t *panUnmaskedVal)
+    {
+        std::vector<GByte> abyMaskLine;
+        if (hMaskBand)
+            abyMaskLine.resize(nXSize);
+        std::lock_guard oLock(oIOMutex);
+        CPLErr eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iY, nXSize, 1,
+                                   panLineVal, nXSize, 1, GDT_Int64, 0, 0);
+        if (eErr == CE_None && panUnmaskedVal)
+            memcpy(panUnmaskedVal, panLineVal, sizeof(*panLineVal) * nXSize);
+        if (eErr == CE_None && hMaskBand != nullptr)
+            eErr = GPMaskImageData(hMaskBand, abyMaskLine.data(), iY, nXSize,
+                                   panLineVal);
+        return eErr;
+    };
+    auto WriteLine = [hDstBand, nXSize, &oIOMutex](int iY,
+                                                   std::int64_t *panLineVal)
+    {
+        std::lock_guard oLock(oIOMutex);
+        return GDALRasterIO(hDstBand, GF_Write, 0, iY, nXSize, 1, panLineVal,
+                            nXSize, 1, GDT_Int64, 0, 0);
+    };
+
+    std::atomic<bool> bStop{false};
+    std::atomic<int> nBandsDone{0};
+    CPLErr eErr = CE_None;
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+
+    // Run a pass on all bands, reporting progress between dfMin and dfMax
+    const auto RunPass = [&](double dfMin, double dfMax, const auto &Job)
+    {
+        nBandsDone = 0;
+        for (int iBand = 0; iBand < nBands; ++iBand)
+        {
+            poJobQueue->SubmitJob(
+                [&Job, &nBandsDone, iBand]
+                {
+                    Job(iBand);
+                    ++nBandsDone;
+                });
+        }
+        while (poJobQueue->WaitEvent())
+        {
+            if (eErr == CE_None &&
+                !pfnProgress(dfMin + (dfMax - dfMin) * nBandsDone / nBands, "",
+                             pProgressArg))
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                eErr = CE_Failure;
+                bStop = true;
+            }
+        }
+        poJobQueue->WaitCompletion();
+        for (const auto &oBand : aoBands)
+        {
+            if (oBand.eErr != CE_None)
+                eErr = CE_Failure;
+        }
+        return eErr == CE_None;
+    };
+
+    /* -------------------------------------------------------------------- */
+    /*      First pass: enumerate the polygons of each band, and merge      */
+    /*      them across band boundaries.                                    */
+    /* -------------------------------------------------------------------- */
+    std::vector<int> anGlobalId;
+    std::vector<int> anPolySizes;
+    std::vector<std::int64_t> anPolyValue;
+    if (!RunPass(0.0, 0.25,
+                 [&](int iBand)
+                 {
+                     GSEnumerateBand(aoBands[iBand], nXSize, nConnectedness,
+                                     ReadLine, bStop);
+                 }) ||
+        !GSMergeBandPolygonIds(aoBands, nXSize, nConnectedness, anGlobalId,
+                               anPolySizes, anPolyValue))
+    {
+        return CE_Failure;
+    }
+
+    if (anGlobalId.empty())
+    {
+        // Can happen if all pixels are masked
+        if (hSrcBand == hDstBand)
+        {
+            pfnProgress(1.0, "", pProgressArg);
+            return CE_None;
+        }
+        else
+        {
+            return GDALRasterBandCopyWholeRaster(hSrcBand, hDstBand, nullptr,
+                                                 pfnProgress, pProgressArg);
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Second pass: identify the largest neighbour for each polygon.   */
+    /*      Candidates are applied in the order in which a sequential       */
+    /*      scan meets them.                                                */
+    /* -------------------------------------------------------------------- */
+    if (!RunPass(0.25, 0.5,
+                 [&](int iBand)
+                 {
+                     GSFindBandNeighbours(
+                         aoBands[iBand],
+                         iBand > 0 ? &aoBands[iBand - 1] : nullptr, nXSize,
+                         nConnectedness, anGlobalId, anPolySizes, ReadLine,
+                         bStop);
+                 }))
+    {
+        return CE_Failure;
+    }
+
+    std::vector<int> anBigNeighbour;
+    try
+    {
+        anBigNeighbour.resize(anPolySizes.size(), -1);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s: Out of memory",
+                 __FUNCTION__);
+        return CE_Failure;
+    }
+    for (auto &oBand : aoBands)
+    {
+        for (const auto &oCandidate : oBand.aoCandidates)
+        {
+            int &nBigNeighbour = anBigNeighbour[oCandidate.nPolyId];
+            if (nBigNeighbour == -1 || anPolySizes[nBigNeighbour] <
+                                           anPolySizes[oCandidate.nBigNeighbour])
+                nBigNeighbour = oCandidate.nBigNeighbour;
+        }
+        oBand.aoCandidates = std::vector<GDALSieveCandidate>();
+        oBand.anLastLineVal = std::vector<std::int64_t>();
+        oBand.anLastLineId = std::vector<GInt32>();
+    }
+
+    GSResolveBigNeighbours(
+        anPolySizes, anBigNeighbour, nSizeThreshold,
+        [&anGlobalId, &anPolyValue](int iPoly) {
+            return anGlobalId[iPoly] == iPoly &&
+                   anPolyValue[iPoly] != GP_NODATA_MARKER;
+        });
+
+    /* -------------------------------------------------------------------- */
+    /*      Third pass: apply the merges.                                   */
+    /* -------------------------------------------------------------------- */
+    RunPass(0.5, 1.0,
+            [&](int iBand)
+            {
+                GSSieveBand(aoBands[iBand], nXSize, nConnectedness, anGlobalId,
+                            anBigNeighbour, anPolyValue, ReadLine, WriteLine,
+                            bStop);
+            });
+    if (eErr == CE_None)
+        pfnProgress(1.0, "", pProgressArg);
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                          GDALSieveFilter()                           */
 /************************************************************************/
@@ -166,8 +949,15 @@ static inline void CompareNeighbour(int nPolyId1, int nPolyId2,
  * @param nConnectedness either 4 indicating that diagonal pixels are not
  * considered directly adjacent for polygon membership purposes or 8
  * indicating they are.
- * @param papszOptions algorithm options in name=value list form.  None
- * currently supported.
+ * @param papszOptions algorithm options in name=value list form. The
+ * following options are supported:
+ * <ul>
+ * <li>NUM_THREADS=number_of_threads or ALL_CPUS: (GDAL >= 3.13) Number of
+ * worker threads. When greater than 1, the raster is split in bands of lines
+ * that are processed in parallel. The result is the same as in
+ * single-threaded mode. Defaults to the GDAL_NUM_THREADS configuration
+ * option, or 1.</li>
+ * </ul>
  * @param pfnProgress callback for reporting algorithm progress matching the
  * GDALProgressFunc() semantics.  May be NULL.
  * @param pProgressArg callback argument passed to pfnProgress.
@@ -178,8 +968,7 @@ static inline void CompareNeighbour(int nPolyId1, int nPolyId2,
 CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
                                    GDALRasterBandH hMaskBand,
                                    GDALRasterBandH hDstBand, int nSizeThreshold,
-                                   int nConnectedness,
-                                   CPL_UNUSED char **papszOptions,
+                                   int nConnectedness, char **papszOptions,
                                    GDALProgressFunc pfnProgress,
                                    void *pProgressArg)
 {
@@ -189,11 +978,25 @@ CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
     if (pfnProgress == nullptr)
         pfnProgress = GDALDummyProgress;
 
+    int nXSize = GDALGetRasterBandXSize(hSrcBand);
+    int nYSize = GDALGetRasterBandYSize(hSrcBand);
+
+    /* -------------------------------------------------------------------- */
+    /*      Process bands of lines in parallel if asked to.                 */
+    /* -------------------------------------------------------------------- */
+    const int nThreads = GDALGetNumThreads(papszOptions, "NUM_THREADS",
+                                           GDAL_DEFAULT_MAX_THREAD_COUNT,
+                                           /* bDefaultAllCPUs = */ false);
+    if (nThreads > 1 && nYSize >= 2 * GS_MIN_BAND_HEIGHT)
+    {
+        return GDALSieveFilterMultiThreaded(hSrcBand, hMaskBand, hDstBand,
+                                            nSizeThreshold, nConnectedness,
+                                            nThreads, pfnProgress, pProgressArg);
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Allocate working buffers.                                       */
     /* -------------------------------------------------------------------- */
-    int nXSize = GDALGetRasterBandXSize(hSrcBand);
-    int nYSize = GDALGetRasterBandYSize(hSrcBand);
     auto panLastLineValKeeper = std::unique_ptr<std::int64_t, VSIFreeReleaser>(
         static_cast<std::int64_t *>(
             VSI_MALLOC2_VERBOSE(sizeof(std::int64_t), nXSize)));
@@ -468,81 +1271,13 @@ CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
     /*      threshold, then try tracking to that polygons biggest           */
     /*      neighbour, and so forth.                                        */
     /* -------------------------------------------------------------------- */
-    int nFailedMerges = 0;
-    int nIsolatedSmall = 0;
-    int nSieveTargets = 0;
-
-    for (int iPoly = 0; iPoly < static_cast<int>(anPolySizes.size()); iPoly++)
-    {
-        if (oFirstEnum.panPolyIdMap[iPoly] != iPoly)
-            continue;
-
-        // Ignore nodata polygons.
-        if (oFirstEnum.panPolyValue[iPoly] == GP_NODATA_MARKER)
-            continue;
-
-        // Don't try to merge polygons larger than the threshold.
-        if (anPolySizes[iPoly] >= nSizeThreshold)
-        {
-            anBigNeighbour[iPoly] = -1;
-            continue;
-        }
-
-        nSieveTargets++;
-
-        // if we have no neighbours but we are small, what shall we do?
-        if (anBigNeighbour[iPoly] == -1)
+    GSResolveBigNeighbours(
+        anPolySizes, anBigNeighbour, nSizeThreshold,
+        [&oFirstEnum](int iPoly)
         {
-            nIsolatedSmall++;
-            continue;
-        }
-
-        std::set<int> oSetVisitedPoly;
-        oSetVisitedPoly.insert(iPoly);
-
-        // Walk through our neighbours until we find a polygon large enough.
-        int iFinalId = iPoly;
-        bool bFoundBigEnoughPoly = false;
-        while (true)
-        {
-            iFinalId = anBigNeighbour[iFinalId];
-            if (iFinalId < 0)
-            {
-                break;
-            }
-            // If the biggest neighbour is larger than the threshold
-            // then we are golden.
-            if (anPolySizes[iFinalId] >= nSizeThreshold)
-            {
-                bFoundBigEnoughPoly = true;
-                break;
-            }
-            // Check that we don't cycle on an already visited polygon.
-            if (oSetVisitedPoly.find(iFinalId) != oSetVisitedPoly.end())
-                break;
-            oSetVisitedPoly.insert(iFinalId);
-        }
-
-        if (!bFoundBigEnoughPoly)
-        {
-            nFailedMerges++;
-            anBigNeighbour[iPoly] = -1;
-            continue;
-        }
-
-        // Map the whole intermediate chain to it.
-        int iPolyCur = iPoly;
-        while (anBigNeighbour[iPolyCur] != iFinalId)
-        {
-            int iNextPoly = anBigNeighbour[iPolyCur];
-            anBigNeighbour[iPolyCur] = iFinalId;
-            iPolyCur = iNextPoly;
-        }
-    }
-
-    CPLDebug("GDALSieveFilter",
-             "Small Polygons: %d, Isolated: %d, Unmergable: %d", nSieveTargets,
-             nIsolatedSmall, nFailedMerges);
+            return oFirstEnum.panPolyIdMap[iPoly] == iPoly &&
+                   oFirstEnum.panPolyValue[iPoly] != GP_NODATA_MARKER;
+        });
 
     /* ==================================================================== */
     /*      Make a third pass over the image, actually applying the         */
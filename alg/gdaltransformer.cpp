@@ -26,7 +26,9 @@
 
 #include <algorithm>
 #include <limits>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -3898,6 +3900,105 @@ static void *GDALDeserializeReprojectionTransformer(CPLXMLNode *psTree)
 /* ==================================================================== */
 /************************************************************************/
 
+/************************************************************************/
+/*                       GDALApproxTransformGrid                        */
+/************************************************************************/
+
+// Cache of the 2-D grid mode of the approximate transformer: exact
+// transformation of the nodes of a grid laid over the destination pixel/line
+// space, and status of its cells, possibly recursively split in 4 when
+// bilinear interpolation of their corners is not accurate enough.
+struct GDALApproxTransformGrid
+{
+    struct Node
+    {
+        double x = 0;
+        double y = 0;
+        double z = 0;
+        bool bSuccess = false;
+    };
+
+    enum class CellStatus : GByte
+    {
+        INTERPOLATE,
+        EXACT,
+        SPLIT
+    };
+
+    // Cells are not split below that size, in pixels
+    static constexpr int MIN_STEP = 4;
+
+    // Above that number of cached nodes, the cache is reset
+    static constexpr size_t MAX_NODES = 1024 * 1024;
+
+    int nStep = 0;
+    std::unordered_map<std::uint64_t, Node> oMapNodes{};
+    // Indexed by split level
+    std::vector<std::unordered_map<std::uint64_t, CellStatus>> aoMapCells{};
+
+    explicit GDALApproxTransformGrid(int nStepIn)
+        : nStep(std::max(MIN_STEP, nStepIn))
+    {
+        int nLevels = 1;
+        for (int nCellStep = nStep; CanSplit(nCellStep); nCellStep /= 2)
+            ++nLevels;
+        aoMapCells.resize(nLevels);
+    }
+
+    static bool CanSplit(int nCellStep)
+    {
+        return (nCellStep % 2) == 0 && nCellStep / 2 >= MIN_STEP;
+    }
+
+    static std::uint64_t GetKey(int nX, int nY)
+    {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(nX))
+                << 32) |
+               static_cast<std::uint32_t>(nY);
+    }
+
+    void Reset()
+    {
+        oMapNodes.clear();
+        for (auto &oMapCells : aoMapCells)
+            oMapCells.clear();
+    }
+};
+
+/************************************************************************/
+/*                  GDALApproxTransformerSetGridStep()                  */
+/************************************************************************/
+
+/**
+ * Enable or disable the 2-D grid mode of an approximate transformer.
+ *
+ * In that mode, destination to source transformations are computed by
+ * bilinear interpolation in the cells of a grid laid over the destination
+ * pixel/line space, whose nodes are transformed with the exact transformer
+ * only once, and cached. Each cell is checked against the exact transformation
+ * of its center and of the middle of its edges, and recursively split in 4
+ * while the error is above the maximum reverse error, down to cells of 4
+ * pixels, below which points are transformed with the exact transformer.
+ *
+ * This is only appropriate when destination coordinates are pixel/line
+ * coordinates, as in the warper.
+ *
+ * @param hTransformArg approximate transformer.
+ * @param nGridStep size of the cells of the grid, in pixels, or 0 to disable
+ * the 2-D grid mode.
+ */
+
+void GDALApproxTransformerSetGridStep(void *hTransformArg, int nGridStep)
+{
+    GDALApproxTransformInfo *psATInfo =
+        static_cast<GDALApproxTransformInfo *>(hTransformArg);
+
+    delete psATInfo->poGrid;
+    psATInfo->poGrid = nullptr;
+    if (nGridStep > 0)
+        psATInfo->poGrid = new GDALApproxTransformGrid(nGridStep);
+}
+
 /************************************************************************/
 /*                 GDALCreateSimilarApproxTransformer()                 */
 /************************************************************************/
@@ -3924,6 +4025,8 @@ static void *GDALCreateSimilarApproxTransformer(void *hTransformArg,
             psInfo->pfnBaseTransformer, pBaseCBData, psInfo->dfMaxErrorForward,
             psInfo->dfMaxErrorReverse));
     psClonedInfo->bOwnSubtransformer = TRUE;
+    if (psInfo->poGrid)
+        GDALApproxTransformerSetGridStep(psClonedInfo, psInfo->poGrid->nStep);
 
     return psClonedInfo;
 }
@@ -3960,6 +4063,13 @@ static CPLXMLNode *GDALSerializeApproxTransformer(void *pTransformArg)
             CPLString().Printf("%g", psInfo->dfMaxErrorReverse));
     }
 
+    if (psInfo->poGrid)
+    {
+        CPLCreateXMLElementAndValue(
+            psTree, "GridStep",
+            CPLString().Printf("%d", psInfo->poGrid->nStep));
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Capture underlying transformer.                                 */
     /* -------------------------------------------------------------------- */
@@ -4087,6 +4197,7 @@ void GDALDestroyApproxTransformer(void *pCBData)
     if (psATInfo->bOwnSubtransformer)
         GDALDestroyTransformer(psATInfo->pBaseCBData);
 
+    delete psATInfo->poGrid;
     delete psATInfo;
 }
 
@@ -4104,6 +4215,10 @@ void GDALRefreshApproxTransformer(void *hTransformArg)
     {
         GDALRefreshGenImgProjTransformer(psInfo->pBaseCBData);
     }
+
+    // The cached grid nodes are no longer valid
+    if (psInfo->poGrid)
+        psInfo->poGrid->Reset();
 }
 
 /************************************************************************/
@@ -4358,6 +4473,250 @@ static int GDALApproxTransformInternal(void *pCBData, int bDstToSrc,
     return TRUE;
 }
 
+/************************************************************************/
+/*                     GDALApproxGridComputeNodes()                     */
+/************************************************************************/
+
+// Make sure that the exact transformation of the passed grid nodes is cached
+static void GDALApproxGridComputeNodes(GDALApproxTransformInfo *psATInfo,
+                                       int nNodes, const int *panX,
+                                       const int *panY)
+{
+    constexpr int MAX_NODES_PER_CALL = 9;
+    CPLAssert(nNodes <= MAX_NODES_PER_CALL);
+    auto &oMapNodes = psATInfo->poGrid->oMapNodes;
+
+    double adfX[MAX_NODES_PER_CALL] = {};
+    double adfY[MAX_NODES_PER_CALL] = {};
+    double adfZ[MAX_NODES_PER_CALL] = {};
+    int anSuccess[MAX_NODES_PER_CALL] = {};
+    std::uint64_t anKeys[MAX_NODES_PER_CALL] = {};
+    int nToCompute = 0;
+    for (int i = 0; i < nNodes; ++i)
+    {
+        const auto nKey = GDALApproxTransformGrid::GetKey(panX[i], panY[i]);
+        if (oMapNodes.find(nKey) != oMapNodes.end() ||
+            std::find(anKeys, anKeys + nToCompute, nKey) != anKeys + nToCompute)
+        {
+            continue;
+        }
+        anKeys[nToCompute] = nKey;
+        adfX[nToCompute] = panX[i];
+        adfY[nToCompute] = panY[i];
+        ++nToCompute;
+    }
+    if (nToCompute == 0)
+        return;
+
+    const int bSuccess = psATInfo->pfnBaseTransformer(
+        psATInfo->pBaseCBData, TRUE, nToCompute, adfX, adfY, adfZ, anSuccess);
+    for (int i = 0; i < nToCompute; ++i)
+    {
+        GDALApproxTransformGrid::Node sNode;
+        sNode.x = adfX[i];
+        sNode.y = adfY[i];
+        sNode.z = adfZ[i];
+        sNode.bSuccess = bSuccess && anSuccess[i] && std::isfinite(adfX[i]) &&
+                         std::isfinite(adfY[i]) && std::isfinite(adfZ[i]);
+        oMapNodes[anKeys[i]] = sNode;
+    }
+}
+
+/************************************************************************/
+/*                     GDALApproxGridEvaluateCell()                     */
+/************************************************************************/
+
+// Check whether bilinear interpolation of the corners of a grid cell is
+// within the error threshold, by comparing it to the exact transformation
+// of the middle of its edges and of its center.
+static GDALApproxTransformGrid::CellStatus
+GDALApproxGridEvaluateCell(GDALApproxTransformInfo *psATInfo, int nX0,
+                           int nY0, int nStep)
+{
+    using CellStatus = GDALApproxTransformGrid::CellStatus;
+
+    const int nX1 = nX0 + nStep;
+    const int nY1 = nY0 + nStep;
+    const int nXMid = nX0 + nStep / 2;
+    const int nYMid = nY0 + nStep / 2;
+    // Corners first (top-left, top-right, bottom-left, bottom-right), then
+    // check points.
+    const int anX[] = {nX0, nX1, nX0, nX1, nXMid, nX0, nX1, nXMid, nXMid};
+    const int anY[] = {nY0, nY0, nY1, nY1, nY0, nYMid, nYMid, nY1, nYMid};
+    constexpr int nNodes = static_cast<int>(CPL_ARRAYSIZE(anX));
+    GDALApproxGridComputeNodes(psATInfo, nNodes, anX, anY);
+
+    const CellStatus eStatusIfInaccurate =
+        GDALApproxTransformGrid::CanSplit(nStep) ? CellStatus::SPLIT
+                                                 : CellStatus::EXACT;
+    const auto &oMapNodes = psATInfo->poGrid->oMapNodes;
+    const GDALApproxTransformGrid::Node *apsNodes[nNodes] = {};
+    for (int i = 0; i < nNodes; ++i)
+    {
+        apsNodes[i] =
+            &(oMapNodes.find(GDALApproxTransformGrid::GetKey(anX[i], anY[i]))
+                  ->second);
+        if (!apsNodes[i]->bSuccess)
+            return eStatusIfInaccurate;
+    }
+
+    const double dfMaxError = psATInfo->dfMaxErrorReverse;
+    for (int i = 4; i < nNodes; ++i)
+    {
+        const double dfU = static_cast<double>(anX[i] - nX0) / nStep;
+        const double dfV = static_cast<double>(anY[i] - nY0) / nStep;
+        const double dfX = (1 - dfV) * ((1 - dfU) * apsNodes[0]->x +
+                                        dfU * apsNodes[1]->x) +
+                           dfV * ((1 - dfU) * apsNodes[2]->x +
+                                  dfU * apsNodes[3]->x);
+        const double dfY = (1 - dfV) * ((1 - dfU) * apsNodes[0]->y +
+                                        dfU * apsNodes[1]->y) +
+                           dfV * ((1 - dfU) * apsNodes[2]->y +
+                                  dfU * apsNodes[3]->y);
+        const double dfError =
+            fabs(dfX - apsNodes[i]->x) + fabs(dfY - apsNodes[i]->y);
+        if (!(dfError <= dfMaxError))
+            return eStatusIfInaccurate;
+    }
+
+    return CellStatus::INTERPOLATE;
+}
+
+/************************************************************************/
+/*                     GDALApproxGridGetLeafCell()                      */
+/************************************************************************/
+
+// Descend from the top-level grid cell to the leaf cell containing the
+// passed point, evaluating cells on the fly, and return the leaf status.
+static GDALApproxTransformGrid::CellStatus
+GDALApproxGridGetLeafCell(GDALApproxTransformInfo *psATInfo, double dfX,
+                          double dfY, int &nX0, int &nY0, int &nStep)
+{
+    GDALApproxTransformGrid *poGrid = psATInfo->poGrid;
+    nStep = poGrid->nStep;
+    for (size_t iLevel = 0;; ++iLevel)
+    {
+        nX0 = static_cast<int>(std::floor(dfX / nStep)) * nStep;
+        nY0 = static_cast<int>(std::floor(dfY / nStep)) * nStep;
+        auto &oMapCells = poGrid->aoMapCells[iLevel];
+        const auto nKey = GDALApproxTransformGrid::GetKey(nX0, nY0);
+        auto oIter = oMapCells.find(nKey);
+        if (oIter == oMapCells.end())
+        {
+            const auto eStatus =
+                GDALApproxGridEvaluateCell(psATInfo, nX0, nY0, nStep);
+            oIter = oMapCells.emplace(nKey, eStatus).first;
+        }
+        if (oIter->second != GDALApproxTransformGrid::CellStatus::SPLIT)
+            return oIter->second;
+        nStep /= 2;
+    }
+}
+
+/************************************************************************/
+/*                     GDALApproxTransformGrid2D()                      */
+/************************************************************************/
+
+// Destination to source transformation in 2-D grid mode
+static int GDALApproxTransformGrid2D(GDALApproxTransformInfo *psATInfo,
+                                     int nPoints, double *x, double *y,
+                                     double *z, int *panSuccess)
+{
+    using CellStatus = GDALApproxTransformGrid::CellStatus;
+    GDALApproxTransformGrid *poGrid = psATInfo->poGrid;
+
+    if (poGrid->oMapNodes.size() > GDALApproxTransformGrid::MAX_NODES)
+        poGrid->Reset();
+
+    // Keep away from the limits of the integer grid node coordinates
+    constexpr double MAX_COORD = 1e9;
+
+    // Leaf cell containing the last interpolated point
+    int nLeafX0 = 0;
+    int nLeafY0 = 0;
+    int nLeafStep = 0;
+    CellStatus eLeafStatus = CellStatus::EXACT;
+    const GDALApproxTransformGrid::Node *apsCorners[4] = {};
+
+    std::vector<int> anExactIdx;
+    for (int i = 0; i < nPoints; ++i)
+    {
+        const double dfX = x[i];
+        const double dfY = y[i];
+        if (z[i] != 0 || !(fabs(dfX) < MAX_COORD) || !(fabs(dfY) < MAX_COORD))
+        {
+            anExactIdx.push_back(i);
+            continue;
+        }
+
+        if (nLeafStep == 0 || !(dfX >= nLeafX0 && dfX < nLeafX0 + nLeafStep &&
+                                dfY >= nLeafY0 && dfY < nLeafY0 + nLeafStep))
+        {
+            eLeafStatus = GDALApproxGridGetLeafCell(
+                psATInfo, dfX, dfY, nLeafX0, nLeafY0, nLeafStep);
+            if (eLeafStatus == CellStatus::INTERPOLATE)
+            {
+                const int anX[] = {nLeafX0, nLeafX0 + nLeafStep, nLeafX0,
+                                   nLeafX0 + nLeafStep};
+                const int anY[] = {nLeafY0, nLeafY0, nLeafY0 + nLeafStep,
+                                   nLeafY0 + nLeafStep};
+                for (int j = 0; j < 4; ++j)
+                {
+                    apsCorners[j] = &(poGrid->oMapNodes
+                                          .find(GDALApproxTransformGrid::GetKey(
+                                              anX[j], anY[j]))
+                                          ->second);
+                }
+            }
+        }
+
+        if (eLeafStatus == CellStatus::EXACT)
+        {
+            anExactIdx.push_back(i);
+            continue;
+        }
+
+        const double dfU = (dfX - nLeafX0) / nLeafStep;
+        const double dfV = (dfY - nLeafY0) / nLeafStep;
+        const double dfW00 = (1 - dfU) * (1 - dfV);
+        const double dfW10 = dfU * (1 - dfV);
+        const double dfW01 = (1 - dfU) * dfV;
+        const double dfW11 = dfU * dfV;
+        x[i] = dfW00 * apsCorners[0]->x + dfW10 * apsCorners[1]->x +
+               dfW01 * apsCorners[2]->x + dfW11 * apsCorners[3]->x;
+        y[i] = dfW00 * apsCorners[0]->y + dfW10 * apsCorners[1]->y +
+               dfW01 * apsCorners[2]->y + dfW11 * apsCorners[3]->y;
+        z[i] = dfW00 * apsCorners[0]->z + dfW10 * apsCorners[1]->z +
+               dfW01 * apsCorners[2]->z + dfW11 * apsCorners[3]->z;
+        panSuccess[i] = TRUE;
+    }
+
+    if (anExactIdx.empty())
+        return TRUE;
+
+    // Transform the remaining points with the exact transformer, in one go
+    const int nExact = static_cast<int>(anExactIdx.size());
+    std::vector<double> adfX(nExact), adfY(nExact), adfZ(nExact);
+    std::vector<int> anSuccess(nExact);
+    for (int i = 0; i < nExact; ++i)
+    {
+        adfX[i] = x[anExactIdx[i]];
+        adfY[i] = y[anExactIdx[i]];
+        adfZ[i] = z[anExactIdx[i]];
+    }
+    const int bRet = psATInfo->pfnBaseTransformer(
+        psATInfo->pBaseCBData, TRUE, nExact, adfX.data(), adfY.data(),
+        adfZ.data(), anSuccess.data());
+    for (int i = 0; i < nExact; ++i)
+    {
+        x[anExactIdx[i]] = adfX[i];
+        y[anExactIdx[i]] = adfY[i];
+        z[anExactIdx[i]] = adfZ[i];
+        panSuccess[anExactIdx[i]] = anSuccess[i];
+    }
+    return bRet;
+}
+
 /************************************************************************/
 /*                        GDALApproxTransform()                         */
 /************************************************************************/
@@ -4390,6 +4749,14 @@ int GDALApproxTransform(void *pCBData, int bDstToSrc, int nPoints, double *x,
     /*      acceptable.                                                     */
     /* -------------------------------------------------------------------- */
     int bRet = FALSE;
+    if (psATInfo->poGrid && bDstToSrc && nPoints > 5 &&
+        psATInfo->dfMaxErrorReverse > 0)
+    {
+        bRet = GDALApproxTransformGrid2D(psATInfo, nPoints, x, y, z,
+                                         panSuccess);
+        goto end;
+    }
+
     if (y[0] != y[nPoints - 1] || y[0] != y[nMiddle] ||
         x[0] == x[nPoints - 1] || x[0] == x[nMiddle] ||
         (psATInfo->dfMaxErrorForward == 0.0 &&
@@ -4485,6 +4852,8 @@ static void *GDALDeserializeApproxTransformer(CPLXMLNode *psTree)
     void *pApproxCBData = GDALCreateApproxTransformer2(
         pfnBaseTransform, pBaseCBData, dfMaxErrorForward, dfMaxErrorReverse);
     GDALApproxTransformerOwnsSubtransformer(pApproxCBData, TRUE);
+    GDALApproxTransformerSetGridStep(
+        pApproxCBData, atoi(CPLGetXMLValue(psTree, "GridStep", "0")));
 
     return pApproxCBData;
 }
@@ -1176,6 +1176,19 @@ const char *GDALWarpGetOptionList(void)
            "Can be set to a numeric value or ALL_CPUS to set the number of "
            "threads to use to parallelize the computation part of the warping. "
            "If not set, computation will be done in a single thread..'/>"
+           "<Option name='NUM_CHUNKS_IN_FLIGHT' type='int' description='"
+           "Only used by the multithreaded warping implementation (-multi). "
+           "Maximum number of chunks being read, warped or written at the "
+           "same time. Values greater than 2 are only honored if the source "
+           "dataset can be read from several threads, and warping chunks "
+           "are then made smaller so that the memory used by all of them "
+           "does not exceed twice the warp memory limit.' default='2'/>"
+           "<Option name='SRC_TILE_CACHE_SIZE' type='string' description='"
+           "Size of a cache of source tiles shared by the warping chunks, "
+           "either in bytes with a unit (e.g. 256MB), in megabytes without "
+           "unit, or as a percentage of the usable RAM (e.g. 10%). "
+           "Avoids re-reading and decoding the source regions shared by "
+           "adjacent chunks. Disabled by default.'/>"
            "<Option name='STREAMABLE_OUTPUT' type='boolean' description='"
            "This defaults to FALSE, but may be set to TRUE typically when "
            "writing to a streamed file. The gdalwarp utility automatically "
@@ -1198,6 +1211,16 @@ const char *GDALWarpGetOptionList(void)
            "performance will be, since exact reprojections must statistically "
            "be done with a frequency of "
            "4*error_threshold/SRC_COORD_PRECISION.' default='0'/>"
+           "<Option name='APPROX_TRANSFORMER_GRID_STEP' type='int' "
+           "description='"
+           "When the transformer is an approximate transformer, size in "
+           "pixels of the cells of a 2-D grid over the target image whose "
+           "nodes are transformed exactly once, and cached. Source "
+           "coordinates are then bilinearly interpolated in the cells, "
+           "which are recursively split while the error exceeds the error "
+           "threshold. This greatly reduces the number of exact "
+           "transformations, in particular for RPC and geolocation array "
+           "warps. 0 to disable.' default='0'/>"
            "<Option name='SRC_ALPHA_MAX' type='float' description='"
            "Maximum value for the alpha band of the source dataset. If the "
            "value is not set and the alpha band has a NBITS metadata item, "
@@ -1420,6 +1443,26 @@ const char *GDALWarpGetOptionList(void)
  * set the number of threads to use to parallelize the computation part of the
  * warping. If not set, computation will be done in a single thread.</li>
  *
+ * <li>NUM_CHUNKS_IN_FLIGHT: (GDAL >= 3.13) Only used by
+ * GDALWarpOperation::ChunkAndWarpMulti(). Maximum number of chunks
+ * being read, warped or written at the same time. Defaults to 2, that is one
+ * chunk doing input/output while another one is being warped. Values greater
+ * than 2 are only honored if the source dataset can be read from several
+ * threads (see GDALGetThreadSafeDataset()), in which case source reads of
+ * the chunks run concurrently, which is mostly beneficial for network hosted
+ * datasets. Warping chunks are then made smaller so that the memory used by
+ * all chunks in flight does not exceed twice the warp memory limit.</li>
+ *
+ * <li>SRC_TILE_CACHE_SIZE: (GDAL >= 3.13) Size of a cache of source tiles,
+ * aligned on source blocks, that is shared by the warping chunks of the warp
+ * operation. Source windows of adjacent chunks overlap, in particular with
+ * reprojection or resampling kernels with a large radius, so this avoids
+ * reading and decoding the same source regions repeatedly, which is mostly
+ * beneficial with compressed sources (JPEG, LERC, etc.). The value may be
+ * expressed in bytes with a unit (e.g. "256MB"), in megabytes without unit,
+ * or as a percentage of the usable RAM (e.g. "10%"). The least recently used
+ * tiles are evicted first. Disabled by default.</li>
+ *
  * <li>STREAMABLE_OUTPUT: This defaults to FALSE, but may
  * be set to TRUE typically when writing to a streamed file. The
  * gdalwarp utility automatically sets this option when writing to
@@ -1442,6 +1485,18 @@ const char *GDALWarpGetOptionList(void)
  * reprojections must statistically be done with a frequency of
  * 4*error_threshold/SRC_COORD_PRECISION.</li>
  *
+ * <li>APPROX_TRANSFORMER_GRID_STEP: (GDAL >= 3.13) Only used when
+ * pfnTransformer is GDALApproxTransform(). If set to a positive value, size in
+ * pixels of the cells of a 2-D grid laid over the destination image. The
+ * nodes of the grid are transformed with the exact transformer only once, and
+ * cached, and source coordinates are bilinearly interpolated in its cells,
+ * instead of being interpolated along each destination row. Cells are
+ * recursively split in 4 while the interpolation error at the middle of their
+ * edges and at their center exceeds the error threshold of the approximate
+ * transformer. This greatly reduces the number of exact transformations, in
+ * particular for RPC and geolocation array warps. Defaults to 0 (disabled).
+ * </li>
+ *
  * <li>SRC_ALPHA_MAX: Maximum value for the alpha band of the
  * source dataset. If the value is not set and the alpha band has a NBITS
  * metadata item, it is used to set SRC_ALPHA_MAX = 2^NBITS-1. Otherwise, if the
@@ -509,6 +509,16 @@ class CPL_DLL GDALWarpOperation final
     GDALWarpOptions *psOptions = nullptr;
     GDALTransformerArgUniquePtr m_psOwnedTransformerArg{nullptr};
 
+    // Transformer used by the warp kernel, when it must differ from
+    // psOptions->pTransformerArg.
+    GDALTransformerArgUniquePtr m_psKernelTransformerArg{nullptr};
+
+    void *GetKernelTransformerArg() const
+    {
+        return m_psKernelTransformerArg ? m_psKernelTransformerArg.get()
+                                        : psOptions->pTransformerArg;
+    }
+
     void WipeOptions();
     int ValidateOptions();
 
@@ -531,6 +541,10 @@ class CPL_DLL GDALWarpOperation final
     CPLMutex *hIOMutex = nullptr;
     CPLMutex *hWarpMutex = nullptr;
 
+    // Set by ChunkAndWarpMulti() when psOptions->hSrcDS may be read from
+    // several threads, without holding hIOMutex.
+    bool m_bConcurrentSrcRead = false;
+
     int nChunkListCount = 0;
     int nChunkListMax = 0;
     GDALWarpChunk *pasChunkList = nullptr;
@@ -75,6 +75,11 @@
 
 #endif
 
+#ifdef CAN_DETECT_AVX2_FMA_AT_RUNTIME
+#include "cpl_cpu_features.h"
+#include "gdalwarpkernel_avx2_fma.h"
+#endif
+
 constexpr double BAND_DENSITY_THRESHOLD = 0.0000000001;
 constexpr float SRC_DENSITY_THRESHOLD_FLOAT = 0.000000001f;
 constexpr double SRC_DENSITY_THRESHOLD_DOUBLE = 0.000000001;
@@ -5503,6 +5508,133 @@ static bool GWKAdjustSrcOffsetOnEdgeUnifiedSrcDensity(GWKJobStruct *psJob,
     return false;
 }
 
+#ifdef CAN_DETECT_AVX2_FMA_AT_RUNTIME
+
+/************************************************************************/
+/*                       GWKAVX2_FMARowResampler                        */
+/*                                                                      */
+/*      Computes with AVX2 instructions the 4-sample bilinear or        */
+/*      cubic resampling of the pixels of a destination row whose       */
+/*      kernel footprint is inside the source window and valid. Other   */
+/*      pixels are left to the scalar code, which gives the same        */
+/*      results.                                                        */
+/************************************************************************/
+
+struct GWKAVX2_FMARowResampler
+{
+    bool bEnabled = false;
+    bool bNoMasks = false;
+    std::vector<GByte> abyCandidate{};
+    std::vector<GPtrDiff_t> anSrcOffset{};
+    std::vector<GByte> abyDone{};
+    std::vector<double> adfValue{};
+    std::vector<double> adfDensity{};
+
+    GWKAVX2_FMARowResampler(const GDALWarpKernel *poWK, bool bNoMasksIn,
+                            bool bUse4SamplesFormula);
+
+    void ProcessRow(GWKJobStruct *psJob, int iDstY, double *padfX,
+                    double *padfY, int *pabSuccess);
+
+    bool IsDone(int iDstX) const
+    {
+        return abyDone[iDstX] != 0;
+    }
+
+    double GetValue(int iBand, int iDstX) const
+    {
+        return adfValue[static_cast<size_t>(iBand) * abyDone.size() + iDstX];
+    }
+};
+
+GWKAVX2_FMARowResampler::GWKAVX2_FMARowResampler(const GDALWarpKernel *poWK,
+                                                 bool bNoMasksIn,
+                                                 bool bUse4SamplesFormula)
+    : bNoMasks(bNoMasksIn)
+{
+    static const bool bHasAVX2_FMA = CPLHaveRuntimeAVX() &&
+                                     __builtin_cpu_supports("avx2") &&
+                                     __builtin_cpu_supports("fma");
+    if (!bHasAVX2_FMA || !bUse4SamplesFormula ||
+        (poWK->eResample != GRA_Bilinear && poWK->eResample != GRA_Cubic) ||
+        (poWK->eWorkingDataType != GDT_UInt8 &&
+         poWK->eWorkingDataType != GDT_Int16 &&
+         poWK->eWorkingDataType != GDT_UInt16 &&
+         poWK->eWorkingDataType != GDT_Float32) ||
+        // Gathers use 32-bit offsets
+        static_cast<GIntBig>(poWK->nSrcXSize) * poWK->nSrcYSize >
+            std::numeric_limits<int>::max() - 4)
+    {
+        return;
+    }
+
+    if (bNoMasks)
+    {
+        // Keep the SSE2 multi-band path of
+        // GWKResampleNoMasksOrDstDensityOnlyThreadInternal()
+        if (poWK->eResample == GRA_Cubic &&
+            (poWK->eWorkingDataType == GDT_UInt8 ||
+             poWK->eWorkingDataType == GDT_UInt16) &&
+            poWK->nBands > 1 && !poWK->bApplyVerticalShift)
+        {
+            return;
+        }
+    }
+    else if (poWK->papanBandSrcValid != nullptr ||
+             poWK->pafUnifiedSrcDensity != nullptr)
+    {
+        return;
+    }
+
+    if (!CPLTestBool(CPLGetConfigOption("GDAL_USE_AVX", "YES")))
+        return;
+
+    const size_t nDstXSize = static_cast<size_t>(poWK->nDstXSize);
+    abyCandidate.resize(nDstXSize);
+    anSrcOffset.resize(nDstXSize);
+    abyDone.resize(nDstXSize);
+    adfValue.resize(nDstXSize * poWK->nBands);
+    if (!bNoMasks)
+        adfDensity.resize(nDstXSize);
+    bEnabled = true;
+}
+
+void GWKAVX2_FMARowResampler::ProcessRow(GWKJobStruct *psJob, int iDstY,
+                                         double *padfX, double *padfY,
+                                         int *pabSuccess)
+{
+    const GDALWarpKernel *poWK = psJob->poWK;
+    const int nDstXSize = poWK->nDstXSize;
+    for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
+    {
+        abyCandidate[iDstX] = GWKCheckAndComputeSrcOffsets(
+            psJob, pabSuccess, iDstX, iDstY, padfX, padfY, poWK->nSrcXSize,
+            poWK->nSrcYSize, anSrcOffset[iDstX]);
+    }
+
+    GWKResample4SampleRowArgs sArgs;
+    sArgs.eWorkingDataType = poWK->eWorkingDataType;
+    sArgs.eResample = poWK->eResample;
+    sArgs.bNoMasks = bNoMasks;
+    sArgs.nSrcXSize = poWK->nSrcXSize;
+    sArgs.nSrcYSize = poWK->nSrcYSize;
+    sArgs.nSrcXOff = poWK->nSrcXOff;
+    sArgs.nSrcYOff = poWK->nSrcYOff;
+    sArgs.nBands = poWK->nBands;
+    sArgs.papabySrcImage = poWK->papabySrcImage;
+    sArgs.panUnifiedSrcValid = poWK->panUnifiedSrcValid;
+    sArgs.nCount = nDstXSize;
+    sArgs.padfX = padfX;
+    sArgs.padfY = padfY;
+    sArgs.pabyCandidate = abyCandidate.data();
+    sArgs.pabyDone = abyDone.data();
+    sArgs.padfValue = adfValue.data();
+    sArgs.padfDensity = adfDensity.data();
+    GWKResample4SampleRow_AVX2_FMA(sArgs);
+}
+
+#endif  // CAN_DETECT_AVX2_FMA_AT_RUNTIME
+
 /************************************************************************/
 /*                           GWKGeneralCase()                           */
 /*                                                                      */
@@ -5850,6 +5982,11 @@ static void GWKRealCaseThread(void *pData)
     for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
         padfX[nDstXSize + iDstX] = iDstX + 0.5 + poWK->nDstXOff;
 
+#ifdef CAN_DETECT_AVX2_FMA_AT_RUNTIME
+    GWKAVX2_FMARowResampler oAVX2_FMA(poWK, /* bNoMasks = */ false,
+                                      bUse4SamplesFormula);
+#endif
+
     /* ==================================================================== */
     /*      Loop over output lines.                                         */
     /* ==================================================================== */
@@ -5882,6 +6019,11 @@ static void GWKRealCaseThread(void *pData)
                 0.5 + poWK->nDstXOff, iDstY + 0.5 + poWK->nDstYOff);
         }
 
+#ifdef CAN_DETECT_AVX2_FMA_AT_RUNTIME
+        if (oAVX2_FMA.bEnabled)
+            oAVX2_FMA.ProcessRow(psJob, iDstY, padfX, padfY, pabSuccess);
+#endif
+
         /* ====================================================================
          */
         /*      Loop over pixels in output scanline. */
@@ -5890,9 +6032,19 @@ static void GWKRealCaseThread(void *pData)
         for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
         {
             GPtrDiff_t iSrcOffset = 0;
-            if (!GWKCheckAndComputeSrcOffsets(psJob, pabSuccess, iDstX, iDstY,
-                                              padfX, padfY, nSrcXSize,
-                                              nSrcYSize, iSrcOffset))
+#ifdef CAN_DETECT_AVX2_FMA_AT_RUNTIME
+            if (oAVX2_FMA.bEnabled)
+            {
+                if (!oAVX2_FMA.abyCandidate[iDstX])
+                    continue;
+                iSrcOffset = oAVX2_FMA.anSrcOffset[iDstX];
+            }
+            else
+#endif
+                if (!GWKCheckAndComputeSrcOffsets(psJob, pabSuccess, iDstX,
+                                                  iDstY, padfX, padfY,
+                                                  nSrcXSize, nSrcYSize,
+                                                  iSrcOffset))
                 continue;
 
             /* --------------------------------------------------------------------
@@ -5968,6 +6120,13 @@ static void GWKRealCaseThread(void *pData)
                     CPL_IGNORE_RET_VAL(GWKGetPixelValueReal(
                         poWK, iBand, iSrcOffset, &dfBandDensity, &dfValueReal));
                 }
+#ifdef CAN_DETECT_AVX2_FMA_AT_RUNTIME
+                else if (oAVX2_FMA.bEnabled && oAVX2_FMA.IsDone(iDstX))
+                {
+                    dfBandDensity = oAVX2_FMA.adfDensity[iDstX];
+                    dfValueReal = oAVX2_FMA.GetValue(iBand, iDstX);
+                }
+#endif
                 else if (poWK->eResample == GRA_Bilinear && bUse4SamplesFormula)
                 {
                     double dfValueImagIgnored = 0.0;
@@ -6285,6 +6444,11 @@ static void GWKResampleNoMasksOrDstDensityOnlyThreadInternal(void *pData)
     for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
         padfX[nDstXSize + iDstX] = iDstX + 0.5 + poWK->nDstXOff;
 
+#ifdef CAN_DETECT_AVX2_FMA_AT_RUNTIME
+    GWKAVX2_FMARowResampler oAVX2_FMA(poWK, /* bNoMasks = */ true,
+                                      bUse4SamplesFormula != FALSE);
+#endif
+
     /* ==================================================================== */
     /*      Loop over output lines.                                         */
     /* ==================================================================== */
@@ -6317,6 +6481,11 @@ static void GWKResampleNoMasksOrDstDensityOnlyThreadInternal(void *pData)
                 0.5 + poWK->nDstXOff, iDstY + 0.5 + poWK->nDstYOff);
         }
 
+#ifdef CAN_DETECT_AVX2_FMA_AT_RUNTIME
+        if (oAVX2_FMA.bEnabled)
+            oAVX2_FMA.ProcessRow(psJob, iDstY, padfX, padfY, pabSuccess);
+#endif
+
         /* ====================================================================
          */
         /*      Loop over pixels in output scanline. */
@@ -6325,9 +6494,19 @@ static void GWKResampleNoMasksOrDstDensityOnlyThreadInternal(void *pData)
         for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
         {
             GPtrDiff_t iSrcOffset = 0;
-            if (!GWKCheckAndComputeSrcOffsets(psJob, pabSuccess, iDstX, iDstY,
-                                              padfX, padfY, nSrcXSize,
-                                              nSrcYSize, iSrcOffset))
+#ifdef CAN_DETECT_AVX2_FMA_AT_RUNTIME
+            if (oAVX2_FMA.bEnabled)
+            {
+                if (!oAVX2_FMA.abyCandidate[iDstX])
+                    continue;
+                iSrcOffset = oAVX2_FMA.anSrcOffset[iDstX];
+            }
+            else
+#endif
+                if (!GWKCheckAndComputeSrcOffsets(psJob, pabSuccess, iDstX,
+                                                  iDstY, padfX, padfY,
+                                                  nSrcXSize, nSrcYSize,
+                                                  iSrcOffset))
                 continue;
 
             /* ====================================================================
@@ -6365,14 +6544,28 @@ static void GWKResampleNoMasksOrDstDensityOnlyThreadInternal(void *pData)
                 }
                 else if constexpr (bUse4SamplesFormula)
                 {
-                    if constexpr (eResample == GRA_Bilinear)
-                        GWKBilinearResampleNoMasks4SampleT(
-                            poWK, iBand, padfX[iDstX] - poWK->nSrcXOff,
-                            padfY[iDstX] - poWK->nSrcYOff, &value);
+#ifdef CAN_DETECT_AVX2_FMA_AT_RUNTIME
+                    if (oAVX2_FMA.bEnabled && oAVX2_FMA.IsDone(iDstX))
+                    {
+                        const double dfValue =
+                            oAVX2_FMA.GetValue(iBand, iDstX);
+                        if constexpr (eResample == GRA_Bilinear)
+                            value = GWKRoundValueT<T>(dfValue);
+                        else
+                            value = GWKClampValueT<T>(dfValue);
+                    }
                     else
-                        GWKCubicResampleNoMasks4SampleT(
-                            poWK, iBand, padfX[iDstX] - poWK->nSrcXOff,
-                            padfY[iDstX] - poWK->nSrcYOff, &value);
+#endif
+                    {
+                        if constexpr (eResample == GRA_Bilinear)
+                            GWKBilinearResampleNoMasks4SampleT(
+                                poWK, iBand, padfX[iDstX] - poWK->nSrcXOff,
+                                padfY[iDstX] - poWK->nSrcYOff, &value);
+                        else
+                            GWKCubicResampleNoMasks4SampleT(
+                                poWK, iBand, padfX[iDstX] - poWK->nSrcXOff,
+                                padfY[iDstX] - poWK->nSrcYOff, &value);
+                    }
                 }
                 else
                 {
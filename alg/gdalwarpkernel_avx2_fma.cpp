@@ -0,0 +1,486 @@
+/******************************************************************************
+ *
+ * Project:  High Performance Image Reprojector
+ * Purpose:  AVX2 and FMA implementation of bilinear and cubic resampling of
+ *           rows of destination pixels.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "gdalwarpkernel_avx2_fma.h"
+
+#include <cstring>
+#include <type_traits>
+
+#include <immintrin.h>
+
+// The values computed here must be strictly identical to the ones of the
+// scalar code of gdalwarpkernel.cpp, as pixels close to the source window
+// edges, or with invalid pixels in their neighbourhood, still go through it.
+// Consequently operations are done in the same order as in the scalar code,
+// and this file is compiled with -ffp-contract=off so that the compiler does
+// not fuse multiplications and additions.
+
+namespace
+{
+
+/************************************************************************/
+/*                             GatherRow()                              */
+/************************************************************************/
+
+// Loads the N consecutive source values starting at pSrc[offset] for the
+// 8 lanes selected by mask, as two vectors of 4 doubles.
+template <class T, int N>
+inline void GatherRow(const T *pSrc, __m256i offset, __m256i mask,
+                      __m256d (&lo)[N], __m256d (&hi)[N])
+{
+    if constexpr (std::is_same_v<T, float>)
+    {
+        for (int k = 0; k < N; ++k)
+        {
+            const __m256 v =
+                _mm256_mask_i32gather_ps(_mm256_setzero_ps(), pSrc + k, offset,
+                                         _mm256_castsi256_ps(mask), 4);
+            lo[k] = _mm256_cvtps_pd(_mm256_castps256_ps128(v));
+            hi[k] = _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1));
+        }
+    }
+    else
+    {
+        // Integer values are fetched 32 bits at a time, that is several
+        // consecutive values per gather.
+        constexpr int BITS = 8 * static_cast<int>(sizeof(T));
+        constexpr int PER_GATHER = 32 / BITS;
+        const __m128i shiftRight = _mm_cvtsi32_si128(32 - BITS);
+        for (int j = 0; j < N; j += PER_GATHER)
+        {
+            const __m256i v = _mm256_mask_i32gather_epi32(
+                _mm256_setzero_si256(), reinterpret_cast<const int *>(pSrc + j),
+                offset, mask, static_cast<int>(sizeof(T)));
+            for (int k = 0; k < PER_GATHER && j + k < N; ++k)
+            {
+                // Move the value in the most significant bits, and shift it
+                // back with sign or zero extension.
+                const __m256i x = _mm256_sll_epi32(
+                    v, _mm_cvtsi32_si128(32 - BITS * (k + 1)));
+                const __m256i val = std::is_signed_v<T>
+                                        ? _mm256_sra_epi32(x, shiftRight)
+                                        : _mm256_srl_epi32(x, shiftRight);
+                lo[j + k] = _mm256_cvtepi32_pd(_mm256_castsi256_si128(val));
+                hi[j + k] =
+                    _mm256_cvtepi32_pd(_mm256_extracti128_si256(val, 1));
+            }
+        }
+    }
+}
+
+/************************************************************************/
+/*                            KeepIfValid()                             */
+/************************************************************************/
+
+// Clears the lanes of mask for which one of the N consecutive pixels
+// starting at offset is not set in panValid.
+template <int N>
+inline __m256i KeepIfValid(const GUInt32 *panValid, __m256i offset,
+                           __m256i mask)
+{
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i bitMask = _mm256_set1_epi32(31);
+    for (int k = 0; k < N; ++k)
+    {
+        const __m256i idx = _mm256_add_epi32(offset, _mm256_set1_epi32(k));
+        const __m256i word = _mm256_mask_i32gather_epi32(
+            _mm256_setzero_si256(), reinterpret_cast<const int *>(panValid),
+            _mm256_srli_epi32(idx, 5), mask, 4);
+        const __m256i bit = _mm256_and_si256(
+            _mm256_srlv_epi32(word, _mm256_and_si256(idx, bitMask)), one);
+        mask = _mm256_and_si256(mask, _mm256_cmpeq_epi32(bit, one));
+    }
+    return mask;
+}
+
+/************************************************************************/
+/*                        CubicComputeWeights()                         */
+/************************************************************************/
+
+// Same as GWKCubicComputeWeights()
+inline void CubicComputeWeights(__m256d x, __m256d (&coeffs)[4])
+{
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d minusOne = _mm256_set1_pd(-1.0);
+    const __m256d halfX = _mm256_mul_pd(_mm256_set1_pd(0.5), x);
+    const __m256d threeX = _mm256_mul_pd(_mm256_set1_pd(3.0), x);
+    const __m256d halfX2 = _mm256_mul_pd(halfX, x);
+
+    coeffs[0] = _mm256_mul_pd(
+        halfX,
+        _mm256_add_pd(minusOne,
+                      _mm256_mul_pd(x, _mm256_sub_pd(_mm256_set1_pd(2.0), x))));
+    coeffs[1] = _mm256_add_pd(
+        one,
+        _mm256_mul_pd(halfX2, _mm256_add_pd(_mm256_set1_pd(-5.0), threeX)));
+    coeffs[2] = _mm256_mul_pd(
+        halfX, _mm256_add_pd(one, _mm256_mul_pd(x, _mm256_sub_pd(
+                                                       _mm256_set1_pd(4.0),
+                                                       threeX))));
+    coeffs[3] = _mm256_mul_pd(halfX2, _mm256_add_pd(minusOne, x));
+}
+
+/************************************************************************/
+/*                              Convol4()                               */
+/************************************************************************/
+
+// Same as CONVOL4()
+inline __m256d Convol4(const __m256d (&coeffs)[4], const __m256d (&v)[4])
+{
+    return _mm256_add_pd(
+        _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(coeffs[0], v[0]),
+                                    _mm256_mul_pd(coeffs[1], v[1])),
+                      _mm256_mul_pd(coeffs[2], v[2])),
+        _mm256_mul_pd(coeffs[3], v[3]));
+}
+
+/************************************************************************/
+/*                         CubicConvolution()                           */
+/************************************************************************/
+
+// Same as CubicConvolution() of gdalwarpkernel.cpp
+inline __m256d CubicConvolution(__m256d distance1, __m256d distance2,
+                                __m256d distance3, const __m256d (&f)[4])
+{
+    const __m256d a = _mm256_mul_pd(distance1, _mm256_sub_pd(f[2], f[0]));
+    // 2 * f0 - 5 * f1 + 4 * f2 - f3
+    const __m256d b = _mm256_mul_pd(
+        distance2,
+        _mm256_sub_pd(
+            _mm256_add_pd(
+                _mm256_sub_pd(_mm256_mul_pd(_mm256_set1_pd(2.0), f[0]),
+                              _mm256_mul_pd(_mm256_set1_pd(5.0), f[1])),
+                _mm256_mul_pd(_mm256_set1_pd(4.0), f[2])),
+            f[3]));
+    // 3 * (f1 - f2) + f3 - f0
+    const __m256d c = _mm256_mul_pd(
+        distance3,
+        _mm256_sub_pd(
+            _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(3.0),
+                                        _mm256_sub_pd(f[1], f[2])),
+                          f[3]),
+            f[0]));
+    return _mm256_add_pd(
+        f[1], _mm256_mul_pd(_mm256_set1_pd(0.5),
+                            _mm256_add_pd(_mm256_add_pd(a, b), c)));
+}
+
+/************************************************************************/
+/*                         Resample4SampleRow()                         */
+/************************************************************************/
+
+// Processes destination pixels 8 at a time. Only pixels whose whole kernel
+// footprint is inside the source window, and valid, are computed here:
+// those give the same results as GWKBilinearResampleNoMasks4SampleT() /
+// GWKCubicResampleNoMasks4SampleT() when bNoMasks is true, and as
+// GWKBilinearResample4Sample() / GWKCubicResample4Sample() otherwise.
+template <class T, GDALResampleAlg eResample, bool bNoMasks>
+void Resample4SampleRow(const GWKResample4SampleRowArgs &sArgs)
+{
+    constexpr bool bCubic = eResample == GRA_Cubic;
+    // Width and height of the kernel footprint.
+    constexpr int N = bCubic ? 4 : 2;
+    // Number of values per row actually read by GatherRow().
+    constexpr int PER_GATHER =
+        std::is_same_v<T, float> ? 1 : 4 / static_cast<int>(sizeof(T));
+    constexpr int N_READ = ((N + PER_GATHER - 1) / PER_GATHER) * PER_GATHER;
+
+    const int nSrcXSize = sArgs.nSrcXSize;
+    const int nSrcYSize = sArgs.nSrcYSize;
+    const int nCount = sArgs.nCount;
+    const GUInt32 *const panValid =
+        bNoMasks ? nullptr : sArgs.panUnifiedSrcValid;
+
+    const __m256d srcXOff = _mm256_set1_pd(sArgs.nSrcXOff);
+    const __m256d srcYOff = _mm256_set1_pd(sArgs.nSrcYOff);
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d half = _mm256_set1_pd(0.5);
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d oneAndHalf = _mm256_set1_pd(1.5);
+    const __m256i minusOneI = _mm256_set1_epi32(-1);
+    const __m256i srcXSize = _mm256_set1_epi32(nSrcXSize);
+    const __m256i firstXUpperBound = _mm256_set1_epi32(nSrcXSize - N + 1);
+    const __m256i firstYUpperBound = _mm256_set1_epi32(nSrcYSize - N + 1);
+    // Bound of the offset of the last footprint row so that the values read
+    // beyond the footprint by GatherRow() are still inside the buffer.
+    const __m256i lastRowOffsetUpperBound =
+        _mm256_set1_epi32(nSrcXSize * nSrcYSize - N_READ + 1);
+
+    int i = 0;
+    for (; i + 8 <= nCount; i += 8)
+    {
+        __m256i mask = _mm256_cmpgt_epi32(
+            _mm256_cvtepu8_epi32(_mm_loadl_epi64(
+                reinterpret_cast<const __m128i *>(sArgs.pabyCandidate + i))),
+            _mm256_setzero_si256());
+        if (_mm256_testz_si256(mask, mask))
+        {
+            memset(sArgs.pabyDone + i, 0, 8);
+            continue;
+        }
+
+        /* ------------------------------------------------------------ */
+        /*      Compute the top left pixel of the kernel footprint and   */
+        /*      only keep lanes where the footprint is inside the        */
+        /*      source window.                                           */
+        /* ------------------------------------------------------------ */
+        __m256d x[2], y[2], ix[2], iy[2];
+        for (int h = 0; h < 2; ++h)
+        {
+            x[h] =
+                _mm256_sub_pd(_mm256_loadu_pd(sArgs.padfX + i + 4 * h), srcXOff);
+            y[h] =
+                _mm256_sub_pd(_mm256_loadu_pd(sArgs.padfY + i + 4 * h), srcYOff);
+            if constexpr (bCubic)
+            {
+                // static_cast<int>(dfSrcX - 0.5)
+                ix[h] = _mm256_round_pd(_mm256_sub_pd(x[h], half),
+                                        _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+                iy[h] = _mm256_round_pd(_mm256_sub_pd(y[h], half),
+                                        _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+            }
+            else
+            {
+                // static_cast<int>(floor(dfSrcX - 0.5))
+                ix[h] = _mm256_floor_pd(_mm256_sub_pd(x[h], half));
+                iy[h] = _mm256_floor_pd(_mm256_sub_pd(y[h], half));
+            }
+        }
+
+        const __m256i firstX = _mm256_sub_epi32(
+            _mm256_set_m128i(_mm256_cvttpd_epi32(ix[1]),
+                             _mm256_cvttpd_epi32(ix[0])),
+            bCubic ? _mm256_set1_epi32(1) : _mm256_setzero_si256());
+        const __m256i firstY = _mm256_sub_epi32(
+            _mm256_set_m128i(_mm256_cvttpd_epi32(iy[1]),
+                             _mm256_cvttpd_epi32(iy[0])),
+            bCubic ? _mm256_set1_epi32(1) : _mm256_setzero_si256());
+        mask = _mm256_and_si256(mask, _mm256_cmpgt_epi32(firstX, minusOneI));
+        mask = _mm256_and_si256(mask,
+                                _mm256_cmpgt_epi32(firstXUpperBound, firstX));
+        mask = _mm256_and_si256(mask, _mm256_cmpgt_epi32(firstY, minusOneI));
+        mask = _mm256_and_si256(mask,
+                                _mm256_cmpgt_epi32(firstYUpperBound, firstY));
+
+        const __m256i offset =
+            _mm256_add_epi32(_mm256_mullo_epi32(firstY, srcXSize), firstX);
+        __m256i rowOffsets[N];
+        rowOffsets[0] = offset;
+        for (int r = 1; r < N; ++r)
+            rowOffsets[r] = _mm256_add_epi32(rowOffsets[r - 1], srcXSize);
+        if constexpr (N_READ > N)
+        {
+            mask = _mm256_and_si256(
+                mask,
+                _mm256_cmpgt_epi32(lastRowOffsetUpperBound, rowOffsets[N - 1]));
+        }
+
+        if (panValid)
+        {
+            for (int r = 0; r < N; ++r)
+                mask = KeepIfValid<N>(panValid, rowOffsets[r], mask);
+        }
+
+        const int nMask = _mm256_movemask_ps(_mm256_castsi256_ps(mask));
+        for (int k = 0; k < 8; ++k)
+            sArgs.pabyDone[i + k] = static_cast<GByte>((nMask >> k) & 1);
+        if (nMask == 0)
+            continue;
+
+        /* ------------------------------------------------------------ */
+        /*      Compute the weights.                                     */
+        /* ------------------------------------------------------------ */
+        __m256d weightsX[2][N], weightsY[2][N];
+        [[maybe_unused]] __m256d bilinearMult[2][4];
+        [[maybe_unused]] __m256d bilinearDivisor[2], bilinearDivisorIsOne[2];
+        for (int h = 0; h < 2; ++h)
+        {
+            if constexpr (bCubic)
+            {
+                __m256d coeffsX[4], coeffsY[4];
+                CubicComputeWeights(
+                    _mm256_sub_pd(_mm256_sub_pd(x[h], half), ix[h]), coeffsX);
+                const __m256d dy =
+                    _mm256_sub_pd(_mm256_sub_pd(y[h], half), iy[h]);
+                for (int k = 0; k < 4; ++k)
+                    weightsX[h][k] = coeffsX[k];
+                if constexpr (bNoMasks)
+                {
+                    // Distances for CubicConvolution()
+                    weightsY[h][0] = dy;
+                    weightsY[h][1] = _mm256_mul_pd(dy, dy);
+                    weightsY[h][2] = _mm256_mul_pd(weightsY[h][1], dy);
+                    weightsY[h][3] = zero;
+                }
+                else
+                {
+                    CubicComputeWeights(dy, coeffsY);
+                    for (int k = 0; k < 4; ++k)
+                        weightsY[h][k] = coeffsY[k];
+
+                    // Density is CONVOL4() of the weights with 1 values
+                    const __m256d rowDensity = _mm256_add_pd(
+                        _mm256_add_pd(_mm256_add_pd(coeffsX[0], coeffsX[1]),
+                                      coeffsX[2]),
+                        coeffsX[3]);
+                    const __m256d rowDensities[4] = {rowDensity, rowDensity,
+                                                     rowDensity, rowDensity};
+                    _mm256_storeu_pd(sArgs.padfDensity + i + 4 * h,
+                                     Convol4(coeffsY, rowDensities));
+                }
+            }
+            else
+            {
+                const __m256d ratioX =
+                    _mm256_sub_pd(oneAndHalf, _mm256_sub_pd(x[h], ix[h]));
+                const __m256d ratioY =
+                    _mm256_sub_pd(oneAndHalf, _mm256_sub_pd(y[h], iy[h]));
+                weightsX[h][0] = ratioX;
+                weightsX[h][1] = _mm256_sub_pd(one, ratioX);
+                weightsY[h][0] = ratioY;
+                weightsY[h][1] = _mm256_sub_pd(one, ratioY);
+                if constexpr (!bNoMasks)
+                {
+                    // Same accumulation order as GWKBilinearResample4Sample()
+                    __m256d(&mult)[4] = bilinearMult[h];
+                    mult[0] = _mm256_mul_pd(weightsX[h][0], weightsY[h][0]);
+                    mult[1] = _mm256_mul_pd(weightsX[h][1], weightsY[h][0]);
+                    mult[2] = _mm256_mul_pd(weightsX[h][0], weightsY[h][1]);
+                    mult[3] = _mm256_mul_pd(weightsX[h][1], weightsY[h][1]);
+                    __m256d divisor = zero;
+                    for (int k = 0; k < 4; ++k)
+                        divisor = _mm256_add_pd(divisor, mult[k]);
+                    bilinearDivisor[h] = divisor;
+                    bilinearDivisorIsOne[h] =
+                        _mm256_cmp_pd(divisor, one, _CMP_EQ_OQ);
+                    // The density is the divisor divided by itself (or not
+                    // divided if equal to 1)
+                    _mm256_storeu_pd(sArgs.padfDensity + i + 4 * h, one);
+                }
+            }
+        }
+
+        /* ------------------------------------------------------------ */
+        /*      Resample each band.                                      */
+        /* ------------------------------------------------------------ */
+        for (int iBand = 0; iBand < sArgs.nBands; ++iBand)
+        {
+            const T *pSrc =
+                reinterpret_cast<const T *>(sArgs.papabySrcImage[iBand]);
+            __m256d values[2][N][N];
+            for (int r = 0; r < N; ++r)
+                GatherRow<T, N>(pSrc, rowOffsets[r], mask, values[0][r],
+                                values[1][r]);
+
+            double *padfValue =
+                sArgs.padfValue + static_cast<size_t>(iBand) * nCount + i;
+            for (int h = 0; h < 2; ++h)
+            {
+                __m256d res;
+                if constexpr (bCubic)
+                {
+                    __m256d rows[4];
+                    for (int r = 0; r < 4; ++r)
+                        rows[r] = Convol4(weightsX[h], values[h][r]);
+                    if constexpr (bNoMasks)
+                        res = CubicConvolution(weightsY[h][0], weightsY[h][1],
+                                               weightsY[h][2], rows);
+                    else
+                        res = Convol4(weightsY[h], rows);
+                }
+                else if constexpr (bNoMasks)
+                {
+                    const __m256d(&s)[2][2] = values[h];
+                    res = _mm256_add_pd(
+                        _mm256_mul_pd(
+                            _mm256_add_pd(
+                                _mm256_mul_pd(s[0][0], weightsX[h][0]),
+                                _mm256_mul_pd(s[0][1], weightsX[h][1])),
+                            weightsY[h][0]),
+                        _mm256_mul_pd(
+                            _mm256_add_pd(
+                                _mm256_mul_pd(s[1][0], weightsX[h][0]),
+                                _mm256_mul_pd(s[1][1], weightsX[h][1])),
+                            weightsY[h][1]));
+                }
+                else
+                {
+                    const __m256d(&s)[2][2] = values[h];
+                    const __m256d(&mult)[4] = bilinearMult[h];
+                    __m256d acc = zero;
+                    acc = _mm256_add_pd(acc, _mm256_mul_pd(s[0][0], mult[0]));
+                    acc = _mm256_add_pd(acc, _mm256_mul_pd(s[0][1], mult[1]));
+                    acc = _mm256_add_pd(acc, _mm256_mul_pd(s[1][0], mult[2]));
+                    acc = _mm256_add_pd(acc, _mm256_mul_pd(s[1][1], mult[3]));
+                    res = _mm256_blendv_pd(
+                        _mm256_div_pd(acc, bilinearDivisor[h]), acc,
+                        bilinearDivisorIsOne[h]);
+                }
+                _mm256_storeu_pd(padfValue + 4 * h, res);
+            }
+        }
+    }
+
+    // Remaining pixels are left to the scalar code
+    if (i < nCount)
+        memset(sArgs.pabyDone + i, 0, nCount - i);
+}
+
+/************************************************************************/
+/*                             Dispatch()                               */
+/************************************************************************/
+
+template <class T> void Dispatch(const GWKResample4SampleRowArgs &sArgs)
+{
+    if (sArgs.eResample == GRA_Cubic)
+    {
+        if (sArgs.bNoMasks)
+            Resample4SampleRow<T, GRA_Cubic, true>(sArgs);
+        else
+            Resample4SampleRow<T, GRA_Cubic, false>(sArgs);
+    }
+    else
+    {
+        if (sArgs.bNoMasks)
+            Resample4SampleRow<T, GRA_Bilinear, true>(sArgs);
+        else
+            Resample4SampleRow<T, GRA_Bilinear, false>(sArgs);
+    }
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                   GWKResample4SampleRow_AVX2_FMA()                   */
+/************************************************************************/
+
+void GWKResample4SampleRow_AVX2_FMA(const GWKResample4SampleRowArgs &sArgs)
+{
+    switch (sArgs.eWorkingDataType)
+    {
+        case GDT_UInt8:
+            Dispatch<GByte>(sArgs);
+            break;
+        case GDT_Int16:
+            Dispatch<GInt16>(sArgs);
+            break;
+        case GDT_UInt16:
+            Dispatch<GUInt16>(sArgs);
+            break;
+        case GDT_Float32:
+            Dispatch<float>(sArgs);
+            break;
+        default:
+            memset(sArgs.pabyDone, 0, sArgs.nCount);
+            break;
+    }
+}
@@ -0,0 +1,69 @@
+/******************************************************************************
+ *
+ * Project:  High Performance Image Reprojector
+ * Purpose:  AVX2 and FMA implementation of bilinear and cubic resampling of
+ *           rows of destination pixels.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef GDALWARPKERNEL_AVX2_FMA_H
+#define GDALWARPKERNEL_AVX2_FMA_H
+
+#include "cpl_port.h"
+#include "gdalwarper.h"
+
+/** Arguments of GWKResample4SampleRow_AVX2_FMA() */
+struct GWKResample4SampleRowArgs
+{
+    /** Working data type. Only GDT_UInt8, GDT_Int16, GDT_UInt16 and
+     * GDT_Float32 are supported. */
+    GDALDataType eWorkingDataType = GDT_Unknown;
+
+    /** GRA_Bilinear or GRA_Cubic */
+    GDALResampleAlg eResample = GRA_Bilinear;
+
+    /** Whether to use the formulas of the "NoMasksOrDstDensityOnly" kernels
+     * (true), or the ones of the general "RealCase" kernel (false) */
+    bool bNoMasks = true;
+
+    int nSrcXSize = 0;
+    int nSrcYSize = 0;
+    int nSrcXOff = 0;
+    int nSrcYOff = 0;
+    int nBands = 0;
+    const GByte *const *papabySrcImage = nullptr;
+
+    /** Unified source validity mask, or nullptr. Only taken into account
+     * when bNoMasks == false. */
+    const GUInt32 *panUnifiedSrcValid = nullptr;
+
+    /** Number of destination pixels of the row */
+    int nCount = 0;
+
+    /** Source coordinates of the destination pixels, in the referential of
+     * the whole source raster (that is including nSrcXOff/nSrcYOff) */
+    const double *padfX = nullptr;
+    const double *padfY = nullptr;
+
+    /** Non-zero for destination pixels whose source coordinates are valid */
+    const GByte *pabyCandidate = nullptr;
+
+    /** Output: set to non-zero for destination pixels that have been
+     * computed, and to zero for the ones left to the scalar code. */
+    GByte *pabyDone = nullptr;
+
+    /** Output: computed values, nBands * nCount values, band interleaved */
+    double *padfValue = nullptr;
+
+    /** Output: computed density, nCount values. Only set when
+     * bNoMasks == false. */
+    double *padfDensity = nullptr;
+};
+
+void GWKResample4SampleRow_AVX2_FMA(const GWKResample4SampleRowArgs &sArgs);
+
+#endif
@@ -22,10 +22,13 @@
 #include <cstring>
 
 #include <algorithm>
+#include <condition_variable>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <utility>
+#include <vector>
 
 #include "cpl_config.h"
 #include "cpl_conv.h"
@@ -35,9 +38,11 @@
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
 #include "gdal_alg_priv.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 
@@ -48,12 +53,212 @@ struct _GDALWarpChunk
     double sExtraSx, sExtraSy;
 };
 
+/************************************************************************/
+/*                         GDALWarpSrcTileCache                         */
+/************************************************************************/
+
+// Cache of source tiles, read in the working data type for the warped bands,
+// shared by all chunks of a warp operation. Adjacent chunks have overlapping
+// source windows, so this avoids decoding the same source blocks repeatedly.
+// Tiles are evicted by least recent use, counted in source window reads, and
+// ties are broken by evicting tiles with the smallest tile row first, as
+// chunks are processed in scan order.
+class GDALWarpSrcTileCache
+{
+    struct Tile
+    {
+        std::shared_ptr<const std::vector<GByte>> poData{};
+        uint64_t nLastUse = 0;
+    };
+
+    const int m_nTileXSize;
+    const int m_nTileYSize;
+    const size_t m_nMaxSize;
+
+    std::mutex m_oMutex{};
+    size_t m_nSize = 0;         // protected by m_oMutex
+    uint64_t m_nGeneration = 0;  // protected by m_oMutex
+    // Keyed by (tile row, tile column)
+    std::map<std::pair<int, int>, Tile> m_oTiles{};  // protected by m_oMutex
+
+    bool MakeRoom(size_t nTileSize, uint64_t nGeneration);
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALWarpSrcTileCache)
+
+  public:
+    GDALWarpSrcTileCache(int nTileXSize, int nTileYSize, size_t nMaxSize)
+        : m_nTileXSize(nTileXSize), m_nTileYSize(nTileYSize),
+          m_nMaxSize(nMaxSize)
+    {
+    }
+
+    CPLErr Read(const GDALWarpOptions *psOptions, int nSrcXOff, int nSrcYOff,
+                int nSrcXSize, int nSrcYSize, GByte *pabyBuffer,
+                GPtrDiff_t nBandSpace);
+};
+
+/************************************************************************/
+/*                              MakeRoom()                              */
+/************************************************************************/
+
+// Must be called with m_oMutex held. Returns false if the tile cannot be
+// inserted without evicting tiles used by the current source window read.
+bool GDALWarpSrcTileCache::MakeRoom(size_t nTileSize, uint64_t nGeneration)
+{
+    if (nTileSize > m_nMaxSize)
+        return false;
+    while (m_nSize + nTileSize > m_nMaxSize)
+    {
+        auto oIterToEvict = m_oTiles.end();
+        for (auto oIter = m_oTiles.begin(); oIter != m_oTiles.end(); ++oIter)
+        {
+            if (oIterToEvict == m_oTiles.end() ||
+                oIter->second.nLastUse < oIterToEvict->second.nLastUse)
+            {
+                oIterToEvict = oIter;
+            }
+        }
+        if (oIterToEvict == m_oTiles.end() ||
+            oIterToEvict->second.nLastUse == nGeneration)
+        {
+            return false;
+        }
+        m_nSize -= oIterToEvict->second.poData->size();
+        m_oTiles.erase(oIterToEvict);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                                Read()                                */
+/************************************************************************/
+
+// Read a source window, for all warped bands, into a buffer with
+// nBandSpace bytes between bands, like the direct RasterIO() call of
+// GDALWarpOperation::WarpRegionToBuffer() does.
+CPLErr GDALWarpSrcTileCache::Read(const GDALWarpOptions *psOptions,
+                                  int nSrcXOff, int nSrcYOff, int nSrcXSize,
+                                  int nSrcYSize, GByte *pabyBuffer,
+                                  GPtrDiff_t nBandSpace)
+{
+    GDALDataset *poSrcDS = GDALDataset::FromHandle(psOptions->hSrcDS);
+    const int nBandCount = psOptions->nBandCount;
+    const GDALDataType eDT = psOptions->eWorkingDataType;
+    const int nWordSize = GDALGetDataTypeSizeBytes(eDT);
+    const int nRasterXSize = poSrcDS->GetRasterXSize();
+    const int nRasterYSize = poSrcDS->GetRasterYSize();
+
+    uint64_t nGeneration;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        nGeneration = ++m_nGeneration;
+    }
+
+    const int nTileX0 = nSrcXOff / m_nTileXSize;
+    const int nTileY0 = nSrcYOff / m_nTileYSize;
+    const int nTileX1 = (nSrcXOff + nSrcXSize - 1) / m_nTileXSize;
+    const int nTileY1 = (nSrcYOff + nSrcYSize - 1) / m_nTileYSize;
+    for (int nTileY = nTileY0; nTileY <= nTileY1; ++nTileY)
+    {
+        const int nTileYOff = nTileY * m_nTileYSize;
+        const int nTileYSize =
+            std::min(m_nTileYSize, nRasterYSize - nTileYOff);
+        for (int nTileX = nTileX0; nTileX <= nTileX1; ++nTileX)
+        {
+            const int nTileXOff = nTileX * m_nTileXSize;
+            const int nTileXSize =
+                std::min(m_nTileXSize, nRasterXSize - nTileXOff);
+            const auto oKey = std::make_pair(nTileY, nTileX);
+
+            std::shared_ptr<const std::vector<GByte>> poData;
+            {
+                std::lock_guard<std::mutex> oLock(m_oMutex);
+                auto oIter = m_oTiles.find(oKey);
+                if (oIter != m_oTiles.end())
+                {
+                    oIter->second.nLastUse = nGeneration;
+                    poData = oIter->second.poData;
+                }
+            }
+
+            if (!poData)
+            {
+                auto poNewData = std::make_shared<std::vector<GByte>>();
+                try
+                {
+                    poNewData->resize(static_cast<size_t>(nTileXSize) *
+                                      nTileYSize * nWordSize * nBandCount);
+                }
+                catch (const std::exception &)
+                {
+                    CPLError(CE_Failure, CPLE_OutOfMemory,
+                             "Cannot allocate source tile");
+                    return CE_Failure;
+                }
+                const CPLErr eErr = poSrcDS->RasterIO(
+                    GF_Read, nTileXOff, nTileYOff, nTileXSize, nTileYSize,
+                    poNewData->data(), nTileXSize, nTileYSize, eDT,
+                    nBandCount, psOptions->panSrcBands, 0, 0, 0, nullptr);
+                if (eErr != CE_None)
+                    return eErr;
+                poData = poNewData;
+
+                std::lock_guard<std::mutex> oLock(m_oMutex);
+                // Another thread may have read the same tile concurrently
+                if (m_oTiles.find(oKey) == m_oTiles.end() &&
+                    MakeRoom(poData->size(), nGeneration))
+                {
+                    m_oTiles[oKey] = Tile{poData, nGeneration};
+                    m_nSize += poData->size();
+                }
+            }
+
+            // Copy the intersection of the tile and of the source window
+            const int nXMin = std::max(nSrcXOff, nTileXOff);
+            const int nXMax =
+                std::min(nSrcXOff + nSrcXSize, nTileXOff + nTileXSize);
+            const int nYMin = std::max(nSrcYOff, nTileYOff);
+            const int nYMax =
+                std::min(nSrcYOff + nSrcYSize, nTileYOff + nTileYSize);
+            const size_t nLineSize =
+                static_cast<size_t>(nXMax - nXMin) * nWordSize;
+            for (int iBand = 0; iBand < nBandCount; ++iBand)
+            {
+                const GByte *pabyTileBand =
+                    poData->data() + static_cast<size_t>(iBand) * nTileXSize *
+                                         nTileYSize * nWordSize;
+                GByte *pabyDstBand = pabyBuffer + iBand * nBandSpace;
+                for (int iY = nYMin; iY < nYMax; ++iY)
+                {
+                    memcpy(pabyDstBand +
+                               (static_cast<GPtrDiff_t>(iY - nSrcYOff) *
+                                    nSrcXSize +
+                                nXMin - nSrcXOff) *
+                                   nWordSize,
+                           pabyTileBand + (static_cast<size_t>(iY - nTileYOff) *
+                                               nTileXSize +
+                                           nXMin - nTileXOff) *
+                                              nWordSize,
+                           nLineSize);
+                }
+            }
+        }
+    }
+
+    return CE_None;
+}
+
+/************************************************************************/
+/*                         GDALWarpPrivateData                          */
+/************************************************************************/
+
 struct GDALWarpPrivateData
 {
     int nStepCount = 0;
     std::vector<int> abSuccess{};
     std::vector<double> adfDstX{};
     std::vector<double> adfDstY{};
+    std::unique_ptr<GDALWarpSrcTileCache> poSrcTileCache{};
 };
 
 static std::mutex gMutex{};
@@ -77,6 +282,61 @@ GetWarpPrivateData(GDALWarpOperation *poWarpOperation)
     }
 }
 
+/************************************************************************/
+/*                         CreateSrcTileCache()                         */
+/************************************************************************/
+
+// Instantiate the source tile cache if requested by the SRC_TILE_CACHE_SIZE
+// warp option. Returns false on invalid option value.
+static bool
+CreateSrcTileCache(const GDALWarpOptions *psOptions,
+                   std::unique_ptr<GDALWarpSrcTileCache> &poSrcTileCache)
+{
+    poSrcTileCache.reset();
+
+    const char *pszCacheSize =
+        CSLFetchNameValue(psOptions->papszWarpOptions, "SRC_TILE_CACHE_SIZE");
+    if (pszCacheSize == nullptr || psOptions->nBandCount == 0)
+        return true;
+
+    GIntBig nCacheSize = 0;
+    bool bUnitSpecified = false;
+    if (CPLParseMemorySize(pszCacheSize, &nCacheSize, &bUnitSpecified) !=
+        CE_None)
+    {
+        return false;
+    }
+    // Assume MB, as for GDAL_CACHEMAX
+    if (!bUnitSpecified && nCacheSize < 100000)
+        nCacheSize *= 1024 * 1024;
+    if (nCacheSize <= 0)
+        return true;
+
+    // Use tiles aligned on source blocks, but not too small to avoid
+    // excessive overhead with strip organized sources.
+    constexpr int MIN_TILE_SIZE = 256;
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    GDALGetBlockSize(
+        GDALGetRasterBand(psOptions->hSrcDS, psOptions->panSrcBands[0]),
+        &nBlockXSize, &nBlockYSize);
+    nBlockXSize = std::max(1, nBlockXSize);
+    nBlockYSize = std::max(1, nBlockYSize);
+    const int nTileXSize =
+        nBlockXSize * DIV_ROUND_UP(MIN_TILE_SIZE, nBlockXSize);
+    const int nTileYSize =
+        nBlockYSize * DIV_ROUND_UP(MIN_TILE_SIZE, nBlockYSize);
+
+    CPLDebug("WARP", "Using a source tile cache of " CPL_FRMT_GIB
+             " bytes, with %dx%d tiles",
+             nCacheSize, nTileXSize, nTileYSize);
+    poSrcTileCache = std::make_unique<GDALWarpSrcTileCache>(
+        nTileXSize, nTileYSize,
+        static_cast<size_t>(std::min<GUIntBig>(
+            nCacheSize, std::numeric_limits<size_t>::max())));
+    return true;
+}
+
 /************************************************************************/
 /* ==================================================================== */
 /*                          GDALWarpOperation                           */
@@ -680,12 +940,44 @@ GDALWarpOperation::Initialize(const GDALWarpOptions *psNewOptions,
     }
     else
     {
+        // Must be done before GWKThreadsCreate(), so that per-thread clones
+        // of the transformer inherit the setting. The 2-D grid mode is only
+        // used by the warp kernel, and is not enabled on a transformer
+        // owned by the caller, but on a clone of it.
+        m_psKernelTransformerArg.reset();
+        const char *pszGridStep = CSLFetchNameValue(
+            psOptions->papszWarpOptions, "APPROX_TRANSFORMER_GRID_STEP");
+        if (pszGridStep && atoi(pszGridStep) > 0 &&
+            GDALIsTransformer(psOptions->pTransformerArg,
+                              GDAL_APPROX_TRANSFORMER_CLASS_NAME))
+        {
+            if (psOptions->pTransformerArg == m_psOwnedTransformerArg.get())
+            {
+                GDALApproxTransformerSetGridStep(psOptions->pTransformerArg,
+                                                 atoi(pszGridStep));
+            }
+            else
+            {
+                m_psKernelTransformerArg.reset(
+                    GDALCloneTransformer(psOptions->pTransformerArg));
+                if (m_psKernelTransformerArg)
+                {
+                    GDALApproxTransformerSetGridStep(
+                        m_psKernelTransformerArg.get(), atoi(pszGridStep));
+                }
+            }
+        }
+
         psThreadData = GWKThreadsCreate(psOptions->papszWarpOptions,
                                         psOptions->pfnTransformer,
-                                        psOptions->pTransformerArg);
+                                        GetKernelTransformerArg());
         if (psThreadData == nullptr)
             eErr = CE_Failure;
 
+        if (!CreateSrcTileCache(psOptions,
+                                GetWarpPrivateData(this)->poSrcTileCache))
+            eErr = CE_Failure;
+
         /* --------------------------------------------------------------------
          */
         /*      Compute dstcoordinates of a few special points. */
@@ -1128,25 +1420,18 @@ struct ChunkThreadData
 {
     GDALWarpOperation *poOperation = nullptr;
     GDALWarpChunk *pasChunkInfo = nullptr;
-    CPLJoinableThread *hThreadHandle = nullptr;
     CPLErr eErr = CE_None;
     double dfProgressBase = 0;
     double dfProgressScale = 0;
+    double dfMemory = 0;
     CPLMutex *hIOMutex = nullptr;
 
-    CPLMutex *hCondMutex = nullptr;
-    volatile int bIOMutexTaken = 0;
-    CPLCond *hCond = nullptr;
-
     CPLErrorAccumulator *poErrorAccumulator = nullptr;
 };
 
-static void ChunkThreadMain(void *pThreadData)
+static void ChunkThreadMain(ChunkThreadData *psData)
 
 {
-    volatile ChunkThreadData *psData =
-        static_cast<volatile ChunkThreadData *>(pThreadData);
-
     GDALWarpChunk *pasChunkInfo = psData->pasChunkInfo;
 
     /* -------------------------------------------------------------------- */
@@ -1160,14 +1445,6 @@ static void ChunkThreadMain(void *pThreadData)
     }
     else
     {
-        if (psData->hCond != nullptr)
-        {
-            CPLAcquireMutex(psData->hCondMutex, 1.0);
-            psData->bIOMutexTaken = TRUE;
-            CPLCondSignal(psData->hCond);
-            CPLReleaseMutex(psData->hCondMutex);
-        }
-
         auto oAccumulator =
             psData->poErrorAccumulator->InstallForCurrentScope();
         CPL_IGNORE_RET_VAL(oAccumulator);
@@ -1179,15 +1456,38 @@ static void ChunkThreadMain(void *pThreadData)
             pasChunkInfo->sExtraSy, psData->dfProgressBase,
             psData->dfProgressScale);
 
-        /* --------------------------------------------------------------------
-         */
-        /*      Release the IO mutex. */
-        /* --------------------------------------------------------------------
-         */
+        /* ---------------------------------------------------------------- */
+        /*      Release the IO mutex.                                       */
+        /* ---------------------------------------------------------------- */
         CPLReleaseMutex(psData->hIOMutex);
     }
 }
 
+/************************************************************************/
+/*                       ChunkMonotonicProgress()                       */
+/************************************************************************/
+
+struct ChunkProgressData
+{
+    GDALProgressFunc pfnProgress = nullptr;
+    void *pProgressArg = nullptr;
+    std::mutex oMutex{};
+    double dfLastComplete = 0;
+};
+
+// Chunks in flight are not necessarily warped in the order of their
+// progress ranges, so never report a value lower than a previous one.
+static int CPL_STDCALL ChunkMonotonicProgress(double dfComplete,
+                                              const char *pszMessage,
+                                              void *pProgressArg)
+{
+    auto psData = static_cast<ChunkProgressData *>(pProgressArg);
+    std::lock_guard<std::mutex> oLock(psData->oMutex);
+    psData->dfLastComplete = std::max(psData->dfLastComplete, dfComplete);
+    return psData->pfnProgress(psData->dfLastComplete, pszMessage,
+                               psData->pProgressArg);
+}
+
 /************************************************************************/
 /*                         ChunkAndWarpMulti()                          */
 /************************************************************************/
@@ -1202,7 +1502,14 @@ static void ChunkThreadMain(void *pThreadData)
  *
  * Externally this method operates the same as ChunkAndWarpImage(), but
  * internally this method uses multiple threads to interleave input/output
- * for one region while the processing is being done for another.
+ * for some regions while the processing is being done for another.
+ *
+ * The number of regions in flight is set by the NUM_CHUNKS_IN_FLIGHT warp
+ * option (2 by default). The warping computation of regions is serialized,
+ * as is the access to the destination dataset. Source reads of different
+ * regions are done concurrently when more than 2 regions are in flight and
+ * the source dataset can be opened by each thread, and are serialized
+ * otherwise.
  *
  * @param nDstXOff X offset to window of destination data to be produced.
  * @param nDstYOff Y offset to window of destination data to be produced.
@@ -1222,127 +1529,181 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(int nDstXOff, int nDstYOff,
     CPLReleaseMutex(hIOMutex);
     CPLReleaseMutex(hWarpMutex);
 
-    CPLCond *hCond = CPLCreateCond();
-    CPLMutex *hCondMutex = CPLCreateMutex();
-    CPLReleaseMutex(hCondMutex);
-
     /* -------------------------------------------------------------------- */
-    /*      Collect the list of chunks to operate on.                       */
+    /*      How many chunks can be in flight? Beyond two, there is only     */
+    /*      benefit if the source dataset can be read from several          */
+    /*      threads.                                                        */
     /* -------------------------------------------------------------------- */
-    CollectChunkList(nDstXOff, nDstYOff, nDstXSize, nDstYSize);
+    int nMaxChunksInFlight =
+        std::max(1, atoi(CSLFetchNameValueDef(psOptions->papszWarpOptions,
+                                              "NUM_CHUNKS_IN_FLIGHT", "2")));
+    GDALDatasetH hThreadSafeSrcDS = nullptr;
+    if (nMaxChunksInFlight > 2)
+    {
+        if (GDALGetAccess(psOptions->hSrcDS) == GA_ReadOnly)
+        {
+            CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+            hThreadSafeSrcDS = GDALGetThreadSafeDataset(
+                psOptions->hSrcDS, GDAL_OF_RASTER, nullptr);
+        }
+        if (hThreadSafeSrcDS == nullptr)
+        {
+            CPLDebug("WARP",
+                     "Source dataset cannot be read from several threads. "
+                     "Limiting the number of chunks in flight to 2");
+            nMaxChunksInFlight = 2;
+        }
+    }
 
     /* -------------------------------------------------------------------- */
-    /*      Process them one at a time, updating the progress               */
-    /*      information for each region.                                    */
+    /*      Collect the list of chunks to operate on. The chunks in flight  */
+    /*      use at most the memory that the two chunks of the default       */
+    /*      setting use, so chunks are made smaller if there are more.      */
     /* -------------------------------------------------------------------- */
-    ChunkThreadData volatile asThreadData[2] = {};
+    const double dfWarpMemoryLimit = psOptions->dfWarpMemoryLimit;
+    const double dfMemoryBudget = 2 * dfWarpMemoryLimit;
+    if (nMaxChunksInFlight > 2)
+        psOptions->dfWarpMemoryLimit = dfMemoryBudget / nMaxChunksInFlight;
+    CollectChunkList(nDstXOff, nDstYOff, nDstXSize, nDstYSize);
+    psOptions->dfWarpMemoryLimit = dfWarpMemoryLimit;
+
     CPLErrorAccumulator oErrorAccumulator;
-    for (int i = 0; i < 2; ++i)
-    {
-        asThreadData[i].poOperation = this;
-        asThreadData[i].hIOMutex = hIOMutex;
-        asThreadData[i].poErrorAccumulator = &oErrorAccumulator;
-    }
+    std::vector<ChunkThreadData> asThreadData(nChunkListCount);
 
     double dfPixelsProcessed = 0.0;
     double dfTotalPixels = static_cast<double>(nDstXSize) * nDstYSize;
 
-    CPLErr eErr = CE_None;
-    for (int iChunk = 0; iChunk < nChunkListCount + 1; iChunk++)
+    for (int iChunk = 0; iChunk < nChunkListCount; iChunk++)
     {
-        int iThread = iChunk % 2;
+        GDALWarpChunk *pasThisChunk = pasChunkList + iChunk;
+        const double dfChunkPixels =
+            pasThisChunk->dsx * static_cast<double>(pasThisChunk->dsy);
 
-        /* --------------------------------------------------------------------
-         */
-        /*      Launch thread for this chunk. */
-        /* --------------------------------------------------------------------
-         */
-        if (pasChunkList != nullptr && iChunk < nChunkListCount)
-        {
-            GDALWarpChunk *pasThisChunk = pasChunkList + iChunk;
-            const double dfChunkPixels =
-                pasThisChunk->dsx * static_cast<double>(pasThisChunk->dsy);
+        auto &sThreadData = asThreadData[iChunk];
+        sThreadData.poOperation = this;
+        sThreadData.pasChunkInfo = pasThisChunk;
+        sThreadData.dfProgressBase = dfPixelsProcessed / dfTotalPixels;
+        sThreadData.dfProgressScale = dfChunkPixels / dfTotalPixels;
+        sThreadData.dfMemory =
+            GetWorkingMemoryForWindow(pasThisChunk->ssx, pasThisChunk->ssy,
+                                      pasThisChunk->dsx, pasThisChunk->dsy);
+        sThreadData.hIOMutex = hIOMutex;
+        sThreadData.poErrorAccumulator = &oErrorAccumulator;
 
-            asThreadData[iThread].dfProgressBase =
-                dfPixelsProcessed / dfTotalPixels;
-            asThreadData[iThread].dfProgressScale =
-                dfChunkPixels / dfTotalPixels;
+        dfPixelsProcessed += dfChunkPixels;
+    }
 
-            dfPixelsProcessed += dfChunkPixels;
+    /* -------------------------------------------------------------------- */
+    /*      Jobs waiting for the IO or warp mutex occupy a worker thread,   */
+    /*      so make room for the threads of the warp kernel too.            */
+    /* -------------------------------------------------------------------- */
+    const int nWarpThreads =
+        GDALGetNumThreads(psOptions->papszWarpOptions, "NUM_THREADS",
+                          GDAL_DEFAULT_MAX_THREAD_COUNT,
+                          /* bDefaultAllCPUs = */ false);
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(
+        nMaxChunksInFlight + (nWarpThreads > 1 ? nWarpThreads : 0));
 
-            asThreadData[iThread].pasChunkInfo = pasThisChunk;
+    CPLErr eErr = CE_None;
+    if (poThreadPool == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot create thread pool in ChunkAndWarpMulti()");
+        eErr = CE_Failure;
+    }
 
-            if (iChunk == 0)
-            {
-                asThreadData[iThread].hCond = hCond;
-                asThreadData[iThread].hCondMutex = hCondMutex;
-            }
-            else
-            {
-                asThreadData[iThread].hCond = nullptr;
-                asThreadData[iThread].hCondMutex = nullptr;
-            }
-            asThreadData[iThread].bIOMutexTaken = FALSE;
+    if (hThreadSafeSrcDS != nullptr)
+    {
+        CPLDebug("WARP", "Reading source dataset from several threads");
+        std::swap(psOptions->hSrcDS, hThreadSafeSrcDS);
+        m_bConcurrentSrcRead = true;
+    }
+
+    ChunkProgressData sProgressData;
+    sProgressData.pfnProgress = psOptions->pfnProgress;
+    sProgressData.pProgressArg = psOptions->pProgressArg;
+    psOptions->pfnProgress = ChunkMonotonicProgress;
+    psOptions->pProgressArg = &sProgressData;
+
+    /* -------------------------------------------------------------------- */
+    /*      Process the chunks, keeping at most nMaxChunksInFlight of       */
+    /*      them, and dfMemoryBudget bytes, in flight.                      */
+    /* -------------------------------------------------------------------- */
+    std::mutex oMutex;
+    std::condition_variable oCV;
+    std::vector<int> anFinishedChunks;  // protected by oMutex
+    int nChunksInFlight = 0;
+    double dfMemoryInFlight = 0;
+    int iNextChunk = 0;
+    while (true)
+    {
+        while (eErr == CE_None && iNextChunk < nChunkListCount &&
+               nChunksInFlight < nMaxChunksInFlight &&
+               (nChunksInFlight == 0 ||
+                dfMemoryInFlight + asThreadData[iNextChunk].dfMemory <=
+                    dfMemoryBudget))
+        {
+            const int iChunk = iNextChunk++;
+            ChunkThreadData *psChunkData = &asThreadData[iChunk];
 
             CPLDebug("GDAL", "Start chunk %d / %d.", iChunk, nChunkListCount);
-            asThreadData[iThread].hThreadHandle = CPLCreateJoinableThread(
-                ChunkThreadMain,
-                const_cast<ChunkThreadData *>(&asThreadData[iThread]));
-            if (asThreadData[iThread].hThreadHandle == nullptr)
-            {
-                CPLError(
-                    CE_Failure, CPLE_AppDefined,
-                    "CPLCreateJoinableThread() failed in ChunkAndWarpMulti()");
-                eErr = CE_Failure;
-                break;
-            }
+            ++nChunksInFlight;
+            dfMemoryInFlight += psChunkData->dfMemory;
+            if (!poThreadPool->SubmitJob(
+                    [psChunkData, iChunk, &oMutex, &oCV, &anFinishedChunks]()
+                    {
+                        ChunkThreadMain(psChunkData);
 
-            // Wait that the first thread has acquired the IO mutex before
-            // proceeding.  This will ensure that the first thread will run
-            // before the second one.
-            if (iChunk == 0)
+                        std::lock_guard<std::mutex> oLock(oMutex);
+                        anFinishedChunks.push_back(iChunk);
+                        oCV.notify_one();
+                    }))
             {
-                CPLAcquireMutex(hCondMutex, 1.0);
-                while (asThreadData[iThread].bIOMutexTaken == FALSE)
-                    CPLCondWait(hCond, hCondMutex);
-                CPLReleaseMutex(hCondMutex);
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "SubmitJob() failed in ChunkAndWarpMulti()");
+                --nChunksInFlight;
+                dfMemoryInFlight -= psChunkData->dfMemory;
+                eErr = CE_Failure;
             }
         }
 
-        /* --------------------------------------------------------------------
-         */
-        /*      Wait for previous chunks thread to complete. */
-        /* --------------------------------------------------------------------
-         */
-        if (iChunk > 0)
+        if (nChunksInFlight == 0)
+            break;
+
+        /* ---------------------------------------------------------------- */
+        /*      Wait for at least one chunk to complete.                    */
+        /* ---------------------------------------------------------------- */
+        std::vector<int> anFinishedChunksThisIter;
         {
-            iThread = (iChunk - 1) % 2;
+            std::unique_lock<std::mutex> oLock(oMutex);
+            oCV.wait(oLock, [&anFinishedChunks]
+                     { return !anFinishedChunks.empty(); });
+            std::swap(anFinishedChunksThisIter, anFinishedChunks);
+        }
 
-            // Wait for thread to finish.
-            CPLJoinThread(asThreadData[iThread].hThreadHandle);
-            asThreadData[iThread].hThreadHandle = nullptr;
+        for (const int iChunk : anFinishedChunksThisIter)
+        {
+            --nChunksInFlight;
+            dfMemoryInFlight -= asThreadData[iChunk].dfMemory;
 
-            CPLDebug("GDAL", "Finished chunk %d / %d.", iChunk - 1,
+            CPLDebug("GDAL", "Finished chunk %d / %d.", iChunk,
                      nChunkListCount);
 
-            eErr = asThreadData[iThread].eErr;
-
-            if (eErr != CE_None)
-                break;
+            if (eErr == CE_None)
+                eErr = asThreadData[iChunk].eErr;
         }
     }
 
-    /* -------------------------------------------------------------------- */
-    /*      Wait for all threads to complete.                               */
-    /* -------------------------------------------------------------------- */
-    for (int iThread = 0; iThread < 2; iThread++)
+    psOptions->pfnProgress = sProgressData.pfnProgress;
+    psOptions->pProgressArg = sProgressData.pProgressArg;
+
+    if (m_bConcurrentSrcRead)
     {
-        if (asThreadData[iThread].hThreadHandle)
-            CPLJoinThread(asThreadData[iThread].hThreadHandle);
+        std::swap(psOptions->hSrcDS, hThreadSafeSrcDS);
+        m_bConcurrentSrcRead = false;
     }
-
-    CPLDestroyCond(hCond);
-    CPLDestroyMutex(hCondMutex);
+    if (hThreadSafeSrcDS != nullptr)
+        GDALReleaseDataset(hThreadSafeSrcDS);
 
     WipeChunkList();
 
@@ -1985,7 +2346,7 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     oWK.eWorkingDataType = psOptions->eWorkingDataType;
 
     oWK.pfnTransformer = psOptions->pfnTransformer;
-    oWK.pTransformerArg = psOptions->pTransformerArg;
+    oWK.pTransformerArg = GetKernelTransformerArg();
 
     oWK.pfnProgress = psOptions->pfnProgress;
     oWK.pProgress = psOptions->pProgressArg;
@@ -2049,7 +2410,29 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
                  WARP_EXTRA_ELTS) *
                 i;
 
-    if (eErr == CE_None && nSrcXSize > 0 && nSrcYSize > 0)
+    /* -------------------------------------------------------------------- */
+    /*      The IO mutex, if any, is held on entry. It is not needed to     */
+    /*      read a source dataset that can be read from several threads.   */
+    /* -------------------------------------------------------------------- */
+    bool bIOMutexHeld = hIOMutex != nullptr;
+    if (bIOMutexHeld && m_bConcurrentSrcRead)
+    {
+        CPLReleaseMutex(hIOMutex);
+        bIOMutexHeld = false;
+    }
+
+    GDALWarpSrcTileCache *poSrcTileCache =
+        GetWarpPrivateData(this)->poSrcTileCache.get();
+    if (eErr == CE_None && nSrcXSize > 0 && nSrcYSize > 0 &&
+        poSrcTileCache != nullptr)
+    {
+        eErr = poSrcTileCache->Read(
+            psOptions, nSrcXOff, nSrcYOff, nSrcXSize, nSrcYSize,
+            oWK.papabySrcImage[0],
+            nWordSize * (static_cast<GPtrDiff_t>(nSrcXSize) * nSrcYSize +
+                         WARP_EXTRA_ELTS));
+    }
+    else if (eErr == CE_None && nSrcXSize > 0 && nSrcYSize > 0)
     {
         GDALDataset *poSrcDS = GDALDataset::FromHandle(psOptions->hSrcDS);
         if (psOptions->nBandCount == 1)
@@ -2179,11 +2562,27 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
 
         eErr = CreateKernelMask(&oWK, 0 /* not used */, "DstDensity");
 
+        // Reads the destination alpha band
+        bool bIOMutexAcquired = false;
+        if (eErr == CE_None && hIOMutex != nullptr && !bIOMutexHeld)
+        {
+            bIOMutexAcquired = CPL_TO_BOOL(CPLAcquireMutex(hIOMutex, 600.0));
+            if (!bIOMutexAcquired)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Failed to acquire IOMutex in WarpRegion().");
+                eErr = CE_Failure;
+            }
+        }
+
         if (eErr == CE_None)
             eErr = GDALWarpDstAlphaMasker(
                 psOptions, psOptions->nBandCount, psOptions->eWorkingDataType,
                 oWK.nDstXOff, oWK.nDstYOff, oWK.nDstXSize, oWK.nDstYSize,
                 oWK.papabyDstImage, TRUE, oWK.pafDstDensity);
+
+        if (bIOMutexAcquired)
+            CPLReleaseMutex(hIOMutex);
     }
 
     /* -------------------------------------------------------------------- */
@@ -2395,7 +2794,8 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     /* -------------------------------------------------------------------- */
     if (hIOMutex != nullptr)
     {
-        CPLReleaseMutex(hIOMutex);
+        if (bIOMutexHeld)
+            CPLReleaseMutex(hIOMutex);
         if (!CPLAcquireMutex(hWarpMutex, 600.0))
         {
             CPLError(CE_Failure, CPLE_AppDefined,
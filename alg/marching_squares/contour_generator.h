@@ -13,13 +13,20 @@
 #ifndef MARCHING_SQUARES_CONTOUR_GENERATOR_H
 #define MARCHING_SQUARES_CONTOUR_GENERATOR_H
 
-#include <vector>
 #include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
 
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
+#include "gdal_thread_pool.h"
 
 #include "utility.h"
 #include "point.h"
+#include "segment_recorder.h"
 #include "square.h"
 
 namespace marching_squares
@@ -54,7 +61,18 @@ class ContourGenerator
         return CE_None;
     }
 
-  private:
+    // Start at line lineIdx instead of line 0. previousLine holds the values
+    // of line lineIdx - 1, and is ignored if lineIdx is 0. This allows
+    // contouring bands of lines independently.
+    void startAtLine(size_t lineIdx, const double *previousLine)
+    {
+        lineIdx_ = lineIdx;
+        if (lineIdx > 0)
+            std::copy(previousLine, previousLine + width_,
+                      previousLine_.begin());
+    }
+
+  protected:
     size_t width_;
     size_t height_;
     bool hasNoData_;
@@ -67,6 +85,7 @@ class ContourGenerator
     ContourWriter &writer_;
     LevelGenerator &levelGenerator_;
 
+  private:
     class ExtendedLine
     {
       public:
@@ -151,8 +170,15 @@ class ContourGeneratorFromRaster
     }
 
     bool process(GDALProgressFunc progressFunc = nullptr,
-                 void *progressData = nullptr)
+                 void *progressData = nullptr, int numThreads = 1)
     {
+        if (numThreads > 1 &&
+            this->height_ >= 2 * MIN_BAND_HEIGHT)
+        {
+            return processMultiThreaded_(numThreads, progressFunc,
+                                         progressData);
+        }
+
         size_t width = GDALGetRasterBandXSize(band_);
         size_t height = GDALGetRasterBandYSize(band_);
         std::vector<double> line;
@@ -184,6 +210,143 @@ class ContourGeneratorFromRaster
   private:
     const GDALRasterBandH band_;
 
+    static constexpr size_t MIN_BAND_HEIGHT = 16;
+
+    // Bands of lines are contoured in parallel into SegmentRecorder's, which
+    // are replayed in order to the writer, so that the output is identical
+    // to the one of process() with a single thread.
+    bool processMultiThreaded_(int numThreads, GDALProgressFunc progressFunc,
+                               void *progressData)
+    {
+        typedef ContourGenerator<SegmentRecorder, LevelGenerator>
+            BandGenerator;
+
+        const size_t width = this->width_;
+        const size_t height = this->height_;
+        const size_t bandHeight =
+            std::max(MIN_BAND_HEIGHT,
+                     (height + 16 * numThreads - 1) / (16 * numThreads));
+        const size_t bandCount = (height + bandHeight - 1) / bandHeight;
+
+        struct Band
+        {
+            std::unique_ptr<SegmentRecorder> recorder{};
+            std::atomic<bool> done{false};
+            bool ok = true;
+            // Exception thrown while processing the band, rethrown by the
+            // calling thread so that it is reported as in single-threaded
+            // mode.
+            std::exception_ptr exception{};
+        };
+
+        std::vector<Band> bands(bandCount);
+        std::mutex ioMutex;
+        std::atomic<bool> stop{false};
+
+        const auto processBand = [&, this](size_t bandIdx)
+        {
+            Band &band = bands[bandIdx];
+            const size_t firstLine = bandIdx * bandHeight;
+            const size_t endLine = std::min(height, firstLine + bandHeight);
+            try
+            {
+                // Also read the line above the band, if any
+                const size_t firstReadLine = firstLine > 0 ? firstLine - 1 : 0;
+                std::vector<double> lines(width * (endLine - firstReadLine));
+                {
+                    std::lock_guard oLock(ioMutex);
+                    if (GDALRasterIO(band_, GF_Read, 0, int(firstReadLine),
+                                     int(width), int(endLine - firstReadLine),
+                                     lines.data(), int(width),
+                                     int(endLine - firstReadLine), GDT_Float64,
+                                     0, 0) != CE_None)
+                    {
+                        CPLDebug("CONTOUR", "failed fetch %d %d",
+                                 int(firstReadLine), int(width));
+                        band.ok = false;
+                    }
+                }
+                if (band.ok)
+                {
+                    band.recorder = std::make_unique<SegmentRecorder>(
+                        this->writer_.polygonize);
+                    BandGenerator cg(width, height, this->hasNoData_,
+                                     this->noDataValue_, *band.recorder,
+                                     this->levelGenerator_);
+                    const double *line = lines.data();
+                    if (firstLine > 0)
+                    {
+                        cg.startAtLine(firstLine, line);
+                        line += width;
+                    }
+                    for (size_t lineIdx = firstLine; lineIdx < endLine && !stop;
+                         ++lineIdx, line += width)
+                    {
+                        cg.feedLine(line);
+                    }
+                }
+            }
+            catch (...)
+            {
+                band.exception = std::current_exception();
+                band.ok = false;
+            }
+            band.done = true;
+        };
+
+        auto jobQueue = GDALGetGlobalThreadPool(numThreads)->CreateJobQueue();
+        // Limit the number of bands waiting to be replayed
+        const size_t maxBandsInFlight = 2 * static_cast<size_t>(numThreads);
+        size_t nextBandToSubmit = 0;
+        bool ok = true;
+        try
+        {
+            for (size_t bandIdx = 0; bandIdx < bandCount && ok; ++bandIdx)
+            {
+                while (nextBandToSubmit < bandCount &&
+                       nextBandToSubmit < bandIdx + maxBandsInFlight)
+                {
+                    const size_t idx = nextBandToSubmit++;
+                    jobQueue->SubmitJob([&processBand, idx]
+                                        { processBand(idx); });
+                }
+
+                if (progressFunc &&
+                    progressFunc(double(bandIdx * bandHeight) / height,
+                                 "Processing line", progressData) == FALSE)
+                {
+                    ok = false;
+                    break;
+                }
+
+                Band &band = bands[bandIdx];
+                while (!band.done)
+                    jobQueue->WaitEvent();
+                if (band.exception)
+                    std::rethrow_exception(band.exception);
+                if (!band.ok)
+                {
+                    ok = false;
+                    break;
+                }
+                band.recorder->replay(this->writer_);
+                band.recorder.reset();
+            }
+        }
+        catch (...)
+        {
+            stop = true;
+            jobQueue->WaitCompletion();
+            throw;
+        }
+        stop = true;
+        jobQueue->WaitCompletion();
+
+        if (ok && progressFunc)
+            progressFunc(1.0, "", progressData);
+        return ok;
+    }
+
     ContourGeneratorFromRaster(const ContourGeneratorFromRaster &) = delete;
     ContourGeneratorFromRaster &
     operator=(const ContourGeneratorFromRaster &) = delete;
@@ -0,0 +1,88 @@
+/******************************************************************************
+ *
+ * Project:  Marching square algorithm
+ * Purpose:  Record segments so that bands of lines can be contoured
+ *           independently.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+#ifndef MARCHING_SQUARES_SEGMENT_RECORDER_H
+#define MARCHING_SQUARES_SEGMENT_RECORDER_H
+
+#include "point.h"
+
+#include <vector>
+
+namespace marching_squares
+{
+
+// SegmentRecorder: a writer that stores the segments produced by a
+// ContourGenerator working on a band of lines. The segments can then be
+// replayed, in the order in which they were produced, to another writer
+// (typically a SegmentMerger), which stitches them with the ones of the
+// neighbouring bands.
+struct SegmentRecorder
+{
+    explicit SegmentRecorder(bool polygonize_) : polygonize(polygonize_)
+    {
+    }
+
+    void addSegment(int levelIdx, const Point &start, const Point &end)
+    {
+        segments_.push_back(Segment{levelIdx, false, start, end});
+    }
+
+    void addBorderSegment(int levelIdx, const Point &start, const Point &end)
+    {
+        segments_.push_back(Segment{levelIdx, true, start, end});
+    }
+
+    void beginningOfLine()
+    {
+    }
+
+    void endOfLine()
+    {
+        lineEnds_.push_back(segments_.size());
+    }
+
+    // Replay the recorded lines to writer
+    template <typename Writer> void replay(Writer &writer) const
+    {
+        size_t i = 0;
+        for (const size_t lineEnd : lineEnds_)
+        {
+            writer.beginningOfLine();
+            for (; i < lineEnd; ++i)
+            {
+                const Segment &s = segments_[i];
+                if (s.border)
+                    writer.addBorderSegment(s.levelIdx, s.start, s.end);
+                else
+                    writer.addSegment(s.levelIdx, s.start, s.end);
+            }
+            writer.endOfLine();
+        }
+    }
+
+    const bool polygonize;
+
+  private:
+    struct Segment
+    {
+        int levelIdx;
+        bool border;
+        Point start;
+        Point end;
+    };
+
+    std::vector<Segment> segments_{};
+    // index in segments_ of the end of each line
+    std::vector<size_t> lineEnds_{};
+};
+
+}  // namespace marching_squares
+#endif
@@ -19,14 +19,18 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <utility>
 #include <vector>
 
 #include "gdal_alg_priv.h"
 #include "gdal.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "cpl_conv.h"
@@ -34,6 +38,7 @@
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 
 #include "polygonize_polygonizer.h"
 
@@ -65,6 +70,537 @@ static CPLErr GPMaskImageData(GDALRasterBandH hMaskBand, GByte *pabyMaskLine,
     return CE_None;
 }
 
+/************************************************************************/
+/*                         GDALPolygonizeBand                           */
+/************************************************************************/
+
+// Minimum number of lines of the row bands processed in parallel
+constexpr int GP_MIN_BAND_HEIGHT = 16;
+
+/* Row band processed independently by the multi-threaded implementation */
+template <class DataType, class EqualityTest> struct GDALPolygonizeBand
+{
+    int nFirstLine = 0;
+    int nEndLine = 0;
+    CPLErr eErr = CE_None;
+    std::atomic<bool> bDone{false};
+
+    // First pass: polygon enumeration of the band, and first and last lines
+    // with their final polygon id in the band.
+    std::unique_ptr<GDALRasterPolygonEnumeratorT<DataType, EqualityTest>>
+        poEnum{};
+    GInt32 nIdOffset = 0;
+    std::vector<DataType> anFirstLineVal{};
+    std::vector<GInt32> anFirstLineId{};
+    std::vector<DataType> anLastLineVal{};
+    std::vector<GInt32> anLastLineId{};
+
+    // Second pass: polygons completed in the band, and parts of polygons
+    // crossing its boundaries.
+    std::vector<std::pair<std::unique_ptr<RPolygon>, DataType>>
+        aoCompletedPolygons{};
+    std::vector<BoundaryArc<GInt32>> aoTopArcs{};
+    std::vector<PartialPolygon<GInt32, DataType>> aoCompletedPartialPolygons{};
+    std::map<GInt32, std::unique_ptr<RPolygon>> oOpenPolygons{};
+    std::vector<BoundaryArc<GInt32>> aoBottomArcs{};
+};
+
+/************************************************************************/
+/*                        GDALPolygonCollector                          */
+/************************************************************************/
+
+/* Keep the polygons completed by the Polygonizer of a band, so that they */
+/* can be written by the main thread. */
+template <class DataType>
+class GDALPolygonCollector final : public PolygonReceiver<DataType>
+{
+  public:
+    std::vector<std::pair<std::unique_ptr<RPolygon>, DataType>> aoPolygons{};
+
+    void receive(RPolygon *poPolygon, DataType nPolygonCellValue) override
+    {
+        auto poCopy = std::make_unique<RPolygon>();
+        poCopy->iBottomRightRow = poPolygon->iBottomRightRow;
+        poCopy->iBottomRightCol = poPolygon->iBottomRightCol;
+        poCopy->oArcs = std::move(poPolygon->oArcs);
+        aoPolygons.emplace_back(std::move(poCopy), nPolygonCellValue);
+    }
+};
+
+/************************************************************************/
+/*                          GPEnumerateBand()                           */
+/*                                                                      */
+/*      First pass over a band of the raster.                           */
+/************************************************************************/
+
+template <class DataType, class EqualityTest, class ReadLineFunc>
+static void GPEnumerateBand(GDALPolygonizeBand<DataType, EqualityTest> &oBand,
+                            int nXSize, int nConnectedness,
+                            ReadLineFunc &ReadLine,
+                            const std::atomic<bool> &bStop)
+{
+    try
+    {
+        oBand.poEnum = std::make_unique<
+            GDALRasterPolygonEnumeratorT<DataType, EqualityTest>>(
+            nConnectedness);
+        std::vector<DataType> anLastLineVal(nXSize);
+        std::vector<DataType> anThisLineVal(nXSize);
+        std::vector<GInt32> anLastLineId(nXSize);
+        std::vector<GInt32> anThisLineId(nXSize);
+        std::vector<GByte> abyMaskLine(nXSize);
+
+        for (int iY = oBand.nFirstLine; iY < oBand.nEndLine; iY++)
+        {
+            if (bStop ||
+                ReadLine(iY, anThisLineVal.data(), abyMaskLine.data()) !=
+                    CE_None)
+            {
+                oBand.eErr = CE_Failure;
+                return;
+            }
+
+            const bool bFirstLine = iY == oBand.nFirstLine;
+            if (!oBand.poEnum->ProcessLine(
+                    bFirstLine ? nullptr : anLastLineVal.data(),
+                    anThisLineVal.data(),
+                    bFirstLine ? nullptr : anLastLineId.data(),
+                    anThisLineId.data(), nXSize))
+            {
+                oBand.eErr = CE_Failure;
+                return;
+            }
+
+            if (bFirstLine)
+            {
+                oBand.anFirstLineVal = anThisLineVal;
+                oBand.anFirstLineId = anThisLineId;
+            }
+
+            std::swap(anLastLineVal, anThisLineVal);
+            std::swap(anLastLineId, anThisLineId);
+        }
+
+        oBand.poEnum->CompleteMerges();
+
+        oBand.anLastLineVal = std::move(anLastLineVal);
+        oBand.anLastLineId = std::move(anLastLineId);
+        for (auto *panLineId : {&oBand.anFirstLineId, &oBand.anLastLineId})
+        {
+            for (auto &nId : *panLineId)
+            {
+                if (nId >= 0)
+                    nId = oBand.poEnum->panPolyIdMap[nId];
+            }
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in GDALPolygonize()");
+        oBand.eErr = CE_Failure;
+    }
+}
+
+/************************************************************************/
+/*                       GPMergeBandPolygonIds()                        */
+/*                                                                      */
+/*      Assign to the polygons of all bands a global id, merging        */
+/*      those connected across band boundaries.                         */
+/************************************************************************/
+
+template <class DataType, class EqualityTest>
+static bool GPMergeBandPolygonIds(
+    std::vector<GDALPolygonizeBand<DataType, EqualityTest>> &aoBands,
+    int nXSize, int nConnectedness, std::vector<GInt32> &anGlobalId)
+{
+    GIntBig nTotalIds = 0;
+    for (auto &oBand : aoBands)
+    {
+        oBand.nIdOffset = static_cast<GInt32>(nTotalIds);
+        nTotalIds += oBand.poEnum->nNextPolygonId;
+        // Keep std::numeric_limits<GInt32>::max() for the outer polygon
+        if (nTotalIds >= std::numeric_limits<GInt32>::max())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "GDALPolygonize(): maximum number of polygons reached");
+            return false;
+        }
+    }
+
+    try
+    {
+        anGlobalId.resize(static_cast<size_t>(nTotalIds));
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in GDALPolygonize()");
+        return false;
+    }
+    std::iota(anGlobalId.begin(), anGlobalId.end(), 0);
+
+    // Union-find where the root of a set is its smallest id
+    const auto Find = [&anGlobalId](GInt32 nId)
+    {
+        while (anGlobalId[nId] != nId)
+        {
+            anGlobalId[nId] = anGlobalId[anGlobalId[nId]];
+            nId = anGlobalId[nId];
+        }
+        return nId;
+    };
+
+    EqualityTest eq;
+    for (size_t iBand = 1; iBand < aoBands.size(); ++iBand)
+    {
+        const auto &oAbove = aoBands[iBand - 1];
+        auto &oBelow = aoBands[iBand];
+        for (int i = 0; i < nXSize; i++)
+        {
+            const GInt32 nId = oBelow.anFirstLineId[i];
+            if (nId < 0)
+                continue;
+            const int iStart = nConnectedness == 8 ? std::max(0, i - 1) : i;
+            const int iEnd =
+                nConnectedness == 8 ? std::min(nXSize - 1, i + 1) : i;
+            for (int j = iStart; j <= iEnd; j++)
+            {
+                const GInt32 nAboveId = oAbove.anLastLineId[j];
+                if (nAboveId >= 0 &&
+                    eq(oAbove.anLastLineVal[j], oBelow.anFirstLineVal[i]))
+                {
+                    const GInt32 nRoot1 = Find(oAbove.nIdOffset + nAboveId);
+                    const GInt32 nRoot2 = Find(oBelow.nIdOffset + nId);
+                    if (nRoot1 < nRoot2)
+                        anGlobalId[nRoot2] = nRoot1;
+                    else
+                        anGlobalId[nRoot1] = nRoot2;
+                }
+            }
+        }
+        oBelow.anFirstLineVal = std::vector<DataType>();
+        oBelow.anFirstLineId = std::vector<GInt32>();
+    }
+
+    // As a parent has always a smaller id than its children, a single pass
+    // maps every id to its root.
+    for (auto &nId : anGlobalId)
+        nId = anGlobalId[nId];
+
+    return true;
+}
+
+/************************************************************************/
+/*                         GPPolygonizeBand()                           */
+/*                                                                      */
+/*      Second pass over a band of the raster.                          */
+/************************************************************************/
+
+template <class DataType, class EqualityTest, class ReadLineFunc>
+static void
+GPPolygonizeBand(GDALPolygonizeBand<DataType, EqualityTest> &oBand,
+                 const GDALPolygonizeBand<DataType, EqualityTest> *poPrevBand,
+                 bool bLastBand, int nXSize,
+                 const std::vector<GInt32> &anGlobalId, int nConnectedness,
+                 ReadLineFunc &ReadLine, const std::atomic<bool> &bStop)
+{
+    try
+    {
+        std::vector<DataType> anLastLineVal(nXSize);
+        std::vector<DataType> anThisLineVal(nXSize);
+        std::vector<GInt32> anLastLineId(nXSize);
+        std::vector<GInt32> anThisLineId(nXSize);
+        std::vector<GInt32> anPolyId(nXSize);
+        std::vector<GByte> abyMaskLine(nXSize);
+        std::vector<TwoArm> aoLastLineArm(nXSize + 2);
+        std::vector<TwoArm> aoThisLineArm(nXSize + 2);
+
+        GDALPolygonCollector<DataType> oCollector;
+        Polygonizer<GInt32, DataType> oPolygonizer{-1, &oCollector};
+        GDALRasterPolygonEnumeratorT<DataType, EqualityTest> oEnum(
+            nConnectedness);
+
+        if (poPrevBand == nullptr)
+        {
+            for (auto &oArm : aoLastLineArm)
+                oArm.poPolyInside = oPolygonizer.getTheOuterPolygon();
+        }
+        else
+        {
+            // Start from the last line of the previous band
+            for (int iX = 0; iX < nXSize; iX++)
+            {
+                const GInt32 nId = poPrevBand->anLastLineId[iX];
+                anPolyId[iX] =
+                    nId < 0 ? -1 : anGlobalId[poPrevBand->nIdOffset + nId];
+            }
+            anLastLineVal = poPrevBand->anLastLineVal;
+            if (!oPolygonizer.seedLine(anPolyId.data(), aoLastLineArm.data(),
+                                       oBand.nFirstLine - 1, nXSize,
+                                       oBand.aoTopArcs))
+            {
+                oBand.eErr = CE_Failure;
+                return;
+            }
+        }
+
+        // The last band processes an extra line, outside of the raster, to
+        // complete all polygons.
+        const int nEndLine = bLastBand ? oBand.nEndLine + 1 : oBand.nEndLine;
+        for (int iY = oBand.nFirstLine; iY < nEndLine; iY++)
+        {
+            if (bStop)
+            {
+                oBand.eErr = CE_Failure;
+                return;
+            }
+
+            if (iY < oBand.nEndLine)
+            {
+                // Redo the enumeration of the first pass
+                const bool bFirstLine = iY == oBand.nFirstLine;
+                if (ReadLine(iY, anThisLineVal.data(), abyMaskLine.data()) !=
+                        CE_None ||
+                    !oEnum.ProcessLine(
+                        bFirstLine ? nullptr : anLastLineVal.data(),
+                        anThisLineVal.data(),
+                        bFirstLine ? nullptr : anLastLineId.data(),
+                        anThisLineId.data(), nXSize))
+                {
+                    oBand.eErr = CE_Failure;
+                    return;
+                }
+
+                for (int iX = 0; iX < nXSize; iX++)
+                {
+                    const GInt32 nId = anThisLineId[iX];
+                    anPolyId[iX] =
+                        nId < 0 ? -1
+                                : anGlobalId[oBand.nIdOffset +
+                                             oBand.poEnum->panPolyIdMap[nId]];
+                }
+            }
+            else
+            {
+                std::fill(anPolyId.begin(), anPolyId.end(),
+                          decltype(oPolygonizer)::THE_OUTER_POLYGON_ID);
+            }
+
+            if (!oPolygonizer.processLine(anPolyId.data(), anLastLineVal.data(),
+                                          aoThisLineArm.data(),
+                                          aoLastLineArm.data(), iY, nXSize))
+            {
+                oBand.eErr = CE_Failure;
+                return;
+            }
+
+            std::swap(anLastLineVal, anThisLineVal);
+            std::swap(anLastLineId, anThisLineId);
+            std::swap(aoThisLineArm, aoLastLineArm);
+        }
+
+        oBand.aoCompletedPolygons = std::move(oCollector.aoPolygons);
+        oBand.aoCompletedPartialPolygons =
+            oPolygonizer.releaseCompletedPartialPolygons();
+        if (!bLastBand)
+        {
+            oPolygonizer.releaseOpenPolygons(aoLastLineArm.data(), nXSize,
+                                             oBand.oOpenPolygons,
+                                             oBand.aoBottomArcs);
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in GDALPolygonize()");
+        oBand.eErr = CE_Failure;
+    }
+}
+
+/************************************************************************/
+/*                   GDALPolygonizeMultiThreadedT()                     */
+/*                                                                      */
+/*      The raster is split in bands of lines, whose polygons are       */
+/*      enumerated and traced by jobs of the global thread pool. The    */
+/*      polygons crossing band boundaries are then merged in order by   */
+/*      the calling thread, which also writes all polygons.             */
+/************************************************************************/
+
+template <class DataType, class EqualityTest>
+static CPLErr GDALPolygonizeMultiThreadedT(
+    GDALRasterBandH hSrcBand, GDALRasterBandH hMaskBand, int nXSize,
+    int nYSize, int nConnectedness, int nThreads,
+    OGRPolygonWriter<DataType> &oPolygonWriter, GDALProgressFunc pfnProgress,
+    void *pProgressArg, GDALDataType eDT)
+{
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poThreadPool)
+        return CE_Failure;
+
+    // Enough bands to balance the load between threads, while keeping them
+    // high enough for the cost of merging boundaries to be negligible.
+    const int nBandHeight =
+        std::max(GP_MIN_BAND_HEIGHT,
+                 static_cast<int>(DIV_ROUND_UP(static_cast<GIntBig>(nYSize),
+                                               16 * nThreads)));
+    const int nBands = static_cast<int>(DIV_ROUND_UP(nYSize, nBandHeight));
+    std::vector<GDALPolygonizeBand<DataType, EqualityTest>> aoBands(nBands);
+    for (int iBand = 0; iBand < nBands; ++iBand)
+    {
+        aoBands[iBand].nFirstLine = iBand * nBandHeight;
+        aoBands[iBand].nEndLine = std::min(nYSize, (iBand + 1) * nBandHeight);
+    }
+    CPLDebug("GDALPolygonize", "Using %d threads on %d bands of %d lines",
+             nThreads, nBands, nBandHeight);
+
+    // Datasets are not thread-safe: serialize reading
+    std::mutex oReadMutex;
+    auto ReadLine = [hSrcBand, hMaskBand, nXSize, eDT,
+                     &oReadMutex](int iY, DataType *panLineVal,
+                                  GByte *pabyMaskLine)
+    {
+        std::lock_guard oLock(oReadMutex);
+        CPLErr eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iY, nXSize, 1,
+                                   panLineVal, nXSize, 1, eDT, 0, 0);
+        if (eErr == CE_None && hMaskBand != nullptr)
+            eErr = GPMaskImageData(hMaskBand, pabyMaskLine, iY, nXSize,
+                                   panLineVal);
+        return eErr;
+    };
+
+    std::atomic<bool> bStop{false};
+    std::atomic<int> nBandsDone{0};
+    CPLErr eErr = CE_None;
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+
+    /* -------------------------------------------------------------------- */
+    /*      First pass: enumerate the polygons of each band.                */
+    /* -------------------------------------------------------------------- */
+    for (auto &oBand : aoBands)
+    {
+        poJobQueue->SubmitJob(
+            [&oBand, nXSize, nConnectedness, &ReadLine, &bStop, &nBandsDone]
+            {
+                GPEnumerateBand(oBand, nXSize, nConnectedness, ReadLine,
+                                bStop);
+                ++nBandsDone;
+            });
+    }
+    while (poJobQueue->WaitEvent())
+    {
+        if (eErr == CE_None &&
+            !pfnProgress(0.10 * nBandsDone / nBands, "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+            bStop = true;
+        }
+    }
+    poJobQueue->WaitCompletion();
+    for (const auto &oBand : aoBands)
+    {
+        if (oBand.eErr != CE_None)
+            eErr = CE_Failure;
+    }
+
+    std::vector<GInt32> anGlobalId;
+    if (eErr != CE_None ||
+        !GPMergeBandPolygonIds(aoBands, nXSize, nConnectedness, anGlobalId))
+    {
+        return CE_Failure;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Second pass: trace the polygons of each band, and merge in      */
+    /*      order those crossing boundaries. The number of bands in         */
+    /*      flight is bounded, as their polygons are kept in memory until   */
+    /*      written.                                                        */
+    /* -------------------------------------------------------------------- */
+    BandStitcher<GInt32, DataType> oStitcher{-1, &oPolygonWriter};
+    const auto SubmitBand = [&](int iBand)
+    {
+        poJobQueue->SubmitJob(
+            [&aoBands, iBand, nBands, nXSize, &anGlobalId, nConnectedness,
+             &ReadLine, &bStop]
+            {
+                auto &oBand = aoBands[iBand];
+                GPPolygonizeBand(oBand,
+                                 iBand > 0 ? &aoBands[iBand - 1] : nullptr,
+                                 iBand == nBands - 1, nXSize, anGlobalId,
+                                 nConnectedness, ReadLine, bStop);
+                oBand.bDone = true;
+            });
+    };
+    const int nMaxBandsInFlight = 2 * nThreads;
+    int iNextBand = 0;
+    for (; iNextBand < std::min(nBands, nMaxBandsInFlight); ++iNextBand)
+        SubmitBand(iNextBand);
+
+    for (int iBand = 0; iBand < nBands && eErr == CE_None; ++iBand)
+    {
+        auto &oBand = aoBands[iBand];
+        while (!oBand.bDone)
+            poJobQueue->WaitEvent();
+        eErr = oBand.eErr;
+        if (eErr != CE_None)
+            break;
+
+        for (auto &oPolygon : oBand.aoCompletedPolygons)
+        {
+            oPolygonWriter.receive(oPolygon.first.get(), oPolygon.second);
+            eErr = oPolygonWriter.getErr();
+            if (eErr != CE_None)
+                break;
+        }
+        oBand.aoCompletedPolygons.clear();
+
+        if (eErr == CE_None &&
+            !oStitcher.addBand(oBand.aoTopArcs,
+                               oBand.aoCompletedPartialPolygons,
+                               oBand.oOpenPolygons, oBand.aoBottomArcs))
+        {
+            eErr = CE_Failure;
+        }
+        if (eErr == CE_None)
+            eErr = oPolygonWriter.getErr();
+
+        // Release what is no longer needed by the next bands
+        oBand.poEnum.reset();
+        oBand.aoTopArcs.clear();
+        if (iBand > 0)
+        {
+            aoBands[iBand - 1].anLastLineVal = std::vector<DataType>();
+            aoBands[iBand - 1].anLastLineId = std::vector<GInt32>();
+        }
+
+        if (iNextBand < nBands)
+            SubmitBand(iNextBand++);
+
+        if (eErr == CE_None &&
+            !pfnProgress(0.10 + 0.90 * oBand.nEndLine /
+                                    static_cast<double>(nYSize),
+                         "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+
+    if (eErr != CE_None)
+        bStop = true;
+    poJobQueue->WaitCompletion();
+
+    if (eErr == CE_None && !oStitcher.isComplete())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "GDALPolygonize(): some polygons have not been completed");
+        eErr = CE_Failure;
+    }
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                          GDALPolygonizeT()                           */
 /************************************************************************/
@@ -108,29 +644,6 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
         return CE_Failure;
     }
 
-    DataType *panLastLineVal =
-        static_cast<DataType *>(VSI_MALLOC2_VERBOSE(sizeof(DataType), nXSize));
-    DataType *panThisLineVal =
-        static_cast<DataType *>(VSI_MALLOC2_VERBOSE(sizeof(DataType), nXSize));
-    GInt32 *panLastLineId =
-        static_cast<GInt32 *>(VSI_MALLOC2_VERBOSE(sizeof(GInt32), nXSize));
-    GInt32 *panThisLineId =
-        static_cast<GInt32 *>(VSI_MALLOC2_VERBOSE(sizeof(GInt32), nXSize));
-
-    GByte *pabyMaskLine = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nXSize));
-
-    if (panLastLineVal == nullptr || panThisLineVal == nullptr ||
-        panLastLineId == nullptr || panThisLineId == nullptr ||
-        pabyMaskLine == nullptr)
-    {
-        CPLFree(panThisLineId);
-        CPLFree(panLastLineId);
-        CPLFree(panThisLineVal);
-        CPLFree(panLastLineVal);
-        CPLFree(pabyMaskLine);
-        return CE_Failure;
-    }
-
     /* -------------------------------------------------------------------- */
     /*      Get the geotransform, if there is one, so we can convert the    */
     /*      vectors into georeferenced coordinates.                         */
@@ -161,6 +674,57 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
         gt = GDALGeoTransform();
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Process bands of lines in parallel if asked to.                 */
+    /* -------------------------------------------------------------------- */
+    // Only on explicit request, as polygons are not written in the same
+    // order as in the single-threaded mode.
+    const char *pszNumThreads = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    const int nThreads =
+        pszNumThreads ? GDALGetNumThreads(pszNumThreads,
+                                          GDAL_DEFAULT_MAX_THREAD_COUNT,
+                                          /* bDefaultAllCPUs = */ false)
+                      : 1;
+    if (nThreads > 1 && nYSize >= 2 * GP_MIN_BAND_HEIGHT)
+    {
+        OGRPolygonWriter<DataType> oPolygonWriter{
+            hOutLayer, iPixValField, gt,
+            atoi(CSLFetchNameValueDef(papszOptions, "COMMIT_INTERVAL",
+                                      "100000"))};
+        CPLErr eErr = GDALPolygonizeMultiThreadedT<DataType, EqualityTest>(
+            hSrcBand, hMaskBand, nXSize, nYSize, nConnectedness, nThreads,
+            oPolygonWriter, pfnProgress, pProgressArg, eDT);
+        if (!oPolygonWriter.Finalize())
+            eErr = CE_Failure;
+        return eErr;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Allocate working buffers.                                       */
+    /* -------------------------------------------------------------------- */
+    DataType *panLastLineVal =
+        static_cast<DataType *>(VSI_MALLOC2_VERBOSE(sizeof(DataType), nXSize));
+    DataType *panThisLineVal =
+        static_cast<DataType *>(VSI_MALLOC2_VERBOSE(sizeof(DataType), nXSize));
+    GInt32 *panLastLineId =
+        static_cast<GInt32 *>(VSI_MALLOC2_VERBOSE(sizeof(GInt32), nXSize));
+    GInt32 *panThisLineId =
+        static_cast<GInt32 *>(VSI_MALLOC2_VERBOSE(sizeof(GInt32), nXSize));
+
+    GByte *pabyMaskLine = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nXSize));
+
+    if (panLastLineVal == nullptr || panThisLineVal == nullptr ||
+        panLastLineId == nullptr || panThisLineId == nullptr ||
+        pabyMaskLine == nullptr)
+    {
+        CPLFree(panThisLineId);
+        CPLFree(panLastLineId);
+        CPLFree(panThisLineVal);
+        CPLFree(panLastLineVal);
+        CPLFree(pabyMaskLine);
+        return CE_Failure;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      The first pass over the raster is only used to build up the     */
     /*      polygon id map so we will know in advance what polygons are     */
@@ -507,6 +1071,14 @@ bool GDALDoubleAlmostEquals(double A, double B, unsigned maxUlps)
  * The function takes care of issuing the starting transaction and committing
  * the final one.
  * </li>
+ * <li>NUM_THREADS=number_of_threads or ALL_CPUS:
+ * (GDAL >= 3.13) Number of worker threads. When greater than 1, the raster
+ * is split in bands of lines that are processed in parallel, and the polygons
+ * crossing band boundaries are merged. The output polygons are the same as
+ * in single-threaded mode, but may be written in a different order.
+ * Defaults to 1. The GDAL_NUM_THREADS configuration option is not taken into
+ * account, so that the order of the output features only changes on request.
+ * </li>
  * </ul>
  * @param pfnProgress callback for reporting algorithm progress matching the
  * GDALProgressFunc() semantics.  May be NULL.
@@ -590,6 +1162,14 @@ CPLErr CPL_STDCALL GDALPolygonize(GDALRasterBandH hSrcBand,
  * The function takes care of issuing the starting transaction and committing
  * the final one.
  * </li>
+ * <li>NUM_THREADS=number_of_threads or ALL_CPUS:
+ * (GDAL >= 3.13) Number of worker threads. When greater than 1, the raster
+ * is split in bands of lines that are processed in parallel, and the polygons
+ * crossing band boundaries are merged. The output polygons are the same as
+ * in single-threaded mode, but may be written in a different order.
+ * Defaults to 1. The GDAL_NUM_THREADS configuration option is not taken into
+ * account, so that the order of the output features only changes on request.
+ * </li>
  * </ul>
  * @param pfnProgress callback for reporting algorithm progress matching the
  * GDALProgressFunc() semantics.  May be NULL.
@@ -14,6 +14,7 @@
 #include "polygonize_polygonizer.h"
 
 #include <algorithm>
+#include <utility>
 
 namespace gdal
 {
@@ -422,6 +423,18 @@ bool Polygonizer<PolyIdType, DataType>::processLine(
             PolyIdType nPolyId = entry.first;
             RPolygon *poPolygon = entry.second;
 
+            // polygon started before the line given to seedLine(): keep it,
+            // to be merged with its upper part
+            if (!oSeededPolygonIds_.empty() &&
+                oSeededPolygonIds_.erase(nPolyId) > 0)
+            {
+                aoCompletedPartialPolygons_.push_back(
+                    {nPolyId, std::unique_ptr<RPolygon>(poPolygon),
+                     panLastLineVal[poPolygon->iBottomRightCol]});
+                oPolygonMap_.erase(nPolyId);
+                continue;
+            }
+
             // emit valid polygon only
             if (nPolyId != nInvalidPolyId_)
             {
@@ -441,6 +454,317 @@ bool Polygonizer<PolyIdType, DataType>::processLine(
     }
 }
 
+template <typename PolyIdType, typename DataType>
+bool Polygonizer<PolyIdType, DataType>::seedLine(
+    const PolyIdType *panLineId, TwoArm *poLastLineArm, const IndexType nRow,
+    const IndexType nCols, std::vector<BoundaryArc<PolyIdType>> &aoTopArcs)
+{
+    try
+    {
+        aoTopArcs.clear();
+        aoTopArcs.resize(2 * (static_cast<std::size_t>(nCols) + 2),
+                         BoundaryArc<PolyIdType>{nInvalidPolyId_, {}});
+
+        // Only the fields of the arms of the line above used by
+        // ProcessArmConnections() need to be set.
+        poLastLineArm[0].poPolyInside = poTheOuterPolygon_;
+        for (IndexType iArmIndex = 1; iArmIndex <= nCols + 1; ++iArmIndex)
+        {
+            const IndexType col = iArmIndex - 1;
+            const PolyIdType nPolyId =
+                col < nCols ? panLineId[col] : THE_OUTER_POLYGON_ID;
+            const PolyIdType nLeftPolyId =
+                col > 0 ? panLineId[col - 1] : THE_OUTER_POLYGON_ID;
+
+            TwoArm *poArm = poLastLineArm + iArmIndex;
+            poArm->iRow = nRow;
+            poArm->iCol = col;
+            poArm->poPolyInside = getPolygon(nPolyId);
+            poArm->poPolyLeft = poLastLineArm[iArmIndex - 1].poPolyInside;
+            poArm->poPolyAbove = nullptr;
+            poArm->bSolidHorizontal = false;
+            poArm->bSolidVertical = poArm->poPolyInside != poArm->poPolyLeft;
+            if (col < nCols)
+            {
+                poArm->poPolyInside->updateBottomRightPos(nRow, col);
+                if (nPolyId != nInvalidPolyId_)
+                    oSeededPolygonIds_.insert(nPolyId);
+            }
+
+            if (poArm->bSolidVertical)
+            {
+                // The inner arc belongs to the polygon of the arm, and the
+                // outer one to the polygon on its left.
+                poArm->oArcVerInner = poArm->poPolyInside->newArc(true);
+                poArm->oArcVerOuter = poArm->poPolyLeft->newArc(false);
+                aoTopArcs[2 * iArmIndex] = {nPolyId, poArm->oArcVerInner};
+                aoTopArcs[2 * iArmIndex + 1] = {nLeftPolyId,
+                                                poArm->oArcVerOuter};
+            }
+            else
+            {
+                poArm->oArcVerInner = IndexedArc{};
+                poArm->oArcVerOuter = IndexedArc{};
+            }
+        }
+        return true;
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in Polygonizer::seedLine");
+        return false;
+    }
+}
+
+template <typename PolyIdType, typename DataType>
+std::vector<PartialPolygon<PolyIdType, DataType>>
+Polygonizer<PolyIdType, DataType>::releaseCompletedPartialPolygons()
+{
+    std::vector<PartialPolygon<PolyIdType, DataType>> aoRet;
+    std::swap(aoRet, aoCompletedPartialPolygons_);
+    return aoRet;
+}
+
+template <typename PolyIdType, typename DataType>
+void Polygonizer<PolyIdType, DataType>::releaseOpenPolygons(
+    const TwoArm *poLastLineArm, const IndexType nCols,
+    std::map<PolyIdType, std::unique_ptr<RPolygon>> &oOpenPolygons,
+    std::vector<BoundaryArc<PolyIdType>> &aoBottomArcs)
+{
+    std::map<const RPolygon *, PolyIdType> oMapPolygonToId;
+    for (const auto &entry : oPolygonMap_)
+        oMapPolygonToId[entry.second] = entry.first;
+
+    aoBottomArcs.clear();
+    aoBottomArcs.resize(2 * (static_cast<std::size_t>(nCols) + 2),
+                        BoundaryArc<PolyIdType>{nInvalidPolyId_, {}});
+    for (IndexType iArmIndex = 1; iArmIndex <= nCols + 1; ++iArmIndex)
+    {
+        const TwoArm *poArm = poLastLineArm + iArmIndex;
+        if (poArm->bSolidVertical)
+        {
+            aoBottomArcs[2 * iArmIndex] = {
+                oMapPolygonToId[poArm->poPolyInside], poArm->oArcVerInner};
+            aoBottomArcs[2 * iArmIndex + 1] = {
+                oMapPolygonToId[poArm->poPolyLeft], poArm->oArcVerOuter};
+        }
+    }
+
+    oOpenPolygons.clear();
+    for (auto oIter = oPolygonMap_.begin(); oIter != oPolygonMap_.end();)
+    {
+        if (oIter->first != nInvalidPolyId_ &&
+            oIter->first != THE_OUTER_POLYGON_ID)
+        {
+            oOpenPolygons[oIter->first].reset(oIter->second);
+            oSeededPolygonIds_.erase(oIter->first);
+            oIter = oPolygonMap_.erase(oIter);
+        }
+        else
+        {
+            ++oIter;
+        }
+    }
+}
+
+/**
+ * Append to poDst the arcs of poSrc, its continuation below a band boundary.
+ * aoStubs lists the arcs of poSrc created by Polygonizer::seedLine(), with
+ * the arc of poDst they continue, in which they are merged.
+ * anNewIndex receives the index in poDst of each arc of poSrc.
+ */
+static void
+MergePolygonBelow(RPolygon *poDst, RPolygon *poSrc,
+                  const std::vector<std::pair<std::size_t, IndexedArc>> &aoStubs,
+                  std::vector<std::size_t> &anNewIndex)
+{
+    constexpr std::size_t UNSET = std::numeric_limits<std::size_t>::max();
+    const std::size_t nDstArcs = poDst->oArcs.size();
+    const std::size_t nSrcArcs = poSrc->oArcs.size();
+
+    // Arcs of poSrc are appended in the order they were created, after
+    // those of poDst, which were created in previous lines. This is thus
+    // the order in which a single Polygonizer would have created them.
+    anNewIndex.assign(nSrcArcs, UNSET);
+    for (const auto &oStub : aoStubs)
+        anNewIndex[oStub.first] = oStub.second.iIndex;
+    std::size_t iNewIndex = nDstArcs;
+    for (auto &nIndex : anNewIndex)
+    {
+        if (nIndex == UNSET)
+            nIndex = iNewIndex++;
+    }
+    poDst->oArcs.reserve(iNewIndex);
+
+    for (std::size_t i = 0; i < nSrcArcs; ++i)
+    {
+        auto &oSrcArc = poSrc->oArcs[i];
+        const std::size_t iDst = anNewIndex[i];
+        // arcs not closed yet are connected to themselves
+        const bool bConnected = oSrcArc.nConnection != i;
+        if (iDst < nDstArcs)
+        {
+            auto &oDstArc = poDst->oArcs[iDst];
+            oDstArc.poArc->insert(oDstArc.poArc->end(), oSrcArc.poArc->begin(),
+                                  oSrcArc.poArc->end());
+            if (bConnected)
+            {
+                CPLAssert(oDstArc.nConnection == iDst);
+                oDstArc.nConnection =
+                    static_cast<unsigned>(anNewIndex[oSrcArc.nConnection]);
+            }
+        }
+        else
+        {
+            CPLAssert(iDst == poDst->oArcs.size());
+            oSrcArc.nConnection =
+                static_cast<unsigned>(anNewIndex[oSrcArc.nConnection]);
+            poDst->oArcs.push_back(std::move(oSrcArc));
+        }
+    }
+
+    poDst->iBottomRightRow = poSrc->iBottomRightRow;
+    poDst->iBottomRightCol = poSrc->iBottomRightCol;
+}
+
+template <typename PolyIdType, typename DataType>
+BandStitcher<PolyIdType, DataType>::BandStitcher(
+    PolyIdType nInvalidPolyId, PolygonReceiver<DataType> *poPolygonReceiver)
+    : nInvalidPolyId_(nInvalidPolyId), poPolygonReceiver_(poPolygonReceiver)
+{
+}
+
+template <typename PolyIdType, typename DataType>
+bool BandStitcher<PolyIdType, DataType>::isStitchable(PolyIdType nPolyId) const
+{
+    return nPolyId != nInvalidPolyId_ &&
+           nPolyId != Polygonizer<PolyIdType, DataType>::THE_OUTER_POLYGON_ID;
+}
+
+template <typename PolyIdType, typename DataType>
+bool BandStitcher<PolyIdType, DataType>::addBand(
+    const BoundaryArcs &aoTopArcs,
+    std::vector<PartialPolygon<PolyIdType, DataType>>
+        &aoCompletedPartialPolygons,
+    OpenPolygons &oOpenPolygons, BoundaryArcs &aoBottomArcs)
+{
+    try
+    {
+        if (aoTopArcs.size() != aoBottomArcs_.size())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "BandStitcher::addBand(): inconsistent band boundary");
+            return false;
+        }
+
+        // For each polygon crossing the boundary, the arcs created by
+        // seedLine() and the arcs they continue.
+        std::map<PolyIdType, std::vector<std::pair<std::size_t, IndexedArc>>>
+            oMapStubs;
+        for (std::size_t i = 0; i < aoTopArcs.size(); ++i)
+        {
+            const auto &oStub = aoTopArcs[i];
+            if (!isStitchable(oStub.nPolyId))
+                continue;
+            if (aoBottomArcs_[i].nPolyId != oStub.nPolyId)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "BandStitcher::addBand(): inconsistent band boundary");
+                return false;
+            }
+            oMapStubs[oStub.nPolyId].emplace_back(oStub.oArc.iIndex,
+                                                  aoBottomArcs_[i].oArc);
+        }
+
+        const auto MergeWithUpperPart =
+            [this, &oMapStubs](PolyIdType nPolyId, RPolygon *poPolygon,
+                               std::vector<std::size_t> &anNewIndex)
+        {
+            const auto oIter = oOpenPolygons_.find(nPolyId);
+            const auto oIterStubs = oMapStubs.find(nPolyId);
+            if (oIter == oOpenPolygons_.end() || oIterStubs == oMapStubs.end())
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "BandStitcher::addBand(): cannot find upper part of "
+                         "polygon");
+                return static_cast<RPolygon *>(nullptr);
+            }
+            MergePolygonBelow(oIter->second.get(), poPolygon,
+                              oIterStubs->second, anNewIndex);
+            oMapStubs.erase(oIterStubs);
+            return oIter->second.get();
+        };
+
+        std::vector<std::size_t> anNewIndex;
+        for (auto &oPartialPolygon : aoCompletedPartialPolygons)
+        {
+            RPolygon *poPolygon =
+                MergeWithUpperPart(oPartialPolygon.nPolyId,
+                                   oPartialPolygon.poPolygon.get(), anNewIndex);
+            if (!poPolygon)
+                return false;
+            poPolygonReceiver_->receive(poPolygon,
+                                        oPartialPolygon.nPolygonCellValue);
+            oOpenPolygons_.erase(oPartialPolygon.nPolyId);
+        }
+        aoCompletedPartialPolygons.clear();
+
+        // Index in the merged polygon of the arcs of the open polygons of
+        // this band that continue a polygon of the previous ones.
+        std::map<PolyIdType, std::vector<std::size_t>> oMapNewIndex;
+        OpenPolygons oNewOpenPolygons;
+        for (auto &oEntry : oOpenPolygons)
+        {
+            const PolyIdType nPolyId = oEntry.first;
+            if (oMapStubs.find(nPolyId) != oMapStubs.end())
+            {
+                if (!MergeWithUpperPart(nPolyId, oEntry.second.get(),
+                                        oMapNewIndex[nPolyId]))
+                    return false;
+                oNewOpenPolygons[nPolyId] =
+                    std::move(oOpenPolygons_[nPolyId]);
+            }
+            else
+            {
+                oNewOpenPolygons[nPolyId] = std::move(oEntry.second);
+            }
+        }
+        oOpenPolygons.clear();
+
+        if (!oMapStubs.empty())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "BandStitcher::addBand(): cannot find lower part of "
+                     "polygon");
+            return false;
+        }
+        oOpenPolygons_ = std::move(oNewOpenPolygons);
+
+        // Arcs that continue an arc of a previous band are replaced by it
+        for (auto &oArc : aoBottomArcs)
+        {
+            const auto oIter = oMapNewIndex.find(oArc.nPolyId);
+            if (oIter != oMapNewIndex.end())
+            {
+                const std::size_t iIndex = oIter->second[oArc.oArc.iIndex];
+                oArc.oArc = IndexedArc{
+                    oOpenPolygons_[oArc.nPolyId]->oArcs[iIndex].poArc.get(),
+                    iIndex};
+            }
+        }
+        aoBottomArcs_ = std::move(aoBottomArcs);
+        aoBottomArcs.clear();
+        return true;
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in BandStitcher::addBand");
+        return false;
+    }
+}
+
 template <typename DataType>
 OGRPolygonWriter<DataType>::OGRPolygonWriter(OGRLayerH hOutLayer,
                                              int iPixValField,
@@ -22,6 +22,8 @@
 #include <vector>
 #include <limits>
 #include <map>
+#include <memory>
+#include <set>
 
 #include "cpl_error.h"
 #include "ogr_api.h"
@@ -115,6 +117,27 @@ struct TwoArm
     bool bSolidVertical{false};
 };
 
+/**
+ * Open vertical arc crossing the boundary between two row bands that are
+ * traced independently, and the id of the polygon it belongs to.
+ */
+template <typename PolyIdType> struct BoundaryArc
+{
+    PolyIdType nPolyId{};
+    IndexedArc oArc{};
+};
+
+/**
+ * Piece of a polygon that started in a previous row band, and that has been
+ * completed in the current one.
+ */
+template <typename PolyIdType, typename DataType> struct PartialPolygon
+{
+    PolyIdType nPolyId{};
+    std::unique_ptr<RPolygon> poPolygon{};
+    DataType nPolygonCellValue{};
+};
+
 template <typename DataType> class PolygonReceiver
 {
   public:
@@ -149,6 +172,12 @@ template <typename PolyIdType, typename DataType> class Polygonizer
 
     PolygonReceiver<DataType> *poPolygonReceiver_;
 
+    // polygons present in the line given to seedLine(), and those of them
+    // that have been completed since then.
+    std::set<PolyIdType> oSeededPolygonIds_{};
+    std::vector<PartialPolygon<PolyIdType, DataType>>
+        aoCompletedPartialPolygons_{};
+
     RPolygon *getPolygon(PolyIdType nPolygonId);
 
     RPolygon *createPolygon(PolyIdType nPolygonId);
@@ -175,6 +204,76 @@ template <typename PolyIdType, typename DataType> class Polygonizer
                      const DataType *panLastLineVal, TwoArm *poThisLineArm,
                      TwoArm *poLastLineArm, IndexType nCurrentRow,
                      IndexType nCols);
+
+    /**
+     * Initialize poLastLineArm as if line nRow, of polygon ids panLineId,
+     * had just been processed, so that processLine() can start at line
+     * nRow + 1. The open vertical arcs of that line are created empty, and
+     * returned in aoTopArcs (inner then outer arc of each arm).
+     * Polygons of that line are not given to the receiver once completed,
+     * but are kept in the list returned by releaseCompletedPartialPolygons().
+     */
+    bool seedLine(const PolyIdType *panLineId, TwoArm *poLastLineArm,
+                  IndexType nRow, IndexType nCols,
+                  std::vector<BoundaryArc<PolyIdType>> &aoTopArcs);
+
+    std::vector<PartialPolygon<PolyIdType, DataType>>
+    releaseCompletedPartialPolygons();
+
+    /**
+     * Transfer the ownership of the polygons that are not completed yet,
+     * and return the open vertical arcs of poLastLineArm, the last line
+     * processed.
+     */
+    void releaseOpenPolygons(
+        const TwoArm *poLastLineArm, IndexType nCols,
+        std::map<PolyIdType, std::unique_ptr<RPolygon>> &oOpenPolygons,
+        std::vector<BoundaryArc<PolyIdType>> &aoBottomArcs);
+};
+
+/**
+ * BandStitcher merges the polygons of consecutive row bands traced
+ * independently by Polygonizer, and emits them to the receiver once
+ * completed.
+ */
+template <typename PolyIdType, typename DataType> class BandStitcher
+{
+    using BoundaryArcs = std::vector<BoundaryArc<PolyIdType>>;
+    using OpenPolygons = std::map<PolyIdType, std::unique_ptr<RPolygon>>;
+
+    const PolyIdType nInvalidPolyId_;
+    PolygonReceiver<DataType> *poPolygonReceiver_;
+
+    // polygons not completed at the bottom of the last band added, and
+    // their open arcs at that line.
+    OpenPolygons oOpenPolygons_{};
+    BoundaryArcs aoBottomArcs_{};
+
+    bool isStitchable(PolyIdType nPolyId) const;
+
+  public:
+    BandStitcher(PolyIdType nInvalidPolyId,
+                 PolygonReceiver<DataType> *poPolygonReceiver);
+
+    BandStitcher(const BandStitcher<PolyIdType, DataType> &) = delete;
+
+    BandStitcher<PolyIdType, DataType> &
+    operator=(const BandStitcher<PolyIdType, DataType> &) = delete;
+
+    /**
+     * Add the next band, as returned by Polygonizer::seedLine() (aoTopArcs,
+     * empty for the first band), Polygonizer::releaseCompletedPartialPolygons()
+     * and Polygonizer::releaseOpenPolygons().
+     */
+    bool addBand(const BoundaryArcs &aoTopArcs,
+                 std::vector<PartialPolygon<PolyIdType, DataType>>
+                     &aoCompletedPartialPolygons,
+                 OpenPolygons &oOpenPolygons, BoundaryArcs &aoBottomArcs);
+
+    bool isComplete() const
+    {
+        return oOpenPolygons_.empty();
+    }
 };
 
 /**
@@ -11,6 +11,12 @@ template class Polygonizer<GInt32, float>;
 
 template class Polygonizer<GInt32, double>;
 
+template class BandStitcher<GInt32, std::int64_t>;
+
+template class BandStitcher<GInt32, float>;
+
+template class BandStitcher<GInt32, double>;
+
 template class OGRPolygonWriter<std::int64_t>;
 
 template class OGRPolygonWriter<float>;
@@ -22,6 +22,7 @@
 #include "ogr_srs_api.h"
 #include "commonutils.h"
 #include "gdal_utils_priv.h"
+#include "gdal_thread_pool.h"
 
 /************************************************************************/
 /*                          GDALContourOptions                          */
@@ -54,6 +55,7 @@ struct GDALContourOptions
     std::string osDestDataSource{};
     std::string osSrcDataSource{};
     GIntBig nGroupTransactions = 100 * 1000;
+    std::string osNumThreads{};
     GDALProgressFunc pfnProgress = GDALDummyProgress;
     void *pProgressData = nullptr;
 };
@@ -426,6 +428,12 @@ CPLErr GDALContourProcessOptions(GDALContourOptions *psOptions,
                                                "COMMIT_INTERVAL=" CPL_FRMT_GIB,
                                                psOptions->nGroupTransactions);
     }
+    if (!psOptions->osNumThreads.empty())
+    {
+        *ppapszStringOptions =
+            CSLAppendPrintf(*ppapszStringOptions, "NUM_THREADS=%s",
+                            psOptions->osNumThreads.c_str());
+    }
 
     return CE_None;
 }
@@ -548,6 +556,23 @@ GDALContourAppOptionsGetParser(GDALContourOptions *psOptions,
             })
         .help(_("Group <n> features per transaction."));
 
+    argParser->add_argument("-num_threads")
+        .metavar("<value|ALL_CPUS>")
+        .action(
+            [psOptions](const std::string &s)
+            {
+                bool bOK = false;
+                GDALGetNumThreads(s.c_str(), GDAL_DEFAULT_MAX_THREAD_COUNT,
+                                  false, nullptr, &bOK);
+                if (!bOK)
+                {
+                    throw std::invalid_argument(CPLSPrintf(
+                        "Invalid value for -num_threads: %s.", s.c_str()));
+                }
+                psOptions->osNumThreads = s;
+            })
+        .help(_("Number of worker threads for the contour generation."));
+
     // Written that way so that in library mode, users can still use the -q
     // switch, even if it has no effect
     argParser->add_quiet_argument(
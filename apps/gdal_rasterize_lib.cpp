@@ -32,6 +32,7 @@
 #include "gdal.h"
 #include "gdal_alg.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_srs_api.h"
@@ -296,6 +297,24 @@ GDALRasterizeOptionsGetParser(GDALRasterizeOptions *psOptions,
             })
         .help(_("Force the algorithm used."));
 
+    argParser->add_argument("-num_threads")
+        .metavar("<value|ALL_CPUS>")
+        .action(
+            [psOptions](const std::string &s)
+            {
+                bool bOK = false;
+                GDALGetNumThreads(s.c_str(), GDAL_DEFAULT_MAX_THREAD_COUNT,
+                                  false, nullptr, &bOK);
+                if (!bOK)
+                {
+                    throw std::invalid_argument(CPLSPrintf(
+                        "Invalid value for -num_threads: %s.", s.c_str()));
+                }
+                psOptions->aosRasterizeOptions.SetNameValue("NUM_THREADS",
+                                                            s.c_str());
+            })
+        .help(_("Number of worker threads for the rasterization."));
+
     argParser->add_creation_options_argument(psOptions->aosCreationOptions)
         .action([psOptions](const std::string &)
                 { psOptions->bCreateOutput = true; });
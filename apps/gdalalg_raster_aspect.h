@@ -41,6 +41,10 @@ class GDALRasterAspectAlgorithm /* non final */
     std::string m_gradientAlg = "Horn";
     bool m_zeroForFlat = false;
     bool m_noEdges = false;
+    int m_numThreads = 0;
+
+    // Work variables
+    std::string m_numThreadsStr{"ALL_CPUS"};
 };
 
 /************************************************************************/
@@ -48,6 +48,10 @@ class GDALRasterHillshadeAlgorithm /* non final */
     std::string m_gradientAlg = "Horn";
     std::string m_variant = "regular";
     bool m_noEdges = false;
+    int m_numThreads = 0;
+
+    // Work variables
+    std::string m_numThreadsStr{"ALL_CPUS"};
 };
 
 /************************************************************************/
@@ -63,6 +63,10 @@ GDALRasterPolygonizeAlgorithm::GDALRasterPolygonizeAlgorithm(
            _("Consider diagonal pixels as connected"), &m_connectDiagonalPixels)
         .SetDefault(m_connectDiagonalPixels);
 
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr,
+                     _("Number of jobs (or ALL_CPUS). Features are written in "
+                       "a different order when greater than 1"));
+
     AddArg("commit-interval", 0, _("Commit interval"), &m_commitInterval)
         .SetHidden();
 }
@@ -260,6 +264,8 @@ bool GDALRasterPolygonizeAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
     {
         aosPolygonizeOptions.SetNameValue("8CONNECTED", "8");
     }
+    aosPolygonizeOptions.SetNameValue("NUM_THREADS",
+                                      CPLSPrintf("%d", m_numThreads));
     if (m_commitInterval)
     {
         aosPolygonizeOptions.SetNameValue("COMMIT_INTERVAL",
@@ -55,6 +55,10 @@ GDALRasterProximityAlgorithm::GDALRasterProximityAlgorithm(bool standaloneStep)
            _("Specify a nodata value to use for pixels that are beyond the "
              "maximum distance"),
            &m_noDataValue);
+    AddArg("algorithm", 0, _("Distance computation algorithm"), &m_algorithm)
+        .SetChoices("scanline", "edt")
+        .SetDefault(m_algorithm);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 }
 
 /************************************************************************/
@@ -113,6 +117,14 @@ bool GDALRasterProximityAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
         dstBand->SetNoDataValue(m_noDataValue);
     }
 
+    if (GetArg("algorithm")->IsExplicitlySet())
+    {
+        proximityOptions.AddString(CPLSPrintf(
+            "ALGORITHM=%s", CPLString(m_algorithm).toupper().c_str()));
+    }
+
+    proximityOptions.AddString(CPLSPrintf("NUM_THREADS=%d", m_numThreads));
+
     // Always set this to YES. Note that this was NOT the
     // default behavior in the python implementation of the utility.
     proximityOptions.AddString("USE_INPUT_NODATA=YES");
@@ -117,6 +117,7 @@ GDALVectorRasterizeAlgorithm::GDALVectorRasterizeAlgorithm(bool bStandaloneStep)
            &m_optimization)
         .SetChoices("AUTO", "RASTER", "VECTOR")
         .SetDefault("AUTO");
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 
     if (bStandaloneStep)
     {
@@ -356,6 +357,9 @@ bool GDALVectorRasterizeAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
         aosOptions.AddString(m_optimization.c_str());
     }
 
+    aosOptions.AddString("-num_threads");
+    aosOptions.AddString(CPLSPrintf("%d", m_numThreads));
+
     bool bOK = false;
     std::unique_ptr<GDALRasterizeOptions, decltype(&GDALRasterizeOptionsFree)>
         psOptions{GDALRasterizeOptionsNew(aosOptions.List(), nullptr),
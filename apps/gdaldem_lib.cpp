@@ -95,6 +95,7 @@
 #include <array>
 #include <cmath>
 #include <limits>
+#include <vector>
 
 #include "cpl_error.h"
 #include "cpl_float.h"
@@ -102,8 +103,10 @@
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "vrtdataset.h"
 
 #if defined(__x86_64__) || defined(_M_X64)
@@ -117,6 +120,14 @@
 #include "gdalsse_priv.h"
 #endif
 
+#if defined(HAVE_16_SSE_REG) && defined(__AVX2__)
+using GDALDEMRegFloat = XMMReg8Float;
+using GDALDEMRegInt = XMMReg8Int;
+#elif defined(HAVE_16_SSE_REG)
+using GDALDEMRegFloat = XMMReg4Float;
+using GDALDEMRegInt = XMMReg4Int;
+#endif
+
 constexpr float kfDegToRad = static_cast<float>(M_PI / 180.0);
 constexpr float kfRadToDeg = static_cast<float>(180.0 / M_PI);
 
@@ -178,6 +189,7 @@ struct GDALDEMProcessingOptions
     bool bMultiDirectional = false;
     CPLStringList aosCreationOptions{};
     int nBand = 1;
+    std::string osNumThreads{};  // empty = GDAL_NUM_THREADS config option
 };
 
 /************************************************************************/
@@ -213,7 +225,8 @@ template <class T> struct GDALGeneric3x3ProcessingAlg_multisample
 {
     typedef int (*type)(const T *pafFirstLine, const T *pafSecondLine,
                         const T *pafThirdLine, int nXSize,
-                        const AlgorithmParameters *pData, float *pafOutputBuf);
+                        float fDstNoDataValue, const AlgorithmParameters *pData,
+                        float *pafOutputBuf);
 };
 
 template <class T>
@@ -313,6 +326,474 @@ GInt32 INTERPOL(GInt32 a, GInt32 b, int bSrcHasNoData, GInt32 fSrcNoDataValue)
     return nVal;
 }
 
+/************************************************************************/
+/*                  GDALGeneric3x3ProcessingContext                     */
+/************************************************************************/
+
+// Parameters of a 3x3 processing, and the per-line computations.
+// The methods only read the context, so they may be called concurrently
+// from several threads working on different lines.
+template <class T> struct GDALGeneric3x3ProcessingContext
+{
+    typename GDALGeneric3x3ProcessingAlg<T>::type pfnAlg = nullptr;
+    typename GDALGeneric3x3ProcessingAlg_multisample<T>::type
+        pfnAlg_multisample = nullptr;
+    const AlgorithmParameters *pData = nullptr;
+    bool bComputeAtEdges = false;
+    bool bSrcHasNoData = false;
+    T fSrcNoDataValue = 0;
+    bool bIsSrcNoDataNan = false;
+    float fDstNoDataValue = 0;
+    int nXSize = 0;
+    int nYSize = 0;
+
+    bool LineHasNoData(const T *pafLine) const;
+    void ComputeFirstLine(const T *pafLine1, const T *pafLine2,
+                          float *pafOutputBuf) const;
+    void ComputeLine(const T *pafLine1, const T *pafLine2, const T *pafLine3,
+                     bool bOneOfThreeLinesHasNoData, float *pafOutputBuf) const;
+    void ComputeLastLine(const T *pafLine1, const T *pafLine2,
+                         float *pafOutputBuf) const;
+    void ComputeLines(const T *pafSrc, int nSrcYOff, int nSrcLines, int nYOff,
+                      int nLines, float *pafOutputBuf) const;
+};
+
+/************************************************************************/
+/*                           LineHasNoData()                            */
+/************************************************************************/
+
+template <class T>
+bool GDALGeneric3x3ProcessingContext<T>::LineHasNoData(const T *pafLine) const
+{
+    if (!bSrcHasNoData)
+        return false;
+
+    int iX = 0;
+    if constexpr (std::numeric_limits<T>::is_integer)
+    {
+        for (; iX + 3 < nXSize; iX += 4)
+        {
+            if (pafLine[iX] == fSrcNoDataValue ||
+                pafLine[iX + 1] == fSrcNoDataValue ||
+                pafLine[iX + 2] == fSrcNoDataValue ||
+                pafLine[iX + 3] == fSrcNoDataValue)
+            {
+                return true;
+            }
+        }
+        for (; iX < nXSize; iX++)
+        {
+            if (pafLine[iX] == fSrcNoDataValue)
+                return true;
+        }
+    }
+    else
+    {
+        for (; iX + 3 < nXSize; iX += 4)
+        {
+            if (pafLine[iX] == fSrcNoDataValue || std::isnan(pafLine[iX]) ||
+                pafLine[iX + 1] == fSrcNoDataValue ||
+                std::isnan(pafLine[iX + 1]) ||
+                pafLine[iX + 2] == fSrcNoDataValue ||
+                std::isnan(pafLine[iX + 2]) ||
+                pafLine[iX + 3] == fSrcNoDataValue ||
+                std::isnan(pafLine[iX + 3]))
+            {
+                return true;
+            }
+        }
+        for (; iX < nXSize; iX++)
+        {
+            if (pafLine[iX] == fSrcNoDataValue || std::isnan(pafLine[iX]))
+                return true;
+        }
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                         ComputeFirstLine()                           */
+/************************************************************************/
+
+// pafLine1 and pafLine2 are the first two lines of the source raster.
+template <class T>
+void GDALGeneric3x3ProcessingContext<T>::ComputeFirstLine(
+    const T *pafLine1, const T *pafLine2, float *pafOutputBuf) const
+{
+    if (!(bComputeAtEdges && nXSize >= 2 && nYSize >= 2))
+    {
+        // Exclude the edges
+        for (int j = 0; j < nXSize; j++)
+        {
+            pafOutputBuf[j] = fDstNoDataValue;
+        }
+        return;
+    }
+
+    for (int j = 0; j < nXSize; j++)
+    {
+        int jmin = (j == 0) ? j : j - 1;
+        int jmax = (j == nXSize - 1) ? j : j + 1;
+
+        T afWin[9] = {
+            INTERPOL(pafLine1[jmin], pafLine2[jmin], bSrcHasNoData,
+                     fSrcNoDataValue),
+            INTERPOL(pafLine1[j], pafLine2[j], bSrcHasNoData, fSrcNoDataValue),
+            INTERPOL(pafLine1[jmax], pafLine2[jmax], bSrcHasNoData,
+                     fSrcNoDataValue),
+            pafLine1[jmin],
+            pafLine1[j],
+            pafLine1[jmax],
+            pafLine2[jmin],
+            pafLine2[j],
+            pafLine2[jmax]};
+        pafOutputBuf[j] =
+            ComputeVal(bSrcHasNoData, fSrcNoDataValue, bIsSrcNoDataNan, afWin,
+                       fDstNoDataValue, pfnAlg, pData, bComputeAtEdges);
+    }
+}
+
+/************************************************************************/
+/*                            ComputeLine()                             */
+/************************************************************************/
+
+// Compute a line that is neither the first nor the last one of the raster.
+template <class T>
+void GDALGeneric3x3ProcessingContext<T>::ComputeLine(
+    const T *pafLine1, const T *pafLine2, const T *pafLine3,
+    bool bOneOfThreeLinesHasNoData, float *pafOutputBuf) const
+{
+    if (bComputeAtEdges && nXSize >= 2)
+    {
+        int j = 0;
+        T afWin[9] = {INTERPOL(pafLine1[j], pafLine1[j + 1], bSrcHasNoData,
+                               fSrcNoDataValue),
+                      pafLine1[j],
+                      pafLine1[j + 1],
+                      INTERPOL(pafLine2[j], pafLine2[j + 1], bSrcHasNoData,
+                               fSrcNoDataValue),
+                      pafLine2[j],
+                      pafLine2[j + 1],
+                      INTERPOL(pafLine3[j], pafLine3[j + 1], bSrcHasNoData,
+                               fSrcNoDataValue),
+                      pafLine3[j],
+                      pafLine3[j + 1]};
+
+        pafOutputBuf[j] = ComputeVal(
+            bOneOfThreeLinesHasNoData, fSrcNoDataValue, bIsSrcNoDataNan, afWin,
+            fDstNoDataValue, pfnAlg, pData, bComputeAtEdges);
+    }
+    else
+    {
+        // Exclude the edges
+        pafOutputBuf[0] = fDstNoDataValue;
+    }
+
+    int j = 1;
+    if (pfnAlg_multisample && !bOneOfThreeLinesHasNoData)
+    {
+        j = pfnAlg_multisample(pafLine1, pafLine2, pafLine3, nXSize,
+                               fDstNoDataValue, pData, pafOutputBuf);
+    }
+
+    for (; j < nXSize - 1; j++)
+    {
+        T afWin[9] = {pafLine1[j - 1], pafLine1[j], pafLine1[j + 1],
+                      pafLine2[j - 1], pafLine2[j], pafLine2[j + 1],
+                      pafLine3[j - 1], pafLine3[j], pafLine3[j + 1]};
+
+        pafOutputBuf[j] = ComputeVal(
+            bOneOfThreeLinesHasNoData, fSrcNoDataValue, bIsSrcNoDataNan, afWin,
+            fDstNoDataValue, pfnAlg, pData, bComputeAtEdges);
+    }
+
+    if (bComputeAtEdges && nXSize >= 2)
+    {
+        j = nXSize - 1;
+
+        T afWin[9] = {pafLine1[j - 1],
+                      pafLine1[j],
+                      INTERPOL(pafLine1[j], pafLine1[j - 1], bSrcHasNoData,
+                               fSrcNoDataValue),
+                      pafLine2[j - 1],
+                      pafLine2[j],
+                      INTERPOL(pafLine2[j], pafLine2[j - 1], bSrcHasNoData,
+                               fSrcNoDataValue),
+                      pafLine3[j - 1],
+                      pafLine3[j],
+                      INTERPOL(pafLine3[j], pafLine3[j - 1], bSrcHasNoData,
+                               fSrcNoDataValue)};
+
+        pafOutputBuf[j] = ComputeVal(
+            bOneOfThreeLinesHasNoData, fSrcNoDataValue, bIsSrcNoDataNan, afWin,
+            fDstNoDataValue, pfnAlg, pData, bComputeAtEdges);
+    }
+    else
+    {
+        // Exclude the edges
+        if (nXSize > 1)
+            pafOutputBuf[nXSize - 1] = fDstNoDataValue;
+    }
+}
+
+/************************************************************************/
+/*                          ComputeLastLine()                           */
+/************************************************************************/
+
+// pafLine1 and pafLine2 are the last two lines of the source raster.
+template <class T>
+void GDALGeneric3x3ProcessingContext<T>::ComputeLastLine(
+    const T *pafLine1, const T *pafLine2, float *pafOutputBuf) const
+{
+    if (!(bComputeAtEdges && nXSize >= 2 && nYSize >= 2))
+    {
+        // Exclude the edges
+        for (int j = 0; j < nXSize; j++)
+        {
+            pafOutputBuf[j] = fDstNoDataValue;
+        }
+        return;
+    }
+
+    for (int j = 0; j < nXSize; j++)
+    {
+        int jmin = (j == 0) ? j : j - 1;
+        int jmax = (j == nXSize - 1) ? j : j + 1;
+
+        T afWin[9] = {
+            pafLine1[jmin],
+            pafLine1[j],
+            pafLine1[jmax],
+            pafLine2[jmin],
+            pafLine2[j],
+            pafLine2[jmax],
+            INTERPOL(pafLine2[jmin], pafLine1[jmin], bSrcHasNoData,
+                     fSrcNoDataValue),
+            INTERPOL(pafLine2[j], pafLine1[j], bSrcHasNoData, fSrcNoDataValue),
+            INTERPOL(pafLine2[jmax], pafLine1[jmax], bSrcHasNoData,
+                     fSrcNoDataValue),
+        };
+
+        pafOutputBuf[j] =
+            ComputeVal(bSrcHasNoData, fSrcNoDataValue, bIsSrcNoDataNan, afWin,
+                       fDstNoDataValue, pfnAlg, pData, bComputeAtEdges);
+    }
+}
+
+/************************************************************************/
+/*                           ComputeLines()                             */
+/************************************************************************/
+
+// Compute nLines output lines starting at line nYOff into pafOutputBuf.
+// pafSrc contains the nSrcLines source lines starting at nSrcYOff, which
+// must include the lines just above and below the requested ones (when
+// they exist).
+template <class T>
+void GDALGeneric3x3ProcessingContext<T>::ComputeLines(
+    const T *pafSrc, int nSrcYOff, int nSrcLines, int nYOff, int nLines,
+    float *pafOutputBuf) const
+{
+    CPLAssert(nSrcYOff <= std::max(0, nYOff - 1));
+    CPLAssert(nSrcYOff + nSrcLines >= std::min(nYSize, nYOff + nLines + 1));
+
+    const auto GetLine = [pafSrc, nSrcYOff, this](int iLine)
+    { return pafSrc + static_cast<size_t>(iLine - nSrcYOff) * nXSize; };
+
+    // Whether each source line contains nodata values
+    std::vector<bool> abLineHasNoDataValue(nSrcLines);
+    for (int iLine = 0; iLine < nSrcLines; ++iLine)
+    {
+        abLineHasNoDataValue[iLine] = LineHasNoData(GetLine(nSrcYOff + iLine));
+    }
+
+    for (int i = nYOff; i < nYOff + nLines; ++i)
+    {
+        float *pafOutputLine =
+            pafOutputBuf + static_cast<size_t>(i - nYOff) * nXSize;
+        if (i == 0)
+        {
+            ComputeFirstLine(GetLine(0), nYSize >= 2 ? GetLine(1) : nullptr,
+                             pafOutputLine);
+        }
+        else if (i == nYSize - 1)
+        {
+            ComputeLastLine(GetLine(i - 1), GetLine(i), pafOutputLine);
+        }
+        else
+        {
+            const bool bOneOfThreeLinesHasNoData =
+                abLineHasNoDataValue[i - 1 - nSrcYOff] ||
+                abLineHasNoDataValue[i - nSrcYOff] ||
+                abLineHasNoDataValue[i + 1 - nSrcYOff];
+            ComputeLine(GetLine(i - 1), GetLine(i), GetLine(i + 1),
+                        bOneOfThreeLinesHasNoData, pafOutputLine);
+        }
+    }
+}
+
+/************************************************************************/
+/*                   GDALGeneric3x3GetLinesPerJob()                     */
+/************************************************************************/
+
+// Number of lines processed by a single job of a multi-threaded 3x3
+// processing: large enough to amortize the scheduling cost, but small
+// enough to keep the working set in the CPU caches.
+static int GDALGeneric3x3GetLinesPerJob(int nXSize)
+{
+    constexpr int PIXELS_PER_JOB = 64 * 1024;
+    constexpr int MAX_LINES_PER_JOB = 64;
+    return std::clamp(PIXELS_PER_JOB / std::max(1, nXSize), 1,
+                      MAX_LINES_PER_JOB);
+}
+
+/************************************************************************/
+/*                  GDALGeneric3x3ComputeLinesMT()                      */
+/************************************************************************/
+
+// Compute nLines output lines starting at nYOff, splitting the work in
+// jobs of a few lines that are run by the global thread pool.
+template <class T>
+static void GDALGeneric3x3ComputeLinesMT(
+    const GDALGeneric3x3ProcessingContext<T> &ctxt, CPLJobQueue *poJobQueue,
+    const T *pafSrc, int nSrcYOff, int nSrcLines, int nYOff, int nLines,
+    float *pafOutputBuf)
+{
+    const int nLinesPerJob = GDALGeneric3x3GetLinesPerJob(ctxt.nXSize);
+    for (int iLine = 0; iLine < nLines; iLine += nLinesPerJob)
+    {
+        const int nJobYOff = nYOff + iLine;
+        const int nJobLines = std::min(nLinesPerJob, nLines - iLine);
+        const int nJobSrcYOff = std::max(nSrcYOff, nJobYOff - 1);
+        const int nJobSrcLines =
+            std::min(nSrcYOff + nSrcLines, nJobYOff + nJobLines + 1) -
+            nJobSrcYOff;
+        const T *pafJobSrc =
+            pafSrc + static_cast<size_t>(nJobSrcYOff - nSrcYOff) * ctxt.nXSize;
+        float *pafJobOutputBuf =
+            pafOutputBuf + static_cast<size_t>(iLine) * ctxt.nXSize;
+        poJobQueue->SubmitJob(
+            [&ctxt, pafJobSrc, nJobSrcYOff, nJobSrcLines, nJobYOff, nJobLines,
+             pafJobOutputBuf]()
+            {
+                ctxt.ComputeLines(pafJobSrc, nJobSrcYOff, nJobSrcLines,
+                                  nJobYOff, nJobLines, pafJobOutputBuf);
+            });
+    }
+}
+
+/************************************************************************/
+/*                  GDALGeneric3x3ProcessingMT()                        */
+/************************************************************************/
+
+// Multi-threaded version of GDALGeneric3x3Processing(). Source reading and
+// destination writing are done by the calling thread, since band objects
+// are not thread-safe, while the computation of a batch of lines is
+// distributed over worker threads. Batches are double-buffered so that
+// the I/O of one batch overlaps the computation of the next one.
+template <class T>
+static CPLErr
+GDALGeneric3x3ProcessingMT(const GDALGeneric3x3ProcessingContext<T> &ctxt,
+                           GDALRasterBandH hSrcBand, GDALDataType eReadDT,
+                           GDALRasterBandH hDstBand,
+                           CPLWorkerThreadPool *poThreadPool, int nThreads,
+                           GDALProgressFunc pfnProgress, void *pProgressData)
+{
+    const int nXSize = ctxt.nXSize;
+    const int nYSize = ctxt.nYSize;
+    const int nBatchLines = std::min(
+        nYSize, GDALGeneric3x3GetLinesPerJob(nXSize) * nThreads * 2);
+
+    struct Batch
+    {
+        int nYOff = 0;
+        int nLines = 0;
+        std::vector<T> aSrc{};
+        std::vector<float> afOutput{};
+    };
+
+    std::array<Batch, 2> aoBatches;
+    try
+    {
+        for (auto &oBatch : aoBatches)
+        {
+            oBatch.aSrc.resize(static_cast<size_t>(nBatchLines + 2) * nXSize);
+            oBatch.afOutput.resize(static_cast<size_t>(nBatchLines) * nXSize);
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate 3x3 processing buffers");
+        return CE_Failure;
+    }
+
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+
+    // Write the lines of a batch whose computation is finished
+    const auto WriteBatch = [hDstBand, nXSize, nYSize, pfnProgress,
+                             pProgressData](const Batch &oBatch)
+    {
+        if (GDALRasterIO(hDstBand, GF_Write, 0, oBatch.nYOff, nXSize,
+                         oBatch.nLines,
+                         const_cast<float *>(oBatch.afOutput.data()), nXSize,
+                         oBatch.nLines, GDT_Float32, 0, 0) != CE_None)
+        {
+            return false;
+        }
+        if (!pfnProgress(1.0 * (oBatch.nYOff + oBatch.nLines) / nYSize,
+                         nullptr, pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return false;
+        }
+        return true;
+    };
+
+    Batch *poPendingBatch = nullptr;
+    CPLErr eErr = CE_None;
+    for (int nYOff = 0, iBatch = 0; nYOff < nYSize;
+         nYOff += nBatchLines, iBatch = 1 - iBatch)
+    {
+        Batch &oBatch = aoBatches[iBatch];
+        oBatch.nYOff = nYOff;
+        oBatch.nLines = std::min(nBatchLines, nYSize - nYOff);
+
+        // Read the batch lines, plus one line above and below
+        const int nSrcYOff = std::max(0, nYOff - 1);
+        const int nSrcLines =
+            std::min(nYSize, nYOff + oBatch.nLines + 1) - nSrcYOff;
+        if (GDALRasterIO(hSrcBand, GF_Read, 0, nSrcYOff, nXSize, nSrcLines,
+                         oBatch.aSrc.data(), nXSize, nSrcLines, eReadDT, 0,
+                         0) != CE_None)
+        {
+            eErr = CE_Failure;
+            break;
+        }
+
+        // Wait for the previous batch before its buffers are reused
+        poJobQueue->WaitCompletion();
+        GDALGeneric3x3ComputeLinesMT(ctxt, poJobQueue.get(),
+                                     oBatch.aSrc.data(), nSrcYOff, nSrcLines,
+                                     oBatch.nYOff, oBatch.nLines,
+                                     oBatch.afOutput.data());
+
+        if (poPendingBatch && !WriteBatch(*poPendingBatch))
+        {
+            eErr = CE_Failure;
+            break;
+        }
+        poPendingBatch = &oBatch;
+    }
+
+    poJobQueue->WaitCompletion();
+    if (eErr == CE_None && poPendingBatch && !WriteBatch(*poPendingBatch))
+    {
+        eErr = CE_Failure;
+    }
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                      GDALGeneric3x3Processing()                      */
 /************************************************************************/
@@ -324,7 +805,7 @@ static CPLErr GDALGeneric3x3Processing(
     typename GDALGeneric3x3ProcessingAlg_multisample<T>::type
         pfnAlg_multisample,
     std::unique_ptr<AlgorithmParameters> pData, bool bComputeAtEdges,
-    GDALProgressFunc pfnProgress, void *pProgressData)
+    int nThreads, GDALProgressFunc pfnProgress, void *pProgressData)
 {
     if (pfnProgress == nullptr)
         pfnProgress = GDALDummyProgress;
@@ -341,26 +822,19 @@ static CPLErr GDALGeneric3x3Processing(
     const int nXSize = GDALGetRasterBandXSize(hSrcBand);
     const int nYSize = GDALGetRasterBandYSize(hSrcBand);
 
-    // 1 line destination buffer.
-    float *pafOutputBuf =
-        static_cast<float *>(VSI_MALLOC2_VERBOSE(sizeof(float), nXSize));
-    // 3 line rotating source buffer.
-    T *pafThreeLineWin =
-        static_cast<T *>(VSI_MALLOC2_VERBOSE(3 * sizeof(T), nXSize));
-    if (pafOutputBuf == nullptr || pafThreeLineWin == nullptr)
-    {
-        VSIFree(pafOutputBuf);
-        VSIFree(pafThreeLineWin);
-        return CE_Failure;
-    }
+    GDALGeneric3x3ProcessingContext<T> ctxt;
+    ctxt.pfnAlg = pfnAlg;
+    ctxt.pfnAlg_multisample = pfnAlg_multisample;
+    ctxt.pData = pData.get();
+    ctxt.bComputeAtEdges = bComputeAtEdges;
+    ctxt.nXSize = nXSize;
+    ctxt.nYSize = nYSize;
 
     GDALDataType eReadDT;
     int bSrcHasNoData = FALSE;
     const double dfNoDataValue =
         GDALGetRasterNoDataValue(hSrcBand, &bSrcHasNoData);
 
-    bool bIsSrcNoDataNan = false;
-    T fSrcNoDataValue = 0;
     if constexpr (std::numeric_limits<T>::is_integer)
     {
         eReadDT = GDT_Int32;
@@ -379,7 +853,8 @@ static CPLErr GDALGeneric3x3Processing(
             if (fabs(dfNoDataValue - floor(dfNoDataValue + 0.5)) < 1e-2 &&
                 dfNoDataValue >= nMinVal && dfNoDataValue <= nMaxVal)
             {
-                fSrcNoDataValue = static_cast<T>(floor(dfNoDataValue + 0.5));
+                ctxt.fSrcNoDataValue =
+                    static_cast<T>(floor(dfNoDataValue + 0.5));
             }
             else
             {
@@ -390,15 +865,40 @@ static CPLErr GDALGeneric3x3Processing(
     else
     {
         eReadDT = GDT_Float32;
-        fSrcNoDataValue = static_cast<T>(dfNoDataValue);
-        bIsSrcNoDataNan = bSrcHasNoData && std::isnan(dfNoDataValue);
+        ctxt.fSrcNoDataValue = static_cast<T>(dfNoDataValue);
+        ctxt.bIsSrcNoDataNan = bSrcHasNoData && std::isnan(dfNoDataValue);
     }
+    ctxt.bSrcHasNoData = CPL_TO_BOOL(bSrcHasNoData);
 
     int bDstHasNoData = FALSE;
-    float fDstNoDataValue =
+    ctxt.fDstNoDataValue =
         static_cast<float>(GDALGetRasterNoDataValue(hDstBand, &bDstHasNoData));
     if (!bDstHasNoData)
-        fDstNoDataValue = 0.0;
+        ctxt.fDstNoDataValue = 0.0;
+
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 && nYSize > 2 ? GDALGetGlobalThreadPool(nThreads)
+                                   : nullptr;
+    if (poThreadPool)
+    {
+        const CPLErr eErr = GDALGeneric3x3ProcessingMT(
+            ctxt, hSrcBand, eReadDT, hDstBand, poThreadPool, nThreads,
+            pfnProgress, pProgressData);
+        if (eErr == CE_None)
+            pfnProgress(1.0, nullptr, pProgressData);
+        return eErr;
+    }
+
+    // 1 line destination buffer.
+    std::unique_ptr<float, VSIFreeReleaser> pafOutputBuf(
+        static_cast<float *>(VSI_MALLOC2_VERBOSE(sizeof(float), nXSize)));
+    // 3 line rotating source buffer.
+    std::unique_ptr<T, VSIFreeReleaser> pafThreeLineWin(
+        static_cast<T *>(VSI_MALLOC2_VERBOSE(3 * sizeof(T), nXSize)));
+    if (pafOutputBuf == nullptr || pafThreeLineWin == nullptr)
+    {
+        return CE_Failure;
+    }
 
     int nLine1Off = 0;
     int nLine2Off = nXSize;
@@ -413,306 +913,70 @@ static CPLErr GDALGeneric3x3Processing(
 
     /* Preload the first 2 lines */
 
-    bool abLineHasNoDataValue[3] = {CPL_TO_BOOL(bSrcHasNoData),
-                                    CPL_TO_BOOL(bSrcHasNoData),
-                                    CPL_TO_BOOL(bSrcHasNoData)};
+    bool abLineHasNoDataValue[3] = {ctxt.bSrcHasNoData, ctxt.bSrcHasNoData,
+                                    ctxt.bSrcHasNoData};
 
     for (int i = 0; i < 2 && i < nYSize; i++)
     {
         if (GDALRasterIO(hSrcBand, GF_Read, 0, i, nXSize, 1,
-                         pafThreeLineWin + i * nXSize, nXSize, 1, eReadDT, 0,
-                         0) != CE_None)
-        {
-            CPLFree(pafOutputBuf);
-            CPLFree(pafThreeLineWin);
-
-            return CE_Failure;
-        }
-        if (bSrcHasNoData)
-        {
-            abLineHasNoDataValue[i] = false;
-            if constexpr (std::numeric_limits<T>::is_integer)
-            {
-                for (int iX = 0; iX < nXSize; iX++)
-                {
-                    if (pafThreeLineWin[i * nXSize + iX] == fSrcNoDataValue)
-                    {
-                        abLineHasNoDataValue[i] = true;
-                        break;
-                    }
-                }
-            }
-            else
-            {
-                for (int iX = 0; iX < nXSize; iX++)
-                {
-                    if (pafThreeLineWin[i * nXSize + iX] == fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[i * nXSize + iX]))
-                    {
-                        abLineHasNoDataValue[i] = true;
-                        break;
-                    }
-                }
-            }
-        }
-    }
-
-    CPLErr eErr = CE_None;
-    if (bComputeAtEdges && nXSize >= 2 && nYSize >= 2)
-    {
-        for (int j = 0; j < nXSize; j++)
-        {
-            int jmin = (j == 0) ? j : j - 1;
-            int jmax = (j == nXSize - 1) ? j : j + 1;
-
-            T afWin[9] = {
-                INTERPOL(pafThreeLineWin[jmin], pafThreeLineWin[nXSize + jmin],
-                         bSrcHasNoData, fSrcNoDataValue),
-                INTERPOL(pafThreeLineWin[j], pafThreeLineWin[nXSize + j],
-                         bSrcHasNoData, fSrcNoDataValue),
-                INTERPOL(pafThreeLineWin[jmax], pafThreeLineWin[nXSize + jmax],
-                         bSrcHasNoData, fSrcNoDataValue),
-                pafThreeLineWin[jmin],
-                pafThreeLineWin[j],
-                pafThreeLineWin[jmax],
-                pafThreeLineWin[nXSize + jmin],
-                pafThreeLineWin[nXSize + j],
-                pafThreeLineWin[nXSize + jmax]};
-            pafOutputBuf[j] = ComputeVal(
-                CPL_TO_BOOL(bSrcHasNoData), fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
-        }
-        eErr = GDALRasterIO(hDstBand, GF_Write, 0, 0, nXSize, 1, pafOutputBuf,
-                            nXSize, 1, GDT_Float32, 0, 0);
-    }
-    else
-    {
-        // Exclude the edges
-        for (int j = 0; j < nXSize; j++)
-        {
-            pafOutputBuf[j] = fDstNoDataValue;
-        }
-        eErr = GDALRasterIO(hDstBand, GF_Write, 0, 0, nXSize, 1, pafOutputBuf,
-                            nXSize, 1, GDT_Float32, 0, 0);
-
-        if (eErr == CE_None && nYSize > 1)
-        {
-            eErr = GDALRasterIO(hDstBand, GF_Write, 0, nYSize - 1, nXSize, 1,
-                                pafOutputBuf, nXSize, 1, GDT_Float32, 0, 0);
-        }
-    }
-    if (eErr != CE_None)
-    {
-        CPLFree(pafOutputBuf);
-        CPLFree(pafThreeLineWin);
-
-        return eErr;
-    }
-
-    int i = 1;  // Used after for.
-    for (; i < nYSize - 1; i++)
-    {
-        /* Read third line of the line buffer */
-        eErr =
-            GDALRasterIO(hSrcBand, GF_Read, 0, i + 1, nXSize, 1,
-                         pafThreeLineWin + nLine3Off, nXSize, 1, eReadDT, 0, 0);
-        if (eErr != CE_None)
-        {
-            CPLFree(pafOutputBuf);
-            CPLFree(pafThreeLineWin);
-
-            return eErr;
-        }
-
-        // In case none of the 3 lines have nodata values, then no need to
-        // check it in ComputeVal()
-        bool bOneOfThreeLinesHasNoData = CPL_TO_BOOL(bSrcHasNoData);
-        if (bSrcHasNoData)
-        {
-            if constexpr (std::numeric_limits<T>::is_integer)
-            {
-                bool bLastLineHasNoDataValue = false;
-                int iX = 0;
-                for (; iX + 3 < nXSize; iX += 4)
-                {
-                    if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue ||
-                        pafThreeLineWin[nLine3Off + iX + 1] ==
-                            fSrcNoDataValue ||
-                        pafThreeLineWin[nLine3Off + iX + 2] ==
-                            fSrcNoDataValue ||
-                        pafThreeLineWin[nLine3Off + iX + 3] == fSrcNoDataValue)
-                    {
-                        bLastLineHasNoDataValue = true;
-                        break;
-                    }
-                }
-                if (!bLastLineHasNoDataValue)
-                {
-                    for (; iX < nXSize; iX++)
-                    {
-                        if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue)
-                        {
-                            bLastLineHasNoDataValue = true;
-                        }
-                    }
-                }
-                abLineHasNoDataValue[nLine3Off / nXSize] =
-                    bLastLineHasNoDataValue;
-
-                bOneOfThreeLinesHasNoData = abLineHasNoDataValue[0] ||
-                                            abLineHasNoDataValue[1] ||
-                                            abLineHasNoDataValue[2];
-            }
-            else
-            {
-                bool bLastLineHasNoDataValue = false;
-                int iX = 0;
-                for (; iX + 3 < nXSize; iX += 4)
-                {
-                    if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[nLine3Off + iX]) ||
-                        pafThreeLineWin[nLine3Off + iX + 1] ==
-                            fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[nLine3Off + iX + 1]) ||
-                        pafThreeLineWin[nLine3Off + iX + 2] ==
-                            fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[nLine3Off + iX + 2]) ||
-                        pafThreeLineWin[nLine3Off + iX + 3] ==
-                            fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[nLine3Off + iX + 3]))
-                    {
-                        bLastLineHasNoDataValue = true;
-                        break;
-                    }
-                }
-                if (!bLastLineHasNoDataValue)
-                {
-                    for (; iX < nXSize; iX++)
-                    {
-                        if (pafThreeLineWin[nLine3Off + iX] ==
-                                fSrcNoDataValue ||
-                            std::isnan(pafThreeLineWin[nLine3Off + iX]))
-                        {
-                            bLastLineHasNoDataValue = true;
-                        }
-                    }
-                }
-                abLineHasNoDataValue[nLine3Off / nXSize] =
-                    bLastLineHasNoDataValue;
-
-                bOneOfThreeLinesHasNoData = abLineHasNoDataValue[0] ||
-                                            abLineHasNoDataValue[1] ||
-                                            abLineHasNoDataValue[2];
-            }
-        }
-
-        if (bComputeAtEdges && nXSize >= 2)
-        {
-            int j = 0;
-            T afWin[9] = {INTERPOL(pafThreeLineWin[nLine1Off + j],
-                                   pafThreeLineWin[nLine1Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine1Off + j],
-                          pafThreeLineWin[nLine1Off + j + 1],
-                          INTERPOL(pafThreeLineWin[nLine2Off + j],
-                                   pafThreeLineWin[nLine2Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine2Off + j],
-                          pafThreeLineWin[nLine2Off + j + 1],
-                          INTERPOL(pafThreeLineWin[nLine3Off + j],
-                                   pafThreeLineWin[nLine3Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine3Off + j],
-                          pafThreeLineWin[nLine3Off + j + 1]};
-
-            pafOutputBuf[j] = ComputeVal(
-                bOneOfThreeLinesHasNoData, fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
-        }
-        else
-        {
-            // Exclude the edges
-            pafOutputBuf[0] = fDstNoDataValue;
-        }
-
-        int j = 1;
-        if (pfnAlg_multisample && !bOneOfThreeLinesHasNoData)
+                         pafThreeLineWin.get() + i * nXSize, nXSize, 1,
+                         eReadDT, 0, 0) != CE_None)
         {
-            j = pfnAlg_multisample(
-                pafThreeLineWin + nLine1Off, pafThreeLineWin + nLine2Off,
-                pafThreeLineWin + nLine3Off, nXSize, pData.get(), pafOutputBuf);
+            return CE_Failure;
         }
+        abLineHasNoDataValue[i] =
+            ctxt.LineHasNoData(pafThreeLineWin.get() + i * nXSize);
+    }
 
-        for (; j < nXSize - 1; j++)
-        {
-            T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
-                          pafThreeLineWin[nLine1Off + j],
-                          pafThreeLineWin[nLine1Off + j + 1],
-                          pafThreeLineWin[nLine2Off + j - 1],
-                          pafThreeLineWin[nLine2Off + j],
-                          pafThreeLineWin[nLine2Off + j + 1],
-                          pafThreeLineWin[nLine3Off + j - 1],
-                          pafThreeLineWin[nLine3Off + j],
-                          pafThreeLineWin[nLine3Off + j + 1]};
-
-            pafOutputBuf[j] = ComputeVal(
-                bOneOfThreeLinesHasNoData, fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
-        }
+    ctxt.ComputeFirstLine(pafThreeLineWin.get(),
+                          pafThreeLineWin.get() + nXSize, pafOutputBuf.get());
+    CPLErr eErr =
+        GDALRasterIO(hDstBand, GF_Write, 0, 0, nXSize, 1, pafOutputBuf.get(),
+                     nXSize, 1, GDT_Float32, 0, 0);
+    if (eErr != CE_None)
+    {
+        return eErr;
+    }
 
-        if (bComputeAtEdges && nXSize >= 2)
-        {
-            j = nXSize - 1;
-
-            T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
-                          pafThreeLineWin[nLine1Off + j],
-                          INTERPOL(pafThreeLineWin[nLine1Off + j],
-                                   pafThreeLineWin[nLine1Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine2Off + j - 1],
-                          pafThreeLineWin[nLine2Off + j],
-                          INTERPOL(pafThreeLineWin[nLine2Off + j],
-                                   pafThreeLineWin[nLine2Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine3Off + j - 1],
-                          pafThreeLineWin[nLine3Off + j],
-                          INTERPOL(pafThreeLineWin[nLine3Off + j],
-                                   pafThreeLineWin[nLine3Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue)};
-
-            pafOutputBuf[j] = ComputeVal(
-                bOneOfThreeLinesHasNoData, fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
-        }
-        else
+    int i = 1;  // Used after for.
+    for (; i < nYSize - 1; i++)
+    {
+        /* Read third line of the line buffer */
+        eErr = GDALRasterIO(hSrcBand, GF_Read, 0, i + 1, nXSize, 1,
+                            pafThreeLineWin.get() + nLine3Off, nXSize, 1,
+                            eReadDT, 0, 0);
+        if (eErr != CE_None)
         {
-            // Exclude the edges
-            if (nXSize > 1)
-                pafOutputBuf[nXSize - 1] = fDstNoDataValue;
+            return eErr;
         }
 
+        // In case none of the 3 lines have nodata values, then no need to
+        // check it in ComputeVal()
+        abLineHasNoDataValue[nLine3Off / nXSize] =
+            ctxt.LineHasNoData(pafThreeLineWin.get() + nLine3Off);
+        const bool bOneOfThreeLinesHasNoData = abLineHasNoDataValue[0] ||
+                                               abLineHasNoDataValue[1] ||
+                                               abLineHasNoDataValue[2];
+
+        ctxt.ComputeLine(pafThreeLineWin.get() + nLine1Off,
+                         pafThreeLineWin.get() + nLine2Off,
+                         pafThreeLineWin.get() + nLine3Off,
+                         bOneOfThreeLinesHasNoData, pafOutputBuf.get());
+
         /* -----------------------------------------
          * Write Line to Raster
          */
-        eErr = GDALRasterIO(hDstBand, GF_Write, 0, i, nXSize, 1, pafOutputBuf,
-                            nXSize, 1, GDT_Float32, 0, 0);
+        eErr = GDALRasterIO(hDstBand, GF_Write, 0, i, nXSize, 1,
+                            pafOutputBuf.get(), nXSize, 1, GDT_Float32, 0, 0);
         if (eErr != CE_None)
         {
-            CPLFree(pafOutputBuf);
-            CPLFree(pafThreeLineWin);
-
             return eErr;
         }
 
         if (!pfnProgress(1.0 * (i + 1) / nYSize, nullptr, pProgressData))
         {
             CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-            eErr = CE_Failure;
-
-            CPLFree(pafOutputBuf);
-            CPLFree(pafThreeLineWin);
-
-            return eErr;
+            return CE_Failure;
         }
 
         const int nTemp = nLine1Off;
@@ -721,53 +985,22 @@ static CPLErr GDALGeneric3x3Processing(
         nLine3Off = nTemp;
     }
 
-    if (bComputeAtEdges && nXSize >= 2 && nYSize >= 2)
+    if (nYSize >= 2)
     {
-        for (int j = 0; j < nXSize; j++)
-        {
-            int jmin = (j == 0) ? j : j - 1;
-            int jmax = (j == nXSize - 1) ? j : j + 1;
-
-            T afWin[9] = {
-                pafThreeLineWin[nLine1Off + jmin],
-                pafThreeLineWin[nLine1Off + j],
-                pafThreeLineWin[nLine1Off + jmax],
-                pafThreeLineWin[nLine2Off + jmin],
-                pafThreeLineWin[nLine2Off + j],
-                pafThreeLineWin[nLine2Off + jmax],
-                INTERPOL(pafThreeLineWin[nLine2Off + jmin],
-                         pafThreeLineWin[nLine1Off + jmin], bSrcHasNoData,
-                         fSrcNoDataValue),
-                INTERPOL(pafThreeLineWin[nLine2Off + j],
-                         pafThreeLineWin[nLine1Off + j], bSrcHasNoData,
-                         fSrcNoDataValue),
-                INTERPOL(pafThreeLineWin[nLine2Off + jmax],
-                         pafThreeLineWin[nLine1Off + jmax], bSrcHasNoData,
-                         fSrcNoDataValue),
-            };
-
-            pafOutputBuf[j] = ComputeVal(
-                CPL_TO_BOOL(bSrcHasNoData), fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
-        }
-        eErr = GDALRasterIO(hDstBand, GF_Write, 0, i, nXSize, 1, pafOutputBuf,
-                            nXSize, 1, GDT_Float32, 0, 0);
+        ctxt.ComputeLastLine(pafThreeLineWin.get() + nLine1Off,
+                             pafThreeLineWin.get() + nLine2Off,
+                             pafOutputBuf.get());
+        eErr = GDALRasterIO(hDstBand, GF_Write, 0, i, nXSize, 1,
+                            pafOutputBuf.get(), nXSize, 1, GDT_Float32, 0, 0);
         if (eErr != CE_None)
         {
-            CPLFree(pafOutputBuf);
-            CPLFree(pafThreeLineWin);
-
             return eErr;
         }
     }
 
     pfnProgress(1.0, nullptr, pProgressData);
-    eErr = CE_None;
 
-    CPLFree(pafOutputBuf);
-    CPLFree(pafThreeLineWin);
-
-    return eErr;
+    return CE_None;
 }
 
 /************************************************************************/
@@ -805,6 +1038,75 @@ template <class T> struct Gradient<T, GradientAlg::ZEVENBERGEN_THORNE>
     }
 };
 
+#if defined(HAVE_16_SSE_REG)
+
+/************************************************************************/
+/*                        GDALLoad3x3RegWindow()                        */
+/************************************************************************/
+
+// Load the 3x3 windows of the pixels j to j + N - 1 of the second line,
+// N being the number of values in a register. aWin[k] holds, for each of
+// those pixels, what afWin[k] is for the per-pixel algorithms.
+template <class T, class REG_T>
+static inline void GDALLoad3x3RegWindow(const T *pafFirstLine,
+                                        const T *pafSecondLine,
+                                        const T *pafThirdLine, int j,
+                                        REG_T *aWin)
+{
+    aWin[0] = REG_T::LoadAllVal(pafFirstLine + j - 1);
+    aWin[1] = REG_T::LoadAllVal(pafFirstLine + j);
+    aWin[2] = REG_T::LoadAllVal(pafFirstLine + j + 1);
+    aWin[3] = REG_T::LoadAllVal(pafSecondLine + j - 1);
+    aWin[4] = REG_T::LoadAllVal(pafSecondLine + j);
+    aWin[5] = REG_T::LoadAllVal(pafSecondLine + j + 1);
+    aWin[6] = REG_T::LoadAllVal(pafThirdLine + j - 1);
+    aWin[7] = REG_T::LoadAllVal(pafThirdLine + j);
+    aWin[8] = REG_T::LoadAllVal(pafThirdLine + j + 1);
+}
+
+/************************************************************************/
+/*                         GradientMultiSample                          */
+/************************************************************************/
+
+// Vectorized counterpart of Gradient, with the same sequence of operations
+// so that results are bit-identical.
+template <GradientAlg alg> struct GradientMultiSample
+{
+};
+
+template <> struct GradientMultiSample<GradientAlg::HORN>
+{
+    template <class REG_T, class REG_FLOAT>
+    static inline void calc(const REG_T *aWin, const REG_FLOAT &inv_ewres,
+                            const REG_FLOAT &inv_nsres, REG_FLOAT &x,
+                            REG_FLOAT &y)
+    {
+        x = ((aWin[0] + aWin[3] + aWin[3] + aWin[6]) -
+             (aWin[2] + aWin[5] + aWin[5] + aWin[8]))
+                .cast_to_float() *
+            inv_ewres;
+
+        y = ((aWin[6] + aWin[7] + aWin[7] + aWin[8]) -
+             (aWin[0] + aWin[1] + aWin[1] + aWin[2]))
+                .cast_to_float() *
+            inv_nsres;
+    }
+};
+
+template <> struct GradientMultiSample<GradientAlg::ZEVENBERGEN_THORNE>
+{
+    template <class REG_T, class REG_FLOAT>
+    static inline void calc(const REG_T *aWin, const REG_FLOAT &inv_ewres,
+                            const REG_FLOAT &inv_nsres, REG_FLOAT &x,
+                            REG_FLOAT &y)
+    {
+        x = (aWin[3] - aWin[5]).cast_to_float() * inv_ewres;
+        y = (aWin[7] - aWin[1]).cast_to_float() * inv_nsres;
+    }
+};
+
+#endif  // HAVE_16_SSE_REG
+
 /************************************************************************/
 /*                           GDALHillshade()                            */
 /************************************************************************/
@@ -923,6 +1225,20 @@ inline float ApproxADivByInvSqrtB(float a, float b)
 }
 #endif
 
+#if defined(HAVE_16_SSE_REG)
+// Vectorized counterpart of the above, giving the same results
+template <class REG_FLOAT>
+inline REG_FLOAT ApproxADivByInvSqrtB(const REG_FLOAT &a, const REG_FLOAT &b)
+{
+#ifdef HAVE_SSE2
+    const auto reg_half = REG_FLOAT::Set1(0.5f);
+    return a * b.approx_inv_sqrt(reg_half + reg_half, reg_half);
+#else
+    return a / REG_FLOAT::Sqrt(b);
+#endif
+}
+#endif
+
 static float NormalizeAngle(float angle, float normalizer)
 {
     angle = std::fmod(angle, normalizer);
@@ -1085,7 +1401,8 @@ static float GDALHillshadeAlg_same_res(const T *afWin,
 template <class T, class REG_T, class REG_FLOAT>
 static int GDALHillshadeAlg_same_res_multisample(
     const T *pafFirstLine, const T *pafSecondLine, const T *pafThirdLine,
-    int nXSize, const AlgorithmParameters *pData, float *pafOutputBuf)
+    int nXSize, float /*fDstNoDataValue*/, const AlgorithmParameters *pData,
+    float *pafOutputBuf)
 {
     const GDALHillshadeAlgData *psData =
         static_cast<const GDALHillshadeAlgData *>(pData);
@@ -1145,6 +1462,52 @@ static int GDALHillshadeAlg_same_res_multisample(
     }
     return j;
 }
+
+// Row-oriented version of GDALHillshadeAlg(), with bit-identical results
+template <class T, GradientAlg alg, class REG_T, class REG_FLOAT>
+static int GDALHillshadeAlg_multisample(const T *pafFirstLine,
+                                        const T *pafSecondLine,
+                                        const T *pafThirdLine, int nXSize,
+                                        float /*fDstNoDataValue*/,
+                                        const AlgorithmParameters *pData,
+                                        float *pafOutputBuf)
+{
+    const GDALHillshadeAlgData *psData =
+        static_cast<const GDALHillshadeAlgData *>(pData);
+    const auto reg_inv_ewres = REG_FLOAT::Set1(psData->inv_ewres_xscale);
+    const auto reg_inv_nsres = REG_FLOAT::Set1(psData->inv_nsres_yscale);
+    const auto reg_constant_num =
+        REG_FLOAT::Set1(psData->sin_altRadians_mul_254);
+    const auto reg_fact_x =
+        REG_FLOAT::Set1(psData->sin_az_mul_cos_alt_mul_z_mul_254);
+    const auto reg_fact_y =
+        REG_FLOAT::Set1(psData->cos_az_mul_cos_alt_mul_z_mul_254);
+    const auto reg_square_z = REG_FLOAT::Set1(psData->square_z);
+    const auto reg_one = REG_FLOAT::Set1(1.0f);
+
+    int j = 1;  // Used after for.
+    constexpr int N_VAL_PER_REG =
+        static_cast<int>(sizeof(REG_FLOAT) / sizeof(float));
+    for (; j < nXSize - N_VAL_PER_REG; j += N_VAL_PER_REG)
+    {
+        REG_T aWin[9];
+        GDALLoad3x3RegWindow(pafFirstLine, pafSecondLine, pafThirdLine, j,
+                             aWin);
+
+        REG_FLOAT x, y;
+        GradientMultiSample<alg>::calc(aWin, reg_inv_ewres, reg_inv_nsres, x,
+                                       y);
+
+        const auto xx_plus_yy = x * x + y * y;
+        const auto cang_mul_254 = ApproxADivByInvSqrtB(
+            reg_constant_num - (y * reg_fact_y - x * reg_fact_x),
+            reg_one + reg_square_z * xx_plus_yy);
+
+        REG_FLOAT::Max(reg_one, cang_mul_254 + reg_one)
+            .StoreAllVal(pafOutputBuf + j);
+    }
+    return j;
+}
 #endif
 
 template <class T, GradientAlg alg>
@@ -1406,6 +1769,62 @@ static float GDALSlopeZevenbergenThorneAlg(const T *afWin,
     return (100.0f / 2.0f) * std::sqrt(key);
 }
 
+#if defined(HAVE_16_SSE_REG)
+// Row-oriented version of GDALSlopeHornAlg() and
+// GDALSlopeZevenbergenThorneAlg(), with bit-identical results
+template <class T, GradientAlg alg, class REG_T, class REG_FLOAT>
+static int GDALSlopeAlg_multisample(const T *pafFirstLine,
+                                    const T *pafSecondLine,
+                                    const T *pafThirdLine, int nXSize,
+                                    float /*fDstNoDataValue*/,
+                                    const AlgorithmParameters *pData,
+                                    float *pafOutputBuf)
+{
+    const GDALSlopeAlgData *psData =
+        static_cast<const GDALSlopeAlgData *>(pData);
+    const auto reg_inv_ewres = REG_FLOAT::Set1(psData->inv_ewres_xscale);
+    const auto reg_inv_nsres = REG_FLOAT::Set1(psData->inv_nsres_yscale);
+    // Horn gradients are expressed over 8 pixel spacings, Zevenbergen &
+    // Thorne ones over 2.
+    constexpr float fInvSpacing =
+        alg == GradientAlg::HORN ? 1.0f / 8.0f : 0.5f;
+    const auto reg_degree_factor = REG_FLOAT::Set1(fInvSpacing);
+    const auto reg_percent_factor = REG_FLOAT::Set1(100.0f * fInvSpacing);
+    const bool bDegrees = psData->slopeFormat == 1;
+
+    int j = 1;  // Used after for.
+    constexpr int N_VAL_PER_REG =
+        static_cast<int>(sizeof(REG_FLOAT) / sizeof(float));
+    for (; j < nXSize - N_VAL_PER_REG; j += N_VAL_PER_REG)
+    {
+        REG_T aWin[9];
+        GDALLoad3x3RegWindow(pafFirstLine, pafSecondLine, pafThirdLine, j,
+                             aWin);
+
+        REG_FLOAT dx, dy;
+        GradientMultiSample<alg>::calc(aWin, reg_inv_ewres, reg_inv_nsres, dx,
+                                       dy);
+
+        const auto sqrt_key = REG_FLOAT::Sqrt(dx * dx + dy * dy);
+        if (bDegrees)
+        {
+            // No vectorized atan(): finish lane by lane
+            (sqrt_key * reg_degree_factor).StoreAllVal(pafOutputBuf + j);
+            for (int k = 0; k < N_VAL_PER_REG; ++k)
+            {
+                pafOutputBuf[j + k] =
+                    std::atan(pafOutputBuf[j + k]) * kfRadToDeg;
+            }
+        }
+        else
+        {
+            (reg_percent_factor * sqrt_key).StoreAllVal(pafOutputBuf + j);
+        }
+    }
+    return j;
+}
+#endif
+
 static std::unique_ptr<AlgorithmParameters>
 GDALCreateSlopeData(double *adfGeoTransform, double xscale, double yscale,
                     int slopeFormat)
@@ -1437,21 +1856,9 @@ GDALAspectAlgData::CreateScaledParameters(double, double)
     return std::make_unique<GDALAspectAlgData>(*this);
 }
 
-template <class T>
-static float GDALAspectAlg(const T *afWin, float fDstNoDataValue,
-                           const AlgorithmParameters *pData)
+static float GDALAspectFromGradient(float dx, float dy, float fDstNoDataValue,
+                                    bool bAngleAsAzimuth)
 {
-    const GDALAspectAlgData *psData =
-        static_cast<const GDALAspectAlgData *>(pData);
-
-    const auto dx =
-        static_cast<float>((afWin[2] + afWin[5] + afWin[5] + afWin[8]) -
-                           (afWin[0] + afWin[3] + afWin[3] + afWin[6]));
-
-    const auto dy =
-        static_cast<float>((afWin[6] + afWin[7] + afWin[7] + afWin[8]) -
-                           (afWin[0] + afWin[1] + afWin[1] + afWin[2]));
-
     auto aspect = std::atan2(dy, -dx) * kfRadToDeg;
 
     if (dx == 0 && dy == 0)
@@ -1459,7 +1866,7 @@ static float GDALAspectAlg(const T *afWin, float fDstNoDataValue,
         /* Flat area */
         aspect = fDstNoDataValue;
     }
-    else if (psData->bAngleAsAzimuth)
+    else if (bAngleAsAzimuth)
     {
         if (aspect > 90.0f)
             aspect = 450.0f - aspect;
@@ -1478,6 +1885,25 @@ static float GDALAspectAlg(const T *afWin, float fDstNoDataValue,
     return aspect;
 }
 
+template <class T>
+static float GDALAspectAlg(const T *afWin, float fDstNoDataValue,
+                           const AlgorithmParameters *pData)
+{
+    const GDALAspectAlgData *psData =
+        static_cast<const GDALAspectAlgData *>(pData);
+
+    const auto dx =
+        static_cast<float>((afWin[2] + afWin[5] + afWin[5] + afWin[8]) -
+                           (afWin[0] + afWin[3] + afWin[3] + afWin[6]));
+
+    const auto dy =
+        static_cast<float>((afWin[6] + afWin[7] + afWin[7] + afWin[8]) -
+                           (afWin[0] + afWin[1] + afWin[1] + afWin[2]));
+
+    return GDALAspectFromGradient(dx, dy, fDstNoDataValue,
+                                  psData->bAngleAsAzimuth);
+}
+
 template <class T>
 static float GDALAspectZevenbergenThorneAlg(const T *afWin,
                                             float fDstNoDataValue,
@@ -1488,30 +1914,62 @@ static float GDALAspectZevenbergenThorneAlg(const T *afWin,
 
     const auto dx = static_cast<float>(afWin[5] - afWin[3]);
     const auto dy = static_cast<float>(afWin[7] - afWin[1]);
-    float aspect = std::atan2(dy, -dx) * kfRadToDeg;
-    if (dx == 0 && dy == 0)
-    {
-        /* Flat area */
-        aspect = fDstNoDataValue;
-    }
-    else if (psData->bAngleAsAzimuth)
-    {
-        if (aspect > 90.0f)
-            aspect = 450.0f - aspect;
-        else
-            aspect = 90.0f - aspect;
-    }
-    else
+    return GDALAspectFromGradient(dx, dy, fDstNoDataValue,
+                                  psData->bAngleAsAzimuth);
+}
+
+#if defined(HAVE_16_SSE_REG)
+// Row-oriented version of GDALAspectAlg() and
+// GDALAspectZevenbergenThorneAlg(), with bit-identical results
+template <class T, GradientAlg alg, class REG_T, class REG_FLOAT>
+static int GDALAspectAlg_multisample(const T *pafFirstLine,
+                                     const T *pafSecondLine,
+                                     const T *pafThirdLine, int nXSize,
+                                     float fDstNoDataValue,
+                                     const AlgorithmParameters *pData,
+                                     float *pafOutputBuf)
+{
+    const GDALAspectAlgData *psData =
+        static_cast<const GDALAspectAlgData *>(pData);
+
+    int j = 1;  // Used after for.
+    constexpr int N_VAL_PER_REG =
+        static_cast<int>(sizeof(REG_FLOAT) / sizeof(float));
+    float afDx[N_VAL_PER_REG];
+    float afDy[N_VAL_PER_REG];
+    for (; j < nXSize - N_VAL_PER_REG; j += N_VAL_PER_REG)
     {
-        if (aspect < 0)
-            aspect += 360.0f;
-    }
+        REG_T aWin[9];
+        GDALLoad3x3RegWindow(pafFirstLine, pafSecondLine, pafThirdLine, j,
+                             aWin);
 
-    if (aspect == 360.0f)
-        aspect = 0.0;
+        if constexpr (alg == GradientAlg::HORN)
+        {
+            ((aWin[2] + aWin[5] + aWin[5] + aWin[8]) -
+             (aWin[0] + aWin[3] + aWin[3] + aWin[6]))
+                .cast_to_float()
+                .StoreAllVal(afDx);
+            ((aWin[6] + aWin[7] + aWin[7] + aWin[8]) -
+             (aWin[0] + aWin[1] + aWin[1] + aWin[2]))
+                .cast_to_float()
+                .StoreAllVal(afDy);
+        }
+        else
+        {
+            (aWin[5] - aWin[3]).cast_to_float().StoreAllVal(afDx);
+            (aWin[7] - aWin[1]).cast_to_float().StoreAllVal(afDy);
+        }
 
-    return aspect;
+        // No vectorized atan2(): finish lane by lane
+        for (int k = 0; k < N_VAL_PER_REG; ++k)
+        {
+            pafOutputBuf[j + k] = GDALAspectFromGradient(
+                afDx[k], afDy[k], fDstNoDataValue, psData->bAngleAsAzimuth);
+        }
+    }
+    return j;
 }
+#endif
 
 static std::unique_ptr<AlgorithmParameters>
 GDALCreateAspectData(bool bAngleAsAzimuth)
@@ -2359,6 +2817,37 @@ static float GDALTPIAlg(const T *afWin, float /*fDstNoDataValue*/,
                        0.125f);
 }
 
+#if defined(HAVE_16_SSE_REG)
+// Row-oriented version of GDALTPIAlg(), with bit-identical results
+template <class T, class REG_T, class REG_FLOAT>
+static int GDALTPIAlg_multisample(const T *pafFirstLine, const T *pafSecondLine,
+                                  const T *pafThirdLine, int nXSize,
+                                  float /*fDstNoDataValue*/,
+                                  const AlgorithmParameters * /*pData*/,
+                                  float *pafOutputBuf)
+{
+    const auto reg_one_eighth = REG_FLOAT::Set1(0.125f);
+
+    int j = 1;  // Used after for.
+    constexpr int N_VAL_PER_REG =
+        static_cast<int>(sizeof(REG_FLOAT) / sizeof(float));
+    for (; j < nXSize - N_VAL_PER_REG; j += N_VAL_PER_REG)
+    {
+        REG_T aWin[9];
+        GDALLoad3x3RegWindow(pafFirstLine, pafSecondLine, pafThirdLine, j,
+                             aWin);
+
+        (aWin[4].cast_to_float() -
+         (aWin[0] + aWin[1] + aWin[2] + aWin[3] + aWin[5] + aWin[6] + aWin[7] +
+          aWin[8])
+                 .cast_to_float() *
+             reg_one_eighth)
+            .StoreAllVal(pafOutputBuf + j);
+    }
+    return j;
+}
+#endif
+
 /************************************************************************/
 /*                          GDALRoughnessAlg()                          */
 /************************************************************************/
@@ -2411,8 +2900,13 @@ template <class T> class GDALGeneric3x3Dataset final : public GDALDataset
     double dfDstNoDataValue = 0;
     int nCurLine = -1;
     const bool bComputeAtEdges;
+    const int nThreads;
     const bool bTakeReference;
 
+    // Buffers used when blocks are several lines high (multi-threaded mode)
+    std::vector<T> m_aSrcLines{};
+    std::vector<float> m_afOutputLines{};
+
     using GDALDatasetRefCountedPtr =
         std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser>;
 
@@ -2428,7 +2922,7 @@ template <class T> class GDALGeneric3x3Dataset final : public GDALDataset
         typename GDALGeneric3x3ProcessingAlg_multisample<T>::type
             pfnAlg_multisample,
         std::unique_ptr<AlgorithmParameters> pAlgData, bool bComputeAtEdges,
-        bool bTakeReferenceIn);
+        int nThreads, bool bTakeReferenceIn);
     ~GDALGeneric3x3Dataset() override;
 
     bool InitOK() const
@@ -2456,6 +2950,7 @@ template <class T> class GDALGeneric3x3RasterBand final : public GDALRasterBand
     GDALDataType eReadDT = GDT_Unknown;
 
     void InitWithNoData(void *pImage);
+    CPLErr IReadMultiLineBlock(int nBlockYOff, void *pImage);
 
   public:
     GDALGeneric3x3RasterBand(GDALGeneric3x3Dataset<T> *poDSIn,
@@ -2487,11 +2982,17 @@ GDALGeneric3x3Dataset<T>::GDALGeneric3x3Dataset(
     typename GDALGeneric3x3ProcessingAlg_multisample<T>::type
         pfnAlg_multisampleIn,
     std::unique_ptr<AlgorithmParameters> pAlgDataIn, bool bComputeAtEdgesIn,
-    bool bTakeReferenceIn)
+    int nThreadsIn, bool bTakeReferenceIn)
     : pfnAlg(pfnAlgIn), pfnAlg_multisample(pfnAlg_multisampleIn),
       pAlgData(std::move(pAlgDataIn)), hSrcDS(hSrcDSIn), hSrcBand(hSrcBandIn),
       bDstHasNoData(bDstHasNoDataIn), dfDstNoDataValue(dfDstNoDataValueIn),
-      bComputeAtEdges(bComputeAtEdgesIn), bTakeReference(bTakeReferenceIn)
+      bComputeAtEdges(bComputeAtEdgesIn),
+      // Fall back to single-threaded computation if the thread pool cannot
+      // be created
+      nThreads(nThreadsIn > 1 && GDALGetGlobalThreadPool(nThreadsIn)
+                   ? nThreadsIn
+                   : 1),
+      bTakeReference(bTakeReferenceIn)
 {
     CPLAssert(eDstDataType == GDT_UInt8 || eDstDataType == GDT_Float32);
 
@@ -2532,7 +3033,7 @@ GDALGeneric3x3Dataset<T>::GDALGeneric3x3Dataset(
                                static_cast<double>(nRasterYSize) /
                                    GDALGetRasterYSize(hOvrDS))
                          : nullptr,
-                bComputeAtEdges, false);
+                bComputeAtEdges, nThreads, false);
             if (poOvrDS->InitOK())
             {
                 m_apoOverviewDS.emplace_back(poOvrDS.release());
@@ -2572,6 +3073,14 @@ GDALGeneric3x3RasterBand<T>::GDALGeneric3x3RasterBand(
     eDataType = eDstDataType;
     nBlockXSize = poDS->GetRasterXSize();
     nBlockYSize = 1;
+    if (poDSIn->nThreads > 1)
+    {
+        // Blocks of several lines, whose computation is split over the
+        // worker threads
+        nBlockYSize = std::min(
+            poDS->GetRasterYSize(),
+            GDALGeneric3x3GetLinesPerJob(nBlockXSize) * poDSIn->nThreads);
+    }
 
     const double dfNoDataValue =
         GDALGetRasterNoDataValue(poDSIn->hSrcBand, &bSrcHasNoData);
@@ -2631,6 +3140,9 @@ template <class T>
 CPLErr GDALGeneric3x3RasterBand<T>::IReadBlock(int /*nBlockXOff*/,
                                                int nBlockYOff, void *pImage)
 {
+    if (nBlockYSize > 1)
+        return IReadMultiLineBlock(nBlockYOff, pImage);
+
     auto poGDS = cpl::down_cast<GDALGeneric3x3Dataset<T> *>(poDS);
 
     const auto UpdateLineNoDataFlag = [this, poGDS](int iLine)
@@ -2905,7 +3417,8 @@ CPLErr GDALGeneric3x3RasterBand<T>::IReadBlock(int /*nBlockXOff*/,
     {
         j = poGDS->pfnAlg_multisample(
             poGDS->apafSourceBuf[0], poGDS->apafSourceBuf[1],
-            poGDS->apafSourceBuf[2], nRasterXSize, poGDS->pAlgData.get(),
+            poGDS->apafSourceBuf[2], nRasterXSize,
+            static_cast<float>(poGDS->dfDstNoDataValue), poGDS->pAlgData.get(),
             poGDS->pafOutputBuf ? poGDS->pafOutputBuf.get()
                                 : static_cast<float *>(pImage));
 
@@ -2941,6 +3454,70 @@ CPLErr GDALGeneric3x3RasterBand<T>::IReadBlock(int /*nBlockXOff*/,
     return CE_None;
 }
 
+template <class T>
+CPLErr GDALGeneric3x3RasterBand<T>::IReadMultiLineBlock(int nBlockYOff,
+                                                        void *pImage)
+{
+    auto poGDS = cpl::down_cast<GDALGeneric3x3Dataset<T> *>(poDS);
+
+    const int nYOff = nBlockYOff * nBlockYSize;
+    const int nLines = std::min(nBlockYSize, nRasterYSize - nYOff);
+    const int nSrcYOff = std::max(0, nYOff - 1);
+    const int nSrcLines = std::min(nRasterYSize, nYOff + nLines + 1) - nSrcYOff;
+    const size_t nLineSize = static_cast<size_t>(nRasterXSize);
+
+    try
+    {
+        poGDS->m_aSrcLines.resize(nSrcLines * nLineSize);
+        if (eDataType != GDT_Float32)
+            poGDS->m_afOutputLines.resize(nLines * nLineSize);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate 3x3 processing buffers");
+        return CE_Failure;
+    }
+
+    const CPLErr eErr = GDALRasterIO(poGDS->hSrcBand, GF_Read, 0, nSrcYOff,
+                                     nRasterXSize, nSrcLines,
+                                     poGDS->m_aSrcLines.data(), nRasterXSize,
+                                     nSrcLines, eReadDT, 0, 0);
+    if (eErr != CE_None)
+        return eErr;
+
+    GDALGeneric3x3ProcessingContext<T> ctxt;
+    ctxt.pfnAlg = poGDS->pfnAlg;
+    ctxt.pfnAlg_multisample = poGDS->pfnAlg_multisample;
+    ctxt.pData = poGDS->pAlgData.get();
+    ctxt.bComputeAtEdges = poGDS->bComputeAtEdges;
+    ctxt.bSrcHasNoData = CPL_TO_BOOL(bSrcHasNoData);
+    ctxt.fSrcNoDataValue = fSrcNoDataValue;
+    ctxt.bIsSrcNoDataNan = bIsSrcNoDataNan;
+    ctxt.fDstNoDataValue = static_cast<float>(poGDS->dfDstNoDataValue);
+    ctxt.nXSize = nRasterXSize;
+    ctxt.nYSize = nRasterYSize;
+
+    float *pafOutputBuf = eDataType == GDT_Float32
+                              ? static_cast<float *>(pImage)
+                              : poGDS->m_afOutputLines.data();
+    auto poJobQueue =
+        GDALGetGlobalThreadPool(poGDS->nThreads)->CreateJobQueue();
+    GDALGeneric3x3ComputeLinesMT(ctxt, poJobQueue.get(),
+                                 poGDS->m_aSrcLines.data(), nSrcYOff, nSrcLines,
+                                 nYOff, nLines, pafOutputBuf);
+    poJobQueue->WaitCompletion();
+
+    if (eDataType != GDT_Float32)
+    {
+        GDALCopyWords64(pafOutputBuf, GDT_Float32,
+                        static_cast<int>(sizeof(float)), pImage, eDataType, 1,
+                        nLines * nLineSize);
+    }
+
+    return CE_None;
+}
+
 template <class T>
 double GDALGeneric3x3RasterBand<T>::GetNoDataValue(int *pbHasNoData)
 {
@@ -3040,6 +3617,23 @@ static std::unique_ptr<GDALArgumentParser> GDALDEMAppOptionsGetParser(
 
         subParser->add_creation_options_argument(psOptions->aosCreationOptions);
 
+        subParser->add_argument("-num_threads")
+            .metavar("<value|ALL_CPUS>")
+            .action(
+                [psOptions](const std::string &s)
+                {
+                    bool bOK = false;
+                    GDALGetNumThreads(s.c_str(), GDAL_DEFAULT_MAX_THREAD_COUNT,
+                                      false, nullptr, &bOK);
+                    if (!bOK)
+                    {
+                        throw std::invalid_argument(CPLSPrintf(
+                            "Invalid value for -num_threads: %s.", s.c_str()));
+                    }
+                    psOptions->osNumThreads = s;
+                })
+            .help(_("Number of worker threads for the computation."));
+
         if (psOptionsForBinary)
         {
             subParser->add_quiet_argument(&psOptionsForBinary->bQuiet);
@@ -3849,6 +4443,14 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
                     GDALHillshadeAlg<float, GradientAlg::ZEVENBERGEN_THORNE>;
                 pfnAlgInt32 =
                     GDALHillshadeAlg<GInt32, GradientAlg::ZEVENBERGEN_THORNE>;
+#if defined(HAVE_16_SSE_REG)
+                pfnAlgFloat_multisample = GDALHillshadeAlg_multisample<
+                    float, GradientAlg::ZEVENBERGEN_THORNE, GDALDEMRegFloat,
+                    GDALDEMRegFloat>;
+                pfnAlgInt32_multisample = GDALHillshadeAlg_multisample<
+                    GInt32, GradientAlg::ZEVENBERGEN_THORNE, GDALDEMRegInt,
+                    GDALDEMRegFloat>;
+#endif
             }
         }
         else
@@ -3872,26 +4474,27 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
                 {
                     pfnAlgFloat = GDALHillshadeAlg_same_res<float>;
                     pfnAlgInt32 = GDALHillshadeAlg_same_res<GInt32>;
-#if defined(HAVE_16_SSE_REG) && defined(__AVX2__)
-                    pfnAlgFloat_multisample =
-                        GDALHillshadeAlg_same_res_multisample<
-                            float, XMMReg8Float, XMMReg8Float>;
-                    pfnAlgInt32_multisample =
-                        GDALHillshadeAlg_same_res_multisample<
-                            GInt32, XMMReg8Int, XMMReg8Float>;
-#elif defined(HAVE_16_SSE_REG)
+#if defined(HAVE_16_SSE_REG)
                     pfnAlgFloat_multisample =
                         GDALHillshadeAlg_same_res_multisample<
-                            float, XMMReg4Float, XMMReg4Float>;
+                            float, GDALDEMRegFloat, GDALDEMRegFloat>;
                     pfnAlgInt32_multisample =
                         GDALHillshadeAlg_same_res_multisample<
-                            GInt32, XMMReg4Int, XMMReg4Float>;
+                            GInt32, GDALDEMRegInt, GDALDEMRegFloat>;
 #endif
                 }
                 else
                 {
                     pfnAlgFloat = GDALHillshadeAlg<float, GradientAlg::HORN>;
                     pfnAlgInt32 = GDALHillshadeAlg<GInt32, GradientAlg::HORN>;
+#if defined(HAVE_16_SSE_REG)
+                    pfnAlgFloat_multisample = GDALHillshadeAlg_multisample<
+                        float, GradientAlg::HORN, GDALDEMRegFloat,
+                        GDALDEMRegFloat>;
+                    pfnAlgInt32_multisample = GDALHillshadeAlg_multisample<
+                        GInt32, GradientAlg::HORN, GDALDEMRegInt,
+                        GDALDEMRegFloat>;
+#endif
                 }
             }
         }
@@ -3908,11 +4511,27 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
         {
             pfnAlgFloat = GDALSlopeZevenbergenThorneAlg<float>;
             pfnAlgInt32 = GDALSlopeZevenbergenThorneAlg<GInt32>;
+#if defined(HAVE_16_SSE_REG)
+            pfnAlgFloat_multisample =
+                GDALSlopeAlg_multisample<float, GradientAlg::ZEVENBERGEN_THORNE,
+                                         GDALDEMRegFloat, GDALDEMRegFloat>;
+            pfnAlgInt32_multisample = GDALSlopeAlg_multisample<
+                GInt32, GradientAlg::ZEVENBERGEN_THORNE, GDALDEMRegInt,
+                GDALDEMRegFloat>;
+#endif
         }
         else
         {
             pfnAlgFloat = GDALSlopeHornAlg<float>;
             pfnAlgInt32 = GDALSlopeHornAlg<GInt32>;
+#if defined(HAVE_16_SSE_REG)
+            pfnAlgFloat_multisample =
+                GDALSlopeAlg_multisample<float, GradientAlg::HORN,
+                                         GDALDEMRegFloat, GDALDEMRegFloat>;
+            pfnAlgInt32_multisample =
+                GDALSlopeAlg_multisample<GInt32, GradientAlg::HORN,
+                                         GDALDEMRegInt, GDALDEMRegFloat>;
+#endif
         }
     }
 
@@ -3929,11 +4548,27 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
         {
             pfnAlgFloat = GDALAspectZevenbergenThorneAlg<float>;
             pfnAlgInt32 = GDALAspectZevenbergenThorneAlg<GInt32>;
+#if defined(HAVE_16_SSE_REG)
+            pfnAlgFloat_multisample = GDALAspectAlg_multisample<
+                float, GradientAlg::ZEVENBERGEN_THORNE, GDALDEMRegFloat,
+                GDALDEMRegFloat>;
+            pfnAlgInt32_multisample = GDALAspectAlg_multisample<
+                GInt32, GradientAlg::ZEVENBERGEN_THORNE, GDALDEMRegInt,
+                GDALDEMRegFloat>;
+#endif
         }
         else
         {
             pfnAlgFloat = GDALAspectAlg<float>;
             pfnAlgInt32 = GDALAspectAlg<GInt32>;
+#if defined(HAVE_16_SSE_REG)
+            pfnAlgFloat_multisample =
+                GDALAspectAlg_multisample<float, GradientAlg::HORN,
+                                          GDALDEMRegFloat, GDALDEMRegFloat>;
+            pfnAlgInt32_multisample =
+                GDALAspectAlg_multisample<GInt32, GradientAlg::HORN,
+                                          GDALDEMRegInt, GDALDEMRegFloat>;
+#endif
         }
     }
     else if (eUtilityMode == TRI)
@@ -3957,6 +4592,12 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
         bDstHasNoData = true;
         pfnAlgFloat = GDALTPIAlg<float>;
         pfnAlgInt32 = GDALTPIAlg<GInt32>;
+#if defined(HAVE_16_SSE_REG)
+        pfnAlgFloat_multisample =
+            GDALTPIAlg_multisample<float, GDALDEMRegFloat, GDALDEMRegFloat>;
+        pfnAlgInt32_multisample =
+            GDALTPIAlg_multisample<GInt32, GDALDEMRegInt, GDALDEMRegFloat>;
+#endif
     }
     else if (eUtilityMode == ROUGHNESS)
     {
@@ -3966,6 +4607,14 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
         pfnAlgInt32 = GDALRoughnessAlg<GInt32>;
     }
 
+    // The row-oriented SSE/AVX kernels can be disabled, mostly for
+    // benchmarking and testing purposes.
+    if (!CPLTestBool(CPLGetConfigOption("GDAL_USE_SSE", "YES")))
+    {
+        pfnAlgFloat_multisample = nullptr;
+        pfnAlgInt32_multisample = nullptr;
+    }
+
     const GDALDataType eDstDataType =
         (eUtilityMode == HILL_SHADE || eUtilityMode == COLOR_RELIEF)
             ? GDT_UInt8
@@ -4034,6 +4683,11 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
 
     const GDALDataType eSrcDT = GDALGetRasterDataType(hSrcBand);
 
+    const int nThreads = GDALGetNumThreads(
+        psOptions->osNumThreads.empty() ? nullptr
+                                        : psOptions->osNumThreads.c_str(),
+        GDAL_DEFAULT_MAX_THREAD_COUNT, /* bDefaultAllCPUs = */ false);
+
     if (hDriver == nullptr ||
         (GDALGetMetadataItem(hDriver, GDAL_DCAP_RASTER, nullptr) != nullptr &&
          ((bForceUseIntermediateDataset ||
@@ -4063,7 +4717,8 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
                 auto poDS = std::make_unique<GDALGeneric3x3Dataset<GInt32>>(
                     hSrcDataset, hSrcBand, eDstDataType, bDstHasNoData,
                     dfDstNoDataValue, pfnAlgInt32, pfnAlgInt32_multisample,
-                    std::move(pData), psOptions->bComputeAtEdges, true);
+                    std::move(pData), psOptions->bComputeAtEdges, nThreads,
+                    true);
 
                 if (!(poDS->InitOK()))
                 {
@@ -4076,7 +4731,8 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
                 auto poDS = std::make_unique<GDALGeneric3x3Dataset<float>>(
                     hSrcDataset, hSrcBand, eDstDataType, bDstHasNoData,
                     dfDstNoDataValue, pfnAlgFloat, pfnAlgFloat_multisample,
-                    std::move(pData), psOptions->bComputeAtEdges, true);
+                    std::move(pData), psOptions->bComputeAtEdges, nThreads,
+                    true);
 
                 if (!(poDS->InitOK()))
                 {
@@ -4138,15 +4794,15 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
         {
             GDALGeneric3x3Processing<GInt32>(
                 hSrcBand, hDstBand, pfnAlgInt32, pfnAlgInt32_multisample,
-                std::move(pData), psOptions->bComputeAtEdges, pfnProgress,
-                pProgressData);
+                std::move(pData), psOptions->bComputeAtEdges, nThreads,
+                pfnProgress, pProgressData);
         }
         else
         {
             GDALGeneric3x3Processing<float>(
                 hSrcBand, hDstBand, pfnAlgFloat, pfnAlgFloat_multisample,
-                std::move(pData), psOptions->bComputeAtEdges, pfnProgress,
-                pProgressData);
+                std::move(pData), psOptions->bComputeAtEdges, nThreads,
+                pfnProgress, pProgressData);
         }
     }
 
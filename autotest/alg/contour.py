@@ -603,3 +603,57 @@ cellsize     1
             elev_values.append((f["ELEV_MIN"], f["ELEV_MAX"]))
 
         assert elev_values == expected_elev_values, (elev_values, expected_elev_values)
+
+
+###############################################################################
+# Test NUM_THREADS
+
+
+@pytest.mark.parametrize("polygonize", [False, True])
+@pytest.mark.parametrize("with_nodata", [False, True])
+def test_contour_num_threads(polygonize, with_nodata):
+
+    src_ds = gdal.Translate(
+        "",
+        "../gcore/data/byte.tif",
+        format="MEM",
+        width=80,
+        height=100,
+        resampleAlg=gdal.GRIORA_Bilinear,
+    )
+    if with_nodata:
+        src_ds.GetRasterBand(1).SetNoDataValue(107)
+
+    def _contour(num_threads):
+        ogr_ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+        lyr = ogr_ds.CreateLayer(
+            "contour",
+            geom_type=ogr.wkbMultiPolygon if polygonize else ogr.wkbLineString,
+        )
+        lyr.CreateField(ogr.FieldDefn("ID", ogr.OFTInteger))
+        lyr.CreateField(ogr.FieldDefn("ELEV_MIN", ogr.OFTReal))
+        lyr.CreateField(ogr.FieldDefn("ELEV_MAX", ogr.OFTReal))
+        options = [
+            "LEVEL_INTERVAL=10",
+            "ID_FIELD=0",
+            "POLYGONIZE=" + ("YES" if polygonize else "NO"),
+            "NUM_THREADS=" + str(num_threads),
+        ]
+        if polygonize:
+            options += ["ELEV_FIELD_MIN=1", "ELEV_FIELD_MAX=2"]
+        else:
+            options += ["ELEV_FIELD=1"]
+        if with_nodata:
+            options += ["NODATA=107"]
+        assert (
+            gdal.ContourGenerateEx(src_ds.GetRasterBand(1), lyr, options=options)
+            == gdal.CE_None
+        )
+        return [
+            (f["ID"], f["ELEV_MIN"], f["ELEV_MAX"], f.GetGeometryRef().ExportToWkt())
+            for f in lyr
+        ]
+
+    ref = _contour(1)
+    assert len(ref) > 0
+    assert _contour(4) == ref
@@ -448,3 +448,76 @@ def test_polygonize_64bit_float():
 
     feature = mem_layer.GetNextFeature()
     assert feature.GetField("DN") == 1.234567890123
+
+
+###############################################################################
+# Test that the multi-threaded mode produces the same polygons as the
+# single-threaded one
+
+
+@pytest.mark.parametrize("connectedness", ["4", "8"])
+@pytest.mark.parametrize("use_mask", [False, True])
+def test_polygonize_num_threads(connectedness, use_mask):
+
+    src_ds = gdal.Open("../gcore/data/byte.tif")
+    # Upsample and reduce the number of values to get polygons crossing
+    # several row bands
+    ds = gdal.Translate(
+        "",
+        src_ds,
+        format="MEM",
+        width=100,
+        height=100,
+        scaleParams=[[0, 255, 0, 4]],
+    )
+    src_band = ds.GetRasterBand(1)
+    if use_mask:
+        src_band.SetNoDataValue(1)
+
+    def polygonize(num_threads):
+        mem_layer = ds.CreateLayer(f"res_{num_threads}", None, ogr.wkbPolygon)
+        mem_layer.CreateField(ogr.FieldDefn("DN", ogr.OFTInteger))
+        options = [f"NUM_THREADS={num_threads}"]
+        if connectedness == "8":
+            options.append("8CONNECTED=8")
+        mask_band = src_band.GetMaskBand() if use_mask else None
+        result = gdal.Polygonize(src_band, mask_band, mem_layer, 0, options)
+        assert result == 0, "Polygonize failed"
+        return sorted(
+            (f.GetField("DN"), f.GetGeometryRef().ExportToWkt()) for f in mem_layer
+        )
+
+    ref = polygonize(1)
+    assert len(ref) > 1
+    assert polygonize(4) == ref
+    assert polygonize("ALL_CPUS") == ref
+
+
+###############################################################################
+# Test that GDAL_NUM_THREADS does not enable the multi-threaded mode, which
+# does not write features in the same order
+
+
+def test_polygonize_num_threads_not_from_config_option():
+
+    src_ds = gdal.Open("../gcore/data/byte.tif")
+    ds = gdal.Translate(
+        "",
+        src_ds,
+        format="MEM",
+        width=100,
+        height=100,
+        scaleParams=[[0, 255, 0, 4]],
+    )
+    src_band = ds.GetRasterBand(1)
+
+    def polygonize(name):
+        mem_layer = ds.CreateLayer(name, None, ogr.wkbPolygon)
+        mem_layer.CreateField(ogr.FieldDefn("DN", ogr.OFTInteger))
+        result = gdal.Polygonize(src_band, None, mem_layer, 0)
+        assert result == 0, "Polygonize failed"
+        return [(f.GetField("DN"), f.GetGeometryRef().ExportToWkt()) for f in mem_layer]
+
+    ref = polygonize("ref")
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        assert polygonize("with_config_option") == ref
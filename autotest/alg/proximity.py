@@ -12,6 +12,9 @@
 ###############################################################################
 
 
+import math
+import struct
+
 import pytest
 
 from osgeo import gdal
@@ -109,3 +112,67 @@ def test_proximity_3():
     if cs != cs_expected:
         print("Got: ", cs)
         pytest.fail("got wrong checksum")
+
+
+###############################################################################
+# Test the exact Euclidean distance transform against a brute-force
+# computation
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_proximity_edt(num_threads):
+
+    src_ds = gdal.Open("data/pat.tif")
+    src_band = src_ds.GetRasterBand(1)
+    xsize = src_ds.RasterXSize
+    ysize = src_ds.RasterYSize
+
+    dst_ds = gdal.GetDriverByName("MEM").Create("", xsize, ysize, 1, gdal.GDT_Float32)
+    dst_band = dst_ds.GetRasterBand(1)
+
+    gdal.ComputeProximity(
+        src_band,
+        dst_band,
+        options=[
+            "VALUES=65,64",
+            "MAXDIST=12",
+            "NODATA=-1",
+            "ALGORITHM=EDT",
+            "NUM_THREADS=" + num_threads,
+        ],
+    )
+
+    src_data = struct.unpack(
+        "i" * (xsize * ysize), src_band.ReadRaster(buf_type=gdal.GDT_Int32)
+    )
+    targets = [
+        (x, y)
+        for y in range(ysize)
+        for x in range(xsize)
+        if src_data[y * xsize + x] in (65, 64)
+    ]
+    assert targets
+
+    got = struct.unpack("f" * (xsize * ysize), dst_band.ReadRaster())
+    for y in range(ysize):
+        for x in range(xsize):
+            dist = math.sqrt(min((tx - x) ** 2 + (ty - y) ** 2 for tx, ty in targets))
+            expected = dist if dist <= 12 else -1
+            assert got[y * xsize + x] == pytest.approx(expected, rel=1e-6), (x, y)
+
+
+###############################################################################
+# Test invalid ALGORITHM
+
+
+def test_proximity_invalid_algorithm():
+
+    src_ds = gdal.Open("data/pat.tif")
+    dst_ds = gdal.GetDriverByName("MEM").Create("", 25, 25, 1, gdal.GDT_Float32)
+
+    with pytest.raises(Exception, match="Unrecognized ALGORITHM value"):
+        gdal.ComputeProximity(
+            src_ds.GetRasterBand(1),
+            dst_ds.GetRasterBand(1),
+            options=["ALGORITHM=INVALID"],
+        )
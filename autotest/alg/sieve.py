@@ -341,3 +341,36 @@ def test_sieve_all_masked():
     gdal.SieveFilter(src_band, mask_band, src_band, 4, 4)
 
     assert src_band.Checksum() == expected_cs
+
+
+###############################################################################
+# Test that the multi-threaded mode gives the same result as the sequential one
+
+
+@pytest.mark.parametrize("connectedness", [4, 8])
+def test_sieve_num_threads(connectedness):
+
+    src_ds = gdal.Translate(
+        "",
+        "../gcore/data/byte.tif",
+        format="MEM",
+        width=100,
+        height=100,
+        scaleParams=[[0, 255, 0, 4]],
+    )
+    src_band = src_ds.GetRasterBand(1)
+
+    drv = gdal.GetDriverByName("MEM")
+    ref_ds = drv.Create("", 100, 100, gdal.GDT_UInt8)
+    ref_band = ref_ds.GetRasterBand(1)
+    gdal.SieveFilter(
+        src_band, None, ref_band, 100, connectedness, options=["NUM_THREADS=1"]
+    )
+    assert ref_band.ReadRaster() != src_band.ReadRaster()
+
+    dst_ds = drv.Create("", 100, 100, gdal.GDT_UInt8)
+    dst_band = dst_ds.GetRasterBand(1)
+    gdal.SieveFilter(
+        src_band, None, dst_band, 100, connectedness, options=["NUM_THREADS=4"]
+    )
+    assert dst_band.ReadRaster() == ref_band.ReadRaster()
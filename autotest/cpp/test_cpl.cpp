@@ -48,6 +48,7 @@
 #include <atomic>
 #include <cmath>
 #include <limits>
+#include <mutex>
 #include <fstream>
 #include <string>
 
@@ -1371,6 +1372,47 @@ TEST_F(test_cpl, CPLGetThreadLocalConfigOptions)
     CSLDestroy(options);
 }
 
+/************************************************************************/
+/*                        CPLCachedConfigOption                         */
+/************************************************************************/
+TEST_F(test_cpl, CPLCachedConfigOption)
+{
+    const CPLCachedConfigOption oOpt("CPL_TEST_CACHED_OPTION", "YES");
+    const CPLCachedConfigOption oOptNoDefault("CPL_TEST_CACHED_OPTION",
+                                              nullptr);
+    EXPECT_TRUE(oOpt.GetBool());
+    EXPECT_FALSE(oOptNoDefault.GetBool());
+    EXPECT_EQ(oOptNoDefault.GetInt(), 0);
+
+    CPLSetConfigOption("CPL_TEST_CACHED_OPTION", "NO");
+    EXPECT_FALSE(oOpt.GetBool());
+    EXPECT_FALSE(oOptNoDefault.GetBool());
+
+    CPLSetConfigOption("CPL_TEST_CACHED_OPTION", "12.5");
+    EXPECT_TRUE(oOpt.GetBool());
+    EXPECT_EQ(oOpt.GetInt(), 12);
+    EXPECT_EQ(oOpt.GetDouble(), 12.5);
+
+    // Thread local options take precedence, but only in the current thread
+    CPLSetThreadLocalConfigOption("CPL_TEST_CACHED_OPTION", "3");
+    EXPECT_EQ(oOpt.GetInt(), 3);
+    {
+        CPLWorkerThreadPool oPool;
+        ASSERT_TRUE(oPool.Setup(1, nullptr, nullptr));
+        GIntBig nValueOtherThread = 0;
+        oPool.SubmitJob([&oOpt, &nValueOtherThread]()
+                        { nValueOtherThread = oOpt.GetInt(); });
+        oPool.WaitCompletion();
+        EXPECT_EQ(nValueOtherThread, 12);
+    }
+    CPLSetThreadLocalConfigOption("CPL_TEST_CACHED_OPTION", nullptr);
+    EXPECT_EQ(oOpt.GetInt(), 12);
+
+    CPLSetConfigOption("CPL_TEST_CACHED_OPTION", nullptr);
+    EXPECT_TRUE(oOpt.GetBool());
+    EXPECT_EQ(oOptNoDefault.GetDouble(), 0.0);
+}
+
 TEST_F(test_cpl, CPLExpandTilde)
 {
     EXPECT_STREQ(CPLExpandTilde("/foo/bar"), "/foo/bar");
@@ -4518,6 +4560,57 @@ TEST_F(test_cpl, CPLWorkerThreadPool_recursion)
     ASSERT_EQ(ctxt.nCounter, 3 * 3);
 }
 
+// Test CPLWorkerThreadPool in work-stealing mode
+TEST_F(test_cpl, CPLWorkerThreadPool_work_stealing)
+{
+    CPLWorkerThreadPool oPool;
+    oPool.SetWorkStealing(true);
+    ASSERT_TRUE(oPool.IsWorkStealing());
+    ASSERT_TRUE(oPool.Setup(4, nullptr, nullptr, false));
+
+    // Recursively split jobs, each one waiting for the completion of its
+    // children, which would exhaust the threads of the pool if waiting
+    // blocked them.
+    std::function<int(int)> Fib;
+    Fib = [&oPool, &Fib](int n)
+    {
+        if (n < 2)
+            return n;
+        int a = 0;
+        int b = 0;
+        auto poQueue = oPool.CreateJobQueue();
+        poQueue->SubmitJob([&a, &Fib, n] { a = Fib(n - 1); });
+        poQueue->SubmitJob([&b, &Fib, n] { b = Fib(n - 2); });
+        poQueue->WaitCompletion();
+        return a + b;
+    };
+
+    {
+        int nRes = 0;
+        auto poQueue = oPool.CreateJobQueue();
+        poQueue->SubmitJob([&nRes, &Fib] { nRes = Fib(16); });
+        poQueue->WaitCompletion();
+        EXPECT_EQ(nRes, 987);
+    }
+
+    // Jobs submitted from jobs to the pool itself
+    {
+        std::atomic<int> nCounter{0};
+        for (int i = 0; i < 100; i++)
+        {
+            oPool.SubmitJob(
+                [&oPool, &nCounter]
+                {
+                    nCounter++;
+                    for (int j = 0; j < 10; ++j)
+                        oPool.SubmitJob([&nCounter] { nCounter++; });
+                });
+        }
+        oPool.WaitCompletion();
+        EXPECT_EQ(nCounter, 100 * 11);
+    }
+}
+
 // Test /vsimem/ PRead() implementation
 TEST_F(test_cpl, vsimem_pread)
 {
@@ -5747,4 +5840,201 @@ TEST_F(test_cpl, cpl_enumerate)
     }
 }
 
+TEST_F(test_cpl, VSIFReadMultiRangeL_local_file)
+{
+    const std::string osFilename = CPLGenerateTempFilename("multirange");
+    constexpr int FILE_SIZE = 1000 * 1000;
+    std::vector<GByte> abyData(FILE_SIZE);
+    for (int i = 0; i < FILE_SIZE; ++i)
+        abyData[i] = static_cast<GByte>((i * 7) % 251);
+    {
+        VSIVirtualHandleUniquePtr fp(VSIFOpenL(osFilename.c_str(), "wb"));
+        ASSERT_NE(fp, nullptr);
+        ASSERT_EQ(fp->Write(abyData.data(), FILE_SIZE),
+                  static_cast<size_t>(FILE_SIZE));
+    }
+
+    // More ranges than the depth of the io_uring queue, including an empty
+    // one.
+    constexpr int RANGE_COUNT = 200;
+    std::vector<vsi_l_offset> anOffsets(RANGE_COUNT);
+    std::vector<size_t> anSizes(RANGE_COUNT);
+    std::vector<std::vector<GByte>> aabyBuffers(RANGE_COUNT);
+    std::vector<void *> apData(RANGE_COUNT);
+    for (int i = 0; i < RANGE_COUNT; ++i)
+    {
+        anOffsets[i] = (static_cast<vsi_l_offset>(i) * 104729) % 900000;
+        anSizes[i] = (i * 997) % 50000;
+        aabyBuffers[i].resize(anSizes[i] + 1);
+        apData[i] = aabyBuffers[i].data();
+    }
+
+    for (const char *pszUseIOURing : {"YES", "NO"})
+    {
+        CPLConfigOptionSetter oSetter("CPL_VSIL_USE_IO_URING", pszUseIOURing,
+                                      false);
+        VSIVirtualHandleUniquePtr fp(VSIFOpenL(osFilename.c_str(), "rb"));
+        ASSERT_NE(fp, nullptr);
+        ASSERT_EQ(fp->Seek(123, SEEK_SET), 0);
+        ASSERT_EQ(fp->ReadMultiRange(RANGE_COUNT, apData.data(),
+                                     anOffsets.data(), anSizes.data()),
+                  0);
+        for (int i = 0; i < RANGE_COUNT; ++i)
+        {
+            EXPECT_TRUE(memcmp(aabyBuffers[i].data(),
+                               abyData.data() + anOffsets[i], anSizes[i]) == 0)
+                << i;
+        }
+        // The file position is not affected
+        EXPECT_EQ(fp->Tell(), 123U);
+
+        // Range extending past the end of file
+        const vsi_l_offset nOldOffset = anOffsets[1];
+        anOffsets[1] = FILE_SIZE - anSizes[1] / 2;
+        EXPECT_NE(fp->ReadMultiRange(RANGE_COUNT, apData.data(),
+                                     anOffsets.data(), anSizes.data()),
+                  0);
+        anOffsets[1] = nOldOffset;
+
+        fp->AdviseRead(RANGE_COUNT, anOffsets.data(), anSizes.data());
+        GByte abyBuffer[10] = {0};
+        ASSERT_EQ(fp->Seek(anOffsets[2], SEEK_SET), 0);
+        ASSERT_EQ(fp->Read(abyBuffer, sizeof(abyBuffer)), sizeof(abyBuffer));
+        EXPECT_TRUE(memcmp(abyBuffer, abyData.data() + anOffsets[2],
+                           sizeof(abyBuffer)) == 0);
+    }
+
+    // Pending buffered writes are visible to ReadMultiRange()
+    {
+        VSIVirtualHandleUniquePtr fp(VSIFOpenL(osFilename.c_str(), "rb+"));
+        ASSERT_NE(fp, nullptr);
+        ASSERT_EQ(fp->Seek(10, SEEK_SET), 0);
+        ASSERT_EQ(fp->Write("hello", 5), 5U);
+        char szA[6] = {0};
+        char szB[4] = {0};
+        void *apBuffers[] = {szA, szB};
+        const vsi_l_offset anOffsets2[] = {10, 12};
+        const size_t anSizes2[] = {5, 3};
+        ASSERT_EQ(fp->ReadMultiRange(2, apBuffers, anOffsets2, anSizes2), 0);
+        EXPECT_STREQ(szA, "hello");
+        EXPECT_STREQ(szB, "llo");
+    }
+
+    VSIUnlink(osFilename.c_str());
+}
+
+TEST_F(test_cpl, AsyncReadMultiRange)
+{
+    const std::string osFilename = CPLGenerateTempFilename("asyncread");
+    constexpr int FILE_SIZE = 1000 * 1000;
+    std::vector<GByte> abyData(FILE_SIZE);
+    for (int i = 0; i < FILE_SIZE; ++i)
+        abyData[i] = static_cast<GByte>((i * 7) % 251);
+    {
+        VSIVirtualHandleUniquePtr fp(VSIFOpenL(osFilename.c_str(), "wb"));
+        ASSERT_NE(fp, nullptr);
+        ASSERT_EQ(fp->Write(abyData.data(), FILE_SIZE),
+                  static_cast<size_t>(FILE_SIZE));
+    }
+    const std::string osMemFilename(
+        VSIMemGenerateHiddenFilename("asyncread.bin"));
+    VSIFCloseL(VSIFileFromMemBuffer(osMemFilename.c_str(), abyData.data(),
+                                    FILE_SIZE, false));
+
+    constexpr int RANGE_COUNT = 200;
+    std::vector<vsi_l_offset> anOffsets(RANGE_COUNT);
+    std::vector<size_t> anSizes(RANGE_COUNT);
+    std::vector<std::vector<GByte>> aabyBuffers(RANGE_COUNT);
+    std::vector<void *> apData(RANGE_COUNT);
+    for (int i = 0; i < RANGE_COUNT; ++i)
+    {
+        anOffsets[i] = (static_cast<vsi_l_offset>(i) * 104729) % 900000;
+        anSizes[i] = (i * 997) % 50000;
+        aabyBuffers[i].resize(anSizes[i] + 1);
+        apData[i] = aabyBuffers[i].data();
+    }
+
+    const auto Test = [&](const std::string &osName, vsi_l_offset nBaseOffset)
+    {
+        VSIVirtualHandleUniquePtr fp(VSIFOpenL(osName.c_str(), "rb"));
+        ASSERT_NE(fp, nullptr);
+        ASSERT_EQ(fp->Seek(123, SEEK_SET), 0);
+
+        std::vector<int> anCalls(RANGE_COUNT);
+        std::vector<bool> abSuccess(RANGE_COUNT);
+        std::mutex oMutex;
+        const auto cbk = [&](int iRange, bool bSuccess)
+        {
+            std::lock_guard oLock(oMutex);
+            ++anCalls[iRange];
+            abSuccess[iRange] = bSuccess;
+        };
+        auto poRequest =
+            fp->AsyncReadMultiRange(RANGE_COUNT, apData.data(),
+                                    anOffsets.data(), anSizes.data(), cbk);
+        ASSERT_NE(poRequest, nullptr);
+        EXPECT_TRUE(poRequest->Wait());
+        for (int i = 0; i < RANGE_COUNT; ++i)
+        {
+            EXPECT_EQ(anCalls[i], 1) << i;
+            EXPECT_TRUE(abSuccess[i]) << i;
+            EXPECT_TRUE(memcmp(aabyBuffers[i].data(),
+                               abyData.data() + nBaseOffset + anOffsets[i],
+                               anSizes[i]) == 0)
+                << i;
+        }
+        // The file position is not affected
+        EXPECT_EQ(fp->Tell(), 123U);
+
+        // Range extending past the end of file
+        std::fill(anCalls.begin(), anCalls.end(), 0);
+        const vsi_l_offset nOldOffset = anOffsets[1];
+        anOffsets[1] = FILE_SIZE - anSizes[1] / 2;
+        poRequest = fp->AsyncReadMultiRange(
+            RANGE_COUNT, apData.data(), anOffsets.data(), anSizes.data(), cbk);
+        anOffsets[1] = nOldOffset;
+        EXPECT_FALSE(poRequest->Wait());
+        for (int i = 0; i < RANGE_COUNT; ++i)
+        {
+            EXPECT_EQ(anCalls[i], 1) << i;
+            EXPECT_EQ(abSuccess[i], i != 1) << i;
+        }
+    };
+
+    for (const char *pszAsyncRead : {"YES", "NO"})
+    {
+        CPLConfigOptionSetter oSetterAsync("CPL_VSIL_LOCAL_ASYNC_READ",
+                                           pszAsyncRead, false);
+        for (const char *pszUseIOURing : {"YES", "NO"})
+        {
+            CPLConfigOptionSetter oSetter("CPL_VSIL_USE_IO_URING",
+                                          pszUseIOURing, false);
+            Test(osFilename, 0);
+        }
+    }
+    Test(osMemFilename, 0);
+    Test(std::string("/vsisubfile/10_")
+             .append(std::to_string(FILE_SIZE - 10))
+             .append(",")
+             .append(osFilename),
+         10);
+
+    // Without a callback, and with a request destroyed without Wait()
+    {
+        VSIVirtualHandleUniquePtr fp(VSIFOpenL(osFilename.c_str(), "rb"));
+        ASSERT_NE(fp, nullptr);
+        fp->AsyncReadMultiRange(RANGE_COUNT, apData.data(), anOffsets.data(),
+                                anSizes.data(), nullptr);
+        for (int i = 0; i < RANGE_COUNT; ++i)
+        {
+            EXPECT_TRUE(memcmp(aabyBuffers[i].data(),
+                               abyData.data() + anOffsets[i], anSizes[i]) == 0)
+                << i;
+        }
+    }
+
+    VSIUnlink(osMemFilename.c_str());
+    VSIUnlink(osFilename.c_str());
+}
+
 }  // namespace
@@ -18,6 +18,7 @@
 #include "gdal_priv.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <vector>
 
@@ -35,7 +36,7 @@ static void Usage()
 {
     printf("Usage: testblockcache [-threads X] [-loops X] [-max_requests X] "
            "[-strategy random|line|block]\n");
-    printf("                      [-migrate] [ filename |\n");
+    printf("                      [-migrate] [-scaling] [ filename |\n");
     printf("                       [[-xsize val] [-ysize val] [-bands val] "
            "[-co key=value]*\n");
     printf("                       [[-memdriver] | [-ondisk]] [-check]] ]\n");
@@ -340,6 +341,7 @@ TEST(testblockcache, test)
     GDALDataset *poMEMDS = nullptr;
     int bMigrate = FALSE;
     int nMaxRequests = -1;
+    bool bScaling = false;
 
     GDALAllRegister();
 
@@ -417,6 +419,8 @@ TEST(testblockcache, test)
         }
         else if (EQUAL(argv[i], "-migrate"))
             bMigrate = TRUE;
+        else if (EQUAL(argv[i], "-scaling"))
+            bScaling = true;
         else if (argv[i][0] == '-')
             Usage();
         else if (pszDataset == nullptr)
@@ -483,105 +487,145 @@ TEST(testblockcache, test)
     CSLDestroy(papszOptions);
     papszOptions = nullptr;
 
-    Request *psGlobalRequestLast = nullptr;
+    // In -scaling mode, run the same per-thread workload with 1, 2, 4, ...
+    // threads up to the requested number, so that the throughput of the
+    // block cache under contention can be compared.
+    std::vector<int> anThreadCounts;
+    if (bScaling)
+    {
+        for (int nCount = 1; nCount < nThreads; nCount *= 2)
+            anThreadCounts.push_back(nCount);
+    }
+    anThreadCounts.push_back(nThreads);
+    double dfElapsedOneThread = 0;
 
-    for (i = 0; i < nThreads; i++)
+    for (const int nCurThreads : anThreadCounts)
     {
-        GDALDataset *poDS;
-        // Since GDAL 2.0, the MEM driver is thread-safe, i.e. does not use the
-        // block cache, but only for operations not involving resampling, which
-        // is the case here
-        if (poMEMDS)
-            poDS = poMEMDS;
-        else
+        nThreads = nCurThreads;
+        apsThreads.clear();
+        asThreadDescription.clear();
+
+        Request *psGlobalRequestLast = nullptr;
+
+        for (i = 0; i < nThreads; i++)
+        {
+            GDALDataset *poDS;
+            // Since GDAL 2.0, the MEM driver is thread-safe, i.e. does not use
+            // the block cache, but only for operations not involving
+            // resampling, which is the case here
+            if (poMEMDS)
+                poDS = poMEMDS;
+            else
+            {
+                poDS = (GDALDataset *)GDALOpen(pszDataset, GA_ReadOnly);
+                if (poDS == nullptr)
+                    exit(1);
+            }
+            if (bMigrate)
+            {
+                Resource *psResource = (Resource *)CPLMalloc(sizeof(Resource));
+                psResource->poDS = poDS;
+                int nBufferSize;
+                if (eStrategy == STRATEGY_RANDOM)
+                    nBufferSize = CreateRandomStrategyRequests(
+                        poDS, nMaxRequests, psGlobalRequestList,
+                        psGlobalRequestLast);
+                else if (eStrategy == STRATEGY_LINE)
+                    nBufferSize = CreateLineStrategyRequests(
+                        poDS, nMaxRequests, psGlobalRequestList,
+                        psGlobalRequestLast);
+                else
+                    nBufferSize = CreateBlockStrategyRequests(
+                        poDS, nMaxRequests, psGlobalRequestList,
+                        psGlobalRequestLast);
+                psResource->pBuffer = CPLMalloc(nBufferSize);
+                PutResourceAtEnd(psResource);
+            }
+            else
+            {
+                ThreadDescription sThreadDescription;
+                sThreadDescription.poDS = poDS;
+                sThreadDescription.psRequestList = nullptr;
+                Request *psRequestLast = nullptr;
+                if (eStrategy == STRATEGY_RANDOM)
+                    sThreadDescription.nBufferSize =
+                        CreateRandomStrategyRequests(
+                            poDS, nMaxRequests,
+                            sThreadDescription.psRequestList, psRequestLast);
+                else if (eStrategy == STRATEGY_LINE)
+                    sThreadDescription.nBufferSize = CreateLineStrategyRequests(
+                        poDS, nMaxRequests, sThreadDescription.psRequestList,
+                        psRequestLast);
+                else
+                    sThreadDescription.nBufferSize =
+                        CreateBlockStrategyRequests(
+                            poDS, nMaxRequests,
+                            sThreadDescription.psRequestList, psRequestLast);
+                asThreadDescription.push_back(sThreadDescription);
+            }
+        }
+
+        if (bCreatedDataset && poMEMDS == nullptr && bOnDisk && !bScaling)
         {
-            poDS = (GDALDataset *)GDALOpen(pszDataset, GA_ReadOnly);
-            if (poDS == nullptr)
-                exit(1);
+            CPLPushErrorHandler(CPLQuietErrorHandler);
+            VSIUnlink(pszDataset);
+            CPLPopErrorHandler();
         }
+
         if (bMigrate)
         {
-            Resource *psResource = (Resource *)CPLMalloc(sizeof(Resource));
-            psResource->poDS = poDS;
-            int nBufferSize;
-            if (eStrategy == STRATEGY_RANDOM)
-                nBufferSize = CreateRandomStrategyRequests(poDS, nMaxRequests,
-                                                           psGlobalRequestList,
-                                                           psGlobalRequestLast);
-            else if (eStrategy == STRATEGY_LINE)
-                nBufferSize = CreateLineStrategyRequests(poDS, nMaxRequests,
-                                                         psGlobalRequestList,
-                                                         psGlobalRequestLast);
-            else
-                nBufferSize = CreateBlockStrategyRequests(poDS, nMaxRequests,
-                                                          psGlobalRequestList,
-                                                          psGlobalRequestLast);
-            psResource->pBuffer = CPLMalloc(nBufferSize);
-            PutResourceAtEnd(psResource);
+            psLock = CPLCreateLock(LOCK_SPIN);
         }
-        else
+
+        const auto start = std::chrono::steady_clock::now();
+        for (i = 0; i < nThreads; i++)
         {
-            ThreadDescription sThreadDescription;
-            sThreadDescription.poDS = poDS;
-            sThreadDescription.psRequestList = nullptr;
-            Request *psRequestLast = nullptr;
-            if (eStrategy == STRATEGY_RANDOM)
-                sThreadDescription.nBufferSize = CreateRandomStrategyRequests(
-                    poDS, nMaxRequests, sThreadDescription.psRequestList,
-                    psRequestLast);
-            else if (eStrategy == STRATEGY_LINE)
-                sThreadDescription.nBufferSize = CreateLineStrategyRequests(
-                    poDS, nMaxRequests, sThreadDescription.psRequestList,
-                    psRequestLast);
+            CPLJoinableThread *pThread;
+            if (bMigrate)
+                pThread =
+                    CPLCreateJoinableThread(ThreadFuncWithMigration, nullptr);
             else
-                sThreadDescription.nBufferSize = CreateBlockStrategyRequests(
-                    poDS, nMaxRequests, sThreadDescription.psRequestList,
-                    psRequestLast);
-            asThreadDescription.push_back(sThreadDescription);
+                pThread = CPLCreateJoinableThread(ThreadFuncDedicatedDataset,
+                                                  &(asThreadDescription[i]));
+            apsThreads.push_back(pThread);
         }
-    }
-
-    if (bCreatedDataset && poMEMDS == nullptr && bOnDisk)
-    {
-        CPLPushErrorHandler(CPLQuietErrorHandler);
-        VSIUnlink(pszDataset);
-        CPLPopErrorHandler();
-    }
-
-    if (bMigrate)
-    {
-        psLock = CPLCreateLock(LOCK_SPIN);
-    }
+        for (i = 0; i < nThreads; i++)
+        {
+            CPLJoinThread(apsThreads[i]);
+            if (!bMigrate && poMEMDS == nullptr)
+                GDALClose(asThreadDescription[i].poDS);
+        }
+        const double dfElapsed = std::chrono::duration<double>(
+                                     std::chrono::steady_clock::now() - start)
+                                     .count();
+        if (dfElapsedOneThread == 0)
+            dfElapsedOneThread = dfElapsed;
+        if (bScaling)
+        {
+            // Each thread has the same workload, so with perfect scaling the
+            // elapsed time should remain constant.
+            printf("%d thread(s): %.3f s, speed-up = %.2f\n", /*ok*/
+                   nThreads, dfElapsed,
+                   dfElapsed > 0 ? nThreads * dfElapsedOneThread / dfElapsed
+                                 : 0.0);
+        }
+        CPLDebug("TEST", "%d thread(s): %.3f s", nThreads, dfElapsed);
 
-    for (i = 0; i < nThreads; i++)
-    {
-        CPLJoinableThread *pThread;
-        if (bMigrate)
-            pThread = CPLCreateJoinableThread(ThreadFuncWithMigration, nullptr);
-        else
-            pThread = CPLCreateJoinableThread(ThreadFuncDedicatedDataset,
-                                              &(asThreadDescription[i]));
-        apsThreads.push_back(pThread);
-    }
-    for (i = 0; i < nThreads; i++)
-    {
-        CPLJoinThread(apsThreads[i]);
-        if (!bMigrate && poMEMDS == nullptr)
-            GDALClose(asThreadDescription[i].poDS);
-    }
-    while (psGlobalResourceList != nullptr)
-    {
-        CPLFree(psGlobalResourceList->pBuffer);
-        if (poMEMDS == nullptr)
-            GDALClose(psGlobalResourceList->poDS);
-        Resource *psNext = psGlobalResourceList->psNext;
-        CPLFree(psGlobalResourceList);
-        psGlobalResourceList = psNext;
-    }
+        while (psGlobalResourceList != nullptr)
+        {
+            CPLFree(psGlobalResourceList->pBuffer);
+            if (poMEMDS == nullptr)
+                GDALClose(psGlobalResourceList->poDS);
+            Resource *psNext = psGlobalResourceList->psNext;
+            CPLFree(psGlobalResourceList);
+            psGlobalResourceList = psNext;
+        }
 
-    if (psLock)
-    {
-        CPLDestroyLock(psLock);
+        if (psLock)
+        {
+            CPLDestroyLock(psLock);
+            psLock = nullptr;
+        }
     }
 
     if (bCreatedDataset && poMEMDS == nullptr)
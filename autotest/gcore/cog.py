@@ -2317,3 +2317,96 @@ def test_cog_create(tmp_vsimem):
 
     with pytest.raises(Exception, match="Attempt to create 0x0 dataset is illegal"):
         gdal.GetDriverByName("COG").Create(tmp_vsimem / "out.tif", 0, 0)
+
+
+###############################################################################
+# Test that in-memory temporary files and the raw copy of their compressed
+# tiles give the same result as on-disk temporary files
+
+
+@pytest.mark.parametrize("COMPRESS", ["ZSTD", "DEFLATE", "JPEG"])
+@pytest.mark.parametrize("reproject", [False, True])
+def test_cog_tmp_memory_limit(tmp_path, COMPRESS, reproject):
+
+    drv = gdal.GetDriverByName("COG")
+    if COMPRESS not in drv.GetMetadataItem("DMD_CREATIONOPTIONLIST"):
+        pytest.skip(f"{COMPRESS} not available")
+
+    src_ds = gdal.Translate("", "data/byte.tif", format="MEM", width=1024)
+    options = ["COMPRESS=" + COMPRESS, "BLOCKSIZE=256"]
+    if reproject:
+        options.append("TILING_SCHEME=GoogleMapsCompatible")
+
+    debug_msgs = []
+
+    def handler(lvl, no, msg):
+        if lvl == gdal.CE_Debug:
+            debug_msgs.append(msg)
+
+    checksums = []
+    for limit in ["10%", "0"]:
+        filename = str(tmp_path / f"out_{limit[0]}.tif")
+        del debug_msgs[:]
+        with gdal.config_options({"COG_TMP_MEMORY_LIMIT": limit, "CPL_DEBUG": "GTiff"}):
+            with gdaltest.error_handler(handler):
+                drv.CreateCopy(filename, src_ds, options=options)
+        # Compressed tiles of the temporary files are copied as they are
+        # with lossless codecs
+        raw_copy = any("Copying compressed blocks" in msg for msg in debug_msgs)
+        assert raw_copy == (COMPRESS != "JPEG")
+        _check_cog(filename)
+        with gdal.Open(filename) as ds:
+            band = ds.GetRasterBand(1)
+            assert band.GetOverviewCount() >= 1
+            checksums.append(
+                [band.Checksum()]
+                + [
+                    band.GetOverview(i).Checksum()
+                    for i in range(band.GetOverviewCount())
+                ]
+            )
+    assert checksums[0] == checksums[1]
+    assert [x.name for x in tmp_path.iterdir() if "tmp" in x.name] == []
+
+
+###############################################################################
+# Test that the compressed tiles of a GTiff input, whose compression level is
+# unknown, are not copied as they are, so that LEVEL is honored
+
+
+def test_cog_level_with_compatible_gtiff_input(tmp_vsimem):
+
+    src_filename = str(tmp_vsimem / "src.tif")
+    with gdal.Translate(
+        src_filename,
+        "data/byte.tif",
+        width=1024,
+        creationOptions=[
+            "TILED=YES",
+            "BLOCKXSIZE=512",
+            "BLOCKYSIZE=512",
+            "COMPRESS=DEFLATE",
+            "ZLEVEL=1",
+        ],
+    ) as ds:
+        ds.BuildOverviews("NEAREST", [2])
+
+    debug_msgs = []
+
+    def handler(lvl, no, msg):
+        if lvl == gdal.CE_Debug:
+            debug_msgs.append(msg)
+
+    sizes = []
+    for level in [1, 9]:
+        filename = str(tmp_vsimem / f"out_{level}.tif")
+        with gdal.config_option("CPL_DEBUG", "GTiff"), gdaltest.error_handler(handler):
+            gdal.GetDriverByName("COG").CreateCopy(
+                filename,
+                gdal.Open(src_filename),
+                options=["COMPRESS=DEFLATE", f"LEVEL={level}"],
+            )
+        _check_cog(filename)
+        sizes.append(gdal.VSIStatL(filename).size)
+    assert not any("Copying compressed blocks" in msg for msg in debug_msgs)
+    assert sizes[0] != sizes[1]
@@ -2389,6 +2389,53 @@ def test_tiff_ovr_multithreading_multiband():
     gdal.Unlink("/vsimem/test.tif")
 
 
+###############################################################################
+# Test that the concurrent generation of overview levels gives the same result
+# as their sequential generation
+
+
+@pytest.mark.parametrize("resampling", ["AVERAGE", "CUBIC"])
+@pytest.mark.parametrize("compress", ["LZW", "JPEG"])
+def test_tiff_ovr_multithreading_multiband_several_levels(
+    tmp_vsimem, resampling, compress
+):
+
+    if compress not in gdal.GetDriverByName("GTiff").GetMetadataItem(
+        "DMD_CREATIONOPTIONLIST"
+    ):
+        pytest.skip(f"{compress} not available")
+
+    checksums = []
+    for num_threads in ["1", "8"]:
+        filename = tmp_vsimem / f"test_{num_threads}.tif"
+        gdal.Translate(
+            filename,
+            "data/stefan_full_rgba.tif",
+            bandList=[1, 2, 3],
+            width=1024,
+            creationOptions=["COMPRESS=" + compress, "TILED=YES"],
+        )
+        with gdal.Open(filename, gdal.GA_Update) as ds:
+            with gdaltest.config_options(
+                {
+                    "GDAL_NUM_THREADS": num_threads,
+                    "GDAL_TIFF_OVR_BLOCKSIZE": "64",
+                }
+            ):
+                ds.BuildOverviews(resampling, [2, 4, 8, 16])
+        with gdal.Open(filename) as ds:
+            band = ds.GetRasterBand(1)
+            assert band.GetOverviewCount() == 4
+            checksums.append(
+                [
+                    ds.GetRasterBand(i + 1).GetOverview(j).Checksum()
+                    for i in range(3)
+                    for j in range(4)
+                ]
+            )
+    assert checksums[0] == checksums[1]
+
+
 ###############################################################################
 
 
@@ -5001,6 +5001,47 @@ def test_tiff_read_multi_threaded(
     ds = None
 
 
+###############################################################################
+# Test multi-threaded decoding with striles fetched with AsyncReadMultiRange()
+
+
+@pytest.mark.parametrize("use_io_uring", ["YES", "NO"])
+@pytest.mark.parametrize("in_subfile", [False, True])
+def test_tiff_read_multi_threaded_async_read(tmp_path, use_io_uring, in_subfile):
+
+    src_ds = gdal.Open("data/byte.tif")
+    tmpfile = str(tmp_path / "test_tiff_read_multi_threaded_async_read.tif")
+    gdal.Translate(
+        tmpfile,
+        src_ds,
+        width=200,
+        height=200,
+        creationOptions=["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16", "COMPRESS=LZW"],
+    )
+    ref_data = gdal.Open(tmpfile).ReadRaster()
+
+    filename = tmpfile
+    if in_subfile:
+        filesize = gdal.VSIStatL(tmpfile).size
+        filename = "/vsisubfile/0_%d,%s" % (filesize, tmpfile)
+
+    with gdal.config_options(
+        {
+            "GDAL_NUM_THREADS": "4",
+            "CPL_VSIL_USE_IO_URING": use_io_uring,
+            "CPL_VSIL_LOCAL_ASYNC_READ": "YES",
+        }
+    ):
+        for allow_async_read in ("YES", "NO"):
+            with gdal.config_option("GTIFF_ALLOW_ASYNC_READ", allow_async_read):
+                ds = gdal.Open(filename)
+                assert ds.ReadRaster() == ref_data
+                assert ds.ReadRaster(10, 20, 150, 100) == gdal.Open(
+                    tmpfile
+                ).ReadRaster(10, 20, 150, 100)
+                ds = None
+
+
 ###############################################################################
 # Test multi-threaded decoding with /vsicurl
 
@@ -12676,3 +12676,70 @@ def test_tiff_no_get_sibling_files(tmp_vsimem):
             with gdal.Open(tmp_vsimem / "foo.tif") as ds:
                 ds.GetRasterBand(1).GetDefaultRAT()
     assert res[0]
+
+
+###############################################################################
+# Test that the compressed blocks of a source dataset opened in update mode
+# are flushed before being copied as they are
+
+
+def test_tiff_write_copy_raw_blocks_from_update_dataset(tmp_vsimem):
+
+    debug_msgs = []
+
+    def handler(lvl, no, msg):
+        if lvl == gdal.CE_Debug:
+            debug_msgs.append(msg)
+
+    src_filename = tmp_vsimem / "src.tif"
+    with gdal.GetDriverByName("GTiff").Create(
+        src_filename, 100, 100, options=["COMPRESS=LZW"]
+    ) as src_ds:
+        src_ds.GetRasterBand(1).Fill(1)
+        src_ds.FlushCache()
+        # Only in the block cache
+        src_ds.GetRasterBand(1).Fill(2)
+        expected_cs = src_ds.GetRasterBand(1).Checksum()
+
+        with gdal.config_option("CPL_DEBUG", "GTiff"):
+            with gdaltest.error_handler(handler):
+                out_ds = gdal.Translate(
+                    tmp_vsimem / "out.tif",
+                    src_ds,
+                    creationOptions=["COMPRESS=LZW", "@COPY_RAW_BLOCKS=YES"],
+                )
+        assert any("Copying compressed blocks" in msg for msg in debug_msgs)
+        assert out_ds.GetRasterBand(1).Checksum() == expected_cs
+
+
+###############################################################################
+# Test that COPY_SRC_OVERVIEWS=YES does not copy as they are the compressed
+# blocks of a source whose compression level is unknown
+
+
+def test_tiff_write_copy_src_overviews_zlevel(tmp_vsimem):
+
+    src_filename = tmp_vsimem / "src.tif"
+    with gdal.Translate(
+        src_filename,
+        "data/byte.tif",
+        width=1024,
+        creationOptions=["TILED=YES", "COMPRESS=DEFLATE", "ZLEVEL=1"],
+    ) as ds:
+        ds.BuildOverviews("NEAREST", [2])
+
+    sizes = []
+    for zlevel in [1, 9]:
+        filename = tmp_vsimem / f"out_{zlevel}.tif"
+        gdal.Translate(
+            filename,
+            src_filename,
+            creationOptions=[
+                "TILED=YES",
+                "COMPRESS=DEFLATE",
+                f"ZLEVEL={zlevel}",
+                "COPY_SRC_OVERVIEWS=YES",
+            ],
+        )
+        sizes.append(gdal.VSIStatL(filename).size)
+    assert sizes[0] != sizes[1]
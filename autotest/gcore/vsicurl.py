@@ -11,6 +11,7 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import json
 import sys
 import time
 
@@ -1896,3 +1897,478 @@ def test_vsicurl_test_redirect_301_to_url_ending_slash_and_then_403(server):
             gdal.VSIStatL("/vsicurl/http://localhost:%d/test_redirect" % server.port)
             is None
         )
+
+
+###############################################################################
+# Test the persistent disk cache (CPL_VSIL_CURL_DISK_CACHE_DIR)
+
+
+def test_vsicurl_disk_cache(server, tmp_path):
+
+    gdal.VSICurlClearCache()
+
+    filesize = 20000
+    content_v1 = bytes(i % 251 for i in range(filesize))
+    content_v2 = bytes(i % 241 for i in range(filesize))
+
+    def serve_range(content):
+        def method(request):
+            rng = request.headers["Range"][len("bytes=") :]
+            start = int(rng.split("-")[0])
+            end = min(int(rng.split("-")[1]), filesize - 1)
+            request.protocol_version = "HTTP/1.1"
+            request.send_response(206)
+            request.send_header(
+                "Content-Range", "bytes %d-%d/%d" % (start, end, filesize)
+            )
+            request.send_header("Content-Length", end - start + 1)
+            request.send_header("Connection", "close")
+            request.end_headers()
+            request.wfile.write(content[start : end + 1])
+
+        return method
+
+    def get_stats():
+        return gdal.VSICurlDiskCacheGetStatistics()
+
+    def read(offset, size):
+        f = gdal.VSIFOpenL(filename, "rb")
+        assert f
+        try:
+            gdal.VSIFSeekL(f, offset, 0)
+            return gdal.VSIFReadL(1, size, f)
+        finally:
+            gdal.VSIFCloseL(f)
+
+    filename = "/vsicurl/http://localhost:%d/test_disk_cache.bin" % server.port
+    with gdaltest.config_options(
+        {
+            "CPL_VSIL_CURL_DISK_CACHE_DIR": str(tmp_path / "cache"),
+            "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+        }
+    ):
+        stats_before = get_stats()
+        assert stats_before["DIR"] == str(tmp_path / "cache")
+
+        # Region downloaded and written to the disk cache
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD",
+            "/test_disk_cache.bin",
+            200,
+            {"Content-Length": "%d" % filesize, "ETag": '"v1"'},
+        )
+        handler.add(
+            "GET", "/test_disk_cache.bin", custom_method=serve_range(content_v1)
+        )
+        with webserver.install_http_handler(handler):
+            assert read(10, 5) == content_v1[10:15]
+
+        stats = get_stats()
+        assert int(stats["WRITES"]) > int(stats_before["WRITES"])
+
+        # The URL, that might contain credentials, is not stored in clear
+        cache_files = [x for x in (tmp_path / "cache").rglob("*") if x.is_file()]
+        assert cache_files
+        for x in cache_files:
+            assert b"test_disk_cache.bin" not in x.read_bytes()
+
+        # Only the in-memory caches are cleared: the region is read from disk
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD",
+            "/test_disk_cache.bin",
+            200,
+            {"Content-Length": "%d" % filesize, "ETag": '"v1"'},
+        )
+        with webserver.install_http_handler(handler):
+            assert read(10, 5) == content_v1[10:15]
+
+        stats_after = get_stats()
+        assert int(stats_after["HITS"]) == int(stats["HITS"]) + 1
+
+        # Entries are not scoped to credentials: only the owner can access them
+        if sys.platform != "win32":
+            cache_dirs = [x for x in (tmp_path / "cache").rglob("*") if x.is_dir()]
+            for x in [tmp_path / "cache"] + cache_dirs:
+                assert x.stat().st_mode & 0o777 == 0o700
+
+        # Corrupted entries are detected thanks to the checksum of their data,
+        # and downloaded again
+        for x in cache_files:
+            data = bytearray(x.read_bytes())
+            data[-1] ^= 0xFF
+            x.write_bytes(bytes(data))
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD",
+            "/test_disk_cache.bin",
+            200,
+            {"Content-Length": "%d" % filesize, "ETag": '"v1"'},
+        )
+        handler.add(
+            "GET", "/test_disk_cache.bin", custom_method=serve_range(content_v1)
+        )
+        with webserver.install_http_handler(handler):
+            assert read(10, 5) == content_v1[10:15]
+
+        # The file has been modified on the server: the disk cache is not used
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD",
+            "/test_disk_cache.bin",
+            200,
+            {"Content-Length": "%d" % filesize, "ETag": '"v2"'},
+        )
+        handler.add(
+            "GET", "/test_disk_cache.bin", custom_method=serve_range(content_v2)
+        )
+        with webserver.install_http_handler(handler):
+            assert read(10, 5) == content_v2[10:15]
+
+        # Prewarm the end of the file
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD",
+            "/test_disk_cache.bin",
+            200,
+            {"Content-Length": "%d" % filesize, "ETag": '"v2"'},
+        )
+        handler.add(
+            "GET", "/test_disk_cache.bin", custom_method=serve_range(content_v2)
+        )
+        with webserver.install_http_handler(handler):
+            assert gdal.VSICurlDiskCachePrewarm(filename, 16384)
+
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD",
+            "/test_disk_cache.bin",
+            200,
+            {"Content-Length": "%d" % filesize, "ETag": '"v2"'},
+        )
+        with webserver.install_http_handler(handler):
+            assert read(19990, 10) == content_v2[19990:]
+
+        assert gdal.VSICurlDiskCacheClear()
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD",
+            "/test_disk_cache.bin",
+            200,
+            {"Content-Length": "%d" % filesize, "ETag": '"v2"'},
+        )
+        handler.add(
+            "GET", "/test_disk_cache.bin", custom_method=serve_range(content_v2)
+        )
+        with webserver.install_http_handler(handler):
+            assert read(10, 5) == content_v2[10:15]
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test that VSICurlDiskCachePrewarm() caches the whole file, including the
+# parts served by the read-ahead of sequential reads
+
+
+def test_vsicurl_disk_cache_prewarm_read_ahead(server, tmp_path):
+
+    gdal.VSICurlClearCache()
+
+    # Large enough for the read-ahead to be triggered by the sequential
+    # reads of VSICurlDiskCachePrewarm()
+    filesize = 6000000
+    content = bytes(i % 251 for i in range(filesize))
+
+    class RangeHandler:
+        def final_check(self):
+            pass
+
+        def do_HEAD(self, request):
+            request.send_response(200)
+            request.send_header("Content-Length", filesize)
+            request.send_header("ETag", '"v1"')
+            request.end_headers()
+
+        def do_GET(self, request):
+            rng = request.headers["Range"][len("bytes=") :]
+            start = int(rng.split("-")[0])
+            end = min(int(rng.split("-")[1]), filesize - 1)
+            request.protocol_version = "HTTP/1.1"
+            request.send_response(206)
+            request.send_header(
+                "Content-Range", "bytes %d-%d/%d" % (start, end, filesize)
+            )
+            request.send_header("Content-Length", end - start + 1)
+            request.send_header("Connection", "close")
+            request.end_headers()
+            request.wfile.write(content[start : end + 1])
+
+    filename = "/vsicurl/http://localhost:%d/test_prewarm.bin" % server.port
+    with gdaltest.config_options(
+        {
+            "CPL_VSIL_CURL_DISK_CACHE_DIR": str(tmp_path / "cache"),
+            "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+            "CPL_VSIL_NETWORK_STATS_ENABLED": "YES",
+        },
+        thread_local=False,
+    ):
+        gdal.NetworkStatsReset()
+        with webserver.install_http_handler(RangeHandler()):
+            assert gdal.VSICurlDiskCachePrewarm(filename)
+        j = json.loads(gdal.NetworkStatsGetAsSerializedJSON())
+        gdal.NetworkStatsReset()
+        stats = j["handlers"]["vsicurl"]
+        assert stats["read_ahead"]["hit_count"] + stats["read_ahead"]["wait_count"]
+
+        # Everything is read from the disk cache
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD",
+            "/test_prewarm.bin",
+            200,
+            {"Content-Length": "%d" % filesize, "ETag": '"v1"'},
+        )
+        with webserver.install_http_handler(handler):
+            f = gdal.VSIFOpenL(filename, "rb")
+            assert f
+            try:
+                data = gdal.VSIFReadL(1, filesize, f)
+            finally:
+                gdal.VSIFCloseL(f)
+        assert data == content
+
+        assert gdal.VSICurlDiskCacheClear()
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test VSICurlDiskCachePrewarm() when the disk cache is not enabled
+
+
+def test_vsicurl_disk_cache_prewarm_not_enabled():
+
+    with pytest.raises(Exception, match="CPL_VSIL_CURL_DISK_CACHE_DIR"):
+        gdal.VSICurlDiskCachePrewarm("/vsicurl/http://localhost/foo")
+
+
+###############################################################################
+# Test the read-ahead of forward sequential reads
+
+
+@pytest.mark.parametrize("read_ahead", ["YES", "NO"])
+def test_vsicurl_read_ahead(server, read_ahead):
+
+    gdal.VSICurlClearCache()
+
+    filesize = 1000000
+    content = bytes(i % 251 for i in range(filesize))
+
+    class RangeHandler:
+        def final_check(self):
+            pass
+
+        def do_HEAD(self, request):
+            request.send_response(200)
+            request.send_header("Content-Length", filesize)
+            request.end_headers()
+
+        def do_GET(self, request):
+            rng = request.headers["Range"][len("bytes=") :]
+            start = int(rng.split("-")[0])
+            end = min(int(rng.split("-")[1]), filesize - 1)
+            request.protocol_version = "HTTP/1.1"
+            request.send_response(206)
+            request.send_header(
+                "Content-Range", "bytes %d-%d/%d" % (start, end, filesize)
+            )
+            request.send_header("Content-Length", end - start + 1)
+            request.send_header("Connection", "close")
+            request.end_headers()
+            request.wfile.write(content[start : end + 1])
+
+    gdal.NetworkStatsReset()
+    with webserver.install_http_handler(RangeHandler()), gdaltest.config_options(
+        {
+            "CPL_VSIL_CURL_READ_AHEAD": read_ahead,
+            "CPL_VSIL_CURL_READ_AHEAD_TOTAL_BYTES_LIMIT": "262144",
+            "CPL_VSIL_NETWORK_STATS_ENABLED": "YES",
+        },
+        thread_local=False,
+    ):
+        f = gdal.VSIFOpenL(
+            "/vsicurl/http://localhost:%d/test_read_ahead.bin" % server.port, "rb"
+        )
+        assert f is not None
+        data = b""
+        while True:
+            chunk = gdal.VSIFReadL(1, 10000, f)
+            data += chunk
+            if len(chunk) < 10000:
+                break
+        gdal.VSIFCloseL(f)
+        j = json.loads(gdal.NetworkStatsGetAsSerializedJSON())
+    gdal.NetworkStatsReset()
+
+    assert data == content
+    stats = j["handlers"]["vsicurl"]
+    if read_ahead == "YES":
+        assert stats["read_ahead"]["hit_count"] + stats["read_ahead"]["wait_count"]
+        assert stats["read_ahead"]["miss_count"] == 0
+        actions = stats["files"][
+            "/vsicurl/http://localhost:%d/test_read_ahead.bin" % server.port
+        ]["actions"]
+        assert actions["ReadAhead"]["methods"]["GET"]["count"] > 0
+    else:
+        assert "read_ahead" not in stats
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test that a large read is split into parallel range requests
+
+
+@pytest.mark.parametrize("num_connections", ["4", "1"])
+def test_vsicurl_parallel_read(server, num_connections):
+
+    gdal.VSICurlClearCache()
+
+    filesize = 5000000
+    content = bytes(i % 251 for i in range(filesize))
+
+    class RangeHandler:
+        def __init__(self):
+            self.ranges = []
+
+        def final_check(self):
+            pass
+
+        def do_HEAD(self, request):
+            request.send_response(200)
+            request.send_header("Content-Length", filesize)
+            request.end_headers()
+
+        def do_GET(self, request):
+            rng = request.headers["Range"][len("bytes=") :]
+            start = int(rng.split("-")[0])
+            end = min(int(rng.split("-")[1]), filesize - 1)
+            self.ranges.append((start, end))
+            request.protocol_version = "HTTP/1.1"
+            request.send_response(206)
+            request.send_header(
+                "Content-Range", "bytes %d-%d/%d" % (start, end, filesize)
+            )
+            request.send_header("Content-Length", end - start + 1)
+            request.send_header("Connection", "close")
+            request.end_headers()
+            request.wfile.write(content[start : end + 1])
+
+    handler = RangeHandler()
+    with webserver.install_http_handler(handler), gdaltest.config_options(
+        {"CPL_VSIL_CURL_PARALLEL_READ_NUM_CONNECTIONS": num_connections},
+        thread_local=False,
+    ):
+        f = gdal.VSIFOpenL(
+            "/vsicurl/http://localhost:%d/test_parallel_read.bin" % server.port,
+            "rb",
+        )
+        assert f is not None
+        gdal.VSIFSeekL(f, 12345, 0)
+        data = gdal.VSIFReadL(1, 4000000, f)
+        gdal.VSIFCloseL(f)
+
+    assert data == content[12345 : 12345 + 4000000]
+    if num_connections == "4":
+        assert len(handler.ranges) > 1
+    else:
+        assert len(handler.ranges) == 1
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test that parallel range requests are not used when they would bypass the
+# cached data, or the disk cache
+
+
+@pytest.mark.parametrize("disk_cache", [False, True])
+def test_vsicurl_parallel_read_cached(server, tmp_path, disk_cache):
+
+    gdal.VSICurlClearCache()
+
+    filesize = 5000000
+    content = bytes(i % 251 for i in range(filesize))
+
+    class RangeHandler:
+        def __init__(self):
+            self.ranges = []
+
+        def final_check(self):
+            pass
+
+        def do_HEAD(self, request):
+            request.send_response(200)
+            request.send_header("Content-Length", filesize)
+            request.send_header("ETag", '"v1"')
+            request.end_headers()
+
+        def do_GET(self, request):
+            rng = request.headers["Range"][len("bytes=") :]
+            start = int(rng.split("-")[0])
+            end = min(int(rng.split("-")[1]), filesize - 1)
+            self.ranges.append((start, end))
+            request.protocol_version = "HTTP/1.1"
+            request.send_response(206)
+            request.send_header(
+                "Content-Range", "bytes %d-%d/%d" % (start, end, filesize)
+            )
+            request.send_header("Content-Length", end - start + 1)
+            request.send_header("Connection", "close")
+            request.end_headers()
+            request.wfile.write(content[start : end + 1])
+
+    options = {
+        "CPL_VSIL_CURL_PARALLEL_READ_NUM_CONNECTIONS": "4",
+        "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+    }
+    if disk_cache:
+        options["CPL_VSIL_CURL_DISK_CACHE_DIR"] = str(tmp_path / "cache")
+
+    handler = RangeHandler()
+    with webserver.install_http_handler(handler), gdaltest.config_options(
+        options, thread_local=False
+    ):
+        f = gdal.VSIFOpenL(
+            "/vsicurl/http://localhost:%d/test_parallel_read_cached.bin"
+            % server.port,
+            "rb",
+        )
+        assert f is not None
+        gdal.VSIFSeekL(f, 2000000, 0)
+        assert gdal.VSIFReadL(1, 10, f) == content[2000000:2000010]
+        assert len(handler.ranges) == 1
+        handler.ranges = []
+        gdal.VSIFSeekL(f, 12345, 0)
+        data = gdal.VSIFReadL(1, 4000000, f)
+        gdal.VSIFCloseL(f)
+
+        if disk_cache:
+            assert gdal.VSICurlDiskCacheClear()
+
+    assert data == content[12345 : 12345 + 4000000]
+    # The chunk already in the region cache is not downloaded again
+    assert not any(start <= 2000000 <= end for start, end in handler.ranges)
+    if disk_cache:
+        assert len(handler.ranges) == 2
+
+    gdal.VSICurlClearCache()
@@ -1245,3 +1245,48 @@ interleave = bip
         match="Cannot handle bands=2147483648 due to GDAL raster data model limitation",
     ):
         gdal.Open("/vsimem/test.bin")
+
+
+###############################################################################
+# Test reading through a memory mapping of the file (RAW_USE_MMAP)
+
+
+@pytest.mark.parametrize("interleave", ["BSQ", "BIL", "BIP"])
+def test_envi_read_mmap(tmp_path, interleave):
+
+    filename = str(tmp_path / "test.bin")
+    gdal.Translate(
+        filename,
+        "data/rgbsmall.tif",
+        format="ENVI",
+        outputType=gdal.GDT_Int16,
+        creationOptions=["INTERLEAVE=" + interleave],
+    )
+
+    def read(ds):
+        return [
+            ds.ReadRaster(),
+            ds.ReadRaster(3, 5, 20, 10, band_list=[3, 1]),
+            ds.ReadRaster(3, 5, 20, 10, buf_type=gdal.GDT_Float64),
+            ds.GetRasterBand(2).ReadRaster(),
+            ds.GetRasterBand(2).ReadRaster(7, 1, 13, 17),
+            ds.GetRasterBand(2).ReadRaster(7, 1, 13, 17, buf_pixel_space=4),
+            ds.GetRasterBand(2).ReadRaster(7, 1, 13, 17, buf_type=gdal.GDT_UInt8),
+            ds.GetRasterBand(3).ReadRaster(0, 0, 50, 50, 25, 25),
+        ]
+
+    with gdal.Open(filename) as ds:
+        expected = read(ds)
+        expected_first_lines = ds.GetRasterBand(1).ReadRaster(0, 0, 50, 10)
+
+    with gdal.config_option("RAW_USE_MMAP", "YES"):
+        with gdal.Open(filename) as ds:
+            assert read(ds) == expected
+
+    # Truncated file: fallback to regular I/O
+    with open(filename, "rb+") as f:
+        f.truncate(os.path.getsize(filename) - 100)
+    with gdal.config_option("RAW_USE_MMAP", "YES"):
+        with gdal.Open(filename) as ds:
+            data = ds.GetRasterBand(1).ReadRaster(0, 0, 50, 10)
+            assert data == expected_first_lines
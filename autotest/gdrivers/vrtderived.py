@@ -1367,6 +1367,64 @@ def test_vrt_pixelfn_expression_coordinates_no_geotransform():
         gdal.Open(xml).ReadRaster()
 
 
+###############################################################################
+# Test that the vectorized evaluation of muparser expressions gives the same
+# results as the pixel-by-pixel one
+
+
+@pytest.mark.parametrize(
+    "expression",
+    [
+        "A > 130 ? sqrt(A) * B : -A / 3",
+        "min(A, B, 150) + max(A, B) ^ 0.5",
+        "A == NODATA ? NODATA + 1 : fmod(A, 7) + A^2 - B^3",
+        "(A >= B && A != 123) || isnan(B)",
+        "1.7*_CENTER_X_ + _CENTER_Y_ - sin(A) * _pi",
+        "-A^2 + B",  # not vectorized
+    ],
+)
+@pytest.mark.parametrize("propagate_nodata", [False, True])
+def test_vrt_pixelfn_expression_vectorized(expression, propagate_nodata):
+
+    if not gdaltest.gdal_has_vrt_expression_dialect("muparser"):
+        pytest.skip("muparser not available")
+
+    gdaltest.importorskip_gdal_array()
+    np = pytest.importorskip("numpy")
+
+    with gdal.Open("data/byte.tif") as ds:
+        gt = ds.GetGeoTransform()
+
+    expression = expression.replace("<", "&lt;").replace(">", "&gt;")
+
+    xml = f"""
+    <VRTDataset rasterXSize="20" rasterYSize="20">
+      <GeoTransform>{",".join(str(x) for x in gt)}</GeoTransform>
+      <VRTRasterBand dataType="Float64" band="1" subClass="VRTDerivedRasterBand">
+        <NoDataValue>107</NoDataValue>
+        <PixelFunctionType>expression</PixelFunctionType>
+        <PixelFunctionArguments expression="{expression}" propagateNoData="{propagate_nodata}"/>
+        <SimpleSource name="A">
+           <SourceFilename>data/byte.tif</SourceFilename>
+           <SourceBand>1</SourceBand>
+        </SimpleSource>
+        <ComplexSource name="B">
+           <SourceFilename>data/byte.tif</SourceFilename>
+           <SourceBand>1</SourceBand>
+           <ScaleOffset>3</ScaleOffset>
+           <ScaleRatio>0.5</ScaleRatio>
+        </ComplexSource>
+      </VRTRasterBand>
+    </VRTDataset>"""
+
+    with gdal.config_option("GDAL_VRT_EXPRESSION_VECTORIZED", "NO"):
+        expected = gdal.Open(xml).ReadAsArray()
+
+    actual = gdal.Open(xml).ReadAsArray()
+
+    np.testing.assert_allclose(actual, expected, rtol=1e-14)
+
+
 ###############################################################################
 # Test multiplication / summation by a constant factor
 
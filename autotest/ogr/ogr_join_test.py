@@ -27,6 +27,7 @@
 ###############################################################################
 
 
+import gdaltest
 import ogrtest
 import pytest
 
@@ -546,3 +547,140 @@ def test_ogr_join_on_special_field():
         assert f["a"] == "a2"
         assert f["b"] is None
         assert sql_lyr.GetNextFeature() is None
+
+
+###############################################################################
+# Test joins resolved with a hash table of the secondary layer, and compare
+# with the generic method
+
+
+@pytest.mark.parametrize("max_ram", [None, "2000", "0"])
+@pytest.mark.parametrize(
+    "key_type", [ogr.OFTInteger, ogr.OFTInteger64, ogr.OFTReal, ogr.OFTString]
+)
+def test_ogr_join_hash_table(key_type, max_ram):
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr1 = ds.CreateLayer("lyr1")
+    lyr1.CreateField(ogr.FieldDefn("key", key_type))
+    lyr1.CreateField(ogr.FieldDefn("a"))
+    lyr2 = ds.CreateLayer("lyr2")
+    lyr2.CreateField(ogr.FieldDefn("b"))
+    lyr2.CreateField(ogr.FieldDefn("key", key_type))
+
+    def make_key(i):
+        if key_type == ogr.OFTReal:
+            return i + 0.5
+        if key_type == ogr.OFTString:
+            return "key%d" % i
+        return i
+
+    for i in range(20):
+        f = ogr.Feature(lyr1.GetLayerDefn())
+        if i != 5:
+            f["key"] = make_key(i)
+        f["a"] = "a%d" % i
+        lyr1.CreateFeature(f)
+
+    for i in range(0, 30, 2):
+        f = ogr.Feature(lyr2.GetLayerDefn())
+        f["key"] = make_key(i)
+        f["b"] = "b%d" % i
+        lyr2.CreateFeature(f)
+    # Only the first match is used
+    f = ogr.Feature(lyr2.GetLayerDefn())
+    f["key"] = make_key(2)
+    f["b"] = "duplicate"
+    lyr2.CreateFeature(f)
+    f = ogr.Feature(lyr2.GetLayerDefn())
+    f["b"] = "null key"
+    lyr2.CreateFeature(f)
+    if key_type == ogr.OFTString:
+        # String comparisons are case insensitive
+        f = ogr.Feature(lyr2.GetLayerDefn())
+        f["key"] = "KEY3"
+        f["b"] = "b3"
+        lyr2.CreateFeature(f)
+
+    sql = "SELECT a, b FROM lyr1 LEFT JOIN lyr2 ON lyr1.key = lyr2.key"
+
+    def get_results():
+        with ds.ExecuteSQL(sql) as sql_lyr:
+            return [(f["a"], f["b"]) for f in sql_lyr]
+
+    with gdal.config_option("OGR_SQL_HASH_JOIN", "NO"):
+        expected = get_results()
+    assert len(expected) == 20
+    assert expected[0] == ("a0", "b0")
+    assert expected[1] == ("a1", None)
+    assert expected[2] == ("a2", "b2")
+    assert expected[3][1] == ("b3" if key_type == ogr.OFTString else None)
+    assert expected[5] == ("a5", None)
+
+    debug_msgs = []
+
+    def handler(lvl, no, msg):
+        if lvl == gdal.CE_Debug:
+            debug_msgs.append(msg)
+
+    with gdal.config_options(
+        {"OGR_SQL_HASH_JOIN_MAX_RAM": max_ram, "CPL_DEBUG": "GenSQL"}
+    ), gdaltest.error_handler(handler):
+        assert get_results() == expected
+
+    if max_ram == "0":
+        # Not even the keys fit in RAM
+        assert any("Not using a hash table" in msg for msg in debug_msgs)
+    else:
+        assert any("Hash table of layer 'lyr2' built" in msg for msg in debug_msgs)
+
+
+###############################################################################
+# Check that the hash table is not used on drivers that evaluate attribute
+# filters with their own SQL engine, where string comparisons are case
+# sensitive
+
+
+@pytest.mark.require_driver("GPKG")
+def test_ogr_join_hash_table_gpkg_case_sensitive(tmp_vsimem):
+
+    ds = ogr.GetDriverByName("GPKG").CreateDataSource(str(tmp_vsimem / "test.gpkg"))
+    lyr1 = ds.CreateLayer("lyr1", geom_type=ogr.wkbNone)
+    lyr1.CreateField(ogr.FieldDefn("key"))
+    lyr1.CreateField(ogr.FieldDefn("a"))
+    lyr2 = ds.CreateLayer("lyr2", geom_type=ogr.wkbNone)
+    lyr2.CreateField(ogr.FieldDefn("key"))
+    lyr2.CreateField(ogr.FieldDefn("b"))
+
+    for key, a in [("abc", "a0"), ("DEF", "a1")]:
+        f = ogr.Feature(lyr1.GetLayerDefn())
+        f["key"] = key
+        f["a"] = a
+        lyr1.CreateFeature(f)
+
+    for key, b in [("ABC", "b0"), ("DEF", "b1")]:
+        f = ogr.Feature(lyr2.GetLayerDefn())
+        f["key"] = key
+        f["b"] = b
+        lyr2.CreateFeature(f)
+
+    sql = "SELECT a, b FROM lyr1 LEFT JOIN lyr2 ON lyr1.key = lyr2.key"
+
+    def get_results():
+        with ds.ExecuteSQL(sql, dialect="OGRSQL") as sql_lyr:
+            return [(f["a"], f["b"]) for f in sql_lyr]
+
+    with gdal.config_option("OGR_SQL_HASH_JOIN", "NO"):
+        expected = get_results()
+    assert expected == [("a0", None), ("a1", "b1")]
+
+    debug_msgs = []
+
+    def handler(lvl, no, msg):
+        if lvl == gdal.CE_Debug:
+            debug_msgs.append(msg)
+
+    with gdal.config_option("CPL_DEBUG", "GenSQL"), gdaltest.error_handler(handler):
+        assert get_results() == expected
+
+    assert not any("Hash table of layer" in msg for msg in debug_msgs)
@@ -850,3 +850,81 @@ def test_gdal_rasterize_bad_output_format(tmp_vsimem):
             height=100,
             format="ESRI Shapefile",
         )
+
+
+###############################################################################
+# Test that -num_threads gives the same result as the single-threaded mode
+
+
+@pytest.mark.parametrize("options", [[], ["-at"], ["-add"], ["-chunkysize", "7"]])
+def test_gdal_rasterize_lib_num_threads(options):
+
+    ref_ds = gdal.Rasterize(
+        "",
+        "../ogr/data/poly.shp",
+        format="MEM",
+        width=200,
+        height=150,
+        outputType=gdal.GDT_Float64,
+        attribute="EAS_ID",
+        options=options,
+    )
+    assert ref_ds.GetRasterBand(1).Checksum() != 0
+
+    ds = gdal.Rasterize(
+        "",
+        "../ogr/data/poly.shp",
+        format="MEM",
+        width=200,
+        height=150,
+        outputType=gdal.GDT_Float64,
+        attribute="EAS_ID",
+        options=options + ["-num_threads", "4"],
+    )
+    assert ds.ReadRaster() == ref_ds.ReadRaster()
+
+
+def test_gdal_rasterize_lib_num_threads_auto_optim(tmp_vsimem):
+
+    # Many small geometries on a tiled output: the vector optim is chosen in
+    # auto mode, whatever the number of threads
+    src_ds = gdal.GetDriverByName("MEM").CreateVector("")
+    lyr = src_ds.CreateLayer("test")
+    for i in range(10001):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT ({i % 1000} {i // 1000})"))
+        lyr.CreateFeature(f)
+
+    messages = []
+
+    def handle(ecls, ecode, emsg):
+        messages.append(emsg)
+
+    with gdaltest.error_handler(handle), gdal.config_option("CPL_DEBUG", "ON"):
+        gdal.Rasterize(
+            tmp_vsimem / "out.tif",
+            src_ds,
+            format="GTiff",
+            outputBounds=[0, 0, 1000, 1000],
+            width=1000,
+            height=1000,
+            burnValues=[1],
+            creationOptions=["TILED=YES"],
+            options=["-num_threads", "4"],
+        )
+
+    assert "The vector optim has been chosen automatically" in messages
+
+
+def test_gdal_rasterize_lib_num_threads_invalid():
+
+    with pytest.raises(Exception, match="Invalid value for -num_threads"):
+        gdal.Rasterize(
+            "",
+            "../ogr/data/poly.shp",
+            format="MEM",
+            width=200,
+            height=150,
+            burnValues=[1],
+            options=["-num_threads", "invalid"],
+        )
@@ -32,6 +32,9 @@ def get_alg():
         ({"gradient-alg": "ZevenbergenThorne"}, 6378),
         ({"gradient-alg": "ZevenbergenThorne", "no-edges": True}, 65468),
         ({"no-edges": True}, 64725),
+        ({"num-threads": "1"}, 5604),
+        ({"num-threads": "4"}, 5604),
+        ({"no-edges": True, "num-threads": "4"}, 64725),
     ],
 )
 def test_gdalalg_raster_slope(options, checksum):
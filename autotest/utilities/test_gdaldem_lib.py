@@ -945,3 +945,93 @@ def test_gdaldem_lib_flipped_hillshade_slope_roughness(alg):
     out_ds = gdal.Warp("", out_ds, format="MEM")
     assert ref_ds.GetGeoTransform() == pytest.approx(out_ds.GetGeoTransform())
     assert ref_ds.ReadRaster() == out_ds.ReadRaster()
+
+
+###############################################################################
+# Test that the row-oriented SSE/AVX kernels give the same result as the
+# per-pixel ones
+
+
+@pytest.mark.parametrize(
+    "alg,options",
+    [
+        ("hillshade", {"xscale": 111120, "yscale": 111120 + 1}),
+        (
+            "hillshade",
+            {"xscale": 111120, "yscale": 111120 + 1, "alg": "ZevenbergenThorne"},
+        ),
+        ("slope", {"scale": 111120}),
+        ("slope", {"scale": 111120, "slopeFormat": "percent"}),
+        ("slope", {"scale": 111120, "alg": "ZevenbergenThorne"}),
+        ("aspect", {}),
+        ("aspect", {"alg": "ZevenbergenThorne", "trigonometric": True}),
+        ("aspect", {"zeroForFlat": True}),
+        ("TPI", {}),
+    ],
+)
+@pytest.mark.parametrize("dt", [gdal.GDT_Int16, gdal.GDT_Float32])
+def test_gdaldem_lib_simd_kernels(alg, options, dt):
+
+    src_ds = gdal.Translate("", "../gdrivers/data/n43.tif", format="MEM", outputType=dt)
+    # Flat area, to test the special cases of aspect
+    src_ds.GetRasterBand(1).WriteRaster(
+        20,
+        20,
+        20,
+        20,
+        struct.pack("f" * 400, *([100] * 400)),
+        buf_type=gdal.GDT_Float32,
+    )
+
+    with gdal.config_option("GDAL_USE_SSE", "NO"):
+        ref_ds = gdal.DEMProcessing(
+            "", src_ds, alg, format="MEM", computeEdges=True, **options
+        )
+    out_ds = gdal.DEMProcessing(
+        "", src_ds, alg, format="MEM", computeEdges=True, **options
+    )
+    assert ref_ds.ReadRaster() == out_ds.ReadRaster()
+
+
+###############################################################################
+# Test that multi-threaded processing gives the same result as the
+# single-threaded one
+
+
+@pytest.mark.parametrize(
+    "alg", ["hillshade", "slope", "aspect", "TRI", "TPI", "roughness"]
+)
+@pytest.mark.parametrize("computeEdges", [False, True])
+@pytest.mark.parametrize("format", ["MEM", "stream"])
+@pytest.mark.parametrize("dt", [gdal.GDT_Int16, gdal.GDT_Float32])
+def test_gdaldem_lib_num_threads(alg, computeEdges, format, dt):
+
+    # Tall and narrow raster, so that it is split in several batches of jobs
+    src_ds = gdal.Translate(
+        "",
+        "../gdrivers/data/n43.tif",
+        format="MEM",
+        width=30,
+        height=1500,
+        outputType=dt,
+        resampleAlg="bilinear",
+    )
+    src_ds.GetRasterBand(1).SetNoDataValue(-1)
+    src_ds.GetRasterBand(1).WriteRaster(
+        10, 700, 2, 2, struct.pack("f" * 4, *([-1] * 4)), buf_type=gdal.GDT_Float32
+    )
+
+    ref_ds = gdal.DEMProcessing(
+        "", src_ds, alg, format=format, computeEdges=computeEdges, numThreads=1
+    )
+    out_ds = gdal.DEMProcessing(
+        "", src_ds, alg, format=format, computeEdges=computeEdges, numThreads=4
+    )
+    assert ref_ds.ReadRaster() == out_ds.ReadRaster()
+
+
+def test_gdaldem_lib_num_threads_invalid():
+
+    src_ds = gdal.Open("../gdrivers/data/n43.tif")
+    with pytest.raises(Exception, match="Invalid value for -num_threads"):
+        gdal.DEMProcessing("", src_ds, "hillshade", format="MEM", numThreads="foo")
@@ -4862,3 +4862,147 @@ def test_gdalwarp_lib_RESET_DEST_PIXELS(dstNodata):
         assert out_ds.ReadRaster() == b"\x00\x00\x00\x00\x02\x03\x00\x00\x00"
     else:
         assert out_ds.ReadRaster() == b"\xff\xff\xff\xff\x02\x03\xff\xff\xff"
+
+
+###############################################################################
+# Test NUM_CHUNKS_IN_FLIGHT warping option
+
+
+@pytest.mark.parametrize("num_chunks_in_flight", [1, 2, 4])
+def test_gdalwarp_lib_multi_NUM_CHUNKS_IN_FLIGHT(num_chunks_in_flight):
+
+    src_ds = gdal.Translate(
+        "", "../gcore/data/utmsmall.tif", format="MEM", width=1000, height=1000
+    )
+
+    # Nearest neighbour and exact transformer so that the result does not
+    # depend on the shape of the warping chunks
+    options = {
+        "format": "MEM",
+        "dstSRS": "EPSG:4326",
+        "resampleAlg": "near",
+        "errorThreshold": 0,
+        "dstAlpha": True,
+        "warpMemoryLimit": 500000,
+    }
+    ref_ds = gdal.Warp("", src_ds, **options)
+
+    tab_pct = [0]
+
+    def my_progress(pct, msg, user_data):
+        assert pct >= tab_pct[0]
+        tab_pct[0] = pct
+        return 1
+
+    out_ds = gdal.Warp(
+        "",
+        src_ds,
+        multithread=True,
+        warpOptions={"NUM_CHUNKS_IN_FLIGHT": num_chunks_in_flight},
+        callback=my_progress,
+        **options,
+    )
+    assert tab_pct[0] == 1.0
+
+    assert [out_ds.GetRasterBand(i + 1).Checksum() for i in range(2)] == [
+        ref_ds.GetRasterBand(i + 1).Checksum() for i in range(2)
+    ]
+
+
+###############################################################################
+# Test SRC_TILE_CACHE_SIZE warping option
+
+
+@pytest.mark.parametrize("multithread", [False, True])
+def test_gdalwarp_lib_SRC_TILE_CACHE_SIZE(tmp_vsimem, multithread):
+
+    src_filename = str(tmp_vsimem / "src.tif")
+    gdal.Translate(
+        src_filename,
+        "../gcore/data/utmsmall.tif",
+        width=1000,
+        height=1000,
+        creationOptions=["TILED=YES", "BLOCKXSIZE=128", "BLOCKYSIZE=128"],
+    )
+
+    options = {
+        "format": "MEM",
+        "dstSRS": "EPSG:4326",
+        "resampleAlg": "cubic",
+        "warpMemoryLimit": 500000,
+        "multithread": multithread,
+    }
+    ref_ds = gdal.Warp("", src_filename, **options)
+
+    # 100KB can only hold one 256x256 tile, so tiles are evicted
+    for cache_size in ["100KB", "1MB", "1"]:
+        out_ds = gdal.Warp(
+            "",
+            src_filename,
+            warpOptions={"SRC_TILE_CACHE_SIZE": cache_size},
+            **options,
+        )
+        assert (
+            out_ds.GetRasterBand(1).Checksum() == ref_ds.GetRasterBand(1).Checksum()
+        )
+
+    with pytest.raises(Exception):
+        gdal.Warp(
+            "",
+            src_filename,
+            warpOptions={"SRC_TILE_CACHE_SIZE": "invalid"},
+            **options,
+        )
+
+
+###############################################################################
+# Test APPROX_TRANSFORMER_GRID_STEP warping option
+
+
+@pytest.mark.parametrize("grid_step,num_threads", [(64, 1), (64, 2), (7, 1)])
+def test_gdalwarp_lib_APPROX_TRANSFORMER_GRID_STEP(tmp_vsimem, grid_step, num_threads):
+
+    src_filename = str(tmp_vsimem / "src.tif")
+    src_ds = gdal.GetDriverByName("GTiff").Create(
+        src_filename, 1000, 1000, 1, gdal.GDT_Float32
+    )
+    src_ds.SetGeoTransform([440720, 60, 0, 3751320, 0, -60])
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(26711)
+    src_ds.SetSpatialRef(srs)
+    # Value = column + line, so that with bilinear resampling, an error on
+    # the source coordinates results in at most the same error on values.
+    values = array.array("f", [x + y + 1.0 for y in range(1000) for x in range(1000)])
+    src_ds.GetRasterBand(1).WriteRaster(0, 0, 1000, 1000, values.tobytes())
+    src_ds = None
+
+    options = {
+        "dstSRS": "EPSG:4326",
+        "outputBounds": [-117.5, 33.45, -117.1, 33.8],
+        "width": 800,
+        "height": 700,
+        "resampleAlg": "bilinear",
+    }
+    ref_ds = gdal.Warp("", src_filename, format="MEM", errorThreshold=0, **options)
+
+    options["errorThreshold"] = 0.125
+    options["warpOptions"] = {
+        "APPROX_TRANSFORMER_GRID_STEP": grid_step,
+        "NUM_THREADS": num_threads,
+    }
+    out_ds = gdal.Warp("", src_filename, format="MEM", **options)
+    assert gdaltest.compare_ds(out_ds, ref_ds, verbose=0) <= 0.125 + 1e-3
+
+    # The grid mode is enabled by the warp option, and not set on the
+    # transformer of the VRT, which is owned by the caller of the warper
+    vrt_filename = str(tmp_vsimem / "out.vrt")
+    gdal.Warp(vrt_filename, src_filename, format="VRT", **options)
+    with gdal.VSIFile(vrt_filename, "rb") as f:
+        content = f.read()
+    assert (
+        b'<Option name="APPROX_TRANSFORMER_GRID_STEP">%d</Option>' % grid_step
+        in content
+    )
+    assert b"<GridStep>" not in content
+    with gdal.Open(vrt_filename) as vrt_ds:
+        assert gdaltest.compare_ds(vrt_ds, ref_ds, verbose=0) <= 0.125 + 1e-3
@@ -149,6 +149,7 @@ else ()
 
   check_function_exists(posix_spawnp HAVE_POSIX_SPAWNP)
   check_function_exists(posix_memalign HAVE_POSIX_MEMALIGN)
+  check_function_exists(posix_fadvise HAVE_POSIX_FADVISE)
   check_function_exists(vfork HAVE_VFORK)
   check_function_exists(mmap HAVE_MMAP)
   check_function_exists(sigaction HAVE_SIGACTION)
@@ -75,6 +75,52 @@ static CPLString GetTmpFilename(const char *pszFilename, const char *pszExt)
     return osTmpFilename;
 }
 
+/************************************************************************/
+/*                        IsLosslessCompression()                       */
+/************************************************************************/
+
+// Whether temporary files can use the compression method of the final file,
+// so that their blocks can be copied as they are in it.
+static bool IsLosslessCompression(const char *pszCompress)
+{
+    return EQUAL(pszCompress, "LZW") || EQUAL(pszCompress, "DEFLATE") ||
+           EQUAL(pszCompress, "ZSTD") || EQUAL(pszCompress, "LZMA") ||
+           EQUAL(pszCompress, "PACKBITS");
+}
+
+/************************************************************************/
+/*                      SetTmpCompressionOptions()                      */
+/************************************************************************/
+
+// Returns whether the temporary file uses the compression settings of the
+// final file, in which case its blocks can be copied as they are in it.
+static bool SetTmpCompressionOptions(CPLStringList &aosOptions,
+                                     const char *pszCompress,
+                                     const char *pszPredictor,
+                                     const char *pszLevel)
+{
+    // only for debug purposes
+    const char *pszTmpCompress =
+        CPLGetConfigOption("COG_TMP_COMPRESSION", nullptr);
+    if (!pszTmpCompress && IsLosslessCompression(pszCompress))
+    {
+        aosOptions.SetNameValue("COMPRESS", pszCompress);
+        aosOptions.SetNameValue("PREDICTOR", pszPredictor);
+        if (EQUAL(pszCompress, "DEFLATE"))
+            aosOptions.SetNameValue("ZLEVEL", pszLevel);
+        else if (EQUAL(pszCompress, "ZSTD"))
+            aosOptions.SetNameValue("ZSTD_LEVEL", pszLevel);
+        else if (EQUAL(pszCompress, "LZMA"))
+            aosOptions.SetNameValue("LZMA_PRESET", pszLevel);
+        return true;
+    }
+
+    aosOptions.SetNameValue("COMPRESS", pszTmpCompress ? pszTmpCompress
+                                        : HasZSTDCompression() ? "ZSTD"
+                                                               : "LZW");
+    return false;
+}
+
 /************************************************************************/
 /*                           GetResampling()                            */
 /************************************************************************/
@@ -568,8 +614,9 @@ void COGRemoveWarpingOptions(CPLStringList &aosOptions)
 /************************************************************************/
 
 static std::unique_ptr<GDALDataset> CreateReprojectedDS(
-    const char *pszDstFilename, GDALDataset *poSrcDS,
-    const char *const *papszOptions, const CPLString &osResampling,
+    const char *pszTmpFilename, CSLConstList papszTmpCreationOptions,
+    GDALDataset *poSrcDS, const char *const *papszOptions,
+    const CPLString &osResampling,
     const CPLString &osTargetSRS, const int nXSize, const int nYSize,
     const double dfMinX, const double dfMinY, const double dfMaxX,
     const double dfMaxY, const double dfRes, GDALProgressFunc pfnProgress,
@@ -591,9 +638,11 @@ static std::unique_ptr<GDALDataset> CreateReprojectedDS(
         papszArg = CSLAddString(papszArg,
                                 (CPLString("BIGTIFF=") + pszBIGTIFF).c_str());
     }
-    papszArg = CSLAddString(papszArg, "-co");
-    papszArg = CSLAddString(papszArg, HasZSTDCompression() ? "COMPRESS=ZSTD"
-                                                           : "COMPRESS=LZW");
+    for (const char *pszOption : cpl::Iterate(papszTmpCreationOptions))
+    {
+        papszArg = CSLAddString(papszArg, "-co");
+        papszArg = CSLAddString(papszArg, pszOption);
+    }
     papszArg = CSLAddString(papszArg, "-t_srs");
     papszArg = CSLAddString(papszArg, osTargetSRS);
     papszArg = CSLAddString(papszArg, "-te");
@@ -671,7 +720,6 @@ static std::unique_ptr<GDALDataset> CreateReprojectedDS(
     CPLDebug("COG", "Reprojecting source dataset: start");
     GDALWarpAppOptionsSetProgress(psOptions, GDALScaledProgress,
                                   pScaledProgress);
-    CPLString osTmpFile(GetTmpFilename(pszDstFilename, "warped.tif.tmp"));
     auto hSrcDS = GDALDataset::ToHandle(poSrcDS);
 
     std::unique_ptr<CPLConfigOptionSetter> poWarpThreadSetter;
@@ -681,7 +729,8 @@ static std::unique_ptr<GDALDataset> CreateReprojectedDS(
             "GDAL_NUM_THREADS", pszNumThreads, false);
     }
 
-    auto hRet = GDALWarp(osTmpFile, nullptr, 1, &hSrcDS, psOptions, nullptr);
+    auto hRet =
+        GDALWarp(pszTmpFilename, nullptr, 1, &hSrcDS, psOptions, nullptr);
     CPL_IGNORE_RET_VAL(poWarpThreadSetter);
     GDALWarpAppOptionsFree(psOptions);
     CPLDebug("COG", "Reprojecting source dataset: end");
@@ -703,8 +752,14 @@ struct GDALCOGCreator final
     CPLString m_osTmpOverviewFilename{};
     CPLString m_osTmpMskOverviewFilename{};
 
+    // Remaining size, in bytes, that temporary files may use in /vsimem/
+    double m_dfTmpMemoryAvailable = 0;
+
     ~GDALCOGCreator();
 
+    CPLString GetTmpFilename(const char *pszFilename, const char *pszExt,
+                             double dfEstimatedSize);
+
     std::unique_ptr<GDALDataset> Create(const char *pszFilename,
                                         GDALDataset *const poSrcDS,
                                         CSLConstList papszOptions,
@@ -744,6 +799,52 @@ GDALCOGCreator::~GDALCOGCreator()
     }
 }
 
+/************************************************************************/
+/*                   GDALCOGCreator::GetTmpFilename()                   */
+/************************************************************************/
+
+// Temporary files are kept in memory as long as their estimated (uncompressed)
+// size fits in what remains of COG_TMP_MEMORY_LIMIT, and spill to disk
+// otherwise.
+CPLString GDALCOGCreator::GetTmpFilename(const char *pszFilename,
+                                         const char *pszExt,
+                                         double dfEstimatedSize)
+{
+    if (!STARTS_WITH(pszFilename, "/vsimem/") &&
+        dfEstimatedSize <= m_dfTmpMemoryAvailable)
+    {
+        m_dfTmpMemoryAvailable -= dfEstimatedSize;
+        CPLString osTmpFilename(VSIMemGenerateHiddenFilename(
+            CPLSPrintf("%s.%s", CPLGetFilename(pszFilename), pszExt)));
+        CPLDebug("COG", "Using %s as in-memory temporary file",
+                 osTmpFilename.c_str());
+        return osTmpFilename;
+    }
+    return ::GetTmpFilename(pszFilename, pszExt);
+}
+
+/************************************************************************/
+/*                            GetBlockSize()                            */
+/************************************************************************/
+
+static CPLString GetBlockSize(CSLConstList papszOptions,
+                              const gdal::TileMatrixSet *poTM)
+{
+    CPLString osBlockSize(CSLFetchNameValueDef(papszOptions, "BLOCKSIZE", ""));
+    if (osBlockSize.empty())
+    {
+        if (poTM)
+        {
+            osBlockSize.Printf("%d", poTM->tileMatrixList()[0].mTileWidth);
+        }
+        else
+        {
+            osBlockSize = "512";
+        }
+    }
+    return osBlockSize;
+}
+
 /************************************************************************/
 /*                       GDALCOGCreator::Create()                       */
 /************************************************************************/
@@ -763,6 +864,21 @@ GDALCOGCreator::Create(const char *pszFilename, GDALDataset *const poSrcDS,
         return nullptr;
     }
 
+    const char *pszTmpMemoryLimit =
+        CPLGetConfigOption("COG_TMP_MEMORY_LIMIT", "10%");
+    GIntBig nTmpMemoryLimit = 0;
+    if (CPLParseMemorySize(pszTmpMemoryLimit, &nTmpMemoryLimit, nullptr) !=
+            CE_None ||
+        nTmpMemoryLimit < 0)
+    {
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Invalid value for COG_TMP_MEMORY_LIMIT: %s. "
+                 "Temporary files will be created on disk.",
+                 pszTmpMemoryLimit);
+        nTmpMemoryLimit = 0;
+    }
+    m_dfTmpMemoryAvailable = static_cast<double>(nTmpMemoryLimit);
+
     const CPLString osCompress = CSLFetchNameValueDef(
         papszOptions, "COMPRESS", gbHasLZW ? "LZW" : "NONE");
 
@@ -809,6 +925,11 @@ GDALCOGCreator::Create(const char *pszFilename, GDALDataset *const poSrcDS,
     double dfTotalPixelsToProcess = 0;
     GDALDataset *poCurDS = poSrcDS;
 
+    // Whether the temporary files use the compression settings of the final
+    // file
+    bool bReprojectedDSHasFinalSettings = false;
+    bool bTmpOverviewHasFinalSettings = false;
+
     std::unique_ptr<gdal::TileMatrixSet> poTM;
     int nZoomLevel = 0;
     int nAlignedLevels = 0;
@@ -875,11 +996,36 @@ GDALCOGCreator::Create(const char *pszFilename, GDALDataset *const poSrcDS,
         }
         else
         {
+            // Use the settings of the final file when possible, so that the
+            // reprojected tiles can be copied as they are in it.
+            CPLStringList aosTmpOptions;
+            bReprojectedDSHasFinalSettings = SetTmpCompressionOptions(
+                aosTmpOptions, osCompress,
+                GetPredictor(poSrcDS, CSLFetchNameValueDef(
+                                          papszOptions, "PREDICTOR", "FALSE")),
+                CSLFetchNameValue(papszOptions, "LEVEL"));
+            const CPLString osTmpBlockSize =
+                GetBlockSize(papszOptions, poTM.get());
+            aosTmpOptions.SetNameValue("BLOCKXSIZE", osTmpBlockSize);
+            aosTmpOptions.SetNameValue("BLOCKYSIZE", osTmpBlockSize);
+            if (EQUAL(pszInterleave, "BAND"))
+                aosTmpOptions.SetNameValue("INTERLEAVE", "BAND");
+
+            // + 1 for a potential alpha band
+            const double dfTmpSize =
+                double(nTargetXSize) * nTargetYSize *
+                (poCurDS->GetRasterCount() + 1) *
+                GDALGetDataTypeSizeBytes(
+                    poCurDS->GetRasterBand(1)->GetRasterDataType());
+            const CPLString osTmpFilename =
+                GetTmpFilename(pszFilename, "warped.tif.tmp", dfTmpSize);
+
             m_poReprojectedDS = CreateReprojectedDS(
-                pszFilename, poCurDS, papszOptions, osTargetResampling,
-                osTargetSRS, nTargetXSize, nTargetYSize, dfTargetMinX,
-                dfTargetMinY, dfTargetMaxX, dfTargetMaxY, dfRes, pfnProgress,
-                pProgressData, dfCurPixels, dfTotalPixelsToProcess);
+                osTmpFilename, aosTmpOptions.List(), poCurDS, papszOptions,
+                osTargetResampling, osTargetSRS, nTargetXSize, nTargetYSize,
+                dfTargetMinX, dfTargetMinY, dfTargetMaxX, dfTargetMaxY, dfRes,
+                pfnProgress, pProgressData, dfCurPixels,
+                dfTotalPixelsToProcess);
             if (!m_poReprojectedDS)
                 return nullptr;
             poCurDS = m_poReprojectedDS.get();
@@ -987,18 +1133,7 @@ GDALCOGCreator::Create(const char *pszFilename, GDALDataset *const poSrcDS,
         m_poVRTWithOrWithoutStats->ClearStatistics();
     }
 
-    CPLString osBlockSize(CSLFetchNameValueDef(papszOptions, "BLOCKSIZE", ""));
-    if (osBlockSize.empty())
-    {
-        if (poTM)
-        {
-            osBlockSize.Printf("%d", poTM->tileMatrixList()[0].mTileWidth);
-        }
-        else
-        {
-            osBlockSize = "512";
-        }
-    }
+    const CPLString osBlockSize = GetBlockSize(papszOptions, poTM.get());
 
     const int nOvrThresholdSize = atoi(osBlockSize);
 
@@ -1125,7 +1260,8 @@ GDALCOGCreator::Create(const char *pszFilename, GDALDataset *const poSrcDS,
     if (bGenerateMskOvr)
     {
         CPLDebug("COG", "Generating overviews of the mask: start");
-        m_osTmpMskOverviewFilename = GetTmpFilename(pszFilename, "msk.ovr.tmp");
+        m_osTmpMskOverviewFilename = GetTmpFilename(
+            pszFilename, "msk.ovr.tmp", double(nXSize) * nYSize / 3);
         GDALRasterBand *poSrcMask = poFirstBand->GetMaskBand();
         const char *pszResampling = CSLFetchNameValueDef(
             papszOptions, "OVERVIEW_RESAMPLING",
@@ -1156,7 +1292,12 @@ GDALCOGCreator::Create(const char *pszFilename, GDALDataset *const poSrcDS,
     if (bGenerateOvr)
     {
         CPLDebug("COG", "Generating overviews of the imagery: start");
-        m_osTmpOverviewFilename = GetTmpFilename(pszFilename, "ovr.tmp");
+        m_osTmpOverviewFilename = GetTmpFilename(
+            pszFilename, "ovr.tmp",
+            double(nXSize) * nYSize * nBands *
+                GDALGetDataTypeSizeBytes(
+                    poFirstBand->GetRasterDataType()) /
+                3);
         std::vector<GDALRasterBand *> apoSrcBands;
         for (int i = 0; i < nBands; i++)
             apoSrcBands.push_back(poCurDS->GetRasterBand(i + 1));
@@ -1172,9 +1313,28 @@ GDALCOGCreator::Create(const char *pszFilename, GDALDataset *const poSrcDS,
             dfNextPixels / dfTotalPixelsToProcess, pfnProgress, pProgressData);
         dfCurPixels = dfNextPixels;
 
+        // Use the settings of the overviews of the final file when possible,
+        // so that their tiles can be copied as they are in it.
+        bTmpOverviewHasFinalSettings = SetTmpCompressionOptions(
+            aosOverviewOptions,
+            CSLFetchNameValueDef(papszOptions, "OVERVIEW_COMPRESS",
+                                 osCompress.c_str()),
+            GetPredictor(poSrcDS,
+                         CSLFetchNameValueDef(papszOptions,
+                                              "OVERVIEW_PREDICTOR", "FALSE")),
+            CSLFetchNameValue(papszOptions, "LEVEL"));
+        const int nBlockSize = atoi(osBlockSize);
+        if (CPLGetConfigOption("GDAL_TIFF_OVR_BLOCKSIZE", nullptr) ==
+                nullptr &&
+            nBlockSize >= 64 && nBlockSize <= 4096 &&
+            CPLIsPowerOfTwo(nBlockSize))
+        {
+            aosOverviewOptions.SetNameValue("BLOCKSIZE", osBlockSize);
+        }
         if (nBands > 1)
         {
-            aosOverviewOptions.SetNameValue("INTERLEAVE", "PIXEL");
+            aosOverviewOptions.SetNameValue(
+                "INTERLEAVE", EQUAL(pszInterleave, "BAND") ? "BAND" : "PIXEL");
         }
         if (!m_osTmpMskOverviewFilename.empty())
         {
@@ -1386,6 +1546,13 @@ GDALCOGCreator::Create(const char *pszFilename, GDALDataset *const poSrcDS,
         aosOptions.SetNameValue("INTERLEAVE", pszInterleave);
     }
 
+    // The blocks of other GTiff datasets, such as the source dataset, may
+    // have been written with a different compression level.
+    if (bReprojectedDSHasFinalSettings && poCurDS == m_poReprojectedDS.get())
+        aosOptions.SetNameValue("@COPY_RAW_BLOCKS", "YES");
+    if (bTmpOverviewHasFinalSettings)
+        aosOptions.SetNameValue("@COPY_RAW_OVERVIEW_BLOCKS", "YES");
+
     aosOptions.SetNameValue("@FLUSHCACHE", "YES");
     aosOptions.SetNameValue("@SUPPRESS_ASAP",
                             CSLFetchNameValue(papszOptions, "@SUPPRESS_ASAP"));
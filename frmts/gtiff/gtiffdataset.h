@@ -457,7 +457,12 @@ class GTiffDataset final : public GDALPamDataset
                                      GDALDataset *poSrcDS,
                                      GDALRasterBand *poSrcMaskBand,
                                      GDALProgressFunc pfnProgress,
-                                     void *pProgressData);
+                                     void *pProgressData,
+                                     GTiffDataset *poSrcRawDS = nullptr);
+
+    bool CanCopyRawBlocksFrom(GTiffDataset *poSrcDS);
+    bool CopyRawBlockFrom(GTiffDataset *poSrcDS, int nBlockId,
+                          std::vector<GByte> &abyBuffer);
 
     bool GetOverviewParameters(int &nCompression, uint16_t &nPlanarConfig,
                                uint16_t &nPredictor, uint16_t &nPhotometric,
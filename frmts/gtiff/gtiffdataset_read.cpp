@@ -392,6 +392,12 @@ struct GTiffDecompressJob
     int nYBlock = 0;
     vsi_l_offset nOffset = 0;
     vsi_l_offset nSize = 0;
+
+    // Set when the strile is fetched with AsyncReadMultiRange() in abyData,
+    // in which case the job is only submitted once the data is available.
+    bool bDataFetched = false;
+    bool bDataFetchOK = false;
+    std::vector<GByte> abyData{};
 };
 
 /************************************************************************/
@@ -400,7 +406,7 @@ struct GTiffDecompressJob
 
 /* static */ void GTiffDataset::ThreadDecompressionFunc(void *pData)
 {
-    const auto psJob = static_cast<const GTiffDecompressJob *>(pData);
+    const auto psJob = static_cast<GTiffDecompressJob *>(pData);
     auto psContext = psJob->psContext;
     auto poDS = psContext->poDS;
 
@@ -605,14 +611,22 @@ struct GTiffDecompressJob
         }
         if (nAlreadyLoadedBlocks != nBandsToCache)
         {
-            if (!AllocInputBuffer())
+            if (psJob->bDataFetched)
+            {
+                abyInput = std::move(psJob->abyData);
+            }
+            else if (!AllocInputBuffer())
             {
                 std::lock_guard<std::recursive_mutex> oLock(psContext->oMutex);
                 psContext->bSuccess = false;
                 return;
             }
-            if (psContext->poHandle->PRead(abyInput.data(), abyInput.size(),
-                                           psJob->nOffset) != abyInput.size())
+            if (psJob->bDataFetched
+                    ? !psJob->bDataFetchOK
+                    : psContext->poHandle->PRead(abyInput.data(),
+                                                 abyInput.size(),
+                                                 psJob->nOffset) !=
+                          abyInput.size())
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
                          "Cannot read " CPL_FRMT_GUIB
@@ -1265,6 +1279,7 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
     std::vector<GTiffDecompressJob> asJobs(nBlocks);
     std::vector<vsi_l_offset> anOffsets(nBlocks);
     std::vector<size_t> anSizes(nBlocks);
+    std::vector<int> anAdviseReadJobIdx(nBlocks);
     int iJob = 0;
     int nAdviseReadRanges = 0;
     const size_t nAdviseReadTotalBytesLimit =
@@ -1415,6 +1430,7 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
                         asJobs.clear();
                         anOffsets.clear();
                         anSizes.clear();
+                        anAdviseReadJobIdx.clear();
                         poQueue.reset();
 
                         CPLErr eErr = MultiThreadedRead(
@@ -1433,6 +1449,7 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
                         return eErr;
                     }
                     nAdviseReadAccBytes += anSizes[nAdviseReadRanges];
+                    anAdviseReadJobIdx[nAdviseReadRanges] = iJob;
 
                     ++nAdviseReadRanges;
                 }
@@ -1444,10 +1461,57 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
 
     if (sContext.bSuccess)
     {
-        // Potentially start asynchronous fetching of ranges depending on file
-        // implementation
-        if (nAdviseReadRanges > 0)
+        // If the file implementation supports it, fetch the ranges with
+        // AsyncReadMultiRange(), and only submit the decompression job of a
+        // strile once its data has been received, so that decompression of
+        // the first striles overlaps with the fetching of the next ones.
+        // Otherwise, the decompression jobs read their strile with PRead(),
+        // which can benefit from ranges prefetched by AdviseRead().
+        std::vector<void *> apAsyncData;
+        std::vector<vsi_l_offset> anAsyncOffsets;
+        std::vector<size_t> anAsyncSizes;
+        std::vector<GTiffDecompressJob *> apsAsyncJobs;
+        if (nAdviseReadRanges > 0 && sContext.bHasPRead &&
+            sContext.poHandle->HasAsyncRead()
+#ifdef DEBUG
+            && CPLTestBool(CPLGetConfigOption("GTIFF_ALLOW_ASYNC_READ", "YES"))
+#endif
+        )
+        {
+            // Memory for the received striles is allocated upfront, so
+            // bound it.
+            const size_t nMaxAsyncBytes =
+                nAdviseReadTotalBytesLimit > 0 ? nAdviseReadTotalBytesLimit
+                                               : 100 * 1024 * 1024;
+            size_t nAsyncBytes = 0;
+            for (int i = 0; i < nAdviseReadRanges; ++i)
+            {
+                auto &sJob = asJobs[anAdviseReadJobIdx[i]];
+                if (anSizes[i] == 0 || sJob.nSize != anSizes[i] ||
+                    anSizes[i] > nMaxAsyncBytes - nAsyncBytes)
+                {
+                    continue;
+                }
+                try
+                {
+                    sJob.abyData.resize(anSizes[i]);
+                }
+                catch (const std::exception &)
+                {
+                    break;
+                }
+                nAsyncBytes += anSizes[i];
+                sJob.bDataFetched = true;
+                apAsyncData.push_back(sJob.abyData.data());
+                anAsyncOffsets.push_back(anOffsets[i]);
+                anAsyncSizes.push_back(anSizes[i]);
+                apsAsyncJobs.push_back(&sJob);
+            }
+        }
+        if (apsAsyncJobs.empty() && nAdviseReadRanges > 0)
         {
+            // Potentially start asynchronous fetching of ranges depending on
+            // file implementation
             sContext.poHandle->AdviseRead(nAdviseReadRanges, anOffsets.data(),
                                           anSizes.data());
         }
@@ -1455,12 +1519,31 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
         // We need to do that as threads will access the block cache
         TemporarilyDropReadWriteLock();
 
+        std::unique_ptr<VSIAsyncReadRequest> poAsyncRequest;
+        if (!apsAsyncJobs.empty())
+        {
+            CPLJobQueue *poQueueRaw = poQueue.get();
+            poAsyncRequest = sContext.poHandle->AsyncReadMultiRange(
+                static_cast<int>(apsAsyncJobs.size()), apAsyncData.data(),
+                anAsyncOffsets.data(), anAsyncSizes.data(),
+                [&apsAsyncJobs, poQueueRaw](int iRange, bool bSuccess)
+                {
+                    GTiffDecompressJob *psJob = apsAsyncJobs[iRange];
+                    psJob->bDataFetchOK = bSuccess;
+                    poQueueRaw->SubmitJob(ThreadDecompressionFunc, psJob);
+                });
+        }
+
         for (auto &sJob : asJobs)
         {
-            poQueue->SubmitJob(ThreadDecompressionFunc, &sJob);
+            if (!sJob.bDataFetched)
+                poQueue->SubmitJob(ThreadDecompressionFunc, &sJob);
         }
 
-        // Wait for all jobs to have been completed
+        // Wait for all striles to have been fetched, and thus all jobs to
+        // have been submitted, and then for all jobs to have been completed
+        if (poAsyncRequest)
+            poAsyncRequest->Wait();
         poQueue->WaitCompletion();
 
         // Undo effect of above TemporarilyDropReadWriteLock()
@@ -7008,18 +7008,162 @@ GDALDataset *GTiffDataset::Create(const char *pszFilename, int nXSize,
     return poDS.release();
 }
 
+/************************************************************************/
+/*                        CanCopyRawBlocksFrom()                        */
+/*                                                                      */
+/*      Return true if the compressed strips/tiles of poSrcDS can be    */
+/*      written as they are in this dataset, that is if both use the    */
+/*      same block layout, pixel representation and lossless codec.    */
+/************************************************************************/
+
+bool GTiffDataset::CanCopyRawBlocksFrom(GTiffDataset *poSrcDS)
+{
+    // Note: DISCARD_LSB (m_panMaskOffsetLsb) alters the pixel values before
+    // compression.
+    if (poSrcDS == nullptr || poSrcDS->m_hTIFF == nullptr ||
+        poSrcDS->m_bStreamingIn || m_panMaskOffsetLsb != nullptr)
+    {
+        return false;
+    }
+
+    // Blocks of a dataset opened in update mode may be pending in its block
+    // cache or compression queue, whereas they are read here from the file.
+    if (poSrcDS->eAccess == GA_Update && poSrcDS->FlushCache(false) != CE_None)
+        return false;
+
+    if (!poSrcDS->SetDirectory())
+        return false;
+
+    switch (m_nCompression)
+    {
+        case COMPRESSION_NONE:
+        case COMPRESSION_LZW:
+        case COMPRESSION_ADOBE_DEFLATE:
+        case COMPRESSION_PACKBITS:
+        case COMPRESSION_LZMA:
+        case COMPRESSION_ZSTD:
+            break;
+
+        default:
+            // Lossy codecs, or codecs with out-of-band parameters
+            return false;
+    }
+
+    const auto GetPredictor = [](TIFF *hTIFF)
+    {
+        uint16_t nPredictor = PREDICTOR_NONE;
+        if (!TIFFGetField(hTIFF, TIFFTAG_PREDICTOR, &nPredictor))
+            nPredictor = PREDICTOR_NONE;
+        return nPredictor;
+    };
+
+    return poSrcDS->m_nCompression == m_nCompression &&
+           poSrcDS->nRasterXSize == nRasterXSize &&
+           poSrcDS->nRasterYSize == nRasterYSize &&
+           poSrcDS->m_nBlockXSize == m_nBlockXSize &&
+           poSrcDS->m_nBlockYSize == m_nBlockYSize &&
+           CPL_TO_BOOL(TIFFIsTiled(poSrcDS->m_hTIFF)) ==
+               CPL_TO_BOOL(TIFFIsTiled(m_hTIFF)) &&
+           poSrcDS->m_nPlanarConfig == m_nPlanarConfig &&
+           poSrcDS->m_nPhotometric == m_nPhotometric &&
+           poSrcDS->m_nSamplesPerPixel == m_nSamplesPerPixel &&
+           poSrcDS->m_nBitsPerSample == m_nBitsPerSample &&
+           poSrcDS->m_nSampleFormat == m_nSampleFormat &&
+           CPL_TO_BOOL(TIFFIsBigEndian(poSrcDS->m_hTIFF)) ==
+               CPL_TO_BOOL(TIFFIsBigEndian(m_hTIFF)) &&
+           GetPredictor(poSrcDS->m_hTIFF) == GetPredictor(m_hTIFF);
+}
+
+/************************************************************************/
+/*                          CopyRawBlockFrom()                          */
+/*                                                                      */
+/*      Write the compressed strip/tile nBlockId of poSrcDS in this     */
+/*      dataset without decompressing and recompressing it. Return      */
+/*      false if the block is not available in the source, in which     */
+/*      case the caller must copy it the regular way.                   */
+/************************************************************************/
+
+bool GTiffDataset::CopyRawBlockFrom(GTiffDataset *poSrcDS, int nBlockId,
+                                    std::vector<GByte> &abyBuffer)
+{
+    vsi_l_offset nOffset = 0;
+    vsi_l_offset nSize = 0;
+    if (!poSrcDS->SetDirectory() ||
+        !poSrcDS->IsBlockAvailable(nBlockId, &nOffset, &nSize, nullptr) ||
+        nSize == 0 ||
+        nSize > static_cast<vsi_l_offset>(std::numeric_limits<int>::max()))
+    {
+        return false;
+    }
+
+    try
+    {
+        abyBuffer.resize(static_cast<size_t>(nSize));
+    }
+    catch (const std::exception &)
+    {
+        return false;
+    }
+
+    VSILFILE *fp = VSI_TIFFGetVSILFile(TIFFClientdata(poSrcDS->m_hTIFF));
+    const vsi_l_offset nCurOffset = VSIFTellL(fp);
+    const bool bOK = VSIFSeekL(fp, nOffset, SEEK_SET) == 0 &&
+                     VSIFReadL(abyBuffer.data(), 1, abyBuffer.size(), fp) ==
+                         abyBuffer.size();
+    VSIFSeekL(fp, nCurOffset, SEEK_SET);
+    if (!bOK)
+        return false;
+
+    // Blocks being compressed by worker threads must be written before,
+    // so that the block order of the file is preserved.
+    auto poQueue = m_poBaseDS ? m_poBaseDS->m_poCompressQueue.get()
+                              : m_poCompressQueue.get();
+    if (poQueue)
+    {
+        poQueue->WaitCompletion();
+
+        // cppcheck-suppress constVariableReference
+        auto &oQueue =
+            m_poBaseDS ? m_poBaseDS->m_asQueueJobIdx : m_asQueueJobIdx;
+        while (!oQueue.empty())
+        {
+            WaitCompletionForJobIdx(oQueue.front());
+        }
+    }
+
+    WriteRawStripOrTile(nBlockId, abyBuffer.data(),
+                        static_cast<GPtrDiff_t>(abyBuffer.size()));
+    return true;
+}
+
 /************************************************************************/
 /*                         CopyImageryAndMask()                         */
+/*                                                                      */
+/*      If poSrcRawDS is set, it must be the GTiff dataset behind       */
+/*      poSrcDS, whose compressed blocks are copied as they are when    */
+/*      possible.                                                       */
 /************************************************************************/
 
 CPLErr GTiffDataset::CopyImageryAndMask(GTiffDataset *poDstDS,
                                         GDALDataset *poSrcDS,
                                         GDALRasterBand *poSrcMaskBand,
                                         GDALProgressFunc pfnProgress,
-                                        void *pProgressData)
+                                        void *pProgressData,
+                                        GTiffDataset *poSrcRawDS)
 {
     CPLErr eErr = CE_None;
 
+    // Tile interleaving writes the blocks of all bands at once, which is
+    // not worth the complication.
+    const bool bCopyRawBlocks = !poDstDS->m_bTileInterleave &&
+                                poDstDS->CanCopyRawBlocksFrom(poSrcRawDS);
+    if (bCopyRawBlocks)
+    {
+        CPLDebug("GTiff", "Copying compressed blocks of %s as they are",
+                 poSrcRawDS->GetDescription());
+    }
+    std::vector<GByte> abyRawBlock;
+
     const auto eType = poDstDS->GetRasterBand(1)->GetRasterDataType();
     const int nDataTypeSize = GDALGetDataTypeSizeBytes(eType);
     const int l_nBands = poDstDS->GetRasterCount();
@@ -7065,23 +7209,30 @@ CPLErr GTiffDataset::CopyImageryAndMask(GTiffDataset *poDstDS,
                 {
                     const int nReqXSize =
                         std::min(nXSize - iX, poDstDS->m_nBlockXSize);
-                    if (nReqXSize < poDstDS->m_nBlockXSize ||
-                        nReqYSize < poDstDS->m_nBlockYSize)
-                    {
-                        memset(pBlockBuffer, 0,
-                               static_cast<size_t>(poDstDS->m_nBlockXSize) *
-                                   poDstDS->m_nBlockYSize * nDataTypeSize);
-                    }
-                    eErr = poSrcDS->GetRasterBand(i + 1)->RasterIO(
-                        GF_Read, iX, iY, nReqXSize, nReqYSize, pBlockBuffer,
-                        nReqXSize, nReqYSize, eType, nDataTypeSize,
-                        static_cast<GSpacing>(nDataTypeSize) *
-                            poDstDS->m_nBlockXSize,
-                        nullptr);
-                    if (eErr == CE_None)
+                    if (!bCopyRawBlocks ||
+                        !poDstDS->CopyRawBlockFrom(poSrcRawDS, iBlock,
+                                                   abyRawBlock))
                     {
-                        eErr = poDstDS->WriteEncodedTileOrStrip(
-                            iBlock, pBlockBuffer, false);
+                        if (nReqXSize < poDstDS->m_nBlockXSize ||
+                            nReqYSize < poDstDS->m_nBlockYSize)
+                        {
+                            memset(pBlockBuffer, 0,
+                                   static_cast<size_t>(
+                                       poDstDS->m_nBlockXSize) *
+                                       poDstDS->m_nBlockYSize * nDataTypeSize);
+                        }
+                        eErr = poSrcDS->GetRasterBand(i + 1)->RasterIO(
+                            GF_Read, iX, iY, nReqXSize, nReqYSize,
+                            pBlockBuffer, nReqXSize, nReqYSize, eType,
+                            nDataTypeSize,
+                            static_cast<GSpacing>(nDataTypeSize) *
+                                poDstDS->m_nBlockXSize,
+                            nullptr);
+                        if (eErr == CE_None)
+                        {
+                            eErr = poDstDS->WriteEncodedTileOrStrip(
+                                iBlock, pBlockBuffer, false);
+                        }
                     }
 
                     iBlock++;
@@ -7181,7 +7332,12 @@ CPLErr GTiffDataset::CopyImageryAndMask(GTiffDataset *poDstDS,
                                nDataTypeSize);
                 }
 
-                if (poDstDS->m_bTileInterleave)
+                if (bCopyRawBlocks &&
+                    poDstDS->CopyRawBlockFrom(poSrcRawDS, iBlock, abyRawBlock))
+                {
+                    // Compressed block copied as it is
+                }
+                else if (poDstDS->m_bTileInterleave)
                 {
                     eErr = poSrcDS->RasterIO(
                         GF_Read, iX, iY, nReqXSize, nReqYSize, pBlockBuffer,
@@ -7449,6 +7605,16 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
     double dfExtraSpaceForOverviews = 0;
     const bool bCopySrcOverviews =
         CPLFetchBool(papszCreateOptions, "COPY_SRC_OVERVIEWS", false);
+
+    // The compression level of a file cannot be read back from it, so the
+    // compressed blocks of the source dataset, or of @OVERVIEW_DATASET, are
+    // only copied as they are when the caller (the COG driver for its
+    // temporary files) guarantees that they have been written with the same
+    // creation options.
+    const bool bCopyRawSrcBlocks =
+        CPLFetchBool(papszCreateOptions, "@COPY_RAW_BLOCKS", false);
+    const bool bCopyRawOverviewDatasetBlocks =
+        CPLFetchBool(papszCreateOptions, "@COPY_RAW_OVERVIEW_BLOCKS", false);
     std::unique_ptr<GDALDataset> poOvrDS;
     int nSrcOverviews = 0;
     if (bCopySrcOverviews)
@@ -8725,8 +8891,14 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
                                              dfNextCurPixels / dfTotalPixels,
                                              pfnProgress, pProgressData);
 
-                eErr = CopyImageryAndMask(poDstDS, poSrcOvrDS, poSrcMaskBand,
-                                          GDALScaledProgress, pScaledData);
+                const bool bCopyRawOvrBlocks =
+                    poOvrDS ? bCopyRawOverviewDatasetBlocks : bCopyRawSrcBlocks;
+                eErr = CopyImageryAndMask(
+                    poDstDS, poSrcOvrDS, poSrcMaskBand, GDALScaledProgress,
+                    pScaledData,
+                    bCopyRawOvrBlocks ? dynamic_cast<GTiffDataset *>(
+                                            poSrcOvrBand->GetDataset())
+                                      : nullptr);
 
                 dfCurPixels = dfNextCurPixels;
                 GDALDestroyScaledProgress(pScaledData);
@@ -8909,9 +9081,11 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
                                              pfnProgress, pProgressData);
             }
 
-            eErr = CopyImageryAndMask(poDS.get(), poSrcDS,
-                                      poSrcDS->GetRasterBand(1)->GetMaskBand(),
-                                      GDALScaledProgress, pScaledData);
+            eErr = CopyImageryAndMask(
+                poDS.get(), poSrcDS, poSrcDS->GetRasterBand(1)->GetMaskBand(),
+                GDALScaledProgress, pScaledData,
+                bCopyRawSrcBlocks ? dynamic_cast<GTiffDataset *>(poSrcDS)
+                                  : nullptr);
             if (poDS->m_poMaskDS)
             {
                 bWriteMask = false;
@@ -3047,6 +3047,117 @@ static CPLErr ExprPixelFunc(void **papoSources, int nSources, void *pData,
     if (!padfResults)
         return CE_Failure;
 
+#if GDAL_VRT_ENABLE_MUPARSER
+    // Evaluate whole lines at once when the expression only uses constructs
+    // supported by VectorizedMuParserExpression.
+    std::vector<std::string> aosVariables;
+    std::unique_ptr<gdal::VectorizedMuParserExpression> poVectorized;
+    if (EQUAL(pszDialect, "muparser") && nXSize > 0 && nYSize > 0 &&
+        CPLTestBool(
+            CPLGetConfigOption("GDAL_VRT_EXPRESSION_VECTORIZED", "YES")))
+    {
+        for (const auto &osName : aosSourceNames)
+            aosVariables.push_back(osName);
+        if (includeCenterCoords)
+        {
+            aosVariables.push_back("_CENTER_X_");
+            aosVariables.push_back("_CENTER_Y_");
+        }
+        poVectorized = gdal::VectorizedMuParserExpression::Create(
+            pszExpression, aosVariables, bHasNoData ? &dfNoData : nullptr);
+    }
+
+    if (poVectorized)
+    {
+        // Let muparser report errors in the expression, if any
+        for (int iSrc = 0; iSrc < nSources; iSrc++)
+            adfValuesForPixel[iSrc] = GetSrcVal(papoSources[iSrc], eSrcType, 0);
+        if (includeCenterCoords)
+        {
+            gt.Apply(static_cast<double>(nXOff) + 0.5,
+                     static_cast<double>(nYOff) + 0.5, &dfCenterX,
+                     &dfCenterY);
+        }
+        if (poExpression->Evaluate() != CE_None)
+            return CE_Failure;
+
+        const int nSrcDTSize = GDALGetDataTypeSizeBytes(eSrcType);
+        std::vector<const double *> apadfVariables(aosVariables.size());
+        std::unique_ptr<double, VSIFreeReleaser> padfLineValues(
+            static_cast<double *>(VSI_MALLOC3_VERBOSE(
+                std::max<size_t>(1, aosVariables.size()), nXSize,
+                sizeof(double))));
+        if (!padfLineValues)
+            return CE_Failure;
+
+        for (int iLine = 0; iLine < nYSize; ++iLine)
+        {
+            const size_t nLineOffset = static_cast<size_t>(iLine) * nXSize;
+            for (int iSrc = 0; iSrc < nSources; iSrc++)
+            {
+                if (eSrcType == GDT_Float64)
+                {
+                    apadfVariables[iSrc] =
+                        static_cast<const double *>(papoSources[iSrc]) +
+                        nLineOffset;
+                }
+                else
+                {
+                    double *padfSrc =
+                        padfLineValues.get() +
+                        static_cast<size_t>(iSrc) * nXSize;
+                    GDALCopyWords64(static_cast<const GByte *>(
+                                        papoSources[iSrc]) +
+                                        nLineOffset * nSrcDTSize,
+                                    eSrcType, nSrcDTSize, padfSrc,
+                                    GDT_Float64, sizeof(double), nXSize);
+                    apadfVariables[iSrc] = padfSrc;
+                }
+            }
+
+            if (includeCenterCoords)
+            {
+                double *padfCenterX = padfLineValues.get() +
+                                      static_cast<size_t>(nSources) * nXSize;
+                double *padfCenterY = padfCenterX + nXSize;
+                for (int iCol = 0; iCol < nXSize; ++iCol)
+                {
+                    gt.Apply(static_cast<double>(iCol + nXOff) + 0.5,
+                             static_cast<double>(iLine + nYOff) + 0.5,
+                             padfCenterX + iCol, padfCenterY + iCol);
+                }
+                apadfVariables[nSources] = padfCenterX;
+                apadfVariables[nSources + 1] = padfCenterY;
+            }
+
+            poVectorized->Evaluate(apadfVariables.data(), nXSize,
+                                   padfResults.get());
+
+            if (bHasNoData && bPropagateNoData)
+            {
+                for (int iCol = 0; iCol < nXSize; ++iCol)
+                {
+                    for (int iSrc = 0; iSrc < nSources; iSrc++)
+                    {
+                        if (IsNoData(apadfVariables[iSrc][iCol], dfNoData))
+                        {
+                            padfResults.get()[iCol] = dfNoData;
+                            break;
+                        }
+                    }
+                }
+            }
+
+            GDALCopyWords(padfResults.get(), GDT_Float64, sizeof(double),
+                          static_cast<GByte *>(pData) +
+                              static_cast<GSpacing>(nLineSpace) * iLine,
+                          eBufType, nPixelSpace, nXSize);
+        }
+
+        return CE_None;
+    }
+#endif
+
     /* ---- Set pixels ---- */
     size_t ii = 0;
     for (int iLine = 0; iLine < nYSize; ++iLine)
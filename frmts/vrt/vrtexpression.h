@@ -14,6 +14,8 @@
 
 #include "cpl_error.h"
 
+#include <memory>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -163,6 +165,56 @@ class MuParserExpression final : public MathExpression
     std::unique_ptr<Impl> m_pImpl;
 };
 
+/**
+ * Class to evaluate an expression over arrays of values, for the subset of the
+ * muparser dialect made of arithmetic, comparison and logical operators, the
+ * ternary operator, and common math functions.
+ *
+ * The expression is compiled to a sequence of instructions, each of them
+ * operating on blocks of values, using SSE2 when available.
+ */
+class VectorizedMuParserExpression
+{
+  public:
+    ~VectorizedMuParserExpression();
+
+    /**
+     * Compile an expression.
+     *
+     * @param osExpression The body of the expression, e.g. "X + 3"
+     * @param aosVariables Names of the variables, in the order in which
+     *                     their values are passed to Evaluate().
+     * @param pdfNoData Pointer to the value of NODATA, or nullptr if not set.
+     * @return a VectorizedMuParserExpression, or nullptr if the expression
+     *         uses constructs that are not supported. No error is emitted in
+     *         that case, and the expression must then be evaluated with
+     *         MuParserExpression, which is also responsible for reporting
+     *         invalid expressions.
+     */
+    static std::unique_ptr<VectorizedMuParserExpression>
+    Create(std::string_view osExpression,
+           const std::vector<std::string> &aosVariables,
+           const double *pdfNoData);
+
+    /**
+     * Evaluate the expression.
+     *
+     * @param papadfVariables Array of pointers to the values of each variable,
+     *                        each one of nValues values.
+     * @param nValues Number of values to evaluate.
+     * @param padfResults Array of nValues values where to store the results.
+     */
+    void Evaluate(const double *const *papadfVariables, size_t nValues,
+                  double *padfResults);
+
+  private:
+    VectorizedMuParserExpression();
+
+    class Impl;
+
+    std::unique_ptr<Impl> m_pImpl;
+};
+
 #endif
 
 inline std::unique_ptr<MathExpression>
@@ -0,0 +1,1032 @@
+/******************************************************************************
+ *
+ * Project:  Virtual GDAL Datasets
+ * Purpose:  Implementation of VectorizedMuParserExpression
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "vrtexpression.h"
+#include "cpl_conv.h"
+#include "cpl_string.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <limits>
+#include <map>
+
+#if defined(__x86_64) || defined(_M_X64) || defined(USE_NEON_OPTIMIZATIONS)
+#define USE_SSE2
+#include "gdalsse_priv.h"
+#endif
+
+namespace gdal
+{
+
+/*! @cond Doxygen_Suppress */
+
+namespace
+{
+
+enum class VectorizedOp
+{
+    ADD,
+    SUB,
+    MUL,
+    DIV,
+    NEG,
+    EQ,
+    NE,
+    LT,
+    LE,
+    GT,
+    GE,
+    AND,
+    OR,
+    TERNARY,
+    MIN,
+    MAX,
+    POW,
+    POW2,
+    POW3,
+    POW4,
+    FMOD,
+    ISNAN,
+    ISNODATA,
+    UNARY_FUNC,
+};
+
+struct VectorizedInstruction
+{
+    VectorizedOp eOp = VectorizedOp::ADD;
+    int nDst = 0;
+    int nSrc1 = 0;
+    int nSrc2 = 0;
+    int nSrc3 = 0;
+    double (*pfnFunc)(double) = nullptr;
+};
+
+// Functions of the muparser dialect, whose result does not depend on the
+// muparser version. "log" is not included as its base has changed across
+// versions.
+const std::map<std::string, double (*)(double)> &GetUnaryFunctions()
+{
+    static const std::map<std::string, double (*)(double)> oMap = {
+        {"sin", [](double x) { return std::sin(x); }},
+        {"cos", [](double x) { return std::cos(x); }},
+        {"tan", [](double x) { return std::tan(x); }},
+        {"asin", [](double x) { return std::asin(x); }},
+        {"acos", [](double x) { return std::acos(x); }},
+        {"atan", [](double x) { return std::atan(x); }},
+        {"sinh", [](double x) { return std::sinh(x); }},
+        {"cosh", [](double x) { return std::cosh(x); }},
+        {"tanh", [](double x) { return std::tanh(x); }},
+        {"asinh", [](double x) { return std::asinh(x); }},
+        {"acosh", [](double x) { return std::acosh(x); }},
+        {"atanh", [](double x) { return std::atanh(x); }},
+        {"log10", [](double x) { return std::log10(x); }},
+        {"ln", [](double x) { return std::log(x); }},
+        {"exp", [](double x) { return std::exp(x); }},
+        {"sqrt", [](double x) { return std::sqrt(x); }},
+        {"abs", [](double x) { return std::fabs(x); }},
+        {"sign", [](double x) { return x < 0 ? -1.0 : x > 0 ? 1.0 : 0.0; }},
+    };
+    return oMap;
+}
+
+/************************************************************************/
+/*                     VectorizedExpressionCompiler                     */
+/************************************************************************/
+
+// Recursive descent parser of the supported subset of the muparser dialect,
+// which directly emits instructions.
+//
+// Values are held in slots: first the variables, then the constants, and
+// then the temporaries, which are allocated as a stack.
+class VectorizedExpressionCompiler
+{
+  public:
+    VectorizedExpressionCompiler(std::string_view osExpression,
+                                 const std::vector<std::string> &aosVariables,
+                                 const double *pdfNoData)
+        : m_osExpression(osExpression), m_aosVariables(aosVariables),
+          m_pdfNoData(pdfNoData)
+    {
+    }
+
+    bool Compile();
+
+    std::vector<VectorizedInstruction> m_asInstructions{};
+    std::vector<double> m_adfConstants{};
+    int m_nTemporaries = 0;
+    int m_nResult = -1;
+
+  private:
+    const std::string_view m_osExpression;
+    const std::vector<std::string> &m_aosVariables;
+    const double *const m_pdfNoData;
+    size_t m_nPos = 0;
+    int m_nCurTemporaries = 0;
+    bool m_bError = false;
+
+    static constexpr int MAX_DEPTH = 256;
+    int m_nDepth = 0;
+
+    // Slot index of temporaries are encoded as negative values until the
+    // number of constants is known.
+    static int TempSlot(int iTemp)
+    {
+        return -1 - iTemp;
+    }
+
+    static bool IsTempSlot(int nSlot)
+    {
+        return nSlot < 0;
+    }
+
+    int NumVariables() const
+    {
+        return static_cast<int>(m_aosVariables.size());
+    }
+
+    bool IsConstSlot(int nSlot) const
+    {
+        return nSlot >= NumVariables();
+    }
+
+    void SkipSpaces()
+    {
+        while (m_nPos < m_osExpression.size() &&
+               std::isspace(static_cast<unsigned char>(m_osExpression[m_nPos])))
+            ++m_nPos;
+    }
+
+    // Consume the passed token if it is the next one
+    bool Accept(const char *pszToken)
+    {
+        SkipSpaces();
+        const size_t nLen = strlen(pszToken);
+        if (m_osExpression.substr(m_nPos, nLen) == pszToken)
+        {
+            m_nPos += nLen;
+            return true;
+        }
+        return false;
+    }
+
+    int Fail()
+    {
+        m_bError = true;
+        return 0;
+    }
+
+    int AddConstant(double dfVal)
+    {
+        m_adfConstants.push_back(dfVal);
+        return NumVariables() + static_cast<int>(m_adfConstants.size()) - 1;
+    }
+
+    void Release(int nSlot)
+    {
+        if (IsTempSlot(nSlot))
+        {
+            CPLAssert(nSlot == TempSlot(m_nCurTemporaries - 1));
+            --m_nCurTemporaries;
+        }
+    }
+
+    int Emit(VectorizedOp eOp, int nSrc1, int nSrc2 = 0, int nSrc3 = 0,
+             double (*pfnFunc)(double) = nullptr)
+    {
+        // Operands are released in the reverse order of their allocation
+        if (eOp == VectorizedOp::TERNARY)
+            Release(nSrc3);
+        if (eOp != VectorizedOp::NEG && eOp != VectorizedOp::POW2 &&
+            eOp != VectorizedOp::POW3 && eOp != VectorizedOp::POW4 &&
+            eOp != VectorizedOp::ISNAN && eOp != VectorizedOp::ISNODATA &&
+            eOp != VectorizedOp::UNARY_FUNC)
+        {
+            Release(nSrc2);
+        }
+        Release(nSrc1);
+
+        VectorizedInstruction sInstr;
+        sInstr.eOp = eOp;
+        sInstr.nDst = TempSlot(m_nCurTemporaries++);
+        m_nTemporaries = std::max(m_nTemporaries, m_nCurTemporaries);
+        sInstr.nSrc1 = nSrc1;
+        sInstr.nSrc2 = nSrc2;
+        sInstr.nSrc3 = nSrc3;
+        sInstr.pfnFunc = pfnFunc;
+        m_asInstructions.push_back(sInstr);
+        return sInstr.nDst;
+    }
+
+    int ParseTernary();
+    int ParseOr();
+    int ParseAnd();
+    int ParseComparison();
+    int ParseAdditive();
+    int ParseMultiplicative();
+    int ParseUnary(bool &bIsPower);
+    int ParsePower(bool &bIsPower);
+    int ParsePrimary(bool &bIsVariable);
+    int ParseFunction(const std::string &osName);
+
+    CPL_DISALLOW_COPY_ASSIGN(VectorizedExpressionCompiler)
+};
+
+/************************************************************************/
+/*                              Compile()                               */
+/************************************************************************/
+
+bool VectorizedExpressionCompiler::Compile()
+{
+    m_nResult = ParseTernary();
+    SkipSpaces();
+    if (m_bError || m_nPos != m_osExpression.size())
+        return false;
+
+    // Now that the number of constants is known, assign the final slot
+    // indices of temporaries.
+    const int nFirstTemp =
+        NumVariables() + static_cast<int>(m_adfConstants.size());
+    const auto Remap = [nFirstTemp](int &nSlot)
+    {
+        if (IsTempSlot(nSlot))
+            nSlot = nFirstTemp + (-1 - nSlot);
+    };
+    for (auto &sInstr : m_asInstructions)
+    {
+        Remap(sInstr.nDst);
+        Remap(sInstr.nSrc1);
+        Remap(sInstr.nSrc2);
+        Remap(sInstr.nSrc3);
+    }
+    Remap(m_nResult);
+    return true;
+}
+
+/************************************************************************/
+/*                            ParseTernary()                            */
+/************************************************************************/
+
+// ternary := or ( '?' ternary ':' ternary )?
+int VectorizedExpressionCompiler::ParseTernary()
+{
+    if (++m_nDepth > MAX_DEPTH)
+        return Fail();
+    int nSlot = ParseOr();
+    if (!m_bError && Accept("?"))
+    {
+        const int nTrue = ParseTernary();
+        if (m_bError || !Accept(":"))
+            return Fail();
+        const int nFalse = ParseTernary();
+        if (m_bError)
+            return Fail();
+        nSlot = Emit(VectorizedOp::TERNARY, nSlot, nTrue, nFalse);
+    }
+    --m_nDepth;
+    return nSlot;
+}
+
+/************************************************************************/
+/*                              ParseOr()                               */
+/************************************************************************/
+
+// or := and ( '||' and )*
+int VectorizedExpressionCompiler::ParseOr()
+{
+    int nSlot = ParseAnd();
+    while (!m_bError && Accept("||"))
+    {
+        const int nRight = ParseAnd();
+        nSlot = Emit(VectorizedOp::OR, nSlot, nRight);
+    }
+    return nSlot;
+}
+
+/************************************************************************/
+/*                              ParseAnd()                              */
+/************************************************************************/
+
+// and := comparison ( '&&' comparison )*
+int VectorizedExpressionCompiler::ParseAnd()
+{
+    int nSlot = ParseComparison();
+    while (!m_bError && Accept("&&"))
+    {
+        const int nRight = ParseComparison();
+        nSlot = Emit(VectorizedOp::AND, nSlot, nRight);
+    }
+    return nSlot;
+}
+
+/************************************************************************/
+/*                          ParseComparison()                           */
+/************************************************************************/
+
+// comparison := additive ( ('<=' | '>=' | '==' | '!=' | '<' | '>') additive )*
+int VectorizedExpressionCompiler::ParseComparison()
+{
+    int nSlot = ParseAdditive();
+    while (!m_bError)
+    {
+        VectorizedOp eOp;
+        if (Accept("<="))
+            eOp = VectorizedOp::LE;
+        else if (Accept(">="))
+            eOp = VectorizedOp::GE;
+        else if (Accept("=="))
+            eOp = VectorizedOp::EQ;
+        else if (Accept("!="))
+            eOp = VectorizedOp::NE;
+        else if (Accept("<"))
+            eOp = VectorizedOp::LT;
+        else if (Accept(">"))
+            eOp = VectorizedOp::GT;
+        else
+            break;
+        const int nRight = ParseAdditive();
+        nSlot = Emit(eOp, nSlot, nRight);
+    }
+    return nSlot;
+}
+
+/************************************************************************/
+/*                           ParseAdditive()                            */
+/************************************************************************/
+
+// additive := multiplicative ( ('+' | '-') multiplicative )*
+int VectorizedExpressionCompiler::ParseAdditive()
+{
+    int nSlot = ParseMultiplicative();
+    while (!m_bError)
+    {
+        VectorizedOp eOp;
+        if (Accept("+"))
+            eOp = VectorizedOp::ADD;
+        else if (Accept("-"))
+            eOp = VectorizedOp::SUB;
+        else
+            break;
+        const int nRight = ParseMultiplicative();
+        nSlot = Emit(eOp, nSlot, nRight);
+    }
+    return nSlot;
+}
+
+/************************************************************************/
+/*                        ParseMultiplicative()                         */
+/************************************************************************/
+
+// multiplicative := unary ( ('*' | '/') unary )*
+int VectorizedExpressionCompiler::ParseMultiplicative()
+{
+    bool bIsPower = false;
+    int nSlot = ParseUnary(bIsPower);
+    while (!m_bError)
+    {
+        VectorizedOp eOp;
+        if (Accept("*"))
+            eOp = VectorizedOp::MUL;
+        else if (Accept("/"))
+            eOp = VectorizedOp::DIV;
+        else
+            break;
+        const int nRight = ParseUnary(bIsPower);
+        nSlot = Emit(eOp, nSlot, nRight);
+    }
+    return nSlot;
+}
+
+/************************************************************************/
+/*                             ParseUnary()                             */
+/************************************************************************/
+
+// unary := ('-' | '+') unary | power
+int VectorizedExpressionCompiler::ParseUnary(bool &bIsPower)
+{
+    if (++m_nDepth > MAX_DEPTH)
+        return Fail();
+    int nSlot;
+    const bool bNegate = Accept("-");
+    if (bNegate || Accept("+"))
+    {
+        // The relative precedence of the sign operator and of the power
+        // operator has changed across muparser versions, so leave
+        // expressions like -A^2 to muparser.
+        bool bOperandIsPower = false;
+        nSlot = ParseUnary(bOperandIsPower);
+        if (m_bError || bOperandIsPower)
+            return Fail();
+        if (bNegate)
+            nSlot = Emit(VectorizedOp::NEG, nSlot);
+    }
+    else
+    {
+        nSlot = ParsePower(bIsPower);
+    }
+    --m_nDepth;
+    return nSlot;
+}
+
+/************************************************************************/
+/*                             ParsePower()                             */
+/************************************************************************/
+
+// power := primary ( '^' primary )?
+int VectorizedExpressionCompiler::ParsePower(bool &bIsPower)
+{
+    bool bIsVariable = false;
+    const int nBase = ParsePrimary(bIsVariable);
+    if (m_bError || !Accept("^"))
+        return nBase;
+    bIsPower = true;
+
+    // Same as in ParseUnary() for a sign in the exponent. The associativity
+    // of the power operator has also changed across muparser versions.
+    const size_t nPosBeforeExponent = m_nPos;
+    SkipSpaces();
+    if (m_nPos < m_osExpression.size() &&
+        (m_osExpression[m_nPos] == '-' || m_osExpression[m_nPos] == '+'))
+    {
+        return Fail();
+    }
+    m_nPos = nPosBeforeExponent;
+    bool bExponentIsPower = false;
+    const int nExponent = ParsePower(bExponentIsPower);
+    if (m_bError || bExponentIsPower)
+        return Fail();
+
+    // muparser optimizes integer powers 2, 3 and 4 of variables as
+    // multiplications.
+    if (bIsVariable && IsConstSlot(nExponent) && !IsTempSlot(nExponent))
+    {
+        const double dfExponent =
+            m_adfConstants[nExponent - NumVariables()];
+        if (dfExponent == 2)
+            return Emit(VectorizedOp::POW2, nBase);
+        if (dfExponent == 3)
+            return Emit(VectorizedOp::POW3, nBase);
+        if (dfExponent == 4)
+            return Emit(VectorizedOp::POW4, nBase);
+    }
+    return Emit(VectorizedOp::POW, nBase, nExponent);
+}
+
+/************************************************************************/
+/*                            ParsePrimary()                            */
+/************************************************************************/
+
+// primary := number | constant | variable | function '(' args ')'
+//            | '(' ternary ')'
+int VectorizedExpressionCompiler::ParsePrimary(bool &bIsVariable)
+{
+    SkipSpaces();
+    if (m_nPos >= m_osExpression.size())
+        return Fail();
+
+    const char chFirst = m_osExpression[m_nPos];
+    if (chFirst == '(')
+    {
+        ++m_nPos;
+        const int nSlot = ParseTernary();
+        if (m_bError || !Accept(")"))
+            return Fail();
+        return nSlot;
+    }
+
+    if (std::isdigit(static_cast<unsigned char>(chFirst)) || chFirst == '.')
+    {
+        // Do not let strtod() parse hexadecimal or special values
+        const auto IsDigitAt = [this](size_t nIdx)
+        {
+            return nIdx < m_osExpression.size() &&
+                   std::isdigit(
+                       static_cast<unsigned char>(m_osExpression[nIdx]));
+        };
+        size_t nEnd = m_nPos;
+        while (IsDigitAt(nEnd) ||
+               (nEnd < m_osExpression.size() && m_osExpression[nEnd] == '.'))
+        {
+            ++nEnd;
+        }
+        if (nEnd < m_osExpression.size() &&
+            (m_osExpression[nEnd] == 'e' || m_osExpression[nEnd] == 'E'))
+        {
+            ++nEnd;
+            if (nEnd < m_osExpression.size() &&
+                (m_osExpression[nEnd] == '-' || m_osExpression[nEnd] == '+'))
+                ++nEnd;
+            while (IsDigitAt(nEnd))
+                ++nEnd;
+        }
+        const std::string osNumber(
+            m_osExpression.substr(m_nPos, nEnd - m_nPos));
+        char *pszEnd = nullptr;
+        const double dfVal = CPLStrtod(osNumber.c_str(), &pszEnd);
+        if (pszEnd != osNumber.c_str() + osNumber.size() ||
+            (nEnd < m_osExpression.size() &&
+             (std::isalpha(static_cast<unsigned char>(m_osExpression[nEnd])) ||
+              m_osExpression[nEnd] == '_')))
+        {
+            return Fail();
+        }
+        m_nPos = nEnd;
+        return AddConstant(dfVal);
+    }
+
+    if (!std::isalpha(static_cast<unsigned char>(chFirst)) && chFirst != '_')
+        return Fail();
+
+    size_t nEnd = m_nPos;
+    while (nEnd < m_osExpression.size() &&
+           (std::isalnum(static_cast<unsigned char>(m_osExpression[nEnd])) ||
+            m_osExpression[nEnd] == '_'))
+    {
+        ++nEnd;
+    }
+    // Variable names such as X[1]
+    if (nEnd < m_osExpression.size() && m_osExpression[nEnd] == '[')
+    {
+        const size_t nClose = m_osExpression.find(']', nEnd);
+        if (nClose == std::string_view::npos)
+            return Fail();
+        nEnd = nClose + 1;
+    }
+    const std::string osName(m_osExpression.substr(m_nPos, nEnd - m_nPos));
+    m_nPos = nEnd;
+
+    if (Accept("("))
+        return ParseFunction(osName);
+
+    const auto oIter =
+        std::find(m_aosVariables.begin(), m_aosVariables.end(), osName);
+    if (oIter != m_aosVariables.end())
+    {
+        bIsVariable = true;
+        return static_cast<int>(oIter - m_aosVariables.begin());
+    }
+    if (osName == "NODATA" && m_pdfNoData)
+        return AddConstant(*m_pdfNoData);
+    if (osName == "nan" || osName == "NaN")
+        return AddConstant(std::numeric_limits<double>::quiet_NaN());
+    if (osName == "_pi")
+        return AddConstant(M_PI);
+    if (osName == "_e")
+        return AddConstant(M_E);
+    return Fail();
+}
+
+/************************************************************************/
+/*                           ParseFunction()                            */
+/************************************************************************/
+
+// Parse the arguments of a function call, whose opening parenthesis has
+// already been consumed.
+int VectorizedExpressionCompiler::ParseFunction(const std::string &osName)
+{
+    if (osName == "min" || osName == "max")
+    {
+        // muparser computes std::min/std::max() from the first argument on
+        const VectorizedOp eOp =
+            osName == "min" ? VectorizedOp::MIN : VectorizedOp::MAX;
+        int nSlot = ParseTernary();
+        while (!m_bError && Accept(","))
+        {
+            const int nArg = ParseTernary();
+            if (m_bError)
+                return Fail();
+            nSlot = Emit(eOp, nSlot, nArg);
+        }
+        if (m_bError || !Accept(")"))
+            return Fail();
+        return nSlot;
+    }
+
+    if (osName == "fmod")
+    {
+        const int nX = ParseTernary();
+        if (m_bError || !Accept(","))
+            return Fail();
+        const int nY = ParseTernary();
+        if (m_bError || !Accept(")"))
+            return Fail();
+        return Emit(VectorizedOp::FMOD, nX, nY);
+    }
+
+    const int nArg = ParseTernary();
+    if (m_bError || !Accept(")"))
+        return Fail();
+    if (osName == "isnan")
+        return Emit(VectorizedOp::ISNAN, nArg);
+    if (osName == "isnodata")
+    {
+        // Without NODATA, GDAL binds isnodata() to a function returning 0
+        if (!m_pdfNoData)
+        {
+            Release(nArg);
+            return AddConstant(0);
+        }
+        return Emit(VectorizedOp::ISNODATA, nArg);
+    }
+
+    const auto &oMapFunctions = GetUnaryFunctions();
+    const auto oIter = oMapFunctions.find(osName);
+    if (oIter == oMapFunctions.end())
+        return Fail();
+    return Emit(VectorizedOp::UNARY_FUNC, nArg, 0, 0, oIter->second);
+}
+
+/************************************************************************/
+/*                           Apply*() helpers                           */
+/************************************************************************/
+
+template <class SIMDFunc, class ScalarFunc>
+void ApplyUnary(const double *padfA, double *padfRes, int n,
+                [[maybe_unused]] SIMDFunc simdFunc, ScalarFunc scalarFunc)
+{
+    int i = 0;
+#ifdef USE_SSE2
+    for (; i + 1 < n; i += 2)
+    {
+        simdFunc(XMMReg2Double::Load2Val(padfA + i)).Store2Val(padfRes + i);
+    }
+#endif
+    for (; i < n; ++i)
+        padfRes[i] = scalarFunc(padfA[i]);
+}
+
+template <class SIMDFunc, class ScalarFunc>
+void ApplyBinary(const double *padfA, const double *padfB, double *padfRes,
+                 int n, [[maybe_unused]] SIMDFunc simdFunc,
+                 ScalarFunc scalarFunc)
+{
+    int i = 0;
+#ifdef USE_SSE2
+    for (; i + 1 < n; i += 2)
+    {
+        simdFunc(XMMReg2Double::Load2Val(padfA + i),
+                 XMMReg2Double::Load2Val(padfB + i))
+            .Store2Val(padfRes + i);
+    }
+#endif
+    for (; i < n; ++i)
+        padfRes[i] = scalarFunc(padfA[i], padfB[i]);
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                 VectorizedMuParserExpression::Impl                   */
+/************************************************************************/
+
+class VectorizedMuParserExpression::Impl
+{
+  public:
+    // Number of values processed by each instruction at once
+    static constexpr int BLOCK_SIZE = 256;
+
+    int m_nVariables = 0;
+    double m_dfNoData = 0;
+    std::vector<VectorizedInstruction> m_asInstructions{};
+    int m_nResult = 0;
+
+    // BLOCK_SIZE values for each constant, and then each temporary
+    std::vector<double> m_adfStorage{};
+
+    // Pointers to the current block of values of each slot
+    std::vector<const double *> m_apdfSlots{};
+
+    double *GetTemporary(int nSlot)
+    {
+        return m_adfStorage.data() +
+               static_cast<size_t>(nSlot - m_nVariables) * BLOCK_SIZE;
+    }
+
+    void Execute(const VectorizedInstruction &sInstr, int n);
+};
+
+/************************************************************************/
+/*                               Execute()                              */
+/************************************************************************/
+
+void VectorizedMuParserExpression::Impl::Execute(
+    const VectorizedInstruction &sInstr, int n)
+{
+    const double *padfA = m_apdfSlots[sInstr.nSrc1];
+    const double *padfB = m_apdfSlots[sInstr.nSrc2];
+    double *padfRes = GetTemporary(sInstr.nDst);
+
+#ifdef USE_SSE2
+    const auto zero = XMMReg2Double::Zero();
+    const auto one = XMMReg2Double::Set1(1.0);
+    const auto allOnes = XMMReg2Double::Equals(zero, zero);
+#define SIMD_UNARY(expr) [&](const XMMReg2Double &a) { return (expr); }
+#define SIMD_BINARY(expr)                                                      \
+    [&](const XMMReg2Double &a, const XMMReg2Double &b) { return (expr); }
+#else
+#define SIMD_UNARY(expr) nullptr
+#define SIMD_BINARY(expr) nullptr
+#endif
+
+    switch (sInstr.eOp)
+    {
+        case VectorizedOp::ADD:
+            ApplyBinary(
+                padfA, padfB, padfRes, n, SIMD_BINARY(a + b),
+                [](double a, double b) { return a + b; });
+            break;
+
+        case VectorizedOp::SUB:
+            ApplyBinary(
+                padfA, padfB, padfRes, n, SIMD_BINARY(a - b),
+                [](double a, double b) { return a - b; });
+            break;
+
+        case VectorizedOp::MUL:
+            ApplyBinary(
+                padfA, padfB, padfRes, n, SIMD_BINARY(a * b),
+                [](double a, double b) { return a * b; });
+            break;
+
+        case VectorizedOp::DIV:
+            ApplyBinary(
+                padfA, padfB, padfRes, n, SIMD_BINARY(a / b),
+                [](double a, double b) { return a / b; });
+            break;
+
+        case VectorizedOp::NEG:
+            ApplyUnary(padfA, padfRes, n,
+                       SIMD_UNARY(a * XMMReg2Double::Set1(-1.0)),
+                       [](double a) { return -a; });
+            break;
+
+        case VectorizedOp::EQ:
+            ApplyBinary(padfA, padfB, padfRes, n,
+                        SIMD_BINARY(XMMReg2Double::And(
+                            XMMReg2Double::Equals(a, b), one)),
+                        [](double a, double b) { return a == b ? 1.0 : 0.0; });
+            break;
+
+        case VectorizedOp::NE:
+            ApplyBinary(padfA, padfB, padfRes, n,
+                        SIMD_BINARY(XMMReg2Double::And(
+                            XMMReg2Double::NotEquals(a, b), one)),
+                        [](double a, double b) { return a != b ? 1.0 : 0.0; });
+            break;
+
+        case VectorizedOp::LT:
+            ApplyBinary(padfA, padfB, padfRes, n,
+                        SIMD_BINARY(XMMReg2Double::And(
+                            XMMReg2Double::Greater(b, a), one)),
+                        [](double a, double b) { return a < b ? 1.0 : 0.0; });
+            break;
+
+        case VectorizedOp::LE:
+            ApplyBinary(
+                padfA, padfB, padfRes, n,
+                SIMD_BINARY(XMMReg2Double::And(
+                    XMMReg2Double::Ternary(XMMReg2Double::Equals(a, b),
+                                           allOnes,
+                                           XMMReg2Double::Greater(b, a)),
+                    one)),
+                [](double a, double b) { return a <= b ? 1.0 : 0.0; });
+            break;
+
+        case VectorizedOp::GT:
+            ApplyBinary(padfA, padfB, padfRes, n,
+                        SIMD_BINARY(XMMReg2Double::And(
+                            XMMReg2Double::Greater(a, b), one)),
+                        [](double a, double b) { return a > b ? 1.0 : 0.0; });
+            break;
+
+        case VectorizedOp::GE:
+            ApplyBinary(
+                padfA, padfB, padfRes, n,
+                SIMD_BINARY(XMMReg2Double::And(
+                    XMMReg2Double::Ternary(XMMReg2Double::Equals(a, b),
+                                           allOnes,
+                                           XMMReg2Double::Greater(a, b)),
+                    one)),
+                [](double a, double b) { return a >= b ? 1.0 : 0.0; });
+            break;
+
+        case VectorizedOp::AND:
+            ApplyBinary(padfA, padfB, padfRes, n,
+                        SIMD_BINARY(XMMReg2Double::And(
+                            XMMReg2Double::And(
+                                XMMReg2Double::NotEquals(a, zero),
+                                XMMReg2Double::NotEquals(b, zero)),
+                            one)),
+                        [](double a, double b)
+                        { return a != 0 && b != 0 ? 1.0 : 0.0; });
+            break;
+
+        case VectorizedOp::OR:
+            ApplyBinary(padfA, padfB, padfRes, n,
+                        SIMD_BINARY(XMMReg2Double::Ternary(
+                            XMMReg2Double::NotEquals(a, zero), one,
+                            XMMReg2Double::And(
+                                XMMReg2Double::NotEquals(b, zero), one))),
+                        [](double a, double b)
+                        { return a != 0 || b != 0 ? 1.0 : 0.0; });
+            break;
+
+        case VectorizedOp::TERNARY:
+        {
+            // muparser considers any non-zero condition, including NaN,
+            // as true.
+            const double *padfC = m_apdfSlots[sInstr.nSrc3];
+            int i = 0;
+#ifdef USE_SSE2
+            for (; i + 1 < n; i += 2)
+            {
+                XMMReg2Double::Ternary(
+                    XMMReg2Double::NotEquals(
+                        XMMReg2Double::Load2Val(padfA + i), zero),
+                    XMMReg2Double::Load2Val(padfB + i),
+                    XMMReg2Double::Load2Val(padfC + i))
+                    .Store2Val(padfRes + i);
+            }
+#endif
+            for (; i < n; ++i)
+                padfRes[i] = padfA[i] != 0 ? padfB[i] : padfC[i];
+            break;
+        }
+
+        case VectorizedOp::MIN:
+            // Same as std::min(a, b) for NaN values
+            ApplyBinary(padfA, padfB, padfRes, n,
+                        SIMD_BINARY(XMMReg2Double::Ternary(
+                            XMMReg2Double::Greater(a, b), b, a)),
+                        [](double a, double b) { return b < a ? b : a; });
+            break;
+
+        case VectorizedOp::MAX:
+            // Same as std::max(a, b) for NaN values
+            ApplyBinary(padfA, padfB, padfRes, n,
+                        SIMD_BINARY(XMMReg2Double::Ternary(
+                            XMMReg2Double::Greater(b, a), b, a)),
+                        [](double a, double b) { return a < b ? b : a; });
+            break;
+
+        case VectorizedOp::POW:
+            for (int i = 0; i < n; ++i)
+                padfRes[i] = std::pow(padfA[i], padfB[i]);
+            break;
+
+        case VectorizedOp::POW2:
+            ApplyUnary(padfA, padfRes, n, SIMD_UNARY(a * a),
+                       [](double a) { return a * a; });
+            break;
+
+        case VectorizedOp::POW3:
+            ApplyUnary(padfA, padfRes, n, SIMD_UNARY(a * a * a),
+                       [](double a) { return a * a * a; });
+            break;
+
+        case VectorizedOp::POW4:
+            ApplyUnary(padfA, padfRes, n, SIMD_UNARY(a * a * a * a),
+                       [](double a) { return a * a * a * a; });
+            break;
+
+        case VectorizedOp::FMOD:
+            for (int i = 0; i < n; ++i)
+                padfRes[i] = std::fmod(padfA[i], padfB[i]);
+            break;
+
+        case VectorizedOp::ISNAN:
+            ApplyUnary(padfA, padfRes, n,
+                       SIMD_UNARY(XMMReg2Double::And(
+                           XMMReg2Double::NotEquals(a, a), one)),
+                       [](double a) { return std::isnan(a) ? 1.0 : 0.0; });
+            break;
+
+        case VectorizedOp::ISNODATA:
+        {
+            const double dfNoData = m_dfNoData;
+            if (std::isnan(dfNoData))
+            {
+                ApplyUnary(padfA, padfRes, n,
+                           SIMD_UNARY(XMMReg2Double::And(
+                               XMMReg2Double::NotEquals(a, a), one)),
+                           [](double a) { return std::isnan(a) ? 1.0 : 0.0; });
+            }
+            else
+            {
+#ifdef USE_SSE2
+                const auto noData = XMMReg2Double::Set1(dfNoData);
+#endif
+                ApplyUnary(padfA, padfRes, n,
+                           SIMD_UNARY(XMMReg2Double::And(
+                               XMMReg2Double::Equals(a, noData), one)),
+                           [dfNoData](double a)
+                           { return a == dfNoData ? 1.0 : 0.0; });
+            }
+            break;
+        }
+
+        case VectorizedOp::UNARY_FUNC:
+        {
+            const auto pfnFunc = sInstr.pfnFunc;
+            for (int i = 0; i < n; ++i)
+                padfRes[i] = pfnFunc(padfA[i]);
+            break;
+        }
+    }
+
+#undef SIMD_UNARY
+#undef SIMD_BINARY
+}
+
+/************************************************************************/
+/*                    VectorizedMuParserExpression()                    */
+/************************************************************************/
+
+VectorizedMuParserExpression::VectorizedMuParserExpression()
+    : m_pImpl{std::make_unique<Impl>()}
+{
+}
+
+VectorizedMuParserExpression::~VectorizedMuParserExpression()
+{
+}
+
+/************************************************************************/
+/*                               Create()                               */
+/************************************************************************/
+
+std::unique_ptr<VectorizedMuParserExpression>
+VectorizedMuParserExpression::Create(
+    std::string_view osExpression,
+    const std::vector<std::string> &aosVariables, const double *pdfNoData)
+{
+    VectorizedExpressionCompiler oCompiler(osExpression, aosVariables,
+                                           pdfNoData);
+    if (!oCompiler.Compile())
+    {
+        CPLDebugOnly("VRT",
+                     "Expression '%s' cannot be vectorized. Using muparser",
+                     std::string(osExpression).c_str());
+        return nullptr;
+    }
+
+    auto poRet = std::unique_ptr<VectorizedMuParserExpression>(
+        new VectorizedMuParserExpression());
+    Impl *psImpl = poRet->m_pImpl.get();
+    psImpl->m_nVariables = static_cast<int>(aosVariables.size());
+    psImpl->m_dfNoData = pdfNoData ? *pdfNoData : 0;
+    psImpl->m_asInstructions = std::move(oCompiler.m_asInstructions);
+    psImpl->m_nResult = oCompiler.m_nResult;
+
+    const int nConstants = static_cast<int>(oCompiler.m_adfConstants.size());
+    const int nSlots =
+        psImpl->m_nVariables + nConstants + oCompiler.m_nTemporaries;
+    psImpl->m_adfStorage.resize(
+        static_cast<size_t>(nConstants + oCompiler.m_nTemporaries) *
+        Impl::BLOCK_SIZE);
+    psImpl->m_apdfSlots.resize(nSlots);
+    for (int i = psImpl->m_nVariables; i < nSlots; ++i)
+        psImpl->m_apdfSlots[i] = psImpl->GetTemporary(i);
+    for (int i = 0; i < nConstants; ++i)
+    {
+        std::fill_n(psImpl->GetTemporary(psImpl->m_nVariables + i),
+                    Impl::BLOCK_SIZE, oCompiler.m_adfConstants[i]);
+    }
+
+    return poRet;
+}
+
+/************************************************************************/
+/*                              Evaluate()                              */
+/************************************************************************/
+
+void VectorizedMuParserExpression::Evaluate(
+    const double *const *papadfVariables, size_t nValues, double *padfResults)
+{
+    Impl *psImpl = m_pImpl.get();
+    for (size_t nOffset = 0; nOffset < nValues; nOffset += Impl::BLOCK_SIZE)
+    {
+        const int n = static_cast<int>(
+            std::min<size_t>(Impl::BLOCK_SIZE, nValues - nOffset));
+        for (int i = 0; i < psImpl->m_nVariables; ++i)
+            psImpl->m_apdfSlots[i] = papadfVariables[i] + nOffset;
+
+        for (const auto &sInstr : psImpl->m_asInstructions)
+            psImpl->Execute(sInstr, n);
+
+        const double *padfResult = psImpl->m_apdfSlots[psImpl->m_nResult];
+        std::copy(padfResult, padfResult + n, padfResults + nOffset);
+    }
+}
+
+/*! @endcond Doxygen_Suppress */
+
+}  // namespace gdal
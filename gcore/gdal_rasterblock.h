@@ -19,12 +19,18 @@
 #include "cpl_atomic_ops.h"
 #include "gdal.h"
 
+#include <atomic>
+
 /* ******************************************************************** */
 /*                           GDALRasterBlock                            */
 /* ******************************************************************** */
 
 class GDALRasterBand;
 
+//! @cond Doxygen_Suppress
+struct GDALRasterBlockCacheShard;
+//! @endcond
+
 /** A single raster block in the block cache.
  *
  * And the global block manager that manages a least-recently-used list of
@@ -53,11 +59,22 @@ class CPL_DLL GDALRasterBlock final
 
     bool bMustDetach = false;
 
+    // Index of the block cache shard this block belongs to
+    int nShard = 0;
+    // Shard epoch when the block was last moved to the head of the LRU list
+    GUIntBig nListEpoch = 0;
+    // Shard epoch when the block was last touched (only used in sharded mode)
+    std::atomic<GUIntBig> nTouchEpoch{0};
+
     CPL_INTERNAL void Detach_unlocked(void);
     CPL_INTERNAL void Touch_unlocked(void);
 
     CPL_INTERNAL void RecycleFor(int nXOffIn, int nYOffIn);
 
+    CPL_INTERNAL static int
+    FlushCacheBlockFromShard(GDALRasterBlockCacheShard *psShard,
+                             int bDirtyBlocksOnly);
+
   public:
     GDALRasterBlock(GDALRasterBand *, int, int);
     GDALRasterBlock(int nXOffIn, int nYOffIn); /* only for lookup purpose */
@@ -37,6 +37,8 @@ CPLWorkerThreadPool *GDALGetGlobalThreadPool(int nThreads)
     if (gpoCompressThreadPool == nullptr)
     {
         gpoCompressThreadPool = new CPLWorkerThreadPool();
+        gpoCompressThreadPool->SetWorkStealing(CPLTestBool(
+            CPLGetConfigOption("GDAL_THREAD_POOL_WORK_STEALING", "NO")));
         if (!gpoCompressThreadPool->Setup(nThreads, nullptr, nullptr, false))
         {
             delete gpoCompressThreadPool;
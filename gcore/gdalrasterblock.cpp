@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <cstdint>
 #include <cstring>
 #include <mutex>
 
@@ -30,21 +31,35 @@
 
 // Will later be overridden by the default 5% if GDAL_CACHEMAX not defined.
 static GIntBig nCacheMax = 40 * 1024 * 1024;
-static GIntBig nCacheUsed = 0;
 
-static GDALRasterBlock *poOldest = nullptr;  // Tail.
-static GDALRasterBlock *poNewest = nullptr;  // Head.
+// The global block cache is made of one or several shards, each with its
+// own lock, LRU list and byte counter. By default there is a single shard.
+// When GDAL_BLOCK_CACHE_SHARDS is greater than 1, a block is assigned to a
+// shard from a hash of its band and offsets, each shard is bounded by
+// GDAL_CACHEMAX / shard_count (so the global limit is only approximately
+// honoured), and Touch() no longer reorders the LRU list: it just records the
+// current shard epoch in the block. Blocks touched since they were put at the
+// head of the list are given a second chance when looking for eviction
+// candidates.
+struct alignas(64) GDALRasterBlockCacheShard
+{
+    CPLLock *hLock = nullptr;
+    GIntBig nCacheUsed = 0;
 
-static int nDisableDirtyBlockFlushCounter = 0;
+    GDALRasterBlock *poOldest = nullptr;  // Tail.
+    GDALRasterBlock *poNewest = nullptr;  // Head.
 
-#if 0
-static CPLMutex *hRBLock = nullptr;
-#define INITIALIZE_LOCK CPLMutexHolderD(&hRBLock)
-#define TAKE_LOCK CPLMutexHolderOptionalLockD(hRBLock)
-#define DESTROY_LOCK CPLDestroyMutex(hRBLock)
-#else
+    // Incremented (under hLock) each time a block is moved to the head.
+    std::atomic<GUIntBig> nEpoch{1};
+};
+
+constexpr int MAX_SHARD_COUNT = 64;
+static GDALRasterBlockCacheShard asShards[MAX_SHARD_COUNT];
+static std::atomic<int> nShardCount{1};
+static std::atomic<int> nNextFlushShard{0};
+
+static int nDisableDirtyBlockFlushCounter = 0;
 
-static CPLLock *hRBLock = nullptr;
 static bool bDebugContention = false;
 static bool bSleepsForBockCacheDebug = false;
 
@@ -75,13 +90,74 @@ static CPLLockType GetLockType()
     return static_cast<CPLLockType>(nLockType);
 }
 
-#define INITIALIZE_LOCK                                                        \
-    CPLLockHolderD(&hRBLock, GetLockType());                                   \
-    CPLLockSetDebugPerf(hRBLock, bDebugContention)
-#define TAKE_LOCK CPLLockHolderOptionalLockD(hRBLock)
-#define DESTROY_LOCK CPLDestroyLock(hRBLock)
+#define INITIALIZE_LOCK(psShard)                                               \
+    CPLLockHolderD(&((psShard)->hLock), GetLockType());                        \
+    CPLLockSetDebugPerf((psShard)->hLock, bDebugContention)
+#define TAKE_LOCK(psShard) CPLLockHolderOptionalLockD((psShard)->hLock)
+#define DESTROY_LOCK(psShard) CPLDestroyLock((psShard)->hLock)
 
-#endif
+/************************************************************************/
+/*                          InitializeLocks()                           */
+/************************************************************************/
+
+static void InitializeLocks()
+{
+    const int nShards = nShardCount.load();
+    for (int i = 0; i < nShards; ++i)
+    {
+        INITIALIZE_LOCK(&asShards[i]);
+    }
+}
+
+/************************************************************************/
+/*                      GetShardCountFromConfig()                       */
+/************************************************************************/
+
+static int GetShardCountFromConfig(GIntBig nCacheMaxIn)
+{
+    const char *pszShards = CPLGetConfigOption("GDAL_BLOCK_CACHE_SHARDS", "1");
+    int nShards;
+    if (EQUAL(pszShards, "AUTO"))
+    {
+        // Largest power of two not greater than the number of CPUs, while
+        // keeping at least 8 MB per shard.
+        const int nCPUs = std::min(CPLGetNumCPUs(), MAX_SHARD_COUNT);
+        nShards = 1;
+        while (nShards * 2 <= nCPUs &&
+               nCacheMaxIn / (nShards * 2) >= 8 * 1024 * 1024)
+        {
+            nShards *= 2;
+        }
+    }
+    else
+    {
+        nShards = atoi(pszShards);
+        if (nShards < 1 || nShards > MAX_SHARD_COUNT)
+        {
+            CPLError(CE_Warning, CPLE_IllegalArg,
+                     "Invalid value for GDAL_BLOCK_CACHE_SHARDS: %s. "
+                     "Should be AUTO or between 1 and %d. Using 1",
+                     pszShards, MAX_SHARD_COUNT);
+            nShards = 1;
+        }
+    }
+    return nShards;
+}
+
+/************************************************************************/
+/*                           GetShardIndex()                            */
+/************************************************************************/
+
+static int GetShardIndex(const GDALRasterBand *poBand, int nXOff, int nYOff)
+{
+    GUIntBig nHash = static_cast<GUIntBig>(reinterpret_cast<uintptr_t>(poBand));
+    nHash = nHash * 31 + static_cast<unsigned>(nXOff);
+    nHash = nHash * 31 + static_cast<unsigned>(nYOff);
+    // Fibonacci hashing to spread consecutive block offsets
+    nHash *= UINT64_C(0x9E3779B97F4A7C15);
+    return static_cast<int>((nHash >> 32) %
+                            static_cast<unsigned>(nShardCount.load()));
+}
 
 // #define ENABLE_DEBUG
 
@@ -145,13 +221,13 @@ void CPL_STDCALL GDALSetCacheMax64(GIntBig nNewSizeInBytes)
     /*      Flush blocks till we are under the new limit or till we         */
     /*      can't seem to flush anymore.                                    */
     /* -------------------------------------------------------------------- */
-    while (nCacheUsed > nCacheMax)
+    while (GDALGetCacheUsed64() > nCacheMax)
     {
-        const GIntBig nOldCacheUsed = nCacheUsed;
+        const GIntBig nOldCacheUsed = GDALGetCacheUsed64();
 
         GDALFlushCacheBlock();
 
-        if (nCacheUsed == nOldCacheUsed)
+        if (GDALGetCacheUsed64() == nOldCacheUsed)
             break;
     }
 }
@@ -220,7 +296,7 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
         []()
         {
             {
-                INITIALIZE_LOCK;
+                INITIALIZE_LOCK(&asShards[0]);
             }
             bSleepsForBockCacheDebug =
                 CPLTestBool(CPLGetConfigOption("GDAL_DEBUG_BLOCK_CACHE", "NO"));
@@ -252,6 +328,14 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
             nCacheMax = nNewCacheMax;
             CPLDebug("GDAL", "GDAL_CACHEMAX = " CPL_FRMT_GIB " MB",
                      nCacheMax / (1024 * 1024));
+
+            const int nShards = GetShardCountFromConfig(nCacheMax);
+            if (nShards > 1)
+            {
+                CPLDebug("GDAL", "Using %d block cache shards", nShards);
+                nShardCount = nShards;
+                InitializeLocks();
+            }
         });
 
     return nCacheMax;
@@ -270,6 +354,7 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
 
 int CPL_STDCALL GDALGetCacheUsed()
 {
+    const GIntBig nCacheUsed = GDALGetCacheUsed64();
     if (nCacheUsed > INT_MAX)
     {
         CPLErrorOnce(CE_Warning, CPLE_AppDefined,
@@ -287,6 +372,11 @@ int CPL_STDCALL GDALGetCacheUsed()
 /**
  * \brief Get cache memory used.
  *
+ * When the block cache is sharded (GDAL_BLOCK_CACHE_SHARDS > 1), the value
+ * is the sum of the per-shard counters, which are read without taking
+ * the shard locks, and is thus only approximate while other threads are
+ * using the cache.
+ *
  * @return the number of bytes of memory currently in use by the
  * GDALRasterBlock memory caching.
  *
@@ -294,6 +384,10 @@ int CPL_STDCALL GDALGetCacheUsed()
 
 GIntBig CPL_STDCALL GDALGetCacheUsed64()
 {
+    const int nShards = nShardCount.load();
+    GIntBig nCacheUsed = 0;
+    for (int i = 0; i < nShards; ++i)
+        nCacheUsed += asShards[i].nCacheUsed;
     return nCacheUsed;
 }
 
@@ -373,12 +467,31 @@ int CPL_STDCALL GDALFlushCacheBlock()
 
 int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
 
+{
+    const int nShards = nShardCount.load();
+    if (nShards == 1)
+        return FlushCacheBlockFromShard(&asShards[0], bDirtyBlocksOnly);
+
+    // Rotate the starting shard so that repeated calls spread evictions.
+    const int nStart = nNextFlushShard++ % nShards;
+    for (int i = 0; i < nShards; ++i)
+    {
+        if (FlushCacheBlockFromShard(&asShards[(nStart + i) % nShards],
+                                     bDirtyBlocksOnly))
+            return TRUE;
+    }
+    return FALSE;
+}
+
+int GDALRasterBlock::FlushCacheBlockFromShard(
+    GDALRasterBlockCacheShard *psShard, int bDirtyBlocksOnly)
+
 {
     GDALRasterBlock *poTarget;
 
     {
-        INITIALIZE_LOCK;
-        poTarget = poOldest;
+        INITIALIZE_LOCK(psShard);
+        poTarget = psShard->poOldest;
 
         while (poTarget != nullptr)
         {
@@ -529,11 +642,11 @@ GDALRasterBlock::GDALRasterBlock(GDALRasterBand *poBandIn, int nXOffIn,
     : eType(poBandIn->GetRasterDataType()), nXOff(nXOffIn), nYOff(nYOffIn),
       poBand(poBandIn), bMustDetach(true)
 {
-    if (!hRBLock)
+    if (!asShards[0].hLock)
     {
         // Needed for scenarios where GDALAllRegister() is called after
         // GDALDestroyDriverManager()
-        INITIALIZE_LOCK;
+        InitializeLocks();
     }
 
     CPLAssert(poBandIn != nullptr);
@@ -583,6 +696,10 @@ void GDALRasterBlock::RecycleFor(int nXOffIn, int nYOffIn)
     poNext = nullptr;
     poPrevious = nullptr;
 
+    nShard = 0;
+    nListEpoch = 0;
+    nTouchEpoch = 0;
+
     nXOff = nXOffIn;
     nYOff = nYOffIn;
     bMustDetach = true;
@@ -648,19 +765,21 @@ void GDALRasterBlock::Detach()
 {
     if (bMustDetach)
     {
-        TAKE_LOCK;
+        TAKE_LOCK(&asShards[nShard]);
         Detach_unlocked();
     }
 }
 
 void GDALRasterBlock::Detach_unlocked()
 {
-    if (poOldest == this)
-        poOldest = poPrevious;
+    GDALRasterBlockCacheShard *psShard = &asShards[nShard];
 
-    if (poNewest == this)
+    if (psShard->poOldest == this)
+        psShard->poOldest = poPrevious;
+
+    if (psShard->poNewest == this)
     {
-        poNewest = poNext;
+        psShard->poNewest = poNext;
     }
 
     if (poPrevious != nullptr)
@@ -674,7 +793,7 @@ void GDALRasterBlock::Detach_unlocked()
     bMustDetach = false;
 
     if (pData)
-        nCacheUsed -= GetEffectiveBlockSize(GetBlockSize());
+        psShard->nCacheUsed -= GetEffectiveBlockSize(GetBlockSize());
 
 #ifdef ENABLE_DEBUG
     Verify();
@@ -694,26 +813,34 @@ void GDALRasterBlock::Detach_unlocked()
 void GDALRasterBlock::Verify()
 
 {
-    TAKE_LOCK;
-
-    CPLAssert((poNewest == nullptr && poOldest == nullptr) ||
-              (poNewest != nullptr && poOldest != nullptr));
-
-    if (poNewest != nullptr)
+    const int nShards = nShardCount.load();
+    for (int i = 0; i < nShards; ++i)
     {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        CPLAssert(poOldest->poNext == nullptr);
+        GDALRasterBlockCacheShard *psShard = &asShards[i];
+        TAKE_LOCK(psShard);
 
-        GDALRasterBlock *poLast = nullptr;
-        for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
-             poBlock = poBlock->poNext)
+        GDALRasterBlock *poNewest = psShard->poNewest;
+        GDALRasterBlock *poOldest = psShard->poOldest;
+        CPLAssert((poNewest == nullptr && poOldest == nullptr) ||
+                  (poNewest != nullptr && poOldest != nullptr));
+
+        if (poNewest != nullptr)
         {
-            CPLAssert(poBlock->poPrevious == poLast);
+            CPLAssert(poNewest->poPrevious == nullptr);
+            CPLAssert(poOldest->poNext == nullptr);
 
-            poLast = poBlock;
-        }
+            GDALRasterBlock *poLast = nullptr;
+            for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
+                 poBlock = poBlock->poNext)
+            {
+                CPLAssert(poBlock->poPrevious == poLast);
+                CPLAssert(poBlock->nShard == i);
+
+                poLast = poBlock;
+            }
 
-        CPLAssert(poOldest == poLast);
+            CPLAssert(poOldest == poLast);
+        }
     }
 }
 
@@ -726,8 +853,8 @@ void GDALRasterBlock::Verify()
 #ifdef notdef
 void GDALRasterBlock::CheckNonOrphanedBlocks(GDALRasterBand *poBand)
 {
-    TAKE_LOCK;
-    for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
+    TAKE_LOCK(&asShards[0]);
+    for (GDALRasterBlock *poBlock = asShards[0].poNewest; poBlock != nullptr;
          poBlock = poBlock->poNext)
     {
         if (poBlock->GetBand() == poBand)
@@ -795,28 +922,53 @@ CPLErr GDALRasterBlock::Write()
  *
  * This method is normally called when a block is used to keep track
  * that it has been recently used.
+ *
+ * When the block cache is sharded, this does not take any lock: the block
+ * is only marked as touched, and will be moved to the top of the LRU list
+ * of its shard when it is considered for eviction.
  */
 
 void GDALRasterBlock::Touch()
 
 {
+    if (nShardCount.load(std::memory_order_relaxed) > 1)
+    {
+        const GUIntBig nEpoch =
+            asShards[nShard].nEpoch.load(std::memory_order_relaxed);
+        // Avoid dirtying the cache line if nothing changed.
+        if (nTouchEpoch.load(std::memory_order_relaxed) != nEpoch)
+            nTouchEpoch.store(nEpoch, std::memory_order_relaxed);
+        return;
+    }
+
     // Can be safely tested outside the lock
-    if (poNewest == this)
+    if (asShards[0].poNewest == this)
         return;
 
-    TAKE_LOCK;
+    TAKE_LOCK(&asShards[0]);
     Touch_unlocked();
 }
 
 void GDALRasterBlock::Touch_unlocked()
 
 {
+    GDALRasterBlockCacheShard *psShard = &asShards[nShard];
+
+    if (nShardCount.load(std::memory_order_relaxed) > 1)
+    {
+        // Record the position in the LRU list, so that Touch() calls
+        // happening after can be detected.
+        nListEpoch = psShard->nEpoch.fetch_add(1, std::memory_order_relaxed);
+    }
+
     // Could happen even if tested in Touch() before taking the lock
     // Scenario would be :
     // 0. this is the second block (the one pointed by poNewest->poNext)
     // 1. Thread 1 calls Touch() and poNewest != this at that point
     // 2. Thread 2 detaches poNewest
     // 3. Thread 1 arrives here
+    GDALRasterBlock *&poNewest = psShard->poNewest;
+    GDALRasterBlock *&poOldest = psShard->poOldest;
     if (poNewest == this)
         return;
 
@@ -875,10 +1027,18 @@ CPLErr GDALRasterBlock::Internalize()
 
     void *pNewData = nullptr;
 
-    // This call will initialize the hRBLock mutex. Other call places can
+    // This call will initialize the block cache locks. Other call places can
     // only be called if we have go through there.
     const GIntBig nCurCacheMax = GDALGetCacheMax64();
 
+    const int nShards = nShardCount.load();
+    const bool bSharded = nShards > 1;
+    if (bSharded)
+        nShard = GetShardIndex(poBand, nXOff, nYOff);
+    GDALRasterBlockCacheShard *psShard = &asShards[nShard];
+    const GIntBig nShardCacheMax = nCurCacheMax / nShards;
+    GIntBig &nCacheUsed = psShard->nCacheUsed;
+
     // No risk of overflow as it is checked in GDALRasterBand::InitBlockInfo().
     const auto nSizeInBytes = GetBlockSize();
 
@@ -894,12 +1054,17 @@ CPLErr GDALRasterBlock::Internalize()
         GDALRasterBlock *apoBlocksToFree[64] = {nullptr};
         int nBlocksToFree = 0;
         {
-            TAKE_LOCK;
+            TAKE_LOCK(psShard);
 
             if (bFirstIter)
                 nCacheUsed += GetEffectiveBlockSize(nSizeInBytes);
-            GDALRasterBlock *poTarget = poOldest;
-            while (nCacheUsed > nCurCacheMax)
+            GDALRasterBlock *poTarget = psShard->poOldest;
+            // Bound the number of second chances, so that blocks touched
+            // concurrently cannot prevent eviction. Beyond that, blocks are
+            // evicted in strict LRU order.
+            constexpr int MAX_SECOND_CHANCES = 64;
+            int nSecondChances = 0;
+            while (nCacheUsed > nShardCacheMax)
             {
                 GDALRasterBlock *poDirtyBlockOtherDataset = nullptr;
                 // In this first pass, only discard dirty blocks of this
@@ -913,6 +1078,18 @@ CPLErr GDALRasterBlock::Internalize()
                 //    so gets the old value.
                 while (poTarget != nullptr)
                 {
+                    if (bSharded && nSecondChances < MAX_SECOND_CHANCES &&
+                        poTarget->nTouchEpoch.load(std::memory_order_relaxed) >
+                            poTarget->nListEpoch)
+                    {
+                        // Touched since last put at the head of the list:
+                        // give it a second chance.
+                        ++nSecondChances;
+                        GDALRasterBlock *poPrev = poTarget->poPrevious;
+                        poTarget->Touch_unlocked();
+                        poTarget = poPrev;
+                        continue;
+                    }
                     if (!poTarget->GetDirty())
                     {
                         if (CPLAtomicCompareAndExchange(&(poTarget->nLockCount),
@@ -945,7 +1122,7 @@ CPLErr GDALRasterBlock::Internalize()
                     }
                     else
                     {
-                        poTarget = poOldest;
+                        poTarget = psShard->poOldest;
                         while (poTarget != nullptr)
                         {
                             if (CPLAtomicCompareAndExchange(
@@ -986,12 +1163,12 @@ CPLErr GDALRasterBlock::Internalize()
                         // Only free one dirty block at a time so that
                         // other dirty blocks of other bands with the same
                         // coordinates can be found with TryGetLockedBlock()
-                        bLoopAgain = nCacheUsed > nCurCacheMax;
+                        bLoopAgain = nCacheUsed > nShardCacheMax;
                         break;
                     }
                     if (nBlocksToFree == 64)
                     {
-                        bLoopAgain = (nCacheUsed > nCurCacheMax);
+                        bLoopAgain = (nCacheUsed > nShardCacheMax);
                         break;
                     }
 
@@ -1120,9 +1297,12 @@ void GDALRasterBlock::MarkClean()
 /*! @cond Doxygen_Suppress */
 void GDALRasterBlock::DestroyRBMutex()
 {
-    if (hRBLock != nullptr)
-        DESTROY_LOCK;
-    hRBLock = nullptr;
+    for (auto &sShard : asShards)
+    {
+        if (sShard.hLock != nullptr)
+            DESTROY_LOCK(&sShard);
+        sShard.hLock = nullptr;
+    }
 }
 
 /*! @endcond */
@@ -1205,7 +1385,7 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 #endif
 
     // Wait for the block for having been unreferenced.
-    TAKE_LOCK;
+    TAKE_LOCK(&asShards[nShard]);
 
     return FALSE;
 }
@@ -1214,7 +1394,7 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 void GDALRasterBlock::DumpAll()
 {
     int iBlock = 0;
-    for( GDALRasterBlock *poBlock = poNewest;
+    for( GDALRasterBlock *poBlock = asShards[0].poNewest;
          poBlock != nullptr;
          poBlock = poBlock->poNext )
     {
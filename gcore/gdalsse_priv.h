@@ -212,6 +212,13 @@ class XMMReg4Float
         return reg;
     }
 
+    static inline XMMReg4Float Sqrt(const XMMReg4Float &expr)
+    {
+        XMMReg4Float reg;
+        reg.xmm = _mm_sqrt_ps(expr.xmm);
+        return reg;
+    }
+
     inline void nsLoad4Val(const float *ptr)
     {
         xmm = _mm_loadu_ps(ptr);
@@ -1829,6 +1836,13 @@ class XMMReg8Float
         return reg;
     }
 
+    static inline XMMReg8Float Sqrt(const XMMReg8Float &expr)
+    {
+        XMMReg8Float reg;
+        reg.ymm = _mm256_sqrt_ps(expr.ymm);
+        return reg;
+    }
+
     inline void nsLoad8Val(const float *ptr)
     {
         ymm = _mm256_loadu_ps(ptr);
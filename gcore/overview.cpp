@@ -5555,6 +5555,14 @@ CPLErr GDALRegenerateOverviewsEx(GDALRasterBandH hSrcBand, int nOverviewCount,
  * to "ALL_CPUS" or a integer value to specify the number of threads to use for
  * overview computation.
  *
+ * Starting with GDAL 3.13, when several threads are used, the overview levels
+ * are generated concurrently: a chunk of a level is computed as soon as the
+ * rows of the previous level it depends on have been written. The block rows
+ * of each level are handed to the driver as soon as they are complete, so
+ * with formats that store overviews in the same file, such as internal
+ * GeoTIFF overviews, the blocks of the different levels end up interleaved
+ * in the file, instead of each level being stored contiguously.
+ *
  * @param nBands the number of bands, size of papoSrcBands and size of
  *               first dimension of papapoOverviewBands
  * @param papoSrcBands the list of source bands to downsample
@@ -5758,8 +5766,539 @@ CPLErr GDALRegenerateOverviewsMultiBand(
         return 100 * 1024 * 1024;
     }();
 
-    // Second pass to do the real job.
+    // Structure describing a resampling job
+    struct OvrLevel;
+    struct OvrJob
+    {
+        // Buffers to free when job is finished
+        std::unique_ptr<PointerHolder> oSrcMaskBufferHolder{};
+        std::unique_ptr<PointerHolder> oSrcBufferHolder{};
+        std::unique_ptr<PointerHolder> oDstBufferHolder{};
+
+        GDALRasterBand *poDstBand = nullptr;
+
+        // Overview level the job belongs to, and whether it is the last job
+        // of its chunk row
+        OvrLevel *poLevel = nullptr;
+        bool bLastOfChunkRow = false;
+
+        // Input parameters of pfnResampleFn
+        GDALResampleFunction pfnResampleFn = nullptr;
+        GDALOverviewResampleArgs args{};
+        const void *pChunk = nullptr;
+
+        // Output values of resampling function
+        CPLErr eErr = CE_Failure;
+        void *pDstBuffer = nullptr;
+        GDALDataType eDstBufferDataType = GDT_Unknown;
+
+        void NotifyFinished()
+        {
+            std::lock_guard guard(mutex);
+            bFinished = true;
+            cv.notify_one();
+        }
+
+        bool IsFinished()
+        {
+            std::lock_guard guard(mutex);
+            return bFinished;
+        }
+
+        void WaitFinished()
+        {
+            std::unique_lock oGuard(mutex);
+            while (!bFinished)
+            {
+                cv.wait(oGuard);
+            }
+        }
+
+      private:
+        // Synchronization
+        bool bFinished = false;
+        std::mutex mutex{};
+        std::condition_variable cv{};
+    };
+
+    // Structure describing an overview level generated chunk row by chunk
+    // row. Rows of the level are available for reading, by the level
+    // computed from it, once they have been written and flushed.
+    struct OvrLevel
+    {
+        int iOverview = 0;
+        int iSrcOverview = -1;  // -1 means the source bands.
+        // Level this one is computed from, if it is also being generated
+        const OvrLevel *poSrcLevel = nullptr;
+        int nSrcWidth = 0;
+        int nSrcHeight = 0;
+        double dfXRatioDstToSrc = 0;
+        double dfYRatioDstToSrc = 0;
+        int nOvrFactor = 1;
+        int nDstTotalWidth = 0;
+        int nDstTotalHeight = 0;
+        int nDstXOffStart = 0;
+        int nDstXOffEnd = 0;
+        int nDstYOffStart = 0;
+        int nDstYOffEnd = 0;
+        int nDstChunkXSize = 0;
+        int nDstChunkYSize = 0;
+        int nFullResXChunk = 0;
+        int nFullResYChunk = 0;
+        int nFullResXChunkQueried = 0;
+        int nFullResYChunkQueried = 0;
+        // Whether all bands share the same block size, which is needed to
+        // flush completed block rows
+        bool bCanFlushBlockRows = false;
+        int nBlockXSize = 0;
+        int nBlockYSize = 0;
+        // Start of the next chunk row to submit
+        int nDstYOffNext = 0;
+        // End of the rows written to the overview bands
+        int nDstYOffWritten = 0;
+        // End of the rows that can be read back from the overview bands
+        int nDstYOffAvailable = 0;
+        bool bDone = false;
+        std::vector<std::unique_ptr<void, VSIFreeReleaser>> apaChunk{};
+        std::vector<std::unique_ptr<GByte, VSIFreeReleaser>>
+            apabyChunkNoDataMask{};
+    };
+
+    // When several threads are used, chunk rows of the different overview
+    // levels are scheduled as soon as the rows of the previous level they
+    // depend on are available, so that all levels are resampled and
+    // written (and thus compressed by drivers that do it asynchronously)
+    // concurrently, instead of waiting for the previous level to be
+    // completed.
+    const bool bPipelineLevels = poJobQueue != nullptr;
+
+    // Overview levels being generated
+    std::vector<std::unique_ptr<OvrLevel>> apoLevels;
+
+    // Queue of jobs
+    std::list<std::unique_ptr<OvrJob>> jobList;
+
+    // Thread function to resample
+    const auto JobResampleFunc = [](void *pData)
+    {
+        OvrJob *poJob = static_cast<OvrJob *>(pData);
+
+        poJob->eErr = poJob->pfnResampleFn(poJob->args, poJob->pChunk,
+                                           &(poJob->pDstBuffer),
+                                           &(poJob->eDstBufferDataType));
+
+        auto pDstBuffer = poJob->pDstBuffer;
+        poJob->oDstBufferHolder = std::make_unique<PointerHolder>(pDstBuffer);
+
+        poJob->NotifyFinished();
+    };
+
+    // Function to write resample data to target band
+    const auto WriteJobData = [](const OvrJob *poJob)
+    {
+        return poJob->poDstBand->RasterIO(
+            GF_Write, poJob->args.nDstXOff, poJob->args.nDstYOff,
+            poJob->args.nDstXOff2 - poJob->args.nDstXOff,
+            poJob->args.nDstYOff2 - poJob->args.nDstYOff, poJob->pDstBuffer,
+            poJob->args.nDstXOff2 - poJob->args.nDstXOff,
+            poJob->args.nDstYOff2 - poJob->args.nDstYOff,
+            poJob->eDstBufferDataType, 0, 0, nullptr);
+    };
+
+    // Function called once all the bands of a chunk row have been written
+    const auto OnChunkRowWritten =
+        [nBands, papapoOverviewBands, bPipelineLevels](OvrLevel &oLevel,
+                                                       int nDstYOff2)
+    {
+        CPLErr l_eErr = CE_None;
+        oLevel.nDstYOffWritten = nDstYOff2;
+        if (oLevel.nDstYOffWritten == oLevel.nDstYOffEnd)
+        {
+            // Flush the data to overviews.
+            for (int iBand = 0; iBand < nBands; ++iBand)
+            {
+                if (papapoOverviewBands[iBand][oLevel.iOverview]->FlushCache(
+                        false) != CE_None)
+                    l_eErr = CE_Failure;
+            }
+            oLevel.nDstYOffAvailable = oLevel.nDstTotalHeight;
+            oLevel.bDone = true;
+        }
+        else if (bPipelineLevels && oLevel.bCanFlushBlockRows)
+        {
+            // Write the completed block rows, so that the next level reads
+            // them as they are stored, as when levels are generated one
+            // after the other.
+            const int nBlockXStart = oLevel.nDstXOffStart / oLevel.nBlockXSize;
+            const int nBlockXEnd =
+                DIV_ROUND_UP(oLevel.nDstXOffEnd, oLevel.nBlockXSize);
+            while (l_eErr == CE_None &&
+                   oLevel.nDstYOffAvailable + oLevel.nBlockYSize <=
+                       oLevel.nDstYOffWritten)
+            {
+                const int nBlockYOff =
+                    oLevel.nDstYOffAvailable / oLevel.nBlockYSize;
+                for (int iBand = 0; iBand < nBands; ++iBand)
+                {
+                    auto poOvrBand =
+                        papapoOverviewBands[iBand][oLevel.iOverview];
+                    for (int nBlockXOff = nBlockXStart; nBlockXOff < nBlockXEnd;
+                         ++nBlockXOff)
+                    {
+                        if (poOvrBand->FlushBlock(nBlockXOff, nBlockYOff) !=
+                            CE_None)
+                            l_eErr = CE_Failure;
+                    }
+                }
+                oLevel.nDstYOffAvailable += oLevel.nBlockYSize;
+            }
+        }
+        return l_eErr;
+    };
+
+    // Function to write resample data of a finished job
+    const auto FinalizeJob = [WriteJobData, OnChunkRowWritten](OvrJob *poJob)
+    {
+        CPLErr l_eErr = poJob->eErr;
+        if (l_eErr == CE_None)
+        {
+            l_eErr = WriteJobData(poJob);
+        }
+        if (l_eErr == CE_None && poJob->bLastOfChunkRow)
+        {
+            l_eErr =
+                OnChunkRowWritten(*(poJob->poLevel), poJob->args.nDstYOff2);
+        }
+        return l_eErr;
+    };
+
+    // Wait for completion of oldest job and serialize it
+    const auto WaitAndFinalizeOldestJob = [FinalizeJob, &jobList]()
+    {
+        auto poOldestJob = jobList.front().get();
+        poOldestJob->WaitFinished();
+        const CPLErr l_eErr = FinalizeJob(poOldestJob);
+        jobList.pop_front();
+        return l_eErr;
+    };
+
+    // Compute the source window to read for a chunk row of a level
+    const auto GetChunkYWindow =
+        [nKernelRadius](const OvrLevel &oLevel, int nDstYOff, int nDstYCount,
+                        int &nChunkYOffQueried, int &nChunkYSizeQueried)
+    {
+        const int nChunkYOff =
+            static_cast<int>(nDstYOff * oLevel.dfYRatioDstToSrc);
+        int nChunkYOff2 = static_cast<int>(
+            ceil((nDstYOff + nDstYCount) * oLevel.dfYRatioDstToSrc));
+        if (nChunkYOff2 > oLevel.nSrcHeight ||
+            nDstYOff + nDstYCount == oLevel.nDstTotalHeight)
+            nChunkYOff2 = oLevel.nSrcHeight;
+        const int nYCount = nChunkYOff2 - nChunkYOff;
+        CPLAssert(nYCount <= oLevel.nFullResYChunk);
+
+        nChunkYOffQueried = nChunkYOff - nKernelRadius * oLevel.nOvrFactor;
+        nChunkYSizeQueried =
+            nYCount + RADIUS_TO_DIAMETER * nKernelRadius * oLevel.nOvrFactor;
+        if (nChunkYOffQueried < 0)
+        {
+            nChunkYSizeQueried += nChunkYOffQueried;
+            nChunkYOffQueried = 0;
+        }
+        if (nChunkYSizeQueried + nChunkYOffQueried > oLevel.nSrcHeight)
+            nChunkYSizeQueried = oLevel.nSrcHeight - nChunkYOffQueried;
+        CPLAssert(nChunkYSizeQueried <= oLevel.nFullResYChunkQueried);
+    };
+
+    // Whether the next chunk row of a level can be submitted
+    const auto IsLevelReady =
+        [bPipelineLevels, &apoLevels, GetChunkYWindow](const OvrLevel &oLevel)
+    {
+        if (!bPipelineLevels)
+        {
+            // Generate levels one after the other
+            for (const auto &poOtherLevel : apoLevels)
+            {
+                if (poOtherLevel.get() == &oLevel)
+                    break;
+                if (!poOtherLevel->bDone)
+                    return false;
+            }
+        }
+        if (!oLevel.poSrcLevel || oLevel.poSrcLevel->bDone)
+            return true;
+        const int nDstYCount = std::min(
+            oLevel.nDstChunkYSize, oLevel.nDstYOffEnd - oLevel.nDstYOffNext);
+        int nChunkYOffQueried = 0;
+        int nChunkYSizeQueried = 0;
+        GetChunkYWindow(oLevel, oLevel.nDstYOffNext, nDstYCount,
+                        nChunkYOffQueried, nChunkYSizeQueried);
+        return nChunkYOffQueried + nChunkYSizeQueried <=
+               oLevel.poSrcLevel->nDstYOffAvailable;
+    };
+
     double dfCurPixelCount = 0;
+
+    // Read the source data of the next chunk row of a level, and submit
+    // the resampling jobs for it.
+    const auto SubmitChunkRow = [&](OvrLevel &oLevel)
+    {
+        CPLErr l_eErr = CE_None;
+
+        const int nDstYOff = oLevel.nDstYOffNext;
+        const int nDstYCount =
+            std::min(oLevel.nDstChunkYSize, oLevel.nDstYOffEnd - nDstYOff);
+        oLevel.nDstYOffNext += nDstYCount;
+
+        int nChunkYOffQueried = 0;
+        int nChunkYSizeQueried = 0;
+        GetChunkYWindow(oLevel, nDstYOff, nDstYCount, nChunkYOffQueried,
+                        nChunkYSizeQueried);
+
+        if (!pfnProgress(std::min(1.0, dfCurPixelCount / dfTotalPixelCount),
+                         nullptr, pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            l_eErr = CE_Failure;
+        }
+
+        // Iterate on destination overview, block by block.
+        for (int nDstXOff = oLevel.nDstXOffStart;
+             nDstXOff < oLevel.nDstXOffEnd && l_eErr == CE_None;
+             nDstXOff += oLevel.nDstChunkXSize)
+        {
+            int nDstXCount = 0;
+            if (nDstXOff + oLevel.nDstChunkXSize <= oLevel.nDstXOffEnd)
+                nDstXCount = oLevel.nDstChunkXSize;
+            else
+                nDstXCount = oLevel.nDstXOffEnd - nDstXOff;
+
+            dfCurPixelCount += static_cast<double>(nDstXCount) * nDstYCount;
+
+            int nChunkXOff =
+                static_cast<int>(nDstXOff * oLevel.dfXRatioDstToSrc);
+            int nChunkXOff2 = static_cast<int>(
+                ceil((nDstXOff + nDstXCount) * oLevel.dfXRatioDstToSrc));
+            if (nChunkXOff2 > oLevel.nSrcWidth ||
+                nDstXOff + nDstXCount == oLevel.nDstTotalWidth)
+                nChunkXOff2 = oLevel.nSrcWidth;
+            const int nXCount = nChunkXOff2 - nChunkXOff;
+            CPLAssert(nXCount <= oLevel.nFullResXChunk);
+
+            int nChunkXOffQueried =
+                nChunkXOff - nKernelRadius * oLevel.nOvrFactor;
+            int nChunkXSizeQueried =
+                nXCount +
+                RADIUS_TO_DIAMETER * nKernelRadius * oLevel.nOvrFactor;
+            if (nChunkXOffQueried < 0)
+            {
+                nChunkXSizeQueried += nChunkXOffQueried;
+                nChunkXOffQueried = 0;
+            }
+            if (nChunkXSizeQueried + nChunkXOffQueried > oLevel.nSrcWidth)
+                nChunkXSizeQueried = oLevel.nSrcWidth - nChunkXOffQueried;
+            CPLAssert(nChunkXSizeQueried <= oLevel.nFullResXChunkQueried);
+#if DEBUG_VERBOSE
+            CPLDebug("GDAL",
+                     "Reading (%dx%d -> %dx%d) for output (%dx%d -> %dx%d)",
+                     nChunkXOffQueried, nChunkYOffQueried, nChunkXSizeQueried,
+                     nChunkYSizeQueried, nDstXOff, nDstYOff, nDstXCount,
+                     nDstYCount);
+#endif
+
+            // Avoid accumulating too many tasks and exhaust RAM
+
+            // Try to complete already finished jobs
+            while (l_eErr == CE_None && !jobList.empty())
+            {
+                auto poOldestJob = jobList.front().get();
+                if (!poOldestJob->IsFinished())
+                    break;
+                l_eErr = FinalizeJob(poOldestJob);
+                jobList.pop_front();
+            }
+
+            // And in case we have saturated the number of threads,
+            // wait for completion of tasks to go below the threshold.
+            while (l_eErr == CE_None &&
+                   jobList.size() >= static_cast<size_t>(nThreads))
+            {
+                l_eErr = WaitAndFinalizeOldestJob();
+            }
+
+            // Read the source buffers for all the bands.
+            for (int iBand = 0; iBand < nBands && l_eErr == CE_None; ++iBand)
+            {
+                auto &paChunk = oLevel.apaChunk[iBand];
+                auto &pabyChunkNoDataMask = oLevel.apabyChunkNoDataMask[iBand];
+
+                // (Re)allocate buffers if needed
+                if (paChunk == nullptr)
+                {
+                    paChunk.reset(VSI_MALLOC3_VERBOSE(
+                        oLevel.nFullResXChunkQueried,
+                        oLevel.nFullResYChunkQueried, nWrkDataTypeSize));
+                    if (paChunk == nullptr)
+                    {
+                        l_eErr = CE_Failure;
+                    }
+                }
+                if (bUseNoDataMask && pabyChunkNoDataMask == nullptr)
+                {
+                    pabyChunkNoDataMask.reset(
+                        static_cast<GByte *>(VSI_MALLOC2_VERBOSE(
+                            oLevel.nFullResXChunkQueried,
+                            oLevel.nFullResYChunkQueried)));
+                    if (pabyChunkNoDataMask == nullptr)
+                    {
+                        l_eErr = CE_Failure;
+                    }
+                }
+
+                if (l_eErr == CE_None)
+                {
+                    GDALRasterBand *poSrcBand = nullptr;
+                    if (oLevel.iSrcOverview == -1)
+                        poSrcBand = papoSrcBands[iBand];
+                    else
+                        poSrcBand =
+                            papapoOverviewBands[iBand][oLevel.iSrcOverview];
+                    l_eErr = poSrcBand->RasterIO(
+                        GF_Read, nChunkXOffQueried, nChunkYOffQueried,
+                        nChunkXSizeQueried, nChunkYSizeQueried, paChunk.get(),
+                        nChunkXSizeQueried, nChunkYSizeQueried, eWrkDataType,
+                        0, 0, nullptr);
+
+                    if (bUseNoDataMask && l_eErr == CE_None)
+                    {
+                        auto poMaskBand = poSrcBand->IsMaskBand()
+                                              ? poSrcBand
+                                              : poSrcBand->GetMaskBand();
+                        l_eErr = poMaskBand->RasterIO(
+                            GF_Read, nChunkXOffQueried, nChunkYOffQueried,
+                            nChunkXSizeQueried, nChunkYSizeQueried,
+                            pabyChunkNoDataMask.get(), nChunkXSizeQueried,
+                            nChunkYSizeQueried, GDT_UInt8, 0, 0, nullptr);
+                    }
+                }
+            }
+
+            // Compute the resulting overview block.
+            for (int iBand = 0; iBand < nBands && l_eErr == CE_None; ++iBand)
+            {
+                auto poJob = std::make_unique<OvrJob>();
+                poJob->pfnResampleFn = pfnResampleFn;
+                poJob->poDstBand = papapoOverviewBands[iBand][oLevel.iOverview];
+                poJob->poLevel = &oLevel;
+                poJob->bLastOfChunkRow =
+                    iBand == nBands - 1 &&
+                    nDstXOff + nDstXCount == oLevel.nDstXOffEnd;
+                poJob->args.eOvrDataType =
+                    poJob->poDstBand->GetRasterDataType();
+                poJob->args.nOvrXSize = poJob->poDstBand->GetXSize();
+                poJob->args.nOvrYSize = poJob->poDstBand->GetYSize();
+                const char *pszNBITS = poJob->poDstBand->GetMetadataItem(
+                    "NBITS", "IMAGE_STRUCTURE");
+                poJob->args.nOvrNBITS = pszNBITS ? atoi(pszNBITS) : 0;
+                poJob->args.dfXRatioDstToSrc = oLevel.dfXRatioDstToSrc;
+                poJob->args.dfYRatioDstToSrc = oLevel.dfYRatioDstToSrc;
+                poJob->args.eWrkDataType = eWrkDataType;
+                poJob->pChunk = oLevel.apaChunk[iBand].get();
+                poJob->args.pabyChunkNodataMask =
+                    oLevel.apabyChunkNoDataMask[iBand].get();
+                poJob->args.nChunkXOff = nChunkXOffQueried;
+                poJob->args.nChunkXSize = nChunkXSizeQueried;
+                poJob->args.nChunkYOff = nChunkYOffQueried;
+                poJob->args.nChunkYSize = nChunkYSizeQueried;
+                poJob->args.nDstXOff = nDstXOff;
+                poJob->args.nDstXOff2 = nDstXOff + nDstXCount;
+                poJob->args.nDstYOff = nDstYOff;
+                poJob->args.nDstYOff2 = nDstYOff + nDstYCount;
+                poJob->args.pszResampling = pszResampling;
+                poJob->args.bHasNoData = abHasNoData[iBand];
+                poJob->args.dfNoDataValue = adfNoDataValue[iBand];
+                poJob->args.eSrcDataType = eDataType;
+                poJob->args.bPropagateNoData = bPropagateNoData;
+
+                if (poJobQueue)
+                {
+                    poJob->oSrcMaskBufferHolder =
+                        std::make_unique<PointerHolder>(
+                            std::move(oLevel.apabyChunkNoDataMask[iBand]));
+
+                    poJob->oSrcBufferHolder = std::make_unique<PointerHolder>(
+                        std::move(oLevel.apaChunk[iBand]));
+
+                    poJobQueue->SubmitJob(JobResampleFunc, poJob.get());
+                    jobList.emplace_back(std::move(poJob));
+                }
+                else
+                {
+                    JobResampleFunc(poJob.get());
+                    l_eErr = FinalizeJob(poJob.get());
+                }
+            }
+        }
+
+        return l_eErr;
+    };
+
+    // Generate the pending overview levels
+    const auto ProcessPendingLevels = [&]()
+    {
+        CPLErr l_eErr = CE_None;
+        while (l_eErr == CE_None)
+        {
+            // Favor the coarsest levels, so that they progress as soon as
+            // the rows they depend on are available.
+            bool bRemainingRows = false;
+            OvrLevel *poReadyLevel = nullptr;
+            for (auto oIter = apoLevels.rbegin(); oIter != apoLevels.rend();
+                 ++oIter)
+            {
+                if ((*oIter)->nDstYOffNext < (*oIter)->nDstYOffEnd)
+                {
+                    bRemainingRows = true;
+                    if (IsLevelReady(**oIter))
+                    {
+                        poReadyLevel = oIter->get();
+                        break;
+                    }
+                }
+            }
+            if (!bRemainingRows)
+                break;
+
+            if (poReadyLevel)
+            {
+                l_eErr = SubmitChunkRow(*poReadyLevel);
+            }
+            else if (!jobList.empty())
+            {
+                l_eErr = WaitAndFinalizeOldestJob();
+            }
+            else
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "GDALRegenerateOverviewsMultiBand(): "
+                         "no overview level can progress");
+                l_eErr = CE_Failure;
+            }
+        }
+
+        // Wait for all pending jobs to complete
+        while (!jobList.empty())
+        {
+            const auto l_eErr2 = WaitAndFinalizeOldestJob();
+            if (l_eErr2 != CE_None && l_eErr == CE_None)
+                l_eErr = l_eErr2;
+        }
+
+        apoLevels.clear();
+        return l_eErr;
+    };
+
+    // Second pass to do the real job.
     CPLErr eErr = CE_None;
     for (int iOverview = 0; iOverview < nOverviews && eErr == CE_None;
          ++iOverview)
@@ -5903,6 +6442,12 @@ CPLErr GDALRegenerateOverviewsMultiBand(
         if (bOverflowFullResXChunkYChunkQueried ||
             nMemRequirement > nChunkMaxSizeForTempFile)
         {
+            // The generation of this level reads the whole previous level:
+            // complete the pending ones first.
+            eErr = ProcessPendingLevels();
+            if (eErr != CE_None)
+                break;
+
             const auto nDTSize =
                 std::max(1, GDALGetDataTypeSizeBytes(eDataType));
             const bool bTmpDSMemRequirementOverflow =
@@ -6256,342 +6801,63 @@ CPLErr GDALRegenerateOverviewsMultiBand(
             continue;
         }
 
-        // Structure describing a resampling job
-        struct OvrJob
-        {
-            // Buffers to free when job is finished
-            std::unique_ptr<PointerHolder> oSrcMaskBufferHolder{};
-            std::unique_ptr<PointerHolder> oSrcBufferHolder{};
-            std::unique_ptr<PointerHolder> oDstBufferHolder{};
-
-            GDALRasterBand *poDstBand = nullptr;
-
-            // Input parameters of pfnResampleFn
-            GDALResampleFunction pfnResampleFn = nullptr;
-            GDALOverviewResampleArgs args{};
-            const void *pChunk = nullptr;
-
-            // Output values of resampling function
-            CPLErr eErr = CE_Failure;
-            void *pDstBuffer = nullptr;
-            GDALDataType eDstBufferDataType = GDT_Unknown;
-
-            void NotifyFinished()
-            {
-                std::lock_guard guard(mutex);
-                bFinished = true;
-                cv.notify_one();
-            }
-
-            bool IsFinished()
-            {
-                std::lock_guard guard(mutex);
-                return bFinished;
-            }
-
-            void WaitFinished()
-            {
-                std::unique_lock oGuard(mutex);
-                while (!bFinished)
-                {
-                    cv.wait(oGuard);
-                }
-            }
-
-          private:
-            // Synchronization
-            bool bFinished = false;
-            std::mutex mutex{};
-            std::condition_variable cv{};
-        };
-
-        // Thread function to resample
-        const auto JobResampleFunc = [](void *pData)
-        {
-            OvrJob *poJob = static_cast<OvrJob *>(pData);
-
-            poJob->eErr = poJob->pfnResampleFn(poJob->args, poJob->pChunk,
-                                               &(poJob->pDstBuffer),
-                                               &(poJob->eDstBufferDataType));
-
-            auto pDstBuffer = poJob->pDstBuffer;
-            poJob->oDstBufferHolder =
-                std::make_unique<PointerHolder>(pDstBuffer);
-
-            poJob->NotifyFinished();
-        };
-
-        // Function to write resample data to target band
-        const auto WriteJobData = [](const OvrJob *poJob)
-        {
-            return poJob->poDstBand->RasterIO(
-                GF_Write, poJob->args.nDstXOff, poJob->args.nDstYOff,
-                poJob->args.nDstXOff2 - poJob->args.nDstXOff,
-                poJob->args.nDstYOff2 - poJob->args.nDstYOff, poJob->pDstBuffer,
-                poJob->args.nDstXOff2 - poJob->args.nDstXOff,
-                poJob->args.nDstYOff2 - poJob->args.nDstYOff,
-                poJob->eDstBufferDataType, 0, 0, nullptr);
-        };
-
-        // Wait for completion of oldest job and serialize it
-        const auto WaitAndFinalizeOldestJob =
-            [WriteJobData](std::list<std::unique_ptr<OvrJob>> &jobList)
-        {
-            auto poOldestJob = jobList.front().get();
-            poOldestJob->WaitFinished();
-            CPLErr l_eErr = poOldestJob->eErr;
-            if (l_eErr == CE_None)
-            {
-                l_eErr = WriteJobData(poOldestJob);
-            }
-
-            jobList.pop_front();
-            return l_eErr;
-        };
-
-        // Queue of jobs
-        std::list<std::unique_ptr<OvrJob>> jobList;
-
-        std::vector<std::unique_ptr<void, VSIFreeReleaser>> apaChunk(nBands);
-        std::vector<std::unique_ptr<GByte, VSIFreeReleaser>>
-            apabyChunkNoDataMask(nBands);
-
-        // Iterate on destination overview, block by block.
-        for (int nDstYOff = nDstYOffStart;
-             nDstYOff < nDstYOffEnd && eErr == CE_None;
-             nDstYOff += nDstChunkYSize)
-        {
-            int nDstYCount;
-            if (nDstYOff + nDstChunkYSize <= nDstYOffEnd)
-                nDstYCount = nDstChunkYSize;
-            else
-                nDstYCount = nDstYOffEnd - nDstYOff;
-
-            int nChunkYOff = static_cast<int>(nDstYOff * dfYRatioDstToSrc);
-            int nChunkYOff2 = static_cast<int>(
-                ceil((nDstYOff + nDstYCount) * dfYRatioDstToSrc));
-            if (nChunkYOff2 > nSrcHeight ||
-                nDstYOff + nDstYCount == nDstTotalHeight)
-                nChunkYOff2 = nSrcHeight;
-            int nYCount = nChunkYOff2 - nChunkYOff;
-            CPLAssert(nYCount <= nFullResYChunk);
-
-            int nChunkYOffQueried = nChunkYOff - nKernelRadius * nOvrFactor;
-            int nChunkYSizeQueried =
-                nYCount + RADIUS_TO_DIAMETER * nKernelRadius * nOvrFactor;
-            if (nChunkYOffQueried < 0)
-            {
-                nChunkYSizeQueried += nChunkYOffQueried;
-                nChunkYOffQueried = 0;
-            }
-            if (nChunkYSizeQueried + nChunkYOffQueried > nSrcHeight)
-                nChunkYSizeQueried = nSrcHeight - nChunkYOffQueried;
-            CPLAssert(nChunkYSizeQueried <= nFullResYChunkQueried);
-
-            if (!pfnProgress(std::min(1.0, dfCurPixelCount / dfTotalPixelCount),
-                             nullptr, pProgressData))
-            {
-                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                eErr = CE_Failure;
-            }
-
-            // Iterate on destination overview, block by block.
-            for (int nDstXOff = nDstXOffStart;
-                 nDstXOff < nDstXOffEnd && eErr == CE_None;
-                 nDstXOff += nDstChunkXSize)
-            {
-                int nDstXCount = 0;
-                if (nDstXOff + nDstChunkXSize <= nDstXOffEnd)
-                    nDstXCount = nDstChunkXSize;
-                else
-                    nDstXCount = nDstXOffEnd - nDstXOff;
-
-                dfCurPixelCount += static_cast<double>(nDstXCount) * nDstYCount;
-
-                int nChunkXOff = static_cast<int>(nDstXOff * dfXRatioDstToSrc);
-                int nChunkXOff2 = static_cast<int>(
-                    ceil((nDstXOff + nDstXCount) * dfXRatioDstToSrc));
-                if (nChunkXOff2 > nSrcWidth ||
-                    nDstXOff + nDstXCount == nDstTotalWidth)
-                    nChunkXOff2 = nSrcWidth;
-                const int nXCount = nChunkXOff2 - nChunkXOff;
-                CPLAssert(nXCount <= nFullResXChunk);
-
-                int nChunkXOffQueried = nChunkXOff - nKernelRadius * nOvrFactor;
-                int nChunkXSizeQueried =
-                    nXCount + RADIUS_TO_DIAMETER * nKernelRadius * nOvrFactor;
-                if (nChunkXOffQueried < 0)
-                {
-                    nChunkXSizeQueried += nChunkXOffQueried;
-                    nChunkXOffQueried = 0;
-                }
-                if (nChunkXSizeQueried + nChunkXOffQueried > nSrcWidth)
-                    nChunkXSizeQueried = nSrcWidth - nChunkXOffQueried;
-                CPLAssert(nChunkXSizeQueried <= nFullResXChunkQueried);
-#if DEBUG_VERBOSE
-                CPLDebug("GDAL",
-                         "Reading (%dx%d -> %dx%d) for output (%dx%d -> %dx%d)",
-                         nChunkXOffQueried, nChunkYOffQueried,
-                         nChunkXSizeQueried, nChunkYSizeQueried, nDstXOff,
-                         nDstYOff, nDstXCount, nDstYCount);
-#endif
-
-                // Avoid accumulating too many tasks and exhaust RAM
-
-                // Try to complete already finished jobs
-                while (eErr == CE_None && !jobList.empty())
-                {
-                    auto poOldestJob = jobList.front().get();
-                    if (!poOldestJob->IsFinished())
-                        break;
-                    eErr = poOldestJob->eErr;
-                    if (eErr == CE_None)
-                    {
-                        eErr = WriteJobData(poOldestJob);
-                    }
-
-                    jobList.pop_front();
-                }
-
-                // And in case we have saturated the number of threads,
-                // wait for completion of tasks to go below the threshold.
-                while (eErr == CE_None &&
-                       jobList.size() >= static_cast<size_t>(nThreads))
-                {
-                    eErr = WaitAndFinalizeOldestJob(jobList);
-                }
-
-                // Read the source buffers for all the bands.
-                for (int iBand = 0; iBand < nBands && eErr == CE_None; ++iBand)
-                {
-                    // (Re)allocate buffers if needed
-                    if (apaChunk[iBand] == nullptr)
-                    {
-                        apaChunk[iBand].reset(VSI_MALLOC3_VERBOSE(
-                            nFullResXChunkQueried, nFullResYChunkQueried,
-                            nWrkDataTypeSize));
-                        if (apaChunk[iBand] == nullptr)
-                        {
-                            eErr = CE_Failure;
-                        }
-                    }
-                    if (bUseNoDataMask &&
-                        apabyChunkNoDataMask[iBand] == nullptr)
-                    {
-                        apabyChunkNoDataMask[iBand].reset(
-                            static_cast<GByte *>(VSI_MALLOC2_VERBOSE(
-                                nFullResXChunkQueried, nFullResYChunkQueried)));
-                        if (apabyChunkNoDataMask[iBand] == nullptr)
-                        {
-                            eErr = CE_Failure;
-                        }
-                    }
-
-                    if (eErr == CE_None)
-                    {
-                        GDALRasterBand *poSrcBand = nullptr;
-                        if (iSrcOverview == -1)
-                            poSrcBand = papoSrcBands[iBand];
-                        else
-                            poSrcBand =
-                                papapoOverviewBands[iBand][iSrcOverview];
-                        eErr = poSrcBand->RasterIO(
-                            GF_Read, nChunkXOffQueried, nChunkYOffQueried,
-                            nChunkXSizeQueried, nChunkYSizeQueried,
-                            apaChunk[iBand].get(), nChunkXSizeQueried,
-                            nChunkYSizeQueried, eWrkDataType, 0, 0, nullptr);
-
-                        if (bUseNoDataMask && eErr == CE_None)
-                        {
-                            auto poMaskBand = poSrcBand->IsMaskBand()
-                                                  ? poSrcBand
-                                                  : poSrcBand->GetMaskBand();
-                            eErr = poMaskBand->RasterIO(
-                                GF_Read, nChunkXOffQueried, nChunkYOffQueried,
-                                nChunkXSizeQueried, nChunkYSizeQueried,
-                                apabyChunkNoDataMask[iBand].get(),
-                                nChunkXSizeQueried, nChunkYSizeQueried,
-                                GDT_UInt8, 0, 0, nullptr);
-                        }
-                    }
-                }
-
-                // Compute the resulting overview block.
-                for (int iBand = 0; iBand < nBands && eErr == CE_None; ++iBand)
-                {
-                    auto poJob = std::make_unique<OvrJob>();
-                    poJob->pfnResampleFn = pfnResampleFn;
-                    poJob->poDstBand = papapoOverviewBands[iBand][iOverview];
-                    poJob->args.eOvrDataType =
-                        poJob->poDstBand->GetRasterDataType();
-                    poJob->args.nOvrXSize = poJob->poDstBand->GetXSize();
-                    poJob->args.nOvrYSize = poJob->poDstBand->GetYSize();
-                    const char *pszNBITS = poJob->poDstBand->GetMetadataItem(
-                        "NBITS", "IMAGE_STRUCTURE");
-                    poJob->args.nOvrNBITS = pszNBITS ? atoi(pszNBITS) : 0;
-                    poJob->args.dfXRatioDstToSrc = dfXRatioDstToSrc;
-                    poJob->args.dfYRatioDstToSrc = dfYRatioDstToSrc;
-                    poJob->args.eWrkDataType = eWrkDataType;
-                    poJob->pChunk = apaChunk[iBand].get();
-                    poJob->args.pabyChunkNodataMask =
-                        apabyChunkNoDataMask[iBand].get();
-                    poJob->args.nChunkXOff = nChunkXOffQueried;
-                    poJob->args.nChunkXSize = nChunkXSizeQueried;
-                    poJob->args.nChunkYOff = nChunkYOffQueried;
-                    poJob->args.nChunkYSize = nChunkYSizeQueried;
-                    poJob->args.nDstXOff = nDstXOff;
-                    poJob->args.nDstXOff2 = nDstXOff + nDstXCount;
-                    poJob->args.nDstYOff = nDstYOff;
-                    poJob->args.nDstYOff2 = nDstYOff + nDstYCount;
-                    poJob->args.pszResampling = pszResampling;
-                    poJob->args.bHasNoData = abHasNoData[iBand];
-                    poJob->args.dfNoDataValue = adfNoDataValue[iBand];
-                    poJob->args.eSrcDataType = eDataType;
-                    poJob->args.bPropagateNoData = bPropagateNoData;
-
-                    if (poJobQueue)
-                    {
-                        poJob->oSrcMaskBufferHolder =
-                            std::make_unique<PointerHolder>(
-                                std::move(apabyChunkNoDataMask[iBand]));
-
-                        poJob->oSrcBufferHolder =
-                            std::make_unique<PointerHolder>(
-                                std::move(apaChunk[iBand]));
-
-                        poJobQueue->SubmitJob(JobResampleFunc, poJob.get());
-                        jobList.emplace_back(std::move(poJob));
-                    }
-                    else
-                    {
-                        JobResampleFunc(poJob.get());
-                        eErr = poJob->eErr;
-                        if (eErr == CE_None)
-                        {
-                            eErr = WriteJobData(poJob.get());
-                        }
-                    }
-                }
-            }
-        }
+        if (nDstWidth <= 0 || nDstHeight <= 0)
+            continue;
 
-        // Wait for all pending jobs to complete
-        while (!jobList.empty())
+        auto poLevel = std::make_unique<OvrLevel>();
+        poLevel->iOverview = iOverview;
+        poLevel->iSrcOverview = iSrcOverview;
+        for (const auto &poOtherLevel : apoLevels)
         {
-            const auto l_eErr = WaitAndFinalizeOldestJob(jobList);
-            if (l_eErr != CE_None && eErr == CE_None)
-                eErr = l_eErr;
+            if (poOtherLevel->iOverview == iSrcOverview)
+                poLevel->poSrcLevel = poOtherLevel.get();
         }
-
-        // Flush the data to overviews.
-        for (int iBand = 0; iBand < nBands; ++iBand)
+        poLevel->nSrcWidth = nSrcWidth;
+        poLevel->nSrcHeight = nSrcHeight;
+        poLevel->dfXRatioDstToSrc = dfXRatioDstToSrc;
+        poLevel->dfYRatioDstToSrc = dfYRatioDstToSrc;
+        poLevel->nOvrFactor = nOvrFactor;
+        poLevel->nDstTotalWidth = nDstTotalWidth;
+        poLevel->nDstTotalHeight = nDstTotalHeight;
+        poLevel->nDstXOffStart = nDstXOffStart;
+        poLevel->nDstXOffEnd = nDstXOffEnd;
+        poLevel->nDstYOffStart = nDstYOffStart;
+        poLevel->nDstYOffEnd = nDstYOffEnd;
+        poLevel->nDstChunkXSize = nDstChunkXSize;
+        poLevel->nDstChunkYSize = nDstChunkYSize;
+        poLevel->nFullResXChunk = nFullResXChunk;
+        poLevel->nFullResYChunk = nFullResYChunk;
+        poLevel->nFullResXChunkQueried = nFullResXChunkQueried;
+        poLevel->nFullResYChunkQueried = nFullResYChunkQueried;
+        papapoOverviewBands[0][iOverview]->GetBlockSize(&poLevel->nBlockXSize,
+                                                        &poLevel->nBlockYSize);
+        poLevel->bCanFlushBlockRows =
+            poLevel->nBlockXSize > 0 && poLevel->nBlockYSize > 0;
+        for (int iBand = 1; iBand < nBands; ++iBand)
         {
-            if (papapoOverviewBands[iBand][iOverview]->FlushCache(false) !=
-                CE_None)
-                eErr = CE_Failure;
+            int nBlockXSize = 0;
+            int nBlockYSize = 0;
+            papapoOverviewBands[iBand][iOverview]->GetBlockSize(&nBlockXSize,
+                                                                &nBlockYSize);
+            if (nBlockXSize != poLevel->nBlockXSize ||
+                nBlockYSize != poLevel->nBlockYSize)
+                poLevel->bCanFlushBlockRows = false;
         }
+        poLevel->nDstYOffNext = nDstYOffStart;
+        poLevel->nDstYOffWritten = nDstYOffStart;
+        poLevel->nDstYOffAvailable =
+            poLevel->bCanFlushBlockRows
+                ? nDstYOffStart / poLevel->nBlockYSize * poLevel->nBlockYSize
+                : nDstYOffStart;
+        poLevel->apaChunk.resize(nBands);
+        poLevel->apabyChunkNoDataMask.resize(nBands);
+        apoLevels.push_back(std::move(poLevel));
     }
 
+    // Generate the levels that use the regular chunked path
+    if (eErr == CE_None)
+        eErr = ProcessPendingLevels();
+
     if (eErr == CE_None)
         pfnProgress(1.0, nullptr, pProgressData);
 
@@ -6636,6 +6902,14 @@ CPLErr GDALRegenerateOverviewsMultiBand(
  * to "ALL_CPUS" or a integer value to specify the number of threads to use for
  * overview computation.
  *
+ * Starting with GDAL 3.13, when several threads are used, the overview levels
+ * are generated concurrently: a chunk of a level is computed as soon as the
+ * rows of the previous level it depends on have been written. The block rows
+ * of each level are handed to the driver as soon as they are complete, so
+ * with formats that store overviews in the same file, such as internal
+ * GeoTIFF overviews, the blocks of the different levels end up interleaved
+ * in the file, instead of each level being stored contiguously.
+ *
  * @param apoSrcBands the list of source bands to downsample
  * @param aapoOverviewBands bidimension array of bands. First dimension is
  *                          indexed by bands. Second dimension is indexed by
@@ -321,6 +321,9 @@ RawRasterBand::~RawRasterBand()
 
     RawRasterBand::FlushCache(true);
 
+    if (psMMap)
+        CPLVirtualMemFree(psMMap);
+
     if (bOwnsFP)
     {
         if (VSIFCloseL(fpRawL) != 0)
@@ -1061,6 +1064,109 @@ int RawRasterBand::CanUseDirectIO(int /* nXOff */, int nYOff, int nXSize,
     return result;
 }
 
+/************************************************************************/
+/*                            GetMMapData()                             */
+/************************************************************************/
+
+// Returns the address of the first pixel of the band in a read-only memory
+// mapping of the file, or nullptr if the RAW_USE_MMAP configuration option
+// is not set or the file cannot be mapped.
+const GByte *RawRasterBand::GetMMapData()
+{
+    if (!bMMapTried)
+    {
+        bMMapTried = true;
+        if (CPLTestBool(CPLGetConfigOption("RAW_USE_MMAP", "NO")) &&
+            nPixelOffset > 0 && nLineOffset > 0 &&
+            VSIFGetNativeFileDescriptorL(fpRawL) != nullptr &&
+            CPLIsVirtualMemFileMapAvailable())
+        {
+            const vsi_l_offset nSize =
+                static_cast<vsi_l_offset>(nRasterYSize - 1) * nLineOffset +
+                static_cast<vsi_l_offset>(nRasterXSize - 1) * nPixelOffset +
+                GDALGetDataTypeSizeBytes(eDataType);
+            if (static_cast<size_t>(nSize) == nSize)
+            {
+                // Fails in particular if the file is truncated
+                CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+                psMMap = CPLVirtualMemFileMapNew(fpRawL, nImgOffset, nSize,
+                                                 VIRTUALMEM_READONLY, nullptr,
+                                                 nullptr);
+            }
+            if (!psMMap)
+            {
+                CPLDebug("RAW", "Cannot memory map band %d. Using regular I/O",
+                         nBand);
+            }
+        }
+    }
+    return psMMap ? static_cast<const GByte *>(CPLVirtualMemGetAddr(psMMap))
+                  : nullptr;
+}
+
+/************************************************************************/
+/*                            CanUseMMapIO()                            */
+/************************************************************************/
+
+// Whether a RasterIO() request can be served from the memory mapping of the
+// file: reads of native byte order data without resampling.
+bool RawRasterBand::CanUseMMapIO(GDALRWFlag eRWFlag, int nXSize, int nYSize,
+                                 int nBufXSize, int nBufYSize)
+{
+    return eRWFlag == GF_Read && eAccess == GA_ReadOnly &&
+           nXSize == nBufXSize && nYSize == nBufYSize &&
+           !NeedsByteOrderChange() && GetMMapData() != nullptr;
+}
+
+/************************************************************************/
+/*                            MMapRasterIO()                            */
+/************************************************************************/
+
+// Copy a window from the memory mapping of the file to the user buffer,
+// without going through the block cache or an intermediate buffer.
+CPLErr RawRasterBand::MMapRasterIO(int nXOff, int nYOff, int nXSize,
+                                   int nYSize, void *pData,
+                                   GDALDataType eBufType, GSpacing nPixelSpace,
+                                   GSpacing nLineSpace,
+                                   GDALRasterIOExtraArg *psExtraArg)
+{
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    const GByte *pabySrc = GetMMapData() +
+                           static_cast<size_t>(nYOff) * nLineOffset +
+                           static_cast<size_t>(nXOff) * nPixelOffset;
+    GByte *pabyDst = static_cast<GByte *>(pData);
+
+    if (eBufType == eDataType && nPixelOffset == nDTSize &&
+        nPixelSpace == nDTSize)
+    {
+        const size_t nRowSize = static_cast<size_t>(nXSize) * nDTSize;
+        // Full rows of the band that are contiguous in both the file and
+        // the user buffer
+        if (nLineOffset == static_cast<GIntBig>(nRowSize) &&
+            nLineSpace == nLineOffset)
+        {
+            memcpy(pabyDst, pabySrc, nRowSize * nYSize);
+            return CE_None;
+        }
+    }
+
+    for (int iLine = 0; iLine < nYSize; iLine++)
+    {
+        GDALCopyWords64(pabySrc + static_cast<size_t>(iLine) * nLineOffset,
+                        eDataType, nPixelOffset, pabyDst + iLine * nLineSpace,
+                        eBufType, static_cast<int>(nPixelSpace), nXSize);
+
+        if (psExtraArg->pfnProgress != nullptr &&
+            !psExtraArg->pfnProgress(1.0 * (iLine + 1) / nYSize, "",
+                                     psExtraArg->pProgressData))
+        {
+            return CE_Failure;
+        }
+    }
+
+    return CE_None;
+}
+
 /************************************************************************/
 /*                             IRasterIO()                              */
 /************************************************************************/
@@ -1082,6 +1188,12 @@ CPLErr RawRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
 #endif
     const int nBufDataSize = GDALGetDataTypeSizeBytes(eBufType);
 
+    if (CanUseMMapIO(eRWFlag, nXSize, nYSize, nBufXSize, nBufYSize))
+    {
+        return MMapRasterIO(nXOff, nYOff, nXSize, nYSize, pData, eBufType,
+                            nPixelSpace, nLineSpace, psExtraArg);
+    }
+
     if (!CanUseDirectIO(nXOff, nYOff, nXSize, nYSize, eBufType, psExtraArg))
     {
         return GDALRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
@@ -1625,7 +1737,9 @@ CPLErr RawDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                 bCanUseDirectIO = false;
                 break;
             }
-            else if (!poBand->CanUseDirectIO(nXOff, nYOff, nXSize, nYSize,
+            else if (!poBand->CanUseMMapIO(eRWFlag, nXSize, nYSize,
+                                           nBufXSize, nBufYSize) &&
+                     !poBand->CanUseDirectIO(nXOff, nYOff, nXSize, nYSize,
                                              eBufType, psExtraArg))
             {
                 bCanUseDirectIO = false;
@@ -114,6 +114,11 @@ class CPL_DLL RawRasterBand : public GDALPamRasterBand
     bool bFlushCacheAtClosingHasRun = false;
     bool bTruncatedFileAllowed = false;
 
+    // Read-only memory mapping of the band data, used by IRasterIO() when
+    // the RAW_USE_MMAP configuration option is set
+    CPLVirtualMem *psMMap = nullptr;
+    bool bMMapTried = false;
+
     GDALColorTable *poCT{};
     GDALColorInterp eInterp = GCI_Undefined;
 
@@ -247,6 +252,13 @@ class CPL_DLL RawRasterBand : public GDALPamRasterBand
     CPL_DISALLOW_COPY_ASSIGN(RawRasterBand)
 
     bool NeedsByteOrderChange() const;
+    const GByte *GetMMapData();
+    bool CanUseMMapIO(GDALRWFlag eRWFlag, int nXSize, int nYSize,
+                      int nBufXSize, int nBufYSize);
+    CPLErr MMapRasterIO(int nXOff, int nYOff, int nXSize, int nYSize,
+                        void *pData, GDALDataType eBufType,
+                        GSpacing nPixelSpace, GSpacing nLineSpace,
+                        GDALRasterIOExtraArg *psExtraArg);
     void DoByteSwap(void *pBuffer, size_t nValues, int nByteSkip,
                     bool bDiskToCPU) const;
     bool IsBIP() const;
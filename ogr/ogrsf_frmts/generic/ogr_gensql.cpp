@@ -15,14 +15,18 @@
 #include "ogr_p.h"
 #include "ogr_gensql.h"
 #include "cpl_string.h"
+#include "cpl_vsi.h"
 #include "ogr_api.h"
+#include "ogr_attrind.h"
 #include "ogr_recordbatch.h"
 #include "ogrlayerarrow.h"
 #include "cpl_time.h"
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 //! @cond Doxygen_Suppress
@@ -46,6 +50,604 @@ class OGRGenSQLGeomFieldDefn final : public OGRGeomFieldDefn
 
 OGRGenSQLGeomFieldDefn::~OGRGenSQLGeomFieldDefn() = default;
 
+/************************************************************************/
+/*                        OGRGenSQLJoinHashTable                        */
+/************************************************************************/
+
+// Features of a secondary layer indexed by the value of their join key, so
+// that a "primary.field = secondary.field" join can be resolved with a single
+// pass on the secondary layer, instead of setting an attribute filter on it
+// for each primary feature.
+// Features are stored serialized, in RAM up to a maximum size controlled by
+// the OGR_SQL_HASH_JOIN_MAX_RAM configuration option, and in a temporary file
+// beyond it. The keys are always kept in RAM and count towards that maximum:
+// when they exceed it on their own, the hash table is abandoned.
+
+class OGRGenSQLJoinHashTable
+{
+  public:
+    static std::unique_ptr<OGRGenSQLJoinHashTable>
+    Create(const swq_join_def *psJoinInfo, OGRLayer *poSrcLayer,
+           OGRLayer *poJoinLayer);
+
+    ~OGRGenSQLJoinHashTable();
+
+    bool Build();
+
+    bool Lookup(OGRFeature *poSrcFeat,
+                std::unique_ptr<OGRFeature> &poJoinFeature);
+
+  private:
+    enum class KeyType
+    {
+        INTEGER,
+        REAL,
+        STRING
+    };
+
+    struct Location
+    {
+        vsi_l_offset nOffset = 0;
+        size_t nFeatureSize = 0;
+        size_t nStyleSize = 0;
+        bool bInFile = false;
+    };
+
+    OGRLayer *const m_poJoinLayer;
+    const int m_iSrcField;
+    const int m_iJoinField;
+    const KeyType m_eKeyType;
+    const GIntBig m_nMaxRAM;
+
+    std::unordered_map<GIntBig, Location> m_oMapInteger{};
+    std::unordered_map<double, Location> m_oMapReal{};
+    std::unordered_map<std::string, Location> m_oMapString{};
+
+    size_t m_nMapRAM = 0;
+
+    std::vector<GByte> m_abyRAM{};
+    bool m_bRAMSpilled = false;
+    std::string m_osTmpFilename{};
+    VSILFILE *m_fpTmp = nullptr;
+    vsi_l_offset m_nTmpFileSize = 0;
+    std::vector<GByte> m_abyBuffer{};
+
+    OGRGenSQLJoinHashTable(OGRLayer *poJoinLayer, int iSrcField,
+                           int iJoinField, KeyType eKeyType, GIntBig nMaxRAM)
+        : m_poJoinLayer(poJoinLayer), m_iSrcField(iSrcField),
+          m_iJoinField(iJoinField), m_eKeyType(eKeyType), m_nMaxRAM(nMaxRAM)
+    {
+    }
+
+    static std::string GetStringKey(const char *pszValue);
+
+    bool OpenTmpFile();
+    bool Store(const OGRFeature *poFeature, Location &sLoc);
+    bool SpillRAM();
+    std::unique_ptr<OGRFeature> Load(const Location &sLoc);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGenSQLJoinHashTable)
+};
+
+/************************************************************************/
+/*                  OGRGenSQLJoinHashTable::Create()                  */
+/************************************************************************/
+
+/* Returns nullptr if the join is not a simple equality between a field of */
+/* the primary layer and a field of the secondary layer, of compatible types. */
+
+std::unique_ptr<OGRGenSQLJoinHashTable>
+OGRGenSQLJoinHashTable::Create(const swq_join_def *psJoinInfo,
+                               OGRLayer *poSrcLayer, OGRLayer *poJoinLayer)
+{
+    if (poJoinLayer == poSrcLayer ||
+        !CPLTestBool(CPLGetConfigOption("OGR_SQL_HASH_JOIN", "YES")))
+    {
+        return nullptr;
+    }
+
+    const swq_expr_node *poExpr = psJoinInfo->poExpr;
+    if (poExpr->eNodeType != SNT_OPERATION || poExpr->nOperation != SWQ_EQ ||
+        poExpr->nSubExprCount != 2)
+    {
+        return nullptr;
+    }
+
+    const swq_expr_node *poSrcColumn = poExpr->papoSubExpr[0];
+    const swq_expr_node *poJoinColumn = poExpr->papoSubExpr[1];
+    if (poSrcColumn->eNodeType != SNT_COLUMN ||
+        poJoinColumn->eNodeType != SNT_COLUMN)
+    {
+        return nullptr;
+    }
+    if (poSrcColumn->table_index != 0)
+        std::swap(poSrcColumn, poJoinColumn);
+    if (poSrcColumn->table_index != 0 ||
+        poJoinColumn->table_index != psJoinInfo->secondary_table)
+    {
+        return nullptr;
+    }
+
+    const auto GetKeyType = [](OGRFieldType eType, KeyType &eKeyType)
+    {
+        switch (eType)
+        {
+            case OFTInteger:
+            case OFTInteger64:
+                eKeyType = KeyType::INTEGER;
+                return true;
+            case OFTReal:
+                eKeyType = KeyType::REAL;
+                return true;
+            case OFTString:
+                eKeyType = KeyType::STRING;
+                return true;
+            default:
+                break;
+        }
+        return false;
+    };
+
+    // Only regular fields are supported on the secondary layer side
+    const OGRFeatureDefn *poJoinFDefn = poJoinLayer->GetLayerDefn();
+    const int iJoinField = poJoinColumn->field_index;
+    KeyType eKeyType = KeyType::INTEGER;
+    if (iJoinField < 0 || iJoinField >= poJoinFDefn->GetFieldCount() ||
+        !GetKeyType(poJoinFDefn->GetFieldDefn(iJoinField)->GetType(),
+                    eKeyType))
+    {
+        return nullptr;
+    }
+
+    // If the secondary layer has an attribute index on the key, looking up
+    // each primary feature is already efficient.
+    OGRLayerAttrIndex *poAttrIndex = poJoinLayer->GetIndex();
+    if (poAttrIndex && poAttrIndex->GetFieldIndex(iJoinField))
+        return nullptr;
+
+    // Drivers with a native SQL dialect translate attribute filters into
+    // their own queries, which are usually backed by an index, and whose
+    // semantics (e.g. case sensitivity of string comparisons) may differ
+    // from the OGR SQL ones implemented by the hash table.
+    if (GDALDataset *poJoinDS = poJoinLayer->GetDataset())
+    {
+        GDALDriver *poJoinDriver = poJoinDS->GetDriver();
+        const char *pszDialects =
+            poJoinDriver ? poJoinDriver->GetMetadataItem(
+                               GDAL_DMD_SUPPORTED_SQL_DIALECTS)
+                         : nullptr;
+        if (pszDialects)
+        {
+            const CPLStringList aosDialects(
+                CSLTokenizeString2(pszDialects, " ", 0));
+            for (int i = 0; i < aosDialects.size(); ++i)
+            {
+                if ((i == 0 && !EQUAL(aosDialects[i], "OGRSQL")) ||
+                    (!EQUAL(aosDialects[i], "OGRSQL") &&
+                     !EQUAL(aosDialects[i], "SQLITE")))
+                {
+                    return nullptr;
+                }
+            }
+        }
+    }
+
+    const OGRFeatureDefn *poSrcFDefn = poSrcLayer->GetLayerDefn();
+    const int iSrcField = poSrcColumn->field_index;
+    KeyType eSrcKeyType = KeyType::INTEGER;
+    if (iSrcField < 0)
+    {
+        return nullptr;
+    }
+    else if (iSrcField < poSrcFDefn->GetFieldCount())
+    {
+        if (!GetKeyType(poSrcFDefn->GetFieldDefn(iSrcField)->GetType(),
+                        eSrcKeyType))
+        {
+            return nullptr;
+        }
+    }
+    else if (iSrcField < poSrcFDefn->GetFieldCount() + SPECIAL_FIELD_COUNT)
+    {
+        switch (SpecialFieldTypes[iSrcField - poSrcFDefn->GetFieldCount()])
+        {
+            case SWQ_INTEGER:
+            case SWQ_INTEGER64:
+                eSrcKeyType = KeyType::INTEGER;
+                break;
+            case SWQ_FLOAT:
+                eSrcKeyType = KeyType::REAL;
+                break;
+            default:
+                eSrcKeyType = KeyType::STRING;
+                break;
+        }
+    }
+    else
+    {
+        return nullptr;
+    }
+
+    // Comparisons between keys of different types involve conversions that
+    // we do not attempt to replicate.
+    if (eSrcKeyType != eKeyType)
+        return nullptr;
+
+    GIntBig nMaxRAM = 0;
+    bool bUnitSpecified = false;
+    if (CPLParseMemorySize(
+            CPLGetConfigOption("OGR_SQL_HASH_JOIN_MAX_RAM", "10%"), &nMaxRAM,
+            &bUnitSpecified) != CE_None)
+    {
+        return nullptr;
+    }
+
+    return std::unique_ptr<OGRGenSQLJoinHashTable>(new OGRGenSQLJoinHashTable(
+        poJoinLayer, iSrcField, iJoinField, eKeyType, nMaxRAM));
+}
+
+/************************************************************************/
+/*                     ~OGRGenSQLJoinHashTable()                      */
+/************************************************************************/
+
+OGRGenSQLJoinHashTable::~OGRGenSQLJoinHashTable()
+{
+    if (m_fpTmp)
+    {
+        VSIFCloseL(m_fpTmp);
+        VSIUnlink(m_osTmpFilename.c_str());
+    }
+}
+
+/************************************************************************/
+/*               OGRGenSQLJoinHashTable::GetStringKey()               */
+/************************************************************************/
+
+/* String equality in OGR SQL is case insensitive */
+
+std::string OGRGenSQLJoinHashTable::GetStringKey(const char *pszValue)
+{
+    std::string osKey(pszValue);
+    for (char &ch : osKey)
+        ch = static_cast<char>(CPLTolower(static_cast<unsigned char>(ch)));
+    return osKey;
+}
+
+/************************************************************************/
+/*                  OGRGenSQLJoinHashTable::Build()                   */
+/************************************************************************/
+
+bool OGRGenSQLJoinHashTable::Build()
+{
+    m_poJoinLayer->SetAttributeFilter(nullptr);
+
+    bool bRet = true;
+    GIntBig nFeatures = 0;
+    for (auto &&poFeature : *m_poJoinLayer)
+    {
+        if (!poFeature->IsFieldSetAndNotNull(m_iJoinField))
+            continue;
+
+        // Only the first feature matching a given key is used, as with
+        // attribute filters.
+        Location *psLoc = nullptr;
+        switch (m_eKeyType)
+        {
+            case KeyType::INTEGER:
+            {
+                auto oRes = m_oMapInteger.try_emplace(
+                    poFeature->GetFieldAsInteger64(m_iJoinField));
+                if (oRes.second)
+                    psLoc = &(oRes.first->second);
+                break;
+            }
+
+            case KeyType::REAL:
+            {
+                const double dfValue =
+                    poFeature->GetFieldAsDouble(m_iJoinField);
+                if (std::isfinite(dfValue))
+                {
+                    auto oRes = m_oMapReal.try_emplace(dfValue);
+                    if (oRes.second)
+                        psLoc = &(oRes.first->second);
+                }
+                break;
+            }
+
+            case KeyType::STRING:
+            {
+                auto oRes = m_oMapString.try_emplace(
+                    GetStringKey(poFeature->GetFieldAsString(m_iJoinField)));
+                if (oRes.second)
+                    psLoc = &(oRes.first->second);
+                break;
+            }
+        }
+
+        if (psLoc)
+        {
+            // Approximate size of a node of the hash table: key, location,
+            // pointer to the next node and bucket.
+            size_t nKeySize = sizeof(GIntBig);
+            if (m_eKeyType == KeyType::STRING)
+            {
+                nKeySize = sizeof(std::string) +
+                           strlen(poFeature->GetFieldAsString(m_iJoinField));
+            }
+            m_nMapRAM += nKeySize + sizeof(Location) + 2 * sizeof(void *);
+
+            if (!Store(poFeature.get(), *psLoc))
+            {
+                bRet = false;
+                break;
+            }
+            ++nFeatures;
+
+            if (static_cast<GUIntBig>(m_nMapRAM) >
+                static_cast<GUIntBig>(m_nMaxRAM))
+            {
+                CPLDebug("GenSQL",
+                         "Keys of layer '%s' do not fit in "
+                         "OGR_SQL_HASH_JOIN_MAX_RAM. Not using a hash table",
+                         m_poJoinLayer->GetName());
+                bRet = false;
+                break;
+            }
+            if (!m_bRAMSpilled &&
+                static_cast<GUIntBig>(m_abyRAM.capacity() + m_nMapRAM) >
+                    static_cast<GUIntBig>(m_nMaxRAM) &&
+                !SpillRAM())
+            {
+                bRet = false;
+                break;
+            }
+        }
+    }
+    m_poJoinLayer->ResetReading();
+
+    if (bRet)
+    {
+        CPLDebug("GenSQL",
+                 "Hash table of layer '%s' built with " CPL_FRMT_GIB
+                 " features, " CPL_FRMT_GUIB " bytes in RAM and " CPL_FRMT_GUIB
+                 " bytes in temporary file",
+                 m_poJoinLayer->GetName(), nFeatures,
+                 static_cast<GUIntBig>(m_abyRAM.size() + m_nMapRAM),
+                 static_cast<GUIntBig>(m_nTmpFileSize));
+    }
+
+    return bRet;
+}
+
+/************************************************************************/
+/*               OGRGenSQLJoinHashTable::OpenTmpFile()                */
+/************************************************************************/
+
+bool OGRGenSQLJoinHashTable::OpenTmpFile()
+{
+    if (m_fpTmp == nullptr)
+    {
+        m_osTmpFilename = CPLGenerateTempFilenameSafe("ogr_sql_hash_join");
+        m_fpTmp = VSIFOpenL(m_osTmpFilename.c_str(), "wb+");
+        if (m_fpTmp == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                     m_osTmpFilename.c_str());
+            return false;
+        }
+        // Unlink immediately so that the file is cleaned up if the process
+        // is killed (at least on Linux)
+        VSIUnlink(m_osTmpFilename.c_str());
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                  OGRGenSQLJoinHashTable::Store()                   */
+/************************************************************************/
+
+bool OGRGenSQLJoinHashTable::Store(const OGRFeature *poFeature,
+                                   Location &sLoc)
+{
+    if (!poFeature->SerializeToBinary(m_abyBuffer))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Failed to serialize feature to buffer");
+        return false;
+    }
+    sLoc.nFeatureSize = m_abyBuffer.size();
+
+    // The style string is not part of the serialized feature.
+    if (const char *pszStyle = poFeature->GetStyleString())
+    {
+        sLoc.nStyleSize = strlen(pszStyle);
+        m_abyBuffer.insert(m_abyBuffer.end(), pszStyle,
+                           pszStyle + sLoc.nStyleSize);
+    }
+
+    const size_t nRAMSize = m_abyRAM.size() + m_abyBuffer.size();
+    if (!m_bRAMSpilled && static_cast<GUIntBig>(nRAMSize + m_nMapRAM) <=
+                              static_cast<GUIntBig>(m_nMaxRAM))
+    {
+        // Grow the buffer ourselves, so that its capacity does not go
+        // beyond the budget, as the doubling of insert() would.
+        if (nRAMSize > m_abyRAM.capacity())
+        {
+            m_abyRAM.reserve(static_cast<size_t>(std::min<GUIntBig>(
+                std::max(nRAMSize, 2 * m_abyRAM.capacity()),
+                static_cast<GUIntBig>(m_nMaxRAM) - m_nMapRAM)));
+        }
+        sLoc.nOffset = m_abyRAM.size();
+        m_abyRAM.insert(m_abyRAM.end(), m_abyBuffer.begin(),
+                        m_abyBuffer.end());
+        return true;
+    }
+
+    if (!OpenTmpFile())
+        return false;
+
+    sLoc.bInFile = true;
+    sLoc.nOffset = m_nTmpFileSize;
+    if (VSIFWriteL(m_abyBuffer.data(), 1, m_abyBuffer.size(), m_fpTmp) !=
+        m_abyBuffer.size())
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot write into %s",
+                 m_osTmpFilename.c_str());
+        return false;
+    }
+    m_nTmpFileSize += m_abyBuffer.size();
+    return true;
+}
+
+/************************************************************************/
+/*                 OGRGenSQLJoinHashTable::SpillRAM()                 */
+/************************************************************************/
+
+/* Moves the features stored in RAM to the temporary file, when the keys */
+/* leave no room for them in the budget. */
+
+bool OGRGenSQLJoinHashTable::SpillRAM()
+{
+    m_bRAMSpilled = true;
+    if (!m_abyRAM.empty())
+    {
+        if (!OpenTmpFile())
+            return false;
+        if (VSIFWriteL(m_abyRAM.data(), 1, m_abyRAM.size(), m_fpTmp) !=
+            m_abyRAM.size())
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot write into %s",
+                     m_osTmpFilename.c_str());
+            return false;
+        }
+
+        const vsi_l_offset nBaseOffset = m_nTmpFileSize;
+        const auto Relocate = [nBaseOffset](Location &sLoc)
+        {
+            if (!sLoc.bInFile)
+            {
+                sLoc.bInFile = true;
+                sLoc.nOffset += nBaseOffset;
+            }
+        };
+        for (auto &oIter : m_oMapInteger)
+            Relocate(oIter.second);
+        for (auto &oIter : m_oMapReal)
+            Relocate(oIter.second);
+        for (auto &oIter : m_oMapString)
+            Relocate(oIter.second);
+        m_nTmpFileSize += m_abyRAM.size();
+    }
+    std::vector<GByte>().swap(m_abyRAM);
+    return true;
+}
+
+/************************************************************************/
+/*                   OGRGenSQLJoinHashTable::Load()                   */
+/************************************************************************/
+
+std::unique_ptr<OGRFeature>
+OGRGenSQLJoinHashTable::Load(const Location &sLoc)
+{
+    const GByte *pabyData = nullptr;
+    if (sLoc.bInFile)
+    {
+        const size_t nSize = sLoc.nFeatureSize + sLoc.nStyleSize;
+        m_abyBuffer.resize(nSize);
+        if (VSIFSeekL(m_fpTmp, sLoc.nOffset, SEEK_SET) != 0 ||
+            VSIFReadL(m_abyBuffer.data(), 1, nSize, m_fpTmp) != nSize)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot read from %s",
+                     m_osTmpFilename.c_str());
+            return nullptr;
+        }
+        pabyData = m_abyBuffer.data();
+    }
+    else
+    {
+        pabyData = m_abyRAM.data() + static_cast<size_t>(sLoc.nOffset);
+    }
+
+    auto poFeature =
+        std::make_unique<OGRFeature>(m_poJoinLayer->GetLayerDefn());
+    if (!poFeature->DeserializeFromBinary(pabyData, sLoc.nFeatureSize))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Failed to deserialize feature from buffer");
+        return nullptr;
+    }
+    if (sLoc.nStyleSize)
+    {
+        poFeature->SetStyleString(
+            std::string(reinterpret_cast<const char *>(pabyData) +
+                            sLoc.nFeatureSize,
+                        sLoc.nStyleSize)
+                .c_str());
+    }
+    return poFeature;
+}
+
+/************************************************************************/
+/*                  OGRGenSQLJoinHashTable::Lookup()                  */
+/************************************************************************/
+
+/* Returns false if the key of the primary feature cannot be looked up in */
+/* the hash table, in which case the generic method must be used. */
+
+bool OGRGenSQLJoinHashTable::Lookup(OGRFeature *poSrcFeat,
+                                    std::unique_ptr<OGRFeature> &poJoinFeature)
+{
+    poJoinFeature.reset();
+
+    // if source key is null, we can't do join.
+    if (!poSrcFeat->IsFieldSetAndNotNull(m_iSrcField))
+        return true;
+
+    const Location *psLoc = nullptr;
+    switch (m_eKeyType)
+    {
+        case KeyType::INTEGER:
+        {
+            const auto oIter =
+                m_oMapInteger.find(poSrcFeat->GetFieldAsInteger64(m_iSrcField));
+            if (oIter != m_oMapInteger.end())
+                psLoc = &(oIter->second);
+            break;
+        }
+
+        case KeyType::REAL:
+        {
+            const auto oIter =
+                m_oMapReal.find(poSrcFeat->GetFieldAsDouble(m_iSrcField));
+            if (oIter != m_oMapReal.end())
+                psLoc = &(oIter->second);
+            break;
+        }
+
+        case KeyType::STRING:
+        {
+            // Values that look like timestamps are subject to special
+            // comparison rules in swq_op_general.cpp
+            const char *pszValue = poSrcFeat->GetFieldAsString(m_iSrcField);
+            const size_t nLen = strlen(pszValue);
+            if (nLen > 3 && (strcmp(pszValue + nLen - 3, "+00") == 0 ||
+                             pszValue[nLen - 3] == ':'))
+            {
+                return false;
+            }
+            const auto oIter = m_oMapString.find(GetStringKey(pszValue));
+            if (oIter != m_oMapString.end())
+                psLoc = &(oIter->second);
+            break;
+        }
+    }
+
+    if (psLoc)
+        poJoinFeature = Load(*psLoc);
+    return true;
+}
+
 /************************************************************************/
 /*                OGRGenSQLResultsLayerHasSpecialField()                */
 /************************************************************************/
@@ -1491,6 +2093,32 @@ static CPLString GetFilterForJoin(swq_expr_node *poExpr, OGRFeature *poSrcFeat,
     return "";
 }
 
+/************************************************************************/
+/*                         InitJoinHashTables()                         */
+/*                                                                      */
+/*      Build a hash table of the secondary layer of the joins that     */
+/*      support it, so that joined features can be found without        */
+/*      issuing an attribute filter for each primary feature.           */
+/************************************************************************/
+
+void OGRGenSQLResultsLayer::InitJoinHashTables()
+{
+    m_bJoinHashTablesInitialized = true;
+
+    swq_select *psSelectInfo = m_pSelectInfo.get();
+    for (int iJoin = 0; iJoin < psSelectInfo->join_count; iJoin++)
+    {
+        const swq_join_def *psJoinInfo = psSelectInfo->join_defs + iJoin;
+        OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
+
+        auto poHashTable = OGRGenSQLJoinHashTable::Create(
+            psJoinInfo, m_poSrcLayer, poJoinLayer);
+        if (poHashTable && !poHashTable->Build())
+            poHashTable.reset();
+        m_apoJoinHashTables.push_back(std::move(poHashTable));
+    }
+}
+
 /************************************************************************/
 /*                          TranslateFeature()                          */
 /************************************************************************/
@@ -1510,6 +2138,9 @@ std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
     apoFeatures.push_back(std::move(poSrcFeatUniquePtr));
     auto poSrcFeat = apoFeatures.front().get();
 
+    if (!m_bJoinHashTablesInitialized)
+        InitJoinHashTables();
+
     /* -------------------------------------------------------------------- */
     /*      Fetch the corresponding features from any jointed tables.       */
     /* -------------------------------------------------------------------- */
@@ -1524,6 +2155,15 @@ std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
 
         OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
 
+        std::unique_ptr<OGRFeature> poJoinFeature;
+
+        const auto &poHashTable = m_apoJoinHashTables[iJoin];
+        if (poHashTable && poHashTable->Lookup(poSrcFeat, poJoinFeature))
+        {
+            apoFeatures.push_back(std::move(poJoinFeature));
+            continue;
+        }
+
         const std::string osFilter =
             GetFilterForJoin(psJoinInfo->poExpr, poSrcFeat, poJoinLayer,
                              psJoinInfo->secondary_table);
@@ -1536,8 +2176,6 @@ std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
             continue;
         }
 
-        std::unique_ptr<OGRFeature> poJoinFeature;
-
         poJoinLayer->ResetReading();
         if (poJoinLayer->SetAttributeFilter(osFilter.c_str()) == OGRERR_NONE)
             poJoinFeature.reset(poJoinLayer->GetNextFeature());
@@ -39,6 +39,7 @@
 /************************************************************************/
 
 class swq_select;
+class OGRGenSQLJoinHashTable;
 
 class OGRGenSQLResultsLayer final : public OGRLayer
 {
@@ -74,8 +75,14 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     GIntBig m_nIteratedFeatures = -1;
     std::vector<std::string> m_aosDistinctList{};
 
+    // Hash tables of the secondary layers, for the joins that can be
+    // resolved that way (one entry per join, possibly null).
+    std::vector<std::unique_ptr<OGRGenSQLJoinHashTable>> m_apoJoinHashTables{};
+    bool m_bJoinHashTablesInitialized = false;
+
     bool PrepareSummary() const;
 
+    void InitJoinHashTables();
     std::unique_ptr<OGRFeature> TranslateFeature(std::unique_ptr<OGRFeature>);
     void CreateOrderByIndex();
     void ReadIndexFields(OGRFeature *poSrcFeat, int nOrderItems,
@@ -0,0 +1,52 @@
+# SPDX-License-Identifier: MIT
+
+# Compare the row-oriented SSE/AVX kernels of gdaldem with the per-pixel ones
+
+import timeit
+
+from osgeo import gdal
+
+tab_ds = {}
+for dt in (gdal.GDT_Int16, gdal.GDT_Float32):
+    tab_ds[dt] = gdal.Translate(
+        "",
+        "../autotest/gdrivers/data/n43.tif",
+        format="MEM",
+        width=4000,
+        height=4000,
+        outputType=dt,
+        resampleAlg="bilinear",
+    )
+
+tests = [
+    ("hillshade", {"xscale": 111120, "yscale": 111120 + 1}),
+    ("hillshade", {"scale": 111120}),
+    ("slope", {"scale": 111120}),
+    ("slope", {"scale": 111120, "slopeFormat": "percent"}),
+    ("aspect", {}),
+    ("TPI", {}),
+]
+
+
+def test(dt, alg, options):
+    gdal.DEMProcessing("", tab_ds[dt], alg, format="MEM", **options)
+
+
+NITERS = 5
+setup = "from osgeo import gdal; from __main__ import test"
+for dt in tab_ds:
+    for alg, options in tests:
+        timings = []
+        for use_sse in ("NO", "YES"):
+            with gdal.config_option("GDAL_USE_SSE", use_sse):
+                timings.append(
+                    timeit.timeit(
+                        f"test({dt}, {repr(alg)}, {repr(options)})",
+                        setup=setup,
+                        number=NITERS,
+                    )
+                )
+        print(
+            "%s(%s, %s): per-pixel %.3f, SIMD %.3f"
+            % (alg, gdal.GetDataTypeName(dt), options, timings[0], timings[1])
+        )
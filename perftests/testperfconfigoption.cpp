@@ -0,0 +1,108 @@
+/******************************************************************************
+ *
+ * Project:  CPL
+ * Purpose:  Test performance of concurrent configuration option lookups
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "cpl_multiproc.h"
+#include "cpl_string.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <vector>
+
+static void Usage()
+{
+    printf("Usage: testperfconfigoption [-lookups <N>] [-options <N>] "
+           "[-max_threads <N>]\n");
+    exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+    int nLookups = 1000 * 1000;
+    int nOptions = 30;
+    int nMaxThreads = 64;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-lookups") == 0 && i + 1 < argc)
+            nLookups = std::max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "-options") == 0 && i + 1 < argc)
+            nOptions = std::max(0, atoi(argv[++i]));
+        else if (strcmp(argv[i], "-max_threads") == 0 && i + 1 < argc)
+            nMaxThreads = std::max(1, atoi(argv[++i]));
+        else
+            Usage();
+    }
+
+    // Typical amount of global options, the looked up one being the last
+    for (int i = 0; i < nOptions; ++i)
+        CPLSetConfigOption(CPLSPrintf("TESTPERF_OPTION_%d", i), "YES");
+    CPLSetConfigOption("TESTPERF_LOOKED_UP_OPTION", "YES");
+
+    static const CPLCachedConfigOption oCachedOption(
+        "TESTPERF_LOOKED_UP_OPTION", "NO");
+
+    // Each thread does nLookups lookups
+    const auto Benchmark = [nLookups](int nThreads,
+                                      const std::function<bool()> &func)
+    {
+        std::atomic<int> nTrue{0};
+        std::vector<std::thread> aoThreads;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < nThreads; ++i)
+        {
+            aoThreads.emplace_back(
+                [nLookups, &func, &nTrue]()
+                {
+                    int nTrueThisThread = 0;
+                    for (int j = 0; j < nLookups; ++j)
+                        nTrueThisThread += func() ? 1 : 0;
+                    nTrue += nTrueThisThread;
+                });
+        }
+        for (auto &oThread : aoThreads)
+            oThread.join();
+        if (nTrue != nThreads * nLookups)
+        {
+            fprintf(stderr, "Wrong option value\n");
+            exit(1);
+        }
+        return std::chrono::duration<double, std::nano>(
+                   std::chrono::steady_clock::now() - start)
+                   .count() /
+               nLookups;
+    };
+
+    printf("%d lookups per thread, %d global options, %d CPUs\n", nLookups,
+           nOptions + 1, CPLGetNumCPUs());
+    printf("threads  CPLGetConfigOption() (ns)  CPLCachedConfigOption (ns)\n");
+    for (int nThreads = 1; nThreads <= nMaxThreads; nThreads *= 2)
+    {
+        const double dfGetConfigOption = Benchmark(
+            nThreads,
+            []()
+            {
+                return CPLTestBool(
+                    CPLGetConfigOption("TESTPERF_LOOKED_UP_OPTION", "NO"));
+            });
+        const double dfCached =
+            Benchmark(nThreads, []() { return oCachedOption.GetBool(); });
+        printf("%7d  %25.1f  %26.1f\n", nThreads, dfGetConfigOption,
+               dfCached);
+    }
+
+    return 0;
+}
@@ -0,0 +1,209 @@
+/******************************************************************************
+ *
+ * Project:  CPL
+ * Purpose:  Test performance of reading random tiles of a local GeoTIFF file
+ *           with VSIFReadMultiRangeL() and AdviseRead()
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
+#include "gdal_priv.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+static void Usage()
+{
+    printf("Usage: testperfreadmultirange [-tiles <N>] [-iterations <N>]\n"
+           "                              <tiled_geotiff_filename>\n"
+           "\n"
+           "To measure cold reads, drop the page cache between runs, e.g. "
+           "with\n"
+           "'echo 3 > /proc/sys/vm/drop_caches' on Linux.\n");
+    exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *pszFilename = nullptr;
+    int nTiles = 1000;
+    int nIterations = 5;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-tiles") == 0 && i + 1 < argc)
+            nTiles = std::max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "-iterations") == 0 && i + 1 < argc)
+            nIterations = std::max(1, atoi(argv[++i]));
+        else if (argv[i][0] == '-' || pszFilename)
+            Usage();
+        else
+            pszFilename = argv[i];
+    }
+    if (!pszFilename)
+        Usage();
+
+    GDALAllRegister();
+
+    // Collect the location of the tiles of the first band
+    std::vector<vsi_l_offset> anTileOffsets;
+    std::vector<size_t> anTileSizes;
+    {
+        auto poDS = std::unique_ptr<GDALDataset>(
+            GDALDataset::Open(pszFilename, GDAL_OF_RASTER));
+        if (!poDS || poDS->GetRasterCount() == 0)
+            return 1;
+        auto poBand = poDS->GetRasterBand(1);
+        int nBlockXSize = 0;
+        int nBlockYSize = 0;
+        poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+        const int nXBlocks = DIV_ROUND_UP(poDS->GetRasterXSize(), nBlockXSize);
+        const int nYBlocks = DIV_ROUND_UP(poDS->GetRasterYSize(), nBlockYSize);
+        for (int y = 0; y < nYBlocks; ++y)
+        {
+            for (int x = 0; x < nXBlocks; ++x)
+            {
+                const char *pszOffset = poBand->GetMetadataItem(
+                    CPLSPrintf("BLOCK_OFFSET_%d_%d", x, y), "TIFF");
+                const char *pszSize = poBand->GetMetadataItem(
+                    CPLSPrintf("BLOCK_SIZE_%d_%d", x, y), "TIFF");
+                if (pszOffset && pszSize && atoi(pszSize) > 0)
+                {
+                    anTileOffsets.push_back(
+                        std::strtoull(pszOffset, nullptr, 10));
+                    anTileSizes.push_back(static_cast<size_t>(
+                        std::strtoull(pszSize, nullptr, 10)));
+                }
+            }
+        }
+    }
+    if (anTileOffsets.empty())
+    {
+        fprintf(stderr, "%s is not a GeoTIFF file with allocated tiles\n",
+                pszFilename);
+        return 1;
+    }
+
+    // Pick random tiles, sorted by increasing offset as GTiff does
+    std::mt19937 oGenerator(0);
+    std::uniform_int_distribution<size_t> oDistribution(
+        0, anTileOffsets.size() - 1);
+    std::vector<size_t> anIndices(nTiles);
+    for (auto &nIdx : anIndices)
+        nIdx = oDistribution(oGenerator);
+    std::sort(anIndices.begin(), anIndices.end(),
+              [&anTileOffsets](size_t a, size_t b)
+              { return anTileOffsets[a] < anTileOffsets[b]; });
+
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    std::vector<std::vector<GByte>> aabyBuffers;
+    std::vector<void *> apData;
+    size_t nTotalSize = 0;
+    for (const size_t nIdx : anIndices)
+    {
+        anOffsets.push_back(anTileOffsets[nIdx]);
+        anSizes.push_back(anTileSizes[nIdx]);
+        aabyBuffers.emplace_back(anTileSizes[nIdx]);
+        apData.push_back(aabyBuffers.back().data());
+        nTotalSize += anTileSizes[nIdx];
+    }
+
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(pszFilename, "rb"));
+    if (!fp)
+        return 1;
+
+    const auto Benchmark = [nIterations](const char *pszMethod,
+                                         const std::function<bool()> &func)
+    {
+        double dfBest = 0;
+        for (int i = 0; i < nIterations; ++i)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            if (!func())
+            {
+                printf("%-28s  failed\n", pszMethod);
+                return;
+            }
+            const double dfElapsed =
+                std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - start)
+                    .count();
+            dfBest = i == 0 ? dfElapsed : std::min(dfBest, dfElapsed);
+        }
+        printf("%-28s  %10.2f\n", pszMethod, dfBest);
+    };
+
+    printf("%d tiles, %.1f MB, best of %d iterations\n", nTiles,
+           static_cast<double>(nTotalSize) / (1024 * 1024), nIterations);
+    printf("method                        time (ms)\n");
+
+    Benchmark("Seek() + Read()",
+              [&]()
+              {
+                  for (int i = 0; i < nTiles; ++i)
+                  {
+                      if (fp->Seek(anOffsets[i], SEEK_SET) != 0 ||
+                          fp->Read(apData[i], anSizes[i]) != anSizes[i])
+                          return false;
+                  }
+                  return true;
+              });
+
+    if (fp->HasPRead())
+    {
+        Benchmark("PRead()",
+                  [&]()
+                  {
+                      for (int i = 0; i < nTiles; ++i)
+                      {
+                          if (fp->PRead(apData[i], anSizes[i], anOffsets[i]) !=
+                              anSizes[i])
+                              return false;
+                      }
+                      return true;
+                  });
+    }
+
+    Benchmark("AdviseRead() + Read()",
+              [&]()
+              {
+                  fp->AdviseRead(nTiles, anOffsets.data(), anSizes.data());
+                  for (int i = 0; i < nTiles; ++i)
+                  {
+                      if (fp->Seek(anOffsets[i], SEEK_SET) != 0 ||
+                          fp->Read(apData[i], anSizes[i]) != anSizes[i])
+                          return false;
+                  }
+                  return true;
+              });
+
+    for (const char *pszUseIOURing : {"YES", "NO"})
+    {
+        CPLSetConfigOption("CPL_VSIL_USE_IO_URING", pszUseIOURing);
+        Benchmark(EQUAL(pszUseIOURing, "YES")
+                      ? "ReadMultiRange()"
+                      : "ReadMultiRange() no io_uring",
+                  [&]()
+                  {
+                      return fp->ReadMultiRange(nTiles, apData.data(),
+                                                anOffsets.data(),
+                                                anSizes.data()) == 0;
+                  });
+    }
+    CPLSetConfigOption("CPL_VSIL_USE_IO_URING", nullptr);
+
+    return 0;
+}
@@ -0,0 +1,113 @@
+/******************************************************************************
+ *
+ * Project:  CPL
+ * Purpose:  Test performance of job dispatching in CPLWorkerThreadPool
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "cpl_worker_thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+static void Usage()
+{
+    printf("Usage: testperfthreadpool [-jobs <N>] [-max_threads <N>]\n");
+    exit(1);
+}
+
+// Recursively split a range of nJobs empty jobs into two halves, so that
+// jobs are submitted from worker threads.
+static void SubmitRange(CPLWorkerThreadPool *poPool, std::atomic<int> *pnCounter,
+                        int nJobs)
+{
+    if (nJobs == 1)
+    {
+        (*pnCounter)++;
+        return;
+    }
+    auto poQueue = poPool->CreateJobQueue();
+    poQueue->SubmitJob([poPool, pnCounter, nJobs]
+                       { SubmitRange(poPool, pnCounter, nJobs / 2); });
+    poQueue->SubmitJob([poPool, pnCounter, nJobs] {
+        SubmitRange(poPool, pnCounter, nJobs - nJobs / 2);
+    });
+    poQueue->WaitCompletion();
+}
+
+int main(int argc, char *argv[])
+{
+    int nJobs = 1000 * 1000;
+    int nMaxThreads = 128;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-jobs") == 0 && i + 1 < argc)
+            nJobs = std::max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "-max_threads") == 0 && i + 1 < argc)
+            nMaxThreads = std::max(1, atoi(argv[++i]));
+        else
+            Usage();
+    }
+
+    printf("%d jobs, %d CPUs\n", nJobs, CPLGetNumCPUs());
+    printf("threads  mode           flat (ns/job)  nested (ns/job)\n");
+    for (int nThreads = 1; nThreads <= nMaxThreads; nThreads *= 2)
+    {
+        for (const bool bWorkStealing : {false, true})
+        {
+            CPLWorkerThreadPool oPool;
+            oPool.SetWorkStealing(bWorkStealing);
+            if (!oPool.Setup(nThreads, nullptr, nullptr, false))
+                return 1;
+
+            // Jobs submitted from the main thread
+            std::atomic<int> nCounter{0};
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < nJobs; ++i)
+                oPool.SubmitJob([&nCounter] { nCounter++; });
+            oPool.WaitCompletion();
+            const double dfFlat =
+                std::chrono::duration<double, std::nano>(
+                    std::chrono::steady_clock::now() - start)
+                    .count() /
+                nJobs;
+            if (nCounter != nJobs)
+            {
+                fprintf(stderr, "Wrong number of jobs run\n");
+                return 1;
+            }
+
+            // Jobs submitted from jobs
+            nCounter = 0;
+            start = std::chrono::steady_clock::now();
+            oPool.SubmitJob([&oPool, &nCounter, nJobs]
+                            { SubmitRange(&oPool, &nCounter, nJobs); });
+            oPool.WaitCompletion();
+            const double dfNested =
+                std::chrono::duration<double, std::nano>(
+                    std::chrono::steady_clock::now() - start)
+                    .count() /
+                nJobs;
+            if (nCounter != nJobs)
+            {
+                fprintf(stderr, "Wrong number of jobs run\n");
+                return 1;
+            }
+
+            printf("%7d  %-13s  %13.1f  %15.1f\n", nThreads,
+                   bWorkStealing ? "work-stealing" : "default", dfFlat,
+                   dfNested);
+        }
+    }
+
+    return 0;
+}
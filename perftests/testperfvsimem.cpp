@@ -0,0 +1,126 @@
+/******************************************************************************
+ *
+ * Project:  CPL
+ * Purpose:  Test performance of concurrent file creation, writing, reading
+ *           and deletion in /vsimem/
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "cpl_multiproc.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+static void Usage()
+{
+    printf("Usage: testperfvsimem [-files <N>] [-size <bytes>] "
+           "[-max_threads <N>]\n");
+    exit(1);
+}
+
+// Create, write, stat, read back and delete nFiles files.
+static bool Work(int iThread, int nFiles, const std::vector<GByte> &abyData)
+{
+    std::vector<GByte> abyRead(abyData.size());
+    for (int i = 0; i < nFiles; ++i)
+    {
+        const std::string osFilename(CPLSPrintf(
+            "/vsimem/testperfvsimem/thread_%d_file_%d.bin", iThread, i));
+        VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb");
+        if (!fp)
+            return false;
+        bool bOK = VSIFWriteL(abyData.data(), 1, abyData.size(), fp) ==
+                   abyData.size();
+        bOK &= VSIFCloseL(fp) == 0;
+
+        VSIStatBufL sStat;
+        bOK &= VSIStatL(osFilename.c_str(), &sStat) == 0 &&
+               static_cast<size_t>(sStat.st_size) == abyData.size();
+
+        fp = VSIFOpenL(osFilename.c_str(), "rb");
+        if (!fp)
+            return false;
+        bOK &= VSIFReadL(abyRead.data(), 1, abyRead.size(), fp) ==
+               abyRead.size();
+        bOK &= VSIFCloseL(fp) == 0;
+
+        bOK &= VSIUnlink(osFilename.c_str()) == 0;
+        if (!bOK)
+            return false;
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    int nFiles = 100 * 1000;
+    int nSize = 4096;
+    int nMaxThreads = 64;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-files") == 0 && i + 1 < argc)
+            nFiles = std::max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "-size") == 0 && i + 1 < argc)
+            nSize = std::max(0, atoi(argv[++i]));
+        else if (strcmp(argv[i], "-max_threads") == 0 && i + 1 < argc)
+            nMaxThreads = std::max(1, atoi(argv[++i]));
+        else
+            Usage();
+    }
+
+    const std::vector<GByte> abyData(nSize, 1);
+    VSIMkdir("/vsimem/testperfvsimem", 0755);
+
+    printf("%d files of %d bytes, %d CPUs\n", nFiles, nSize,
+           CPLGetNumCPUs());
+    printf("threads  time (ms)  files/s\n");
+    for (int nThreads = 1; nThreads <= nMaxThreads; nThreads *= 2)
+    {
+        // Split the same total number of files among threads
+        std::atomic<bool> bOK{true};
+        std::vector<std::thread> aoThreads;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < nThreads; ++i)
+        {
+            const int nFilesThisThread =
+                nFiles / nThreads + (i < nFiles % nThreads ? 1 : 0);
+            aoThreads.emplace_back(
+                [i, nFilesThisThread, &abyData, &bOK]()
+                {
+                    if (!Work(i, nFilesThisThread, abyData))
+                        bOK = false;
+                });
+        }
+        for (auto &oThread : aoThreads)
+            oThread.join();
+        const double dfElapsed = std::chrono::duration<double, std::milli>(
+                                     std::chrono::steady_clock::now() - start)
+                                     .count();
+        if (!bOK)
+        {
+            fprintf(stderr, "Failure with %d threads\n", nThreads);
+            return 1;
+        }
+
+        printf("%7d  %9.1f  %7.0f\n", nThreads, dfElapsed,
+               nFiles / (dfElapsed / 1000));
+    }
+
+    VSIRmdirRecursive("/vsimem/testperfvsimem");
+
+    return 0;
+}
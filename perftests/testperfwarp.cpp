@@ -0,0 +1,204 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Test performance of the bilinear and cubic warping kernels, with
+ *           and without their AVX2 implementation.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "cpl_string.h"
+#include "gdal.h"
+#include "gdal_alg.h"
+#include "gdalwarper.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+static void Usage()
+{
+    printf("Usage: testperfwarp [-size <N>] [-iterations <N>] "
+           "[-threads <N>]\n");
+    exit(1);
+}
+
+// Warp hSrcDS into hDstDS and return the content of the latter
+static std::vector<GByte> Warp(GDALDatasetH hSrcDS, GDALDatasetH hDstDS,
+                               GDALResampleAlg eResample, bool bNoData,
+                               int nThreads)
+{
+    const int nBands = GDALGetRasterCount(hSrcDS);
+    GDALWarpOptions *psOptions = GDALCreateWarpOptions();
+    psOptions->hSrcDS = hSrcDS;
+    psOptions->hDstDS = hDstDS;
+    psOptions->eResampleAlg = eResample;
+    psOptions->nBandCount = nBands;
+    psOptions->panSrcBands =
+        static_cast<int *>(CPLMalloc(sizeof(int) * nBands));
+    psOptions->panDstBands =
+        static_cast<int *>(CPLMalloc(sizeof(int) * nBands));
+    for (int i = 0; i < nBands; ++i)
+    {
+        psOptions->panSrcBands[i] = i + 1;
+        psOptions->panDstBands[i] = i + 1;
+    }
+    if (bNoData)
+    {
+        psOptions->padfSrcNoDataReal =
+            static_cast<double *>(CPLMalloc(sizeof(double) * nBands));
+        for (int i = 0; i < nBands; ++i)
+            psOptions->padfSrcNoDataReal[i] = 0;
+        psOptions->papszWarpOptions = CSLSetNameValue(
+            psOptions->papszWarpOptions, "UNIFIED_SRC_NODATA", "YES");
+    }
+    psOptions->papszWarpOptions =
+        CSLSetNameValue(psOptions->papszWarpOptions, "INIT_DEST", "0");
+    psOptions->papszWarpOptions =
+        CSLSetNameValue(psOptions->papszWarpOptions, "NUM_THREADS",
+                        CPLSPrintf("%d", nThreads));
+    psOptions->pTransformerArg =
+        GDALCreateGenImgProjTransformer2(hSrcDS, hDstDS, nullptr);
+    psOptions->pfnTransformer = GDALGenImgProjTransform;
+
+    GDALWarpOperationH hOperation = GDALCreateWarpOperation(psOptions);
+    const int nXSize = GDALGetRasterXSize(hDstDS);
+    const int nYSize = GDALGetRasterYSize(hDstDS);
+    if (!hOperation ||
+        GDALChunkAndWarpImage(hOperation, 0, 0, nXSize, nYSize) != CE_None)
+    {
+        fprintf(stderr, "Warping failed\n");
+        exit(1);
+    }
+    GDALDestroyWarpOperation(hOperation);
+    GDALDestroyGenImgProjTransformer(psOptions->pTransformerArg);
+    GDALDestroyWarpOptions(psOptions);
+
+    const GDALDataType eDT =
+        GDALGetRasterDataType(GDALGetRasterBand(hDstDS, 1));
+    std::vector<GByte> abyRet(static_cast<size_t>(nXSize) * nYSize * nBands *
+                              GDALGetDataTypeSizeBytes(eDT));
+    CPL_IGNORE_RET_VAL(GDALDatasetRasterIO(
+        hDstDS, GF_Read, 0, 0, nXSize, nYSize, abyRet.data(), nXSize, nYSize,
+        eDT, nBands, nullptr, 0, 0, 0));
+    return abyRet;
+}
+
+int main(int argc, char *argv[])
+{
+    int nSize = 4096;
+    int nIterations = 3;
+    int nThreads = 1;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-size") == 0 && i + 1 < argc)
+            nSize = std::max(16, atoi(argv[++i]));
+        else if (strcmp(argv[i], "-iterations") == 0 && i + 1 < argc)
+            nIterations = std::max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "-threads") == 0 && i + 1 < argc)
+            nThreads = std::max(1, atoi(argv[++i]));
+        else
+            Usage();
+    }
+
+    GDALAllRegister();
+    GDALDriverH hMEMDrv = GDALGetDriverByName("MEM");
+    if (!hMEMDrv)
+    {
+        fprintf(stderr, "MEM driver missing\n");
+        return 1;
+    }
+
+    const GDALDataType aeTypes[] = {GDT_UInt8, GDT_Int16, GDT_UInt16,
+                                    GDT_Float32};
+    const GDALResampleAlg aeResamples[] = {GRA_Bilinear, GRA_Cubic};
+    const int anBandCounts[] = {1, 3};
+
+    printf("%dx%d pixels, %d iteration(s), %d thread(s)\n", nSize, nSize,
+           nIterations, nThreads);
+    printf("type     resampling  bands  nodata  scalar (ms)  AVX2 (ms)\n");
+    for (const GDALDataType eDT : aeTypes)
+    {
+        for (const int nBands : anBandCounts)
+        {
+            GDALDatasetH hSrcDS = GDALCreate(hMEMDrv, "", nSize, nSize, nBands,
+                                             eDT, nullptr);
+            const double adfSrcGT[6] = {0, 1, 0, 0, 0, -1};
+            GDALSetGeoTransform(hSrcDS, adfSrcGT);
+            std::vector<float> afLine(nSize);
+            for (int iBand = 1; iBand <= nBands; ++iBand)
+            {
+                GDALRasterBandH hBand = GDALGetRasterBand(hSrcDS, iBand);
+                for (int iY = 0; iY < nSize; ++iY)
+                {
+                    // Sprinkle a few nodata (0) values
+                    for (int iX = 0; iX < nSize; ++iX)
+                        afLine[iX] = static_cast<float>(
+                            ((iX * 7 + iY * 13 + iBand * 17) % 251));
+                    CPL_IGNORE_RET_VAL(GDALRasterIO(hBand, GF_Write, 0, iY,
+                                                    nSize, 1, afLine.data(),
+                                                    nSize, 1, GDT_Float32, 0,
+                                                    0));
+                }
+            }
+
+            // Slightly rotated and zoomed destination, so that source
+            // coordinates are not aligned on the source grid
+            GDALDatasetH hDstDS = GDALCreate(hMEMDrv, "", nSize, nSize, nBands,
+                                             eDT, nullptr);
+            const double adfDstGT[6] = {0.3, 0.9, 0.05, -0.2, 0.04, -0.93};
+            GDALSetGeoTransform(hDstDS, adfDstGT);
+
+            for (const GDALResampleAlg eResample : aeResamples)
+            {
+                for (const bool bNoData : {false, true})
+                {
+                    double adfTime[2] = {0, 0};
+                    std::vector<GByte> aabyRes[2];
+                    for (int iMode = 0; iMode < 2; ++iMode)
+                    {
+                        CPLSetConfigOption("GDAL_USE_AVX",
+                                           iMode == 0 ? "NO" : "YES");
+                        for (int iIter = 0; iIter < nIterations; ++iIter)
+                        {
+                            const auto start =
+                                std::chrono::steady_clock::now();
+                            aabyRes[iMode] = Warp(hSrcDS, hDstDS, eResample,
+                                                  bNoData, nThreads);
+                            adfTime[iMode] +=
+                                std::chrono::duration<double, std::milli>(
+                                    std::chrono::steady_clock::now() - start)
+                                    .count();
+                        }
+                    }
+                    CPLSetConfigOption("GDAL_USE_AVX", nullptr);
+                    if (aabyRes[0] != aabyRes[1])
+                    {
+                        fprintf(stderr,
+                                "Results differ between scalar and AVX2 "
+                                "code paths\n");
+                        return 1;
+                    }
+
+                    printf("%-7s  %-10s  %5d  %-6s  %11.1f  %9.1f\n",
+                           GDALGetDataTypeName(eDT),
+                           eResample == GRA_Bilinear ? "bilinear" : "cubic",
+                           nBands, bNoData ? "yes" : "no",
+                           adfTime[0] / nIterations, adfTime[1] / nIterations);
+                }
+            }
+
+            GDALClose(hDstDS);
+            GDALClose(hSrcDS);
+        }
+    }
+
+    return 0;
+}
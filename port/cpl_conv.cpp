@@ -55,8 +55,11 @@
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
+#include <limits>
+#include <memory>
 #include <mutex>
 #include <set>
+#include <vector>
 
 #if HAVE_UNISTD_H
 #include <unistd.h>
@@ -110,8 +113,36 @@ void OGRAPISPYCPLSetThreadLocalConfigOption(const char *, const char *);
 // Uncomment to get list of options that have been fetched and set.
 // #define DEBUG_CONFIG_OPTIONS
 
+namespace
+{
+/** Immutable list of the global configuration options. A new snapshot is
+ * published by each change, so that readers do not need hConfigMutex. */
+struct CPLConfigOptionsSnapshot
+{
+    // KEY=VALUE items. They are shared with the previous and next snapshots,
+    // so that a value returned by CPLGetConfigOption() remains valid at least
+    // until the option is modified, as with a single CSL list.
+    std::vector<std::shared_ptr<const std::string>> apoItems{};
+    // Null terminated list of the c_str() of apoItems.
+    std::vector<const char *> apszList{nullptr};
+};
+
+/** Snapshot of the global configuration options used by the current
+ * thread, stored in CTLS_CONFIGOPTIONSSNAPSHOT. */
+struct CPLConfigOptionsSnapshotTLS
+{
+    uint64_t nGeneration = 0;
+    std::shared_ptr<const CPLConfigOptionsSnapshot> poSnapshot{};
+};
+}  // namespace
+
 static CPLMutex *hConfigMutex = nullptr;
-static volatile char **g_papszConfigOptions = nullptr;
+// Current snapshot, protected by hConfigMutex. Heap allocated so that it is
+// not destroyed before late calls to CPLGetConfigOption() at process exit.
+static std::shared_ptr<const CPLConfigOptionsSnapshot> *g_ppoConfigOptions =
+    nullptr;
+// Incremented each time *g_ppoConfigOptions is replaced.
+static std::atomic<uint64_t> g_nConfigOptionsGeneration{1};
 static bool gbIgnoreEnvVariables =
     false;  // if true, only take into account configuration options set through
             // configuration file or
@@ -1665,6 +1696,92 @@ static void CPLAccessConfigOption(const char *pszKey, bool bGet)
 }
 #endif
 
+/************************************************************************/
+/*                  CPLFreeConfigOptionsSnapshotTLS()                   */
+/************************************************************************/
+
+static void CPLFreeConfigOptionsSnapshotTLS(void *pData)
+{
+    delete static_cast<CPLConfigOptionsSnapshotTLS *>(pData);
+}
+
+/************************************************************************/
+/*                    CPLGetConfigOptionsSnapshot()                     */
+/************************************************************************/
+
+/** Return the snapshot of the global configuration options for the current
+ * thread, refreshing it if the options have changed since the last call.
+ *
+ * In the common case where the options have not changed, this does not take
+ * any lock.
+ *
+ * @param pbMemoryError set to true if the thread local storage could not be
+ *                      allocated.
+ * @return the snapshot, or nullptr if there is no global option.
+ */
+static const CPLConfigOptionsSnapshot *
+CPLGetConfigOptionsSnapshot(bool *pbMemoryError)
+{
+    int bMemoryError = FALSE;
+    auto psTLS = static_cast<CPLConfigOptionsSnapshotTLS *>(
+        CPLGetTLSEx(CTLS_CONFIGOPTIONSSNAPSHOT, &bMemoryError));
+    if (bMemoryError)
+    {
+        *pbMemoryError = true;
+        return nullptr;
+    }
+    *pbMemoryError = false;
+    if (psTLS == nullptr)
+    {
+        psTLS = new CPLConfigOptionsSnapshotTLS();
+        CPLSetTLSWithFreeFunc(CTLS_CONFIGOPTIONSSNAPSHOT, psTLS,
+                              CPLFreeConfigOptionsSnapshotTLS);
+    }
+
+    if (psTLS->nGeneration !=
+        g_nConfigOptionsGeneration.load(std::memory_order_acquire))
+    {
+        CPLMutexHolderD(&hConfigMutex);
+        psTLS->poSnapshot =
+            g_ppoConfigOptions ? *g_ppoConfigOptions : nullptr;
+        psTLS->nGeneration =
+            g_nConfigOptionsGeneration.load(std::memory_order_relaxed);
+    }
+    return psTLS->poSnapshot.get();
+}
+
+/************************************************************************/
+/*                  CPLPublishConfigOptionsSnapshot()                   */
+/************************************************************************/
+
+/** Replace the global configuration options with the passed items.
+ *
+ * Must be called with hConfigMutex held.
+ */
+static void CPLPublishConfigOptionsSnapshot(
+    std::vector<std::shared_ptr<const std::string>> &&apoItems)
+{
+    std::shared_ptr<CPLConfigOptionsSnapshot> poSnapshot;
+    if (!apoItems.empty())
+    {
+        poSnapshot = std::make_shared<CPLConfigOptionsSnapshot>();
+        poSnapshot->apoItems = std::move(apoItems);
+        poSnapshot->apszList.clear();
+        poSnapshot->apszList.reserve(poSnapshot->apoItems.size() + 1);
+        for (const auto &poItem : poSnapshot->apoItems)
+            poSnapshot->apszList.push_back(poItem->c_str());
+        poSnapshot->apszList.push_back(nullptr);
+    }
+
+    if (!g_ppoConfigOptions)
+    {
+        g_ppoConfigOptions =
+            new std::shared_ptr<const CPLConfigOptionsSnapshot>();
+    }
+    *g_ppoConfigOptions = std::move(poSnapshot);
+    g_nConfigOptionsGeneration.fetch_add(1, std::memory_order_release);
+}
+
 /************************************************************************/
 /*                         CPLGetConfigOption()                         */
 /************************************************************************/
@@ -1754,7 +1871,9 @@ const char *CPL_STDCALL CPLGetConfigOption(const char *pszKey,
 char **CPLGetConfigOptions(void)
 {
     CPLMutexHolderD(&hConfigMutex);
-    return CSLDuplicate(const_cast<char **>(g_papszConfigOptions));
+    if (!g_ppoConfigOptions || !*g_ppoConfigOptions)
+        return nullptr;
+    return CSLDuplicate((*g_ppoConfigOptions)->apszList.data());
 }
 
 /************************************************************************/
@@ -1778,10 +1897,15 @@ char **CPLGetConfigOptions(void)
  */
 void CPLSetConfigOptions(const char *const *papszConfigOptions)
 {
+    std::vector<std::shared_ptr<const std::string>> apoItems;
+    for (const char *const *papszIter = papszConfigOptions;
+         papszIter && *papszIter; ++papszIter)
+    {
+        apoItems.push_back(std::make_shared<const std::string>(*papszIter));
+    }
+
     CPLMutexHolderD(&hConfigMutex);
-    CSLDestroy(const_cast<char **>(g_papszConfigOptions));
-    g_papszConfigOptions = const_cast<volatile char **>(
-        CSLDuplicate(const_cast<char **>(papszConfigOptions)));
+    CPLPublishConfigOptionsSnapshot(std::move(apoItems));
 }
 
 /************************************************************************/
@@ -1845,10 +1969,22 @@ CPLGetGlobalConfigOption(const char *pszKey, const char *pszDefault,
     CPLAccessConfigOption(pszKey, TRUE);
 #endif
 
-    CPLMutexHolderD(&hConfigMutex);
-
-    const char *pszResult =
-        CSLFetchNameValue(const_cast<char **>(g_papszConfigOptions), pszKey);
+    const char *pszResult = nullptr;
+    bool bMemoryError = false;
+    const auto poSnapshot = CPLGetConfigOptionsSnapshot(&bMemoryError);
+    if (poSnapshot)
+    {
+        pszResult = CSLFetchNameValue(poSnapshot->apszList.data(), pszKey);
+    }
+    else if (bMemoryError)
+    {
+        CPLMutexHolderD(&hConfigMutex);
+        if (g_ppoConfigOptions && *g_ppoConfigOptions)
+        {
+            pszResult = CSLFetchNameValue(
+                (*g_ppoConfigOptions)->apszList.data(), pszKey);
+        }
+    }
 
     if (pszResult == nullptr || (bSubstituteNullValueMarkerWithNull &&
                                  strcmp(pszResult, CPL_NULL_VALUE) == 0))
@@ -1857,6 +1993,113 @@ CPLGetGlobalConfigOption(const char *pszKey, const char *pszDefault,
     return pszResult;
 }
 
+/************************************************************************/
+/*                        CPLCachedConfigOption                         */
+/************************************************************************/
+
+constexpr uint64_t CACHED_CONFIG_OPTION_UPDATING =
+    std::numeric_limits<uint64_t>::max();
+
+/** Constructor.
+ *
+ * @param pszKey the key of the option.
+ * @param pszDefault the default value if the option isn't found (may be NULL)
+ */
+CPLCachedConfigOption::CPLCachedConfigOption(const char *pszKey,
+                                             const char *pszDefault)
+    : m_osKey(pszKey), m_osDefault(pszDefault ? pszDefault : ""),
+      m_bHasDefault(pszDefault != nullptr)
+{
+}
+
+/** Return the value of the option, as with CPLGetConfigOption() */
+const char *CPLCachedConfigOption::GetValue() const
+{
+    return CPLGetConfigOption(m_osKey.c_str(),
+                              m_bHasDefault ? m_osDefault.c_str() : nullptr);
+}
+
+/** Make sure that the cached values are up to date.
+ *
+ * @return false if the cached values cannot be used, because the current
+ * thread has thread local options, or because another thread is updating
+ * them.
+ */
+bool CPLCachedConfigOption::Refresh() const
+{
+    int bMemoryError = FALSE;
+    const char *const *papszTLConfigOptions = static_cast<char **>(
+        CPLGetTLSEx(CTLS_CONFIGOPTIONS, &bMemoryError));
+    if (bMemoryError ||
+        (papszTLConfigOptions != nullptr && papszTLConfigOptions[0] != nullptr))
+    {
+        return false;
+    }
+
+    const uint64_t nGeneration =
+        g_nConfigOptionsGeneration.load(std::memory_order_acquire);
+    uint64_t nCachedGeneration = m_nGeneration.load(std::memory_order_acquire);
+    if (nCachedGeneration == nGeneration)
+        return true;
+
+    // Only one thread updates the cached values at a time
+    if (nCachedGeneration == CACHED_CONFIG_OPTION_UPDATING ||
+        !m_nGeneration.compare_exchange_strong(nCachedGeneration,
+                                               CACHED_CONFIG_OPTION_UPDATING,
+                                               std::memory_order_acq_rel))
+    {
+        return false;
+    }
+
+    // The value is at least as recent as nGeneration. If it is more recent,
+    // the next call will just update the cache again.
+    const char *pszValue = GetValue();
+    m_bValue.store(pszValue ? CPLTestBool(pszValue) : false,
+                   std::memory_order_relaxed);
+    m_nValue.store(pszValue ? CPLAtoGIntBig(pszValue) : 0,
+                   std::memory_order_relaxed);
+    m_dfValue.store(pszValue ? CPLAtof(pszValue) : 0.0,
+                    std::memory_order_relaxed);
+    m_nGeneration.store(nGeneration, std::memory_order_release);
+    return true;
+}
+
+/** Return the value of the option as a boolean, as with CPLTestBool().
+ *
+ * False is returned if the option is not set and there is no default value.
+ */
+bool CPLCachedConfigOption::GetBool() const
+{
+    if (Refresh())
+        return m_bValue.load(std::memory_order_relaxed);
+    const char *pszValue = GetValue();
+    return pszValue ? CPLTestBool(pszValue) : false;
+}
+
+/** Return the value of the option as an integer, as with CPLAtoGIntBig().
+ *
+ * 0 is returned if the option is not set and there is no default value.
+ */
+GIntBig CPLCachedConfigOption::GetInt() const
+{
+    if (Refresh())
+        return m_nValue.load(std::memory_order_relaxed);
+    const char *pszValue = GetValue();
+    return pszValue ? CPLAtoGIntBig(pszValue) : 0;
+}
+
+/** Return the value of the option as a double, as with CPLAtof().
+ *
+ * 0 is returned if the option is not set and there is no default value.
+ */
+double CPLCachedConfigOption::GetDouble() const
+{
+    if (Refresh())
+        return m_dfValue.load(std::memory_order_relaxed);
+    const char *pszValue = GetValue();
+    return pszValue ? CPLAtof(pszValue) : 0.0;
+}
+
 /************************************************************************/
 /*                   CPLSubscribeToSetConfigOption()                    */
 /************************************************************************/
@@ -2120,8 +2363,30 @@ void CPL_STDCALL CPLSetConfigOption(const char *pszKey, const char *pszValue)
 
     CPLSetConfigOptionDetectUnknownConfigOption(pszKey, pszValue);
 
-    g_papszConfigOptions = const_cast<volatile char **>(CSLSetNameValue(
-        const_cast<char **>(g_papszConfigOptions), pszKey, pszValue));
+    // Build the new snapshot from the current one, sharing the items of the
+    // other options.
+    std::vector<std::shared_ptr<const std::string>> apoItems;
+    int iItem = -1;
+    if (g_ppoConfigOptions && *g_ppoConfigOptions)
+    {
+        apoItems = (*g_ppoConfigOptions)->apoItems;
+        iItem = CSLFindName((*g_ppoConfigOptions)->apszList.data(), pszKey);
+    }
+    if (pszValue == nullptr)
+    {
+        if (iItem >= 0)
+            apoItems.erase(apoItems.begin() + iItem);
+    }
+    else
+    {
+        auto poItem = std::make_shared<const std::string>(
+            std::string(pszKey).append("=").append(pszValue));
+        if (iItem >= 0)
+            apoItems[iItem] = std::move(poItem);
+        else
+            apoItems.push_back(std::move(poItem));
+    }
+    CPLPublishConfigOptionsSnapshot(std::move(apoItems));
 
     NotifyOtherComponentsConfigOptionChanged(pszKey, pszValue,
                                              /*bTheadLocal=*/false);
@@ -2266,10 +2531,16 @@ void CPL_STDCALL CPLFreeConfig()
     {
         CPLMutexHolderD(&hConfigMutex);
 
-        CSLDestroy(const_cast<char **>(g_papszConfigOptions));
-        g_papszConfigOptions = nullptr;
+        delete g_ppoConfigOptions;
+        g_ppoConfigOptions = nullptr;
+        g_nConfigOptionsGeneration.fetch_add(1, std::memory_order_release);
 
         int bMemoryError = FALSE;
+        auto psSnapshotTLS = static_cast<CPLConfigOptionsSnapshotTLS *>(
+            CPLGetTLSEx(CTLS_CONFIGOPTIONSSNAPSHOT, &bMemoryError));
+        if (psSnapshotTLS != nullptr)
+            psSnapshotTLS->poSnapshot.reset();
+
         char **papszTLConfigOptions = reinterpret_cast<char **>(
             CPLGetTLSEx(CTLS_CONFIGOPTIONS, &bMemoryError));
         if (papszTLConfigOptions != nullptr)
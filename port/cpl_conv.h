@@ -474,6 +474,65 @@ extern "C++"
 #endif /* def __cplusplus */
 //! @endcond
 
+/* -------------------------------------------------------------------- */
+/*      C++ object for cached access to a config option                 */
+/* -------------------------------------------------------------------- */
+
+#if defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS)
+
+extern "C++"
+{
+#ifndef DOXYGEN_SKIP
+#include <atomic>
+#include <string>
+#endif
+
+    /** Cached and typed access to a configuration option, for options that
+     * are consulted in hot code paths (per block, per feature, ...).
+     *
+     * The value is looked up with CPLGetConfigOption() and parsed once, and
+     * is looked up again only after a change of the global configuration
+     * options. When the calling thread has options set with
+     * CPLSetThreadLocalConfigOption(), the cache is bypassed.
+     *
+     * Changes of environment variables made after the first lookup are only
+     * taken into account after a change of the global configuration options.
+     *
+     * Typical use is with a static instance:
+     * \code{.cpp}
+     * static const CPLCachedConfigOption oOpt("MY_OPTION", "NO");
+     * if (oOpt.GetBool()) { ... }
+     * \endcode
+     *
+     * @since GDAL 3.13
+     */
+    class CPL_DLL CPLCachedConfigOption
+    {
+        CPL_DISALLOW_COPY_ASSIGN(CPLCachedConfigOption)
+      public:
+        CPLCachedConfigOption(const char *pszKey, const char *pszDefault);
+
+        bool GetBool() const;
+        GIntBig GetInt() const;
+        double GetDouble() const;
+
+      private:
+        const std::string m_osKey;
+        const std::string m_osDefault;
+        const bool m_bHasDefault;
+
+        mutable std::atomic<uint64_t> m_nGeneration{0};
+        mutable std::atomic<bool> m_bValue{false};
+        mutable std::atomic<GIntBig> m_nValue{0};
+        mutable std::atomic<double> m_dfValue{0};
+
+        const char *GetValue() const;
+        bool Refresh() const;
+    };
+}
+
+#endif /* def __cplusplus */
+
 #if defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS)
 
 extern "C++"
@@ -83,6 +83,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "CLOUD_RUN_WORKER_POOL", // from cpl_google_cloud.cpp
    "COG_DELETE_TEMP_FILES", // from cogdriver.cpp
    "COG_TMP_COMPRESSION", // from cogdriver.cpp
+   "COG_TMP_MEMORY_LIMIT", // from cogdriver.cpp
    "COMPRESS_GEOM", // from ogrsqlitelayer.cpp
    "COMPRESS_OVERVIEW", // from gt_overview.cpp
    "CONVERT_YCBCR_TO_RGB", // from ecwdataset.cpp, geotiff.cpp, gtiffdataset.cpp, gtiffdataset_read.cpp, gtiffdataset_write.cpp, gtiffrasterband.cpp
@@ -134,17 +135,24 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "CPL_VSI_MEM_MTIME", // from cpl_vsi_mem.cpp
    "CPL_VSIAZ_UNLINK_BATCH_SIZE", // from cpl_vsil_az.cpp
    "CPL_VSIGS_UNLINK_BATCH_SIZE", // from cpl_vsil_gs.cpp
+   "CPL_VSIL_ASYNC_READ_NUM_THREADS", // from cpl_vsil.cpp
    "CPL_VSIL_CURL_ADVISE_READ_TOTAL_BYTES_LIMIT", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_ALLOWED_EXTENSIONS", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_ALLOWED_FILENAME", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_AUTHORIZATION_HEADER_ALLOWED_IF_REDIRECT", // from cpl_http.cpp, cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_CACHE_SIZE", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_CHUNK_SIZE", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_DISK_CACHE_DIR", // from cpl_vsil_curl_disk_cache.cpp
+   "CPL_VSIL_CURL_DISK_CACHE_SIZE", // from cpl_vsil_curl_disk_cache.cpp
    "CPL_VSIL_CURL_HONOR_CACHE_CONTROL", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_IGNORE_GLACIER_STORAGE", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_IGNORE_STORAGE_CLASSES", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_MAX_RANGES", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_NON_CACHED", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_PARALLEL_READ_NUM_CONNECTIONS", // from cpl_vsil_curl.cpp, cpl_vsil_s3.cpp
+   "CPL_VSIL_CURL_READ_AHEAD", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_READ_AHEAD_NUM_CONNECTIONS", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_READ_AHEAD_TOTAL_BYTES_LIMIT", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_SLOW_GET_SIZE", // from cpl_vsil_curl.cpp, cpl_vsil_curl_streaming.cpp
    "CPL_VSIL_CURL_STREMAING_SIMULATED_CURL_ERROR", // from cpl_vsil_curl_streaming.cpp
    "CPL_VSIL_CURL_USE_HEAD", // from cpl_vsil_curl.cpp
@@ -152,8 +160,11 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "CPL_VSIL_DEFLATE_CHUNK_SIZE", // from cpl_minizip_zip.cpp, cpl_vsil_gzip.cpp
    "CPL_VSIL_GZIP_SAVE_INFO", // from cpl_vsil_gzip.cpp
    "CPL_VSIL_GZIP_WRITE_PROPERTIES", // from cpl_vsil_gzip.cpp
+   "CPL_VSIL_LOCAL_ADVISE_READ_TOTAL_BYTES_LIMIT", // from cpl_vsil_unix_stdio_64.cpp
+   "CPL_VSIL_LOCAL_ASYNC_READ", // from cpl_vsil_unix_stdio_64.cpp
    "CPL_VSIL_NETWORK_STATS_ENABLED", // from cpl_vsil_curl.cpp
    "CPL_VSIL_SHOW_NETWORK_STATS", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_USE_IO_URING", // from cpl_vsil_unix_stdio_64.cpp
    "CPL_VSIL_USE_TEMP_FILE_FOR_RANDOM_WRITE", // from cpl_vsil_s3.cpp, ogrgeopackagedatasource.cpp, ogrlibkmldatasource.cpp, ogrsqlitedatasource.cpp
    "CPL_VSIL_ZIP_ALLOWED_EXTENSIONS", // from cpl_vsil_gzip.cpp
    "CPL_VSIS3_CREATE_DIR_OBJECT", // from cpl_vsil_s3.cpp
@@ -236,6 +247,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_BAG_BLOCK_SIZE", // from bagdataset.cpp
    "GDAL_BAG_MAX_SIZE_VARRES_MAP", // from bagdataset.cpp
    "GDAL_BAND_BLOCK_CACHE", // from gdalrasterband.cpp
+   "GDAL_BLOCK_CACHE_SHARDS", // from gdalrasterblock.cpp
    "GDAL_CACHE_DIRECTORY", // from gdal_misc.cpp
    "GDAL_CACHEMAX", // from gdalrasterblock.cpp, nearblack_bin.cpp
    "GDAL_CONFIG_FILE", // from cpl_conv.cpp
@@ -413,23 +425,25 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_SWATH_SIZE", // from gdalmultidim.cpp, rasterio.cpp
    "GDAL_TEMP_DRIVER_NAME", // from nearblack_lib_floodfill.cpp
    "GDAL_TERM_PROGRESS_OSC_9_4", // from cpl_progress.cpp
+   "GDAL_THREAD_POOL_WORK_STEALING", // from gdal_thread_pool.cpp
    "GDAL_THRESHOLD_MIN_THREADS_FOR_SPAWN", // from gdalalg_raster_tile.cpp
    "GDAL_THRESHOLD_MIN_TILES_PER_JOB", // from gdalalg_raster_tile.cpp
    "GDAL_TIFF_DEFLATE_SUBCODEC", // from gtiffdataset.cpp
    "GDAL_TIFF_ENDIANNESS", // from gtiffdataset_write.cpp
    "GDAL_TIFF_INTERNAL_MASK", // from gtiffdataset_write.cpp
    "GDAL_TIFF_INTERNAL_MASK_TO_8BIT", // from gtiffdataset.cpp, gtiffdataset_write.cpp
-   "GDAL_TIFF_OVR_BLOCKSIZE", // from geotiff.cpp
+   "GDAL_TIFF_OVR_BLOCKSIZE", // from cogdriver.cpp, geotiff.cpp
    "GDAL_TRY_PDS3_WITH_VICAR", // from pdsdrivercore.cpp
-   "GDAL_USE_AVX", // from gdalgrid.cpp
+   "GDAL_USE_AVX", // from gdalgrid.cpp, gdalwarpkernel.cpp
    "GDAL_USE_GEOJP2", // from gdaljp2metadata.cpp
    "GDAL_USE_GMLJP2", // from gdaljp2metadata.cpp
-   "GDAL_USE_SSE", // from gdalgrid.cpp
+   "GDAL_USE_SSE", // from gdaldem_lib.cpp, gdalgrid.cpp
    "GDAL_USE_SSSE3", // from cpl_cpu_features.cpp
    "GDAL_VALIDATE_CREATION_OPTIONS", // from gdaldataset.cpp, gdaldriver.cpp
    "GDAL_VECTOR_CONCAT_MAX_OPENED_DATASETS", // from gdalalg_vector_concat.cpp
    "GDAL_VRT_ENABLE_PYTHON", // from vrtderivedrasterband.cpp
    "GDAL_VRT_ENABLE_RAWRASTERBAND", // from vrtdataset.cpp
+   "GDAL_VRT_EXPRESSION_VECTORIZED", // from pixelfunctions.cpp
    "GDAL_VRT_PYTHON_EXCLUSIVE_LOCK", // from vrtderivedrasterband.cpp
    "GDAL_VRT_PYTHON_TRUSTED_MODULES", // from vrtderivedrasterband.cpp
    "GDAL_VRT_RAWRASTERBAND_ALLOWED_SOURCE", // from vrtrawrasterband.cpp
@@ -525,6 +539,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GS_SECRET_ACCESS_KEY", // from cpl_google_cloud.cpp
    "GS_USER_PROJECT", // from cpl_google_cloud.cpp
    "GTI_NUM_THREADS", // from gdaltileindexdataset.cpp
+   "GTIFF_ALLOW_ASYNC_READ", // from gtiffdataset_read.cpp
    "GTIFF_ALLOW_PREAD", // from gtiffdataset_read.cpp
    "GTIFF_ALPHA", // from gtiffdataset_write.cpp, gtiffrasterband_write.cpp
    "GTIFF_DELETE_ON_ERROR", // from gtiffdataset_write.cpp
@@ -825,6 +840,8 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_SHAPE_PACK_IN_PLACE", // from ogrshapedatasource.cpp, ogrshapelayer.cpp
    "OGR_SHAPE_USE_VSIMEM_FOR_TEMP", // from ogrshapedatasource.cpp
    "OGR_SKIP", // from gdaldrivermanager.cpp
+   "OGR_SQL_HASH_JOIN", // from ogr_gensql.cpp
+   "OGR_SQL_HASH_JOIN_MAX_RAM", // from ogr_gensql.cpp
    "OGR_SQL_LIKE_AS_ILIKE", // from ogrwfsfilter.cpp, swq_op_general.cpp
    "OGR_SQL_STRICT", // from swq.cpp
    "OGR_SQLITE_ALLOW_EXTERNAL_ACCESS", // from ogrsqlitesqlfunctionscommon.cpp
@@ -996,6 +1013,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "QHULL_LOG_TO_TEMP_FILE", // from delaunay.c
    "RAW_CHECK_FILE_SIZE", // from rawdataset.cpp
    "RAW_MEM_ALLOC_LIMIT_MB", // from rawdataset.cpp
+   "RAW_USE_MMAP", // from rawdataset.cpp
    "REPORT_COMPD_CS", // from dteddataset.cpp, srtmhgtdataset.cpp
    "RESTRICT_OUTPUT_DATASET_UPDATE", // from gdalwarp_lib.cpp
    "RL2_SHOW_ALL_PYRAMID_LEVELS", // from rasterlite2.cpp
@@ -546,6 +546,10 @@ void CPL_DLL VSIInstallSubFileHandler(void);
 void VSIInstallCurlFileHandler(void);
 void CPL_DLL VSICurlClearCache(void);
 void CPL_DLL VSICurlPartialClearCache(const char *pszFilenamePrefix);
+char CPL_DLL **VSICurlDiskCacheGetStatistics(void);
+int CPL_DLL VSICurlDiskCacheClear(void);
+int CPL_DLL VSICurlDiskCachePrewarm(const char *pszFilename,
+                                    vsi_l_offset nOffset, vsi_l_offset nSize);
 void VSIInstallCurlStreamingFileHandler(void);
 void VSIInstallS3FileHandler(void);
 void VSIInstallS3StreamingFileHandler(void);
@@ -24,12 +24,15 @@
 #include <fcntl.h>
 
 #include <algorithm>
+#include <array>
 #include <atomic>
+#include <functional>
 #include <map>
 #include <string>
 #include <utility>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <mutex>
 // c++17 or VS2017
@@ -89,11 +92,15 @@ constexpr const char *szHIDDEN_DIRNAME = "/vsimem/.#!HIDDEN!#.";
 /*
 ** Notes on Multithreading:
 **
-** VSIMemFilesystemHandler: This class maintains a mutex to protect
-** access and update of the oFileList array which has all the "files" in
-** the memory filesystem area.  It is expected that multiple threads would
-** want to create and read different files at the same time and so might
-** collide access oFileList without the mutex.
+** VSIMemFilesystemHandler: The "files" of the memory filesystem area are
+** spread over a fixed number of shards, selected by hashing the normalized
+** filename. Each shard has its own file list, protected by a shared mutex.
+** It is expected that multiple threads would want to create and read
+** different files at the same time: lookups (open, stat) only take the
+** shared lock of a single shard, and creation/deletion of a file only takes
+** the exclusive lock of its shard. Operations that work on a whole
+** hierarchy (ReadDir, RmdirRecursive, Rename) lock all shards, always in
+** the same order.
 **
 ** VSIMemFile: A mutex protects accesses to the file
 **
@@ -176,6 +183,11 @@ class VSIMemHandle final : public VSIVirtualHandle
 
     size_t PRead(void * /*pBuffer*/, size_t /* nSize */,
                  vsi_l_offset /*nOffset*/) const override;
+
+    std::unique_ptr<VSIAsyncReadRequest>
+    AsyncReadMultiRange(int nRanges, void **ppData,
+                        const vsi_l_offset *panOffsets, const size_t *panSizes,
+                        const VSIAsyncReadCallback &cbk) override;
 };
 
 /************************************************************************/
@@ -190,8 +202,22 @@ class VSIMemFilesystemHandler final : public VSIFilesystemHandler
     CPL_DISALLOW_COPY_ASSIGN(VSIMemFilesystemHandler)
 
   public:
-    std::map<std::string, std::shared_ptr<VSIMemFile>> oFileList{};
-    CPLMutex *hMutex = nullptr;
+    struct Shard
+    {
+        std::map<std::string, std::shared_ptr<VSIMemFile>> oFileList{};
+        CPL_SHARED_MUTEX_TYPE oMutex{};
+    };
+
+    static constexpr size_t SHARD_COUNT = 16;
+    std::array<Shard, SHARD_COUNT> aoShards{};
+
+    Shard &GetShard(const std::string &osFilename)
+    {
+        return aoShards[std::hash<std::string>{}(osFilename) % SHARD_COUNT];
+    }
+
+    std::vector<std::unique_ptr<CPL_SHARED_LOCK>> LockAllShardsShared();
+    std::vector<std::unique_ptr<CPL_EXCLUSIVE_LOCK>> LockAllShardsExclusive();
 
     explicit VSIMemFilesystemHandler(const char *pszPrefix)
         : m_osPrefix(pszPrefix)
@@ -222,8 +248,6 @@ class VSIMemFilesystemHandler final : public VSIFilesystemHandler
         return NormalizePath(osFilename);
     }
 
-    int Unlink_unlocked(const char *pszFilename);
-
     VSIFilesystemHandler *Duplicate(const char *pszPrefix) override
     {
         return new VSIMemFilesystemHandler(pszPrefix);
@@ -495,6 +519,30 @@ size_t VSIMemHandle::PRead(void *pBuffer, size_t nSize,
     return 0;
 }
 
+/************************************************************************/
+/*                        AsyncReadMultiRange()                         */
+/************************************************************************/
+
+// Copying from memory is not worth deferring to another thread, so the
+// ranges are read before returning. PRead() is used, so that, contrary to
+// the default implementation, the file position is left untouched and
+// concurrent requests on the same handle are safe.
+std::unique_ptr<VSIAsyncReadRequest>
+VSIMemHandle::AsyncReadMultiRange(int nRanges, void **ppData,
+                                  const vsi_l_offset *panOffsets,
+                                  const size_t *panSizes,
+                                  const VSIAsyncReadCallback &cbk)
+{
+    auto poRequest = std::make_unique<VSIAsyncReadRequest>(nRanges, cbk);
+    for (int i = 0; i < nRanges; ++i)
+    {
+        poRequest->SetRangeDone(
+            i, m_bReadAllowed &&
+                   PRead(ppData[i], panSizes[i], panOffsets[i]) == panSizes[i]);
+    }
+    return poRequest;
+}
+
 /************************************************************************/
 /*                               Write()                                */
 /************************************************************************/
@@ -601,11 +649,39 @@ int VSIMemHandle::Truncate(vsi_l_offset nNewSize)
 VSIMemFilesystemHandler::~VSIMemFilesystemHandler()
 
 {
-    oFileList.clear();
+    for (auto &oShard : aoShards)
+        oShard.oFileList.clear();
+}
+
+/************************************************************************/
+/*                        LockAllShardsShared()                         */
+/************************************************************************/
+
+std::vector<std::unique_ptr<CPL_SHARED_LOCK>>
+VSIMemFilesystemHandler::LockAllShardsShared()
+{
+    // Always lock shards in the same order to avoid dead locks
+    std::vector<std::unique_ptr<CPL_SHARED_LOCK>> apoLocks;
+    apoLocks.reserve(SHARD_COUNT);
+    for (auto &oShard : aoShards)
+        apoLocks.push_back(std::make_unique<CPL_SHARED_LOCK>(oShard.oMutex));
+    return apoLocks;
+}
+
+/************************************************************************/
+/*                       LockAllShardsExclusive()                       */
+/************************************************************************/
 
-    if (hMutex != nullptr)
-        CPLDestroyMutex(hMutex);
-    hMutex = nullptr;
+std::vector<std::unique_ptr<CPL_EXCLUSIVE_LOCK>>
+VSIMemFilesystemHandler::LockAllShardsExclusive()
+{
+    // Always lock shards in the same order to avoid dead locks
+    std::vector<std::unique_ptr<CPL_EXCLUSIVE_LOCK>> apoLocks;
+    apoLocks.reserve(SHARD_COUNT);
+    for (auto &oShard : aoShards)
+        apoLocks.push_back(
+            std::make_unique<CPL_EXCLUSIVE_LOCK>(oShard.oMutex));
+    return apoLocks;
 }
 
 /************************************************************************/
@@ -617,7 +693,6 @@ VSIMemFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
                               bool bSetError, CSLConstList /* papszOptions */)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
     const CPLString osFilename = NormalizePath(pszFilename);
     if (osFilename.empty())
         return nullptr;
@@ -633,11 +708,15 @@ VSIMemFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
     /* -------------------------------------------------------------------- */
     /*      Get the filename we are opening, create if needed.              */
     /* -------------------------------------------------------------------- */
+    Shard &oShard = GetShard(osFilename);
     std::shared_ptr<VSIMemFile> poFile = nullptr;
-    const auto oIter = oFileList.find(osFilename);
-    if (oIter != oFileList.end())
     {
-        poFile = oIter->second;
+        CPL_SHARED_LOCK oLock(oShard.oMutex);
+        const auto oIter = oShard.oFileList.find(osFilename);
+        if (oIter != oShard.oFileList.end())
+        {
+            poFile = oIter->second;
+        }
     }
 
     // If no file and opening in read, error out.
@@ -653,8 +732,11 @@ VSIMemFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
     }
 
     // Create.
+    bool bCreated = false;
     if (poFile == nullptr)
     {
+        // Must be done without holding the shard lock, as it recurses into
+        // Stat() and Mkdir()
         const std::string osFileDir = CPLGetPathSafe(osFilename.c_str());
         if (VSIMkdirRecursive(osFileDir.c_str(), 0755) == -1)
         {
@@ -668,17 +750,25 @@ VSIMemFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
             return nullptr;
         }
 
-        poFile = std::make_shared<VSIMemFile>();
-        poFile->osFilename = osFilename;
-        oFileList[poFile->osFilename] = poFile;
+        CPL_EXCLUSIVE_LOCK oLock(oShard.oMutex);
+        auto &poEntry = oShard.oFileList[osFilename];
+        // Another thread may have created it in the meantime
+        if (poEntry == nullptr)
+        {
+            poEntry = std::make_shared<VSIMemFile>();
+            poEntry->osFilename = osFilename;
+            poEntry->nMaxLength = nMaxLength;
+            bCreated = true;
+        }
+        poFile = poEntry;
 #ifdef DEBUG_VERBOSE
         CPLDebug("VSIMEM", "Creating file %s: ref_count=%d", pszFilename,
                  static_cast<int>(poFile.use_count()));
 #endif
-        poFile->nMaxLength = nMaxLength;
     }
+
     // Overwrite
-    else if (strstr(pszAccess, "w"))
+    if (!bCreated && strstr(pszAccess, "w"))
     {
         CPL_EXCLUSIVE_LOCK oLock(poFile->m_oMutex);
         poFile->SetLength(0);
@@ -728,8 +818,6 @@ int VSIMemFilesystemHandler::Stat(const char *pszFilename,
                                   VSIStatBufL *pStatBuf, int /* nFlags */)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const CPLString osFilename = NormalizePath(pszFilename);
 
     memset(pStatBuf, 0, sizeof(VSIStatBufL));
@@ -741,15 +829,19 @@ int VSIMemFilesystemHandler::Stat(const char *pszFilename,
         return 0;
     }
 
-    auto oIter = oFileList.find(osFilename);
-    if (oIter == oFileList.end())
+    std::shared_ptr<VSIMemFile> poFile;
     {
-        errno = ENOENT;
-        return -1;
+        Shard &oShard = GetShard(osFilename);
+        CPL_SHARED_LOCK oLock(oShard.oMutex);
+        auto oIter = oShard.oFileList.find(osFilename);
+        if (oIter == oShard.oFileList.end())
+        {
+            errno = ENOENT;
+            return -1;
+        }
+        poFile = oIter->second;
     }
 
-    std::shared_ptr<VSIMemFile> poFile = oIter->second;
-
     memset(pStatBuf, 0, sizeof(VSIStatBufL));
 
     CPL_SHARED_LOCK oLock(poFile->m_oMutex);
@@ -783,20 +875,12 @@ int VSIMemFilesystemHandler::Stat(const char *pszFilename,
 
 int VSIMemFilesystemHandler::Unlink(const char *pszFilename)
 
-{
-    CPLMutexHolder oHolder(&hMutex);
-    return Unlink_unlocked(pszFilename);
-}
-
-/************************************************************************/
-/*                          Unlink_unlocked()                           */
-/************************************************************************/
-
-int VSIMemFilesystemHandler::Unlink_unlocked(const char *pszFilename)
-
 {
     const CPLString osFilename = NormalizePath(pszFilename);
 
+    Shard &oShard = GetShard(osFilename);
+    CPL_EXCLUSIVE_LOCK oLock(oShard.oMutex);
+    auto &oFileList = oShard.oFileList;
     auto oIter = oFileList.find(osFilename);
     if (oIter == oFileList.end())
     {
@@ -821,8 +905,6 @@ int VSIMemFilesystemHandler::Unlink_unlocked(const char *pszFilename)
 int VSIMemFilesystemHandler::Mkdir(const char *pszPathname, long /* nMode */)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const CPLString osPathname = NormalizePath(pszPathname);
     if (STARTS_WITH(osPathname.c_str(), szHIDDEN_DIRNAME))
     {
@@ -837,7 +919,9 @@ int VSIMemFilesystemHandler::Mkdir(const char *pszPathname, long /* nMode */)
         // accept creating an explicit directory
     }
 
-    if (oFileList.find(osPathname) != oFileList.end())
+    Shard &oShard = GetShard(osPathname);
+    CPL_EXCLUSIVE_LOCK oLock(oShard.oMutex);
+    if (oShard.oFileList.find(osPathname) != oShard.oFileList.end())
     {
         errno = EEXIST;
         return -1;
@@ -846,7 +930,7 @@ int VSIMemFilesystemHandler::Mkdir(const char *pszPathname, long /* nMode */)
     std::shared_ptr<VSIMemFile> poFile = std::make_shared<VSIMemFile>();
     poFile->osFilename = osPathname;
     poFile->bIsDirectory = true;
-    oFileList[osPathname] = poFile;
+    oShard.oFileList[osPathname] = poFile;
 #ifdef DEBUG_VERBOSE
     CPLDebug("VSIMEM", "Mkdir on %s: ref_count=%d", pszPathname,
              static_cast<int>(poFile.use_count()));
@@ -871,53 +955,61 @@ int VSIMemFilesystemHandler::Rmdir(const char *pszPathname)
 
 int VSIMemFilesystemHandler::RmdirRecursive(const char *pszDirname)
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const CPLString osPath = NormalizePath(pszDirname);
     const size_t nPathLen = osPath.size();
+
+    const auto apoLocks = LockAllShardsExclusive();
+
     int ret = 0;
     if (osPath == "/vsimem")
     {
         // Clean-up all files under pszDirname, except hidden directories
         // if called from "/vsimem"
-        for (auto iter = oFileList.begin(); iter != oFileList.end();
-             /* no automatic increment */)
+        for (auto &oShard : aoShards)
         {
-            const char *pszFilePath = iter->second->osFilename.c_str();
-            const size_t nFileLen = iter->second->osFilename.size();
-            if (nFileLen > nPathLen &&
-                memcmp(pszFilePath, osPath.c_str(), nPathLen) == 0 &&
-                pszFilePath[nPathLen] == '/' &&
-                !STARTS_WITH(pszFilePath, szHIDDEN_DIRNAME))
-            {
-                iter = oFileList.erase(iter);
-            }
-            else
+            auto &oFileList = oShard.oFileList;
+            for (auto iter = oFileList.lower_bound(osPath);
+                 iter != oFileList.end() &&
+                 iter->first.compare(0, nPathLen, osPath) == 0;
+                 /* no automatic increment */)
             {
-                ++iter;
+                const char *pszFilePath = iter->first.c_str();
+                if (iter->first.size() > nPathLen &&
+                    pszFilePath[nPathLen] == '/' &&
+                    !STARTS_WITH(pszFilePath, szHIDDEN_DIRNAME))
+                {
+                    iter = oFileList.erase(iter);
+                }
+                else
+                {
+                    ++iter;
+                }
             }
         }
     }
     else
     {
         ret = -1;
-        for (auto iter = oFileList.begin(); iter != oFileList.end();
-             /* no automatic increment */)
+        for (auto &oShard : aoShards)
         {
-            const char *pszFilePath = iter->second->osFilename.c_str();
-            const size_t nFileLen = iter->second->osFilename.size();
-            if (nFileLen >= nPathLen &&
-                memcmp(pszFilePath, osPath.c_str(), nPathLen) == 0 &&
-                (nFileLen == nPathLen || pszFilePath[nPathLen] == '/'))
+            auto &oFileList = oShard.oFileList;
+            for (auto iter = oFileList.lower_bound(osPath);
+                 iter != oFileList.end() &&
+                 iter->first.compare(0, nPathLen, osPath) == 0;
+                 /* no automatic increment */)
             {
-                // If VSIRmdirRecursive() is used correctly, it should at
-                // least delete the directory on which it has been called
-                ret = 0;
-                iter = oFileList.erase(iter);
-            }
-            else
-            {
-                ++iter;
+                if (iter->first.size() == nPathLen ||
+                    iter->first[nPathLen] == '/')
+                {
+                    // If VSIRmdirRecursive() is used correctly, it should at
+                    // least delete the directory on which it has been called
+                    ret = 0;
+                    iter = oFileList.erase(iter);
+                }
+                else
+                {
+                    ++iter;
+                }
             }
         }
 
@@ -935,98 +1027,55 @@ int VSIMemFilesystemHandler::RmdirRecursive(const char *pszDirname)
 char **VSIMemFilesystemHandler::ReadDirEx(const char *pszPath, int nMaxFiles)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const CPLString osPath = NormalizePath(pszPath);
-
-    char **papszDir = nullptr;
     const size_t nPathLen = osPath.size();
 
-    // In case of really big number of files in the directory, CSLAddString
-    // can be slow (see #2158). We then directly build the list.
-    int nItems = 0;
-    int nAllocatedItems = 0;
+    // Special mode for hidden filenames.
+    // "/vsimem/.#!HIDDEN!#./{counter}" subdirectories are not explicitly
+    // created so they do not appear in the file lists, but their subcontent
+    // (e.g "/vsimem/.#!HIDDEN!#./{counter}/foo") does
+    const bool bHiddenDir = osPath == szHIDDEN_DIRNAME;
 
-    if (osPath == szHIDDEN_DIRNAME)
+    // Entries of a directory are spread over all shards. Collect them in
+    // a set so that they are returned sorted, as with a single file list.
+    std::set<std::string> oSetItems;
     {
-        // Special mode for hidden filenames.
-        // "/vsimem/.#!HIDDEN!#./{counter}" subdirectories are not explicitly
-        // created so they do not appear in oFileList, but their subcontent
-        // (e.g "/vsimem/.#!HIDDEN!#./{counter}/foo") does
-        std::set<std::string> oSetSubDirs;
-        for (const auto &iter : oFileList)
+        const auto apoLocks = LockAllShardsShared();
+        for (const auto &oShard : aoShards)
         {
-            const char *pszFilePath = iter.second->osFilename.c_str();
-            if (iter.second->osFilename.size() > nPathLen &&
-                memcmp(pszFilePath, osPath.c_str(), nPathLen) == 0)
+            const auto &oFileList = oShard.oFileList;
+            for (auto iter = oFileList.lower_bound(osPath);
+                 iter != oFileList.end() &&
+                 iter->first.compare(0, nPathLen, osPath) == 0;
+                 ++iter)
             {
-                char *pszItem = CPLStrdup(pszFilePath + nPathLen + 1);
-                char *pszSlash = strchr(pszItem, '/');
-                if (pszSlash)
-                    *pszSlash = 0;
-                if (cpl::contains(oSetSubDirs, pszItem))
-                {
-                    CPLFree(pszItem);
+                const std::string &osFilePath = iter->first;
+                if (osFilePath.size() <= nPathLen)
                     continue;
-                }
-                oSetSubDirs.insert(pszItem);
-
-                if (nItems == 0)
+                if (bHiddenDir)
                 {
-                    papszDir =
-                        static_cast<char **>(CPLCalloc(2, sizeof(char *)));
-                    nAllocatedItems = 1;
+                    oSetItems.insert(osFilePath.substr(
+                        nPathLen + 1,
+                        osFilePath.find('/', nPathLen + 1) - (nPathLen + 1)));
                 }
-                else if (nItems >= nAllocatedItems)
+                else if (osFilePath[nPathLen] == '/' &&
+                         osFilePath.find('/', nPathLen + 1) ==
+                             std::string::npos)
                 {
-                    nAllocatedItems = nAllocatedItems * 2;
-                    papszDir = static_cast<char **>(CPLRealloc(
-                        papszDir, (nAllocatedItems + 2) * sizeof(char *)));
+                    oSetItems.insert(osFilePath.substr(nPathLen + 1));
                 }
-
-                papszDir[nItems] = pszItem;
-                papszDir[nItems + 1] = nullptr;
-
-                nItems++;
-                if (nMaxFiles > 0 && nItems > nMaxFiles)
-                    break;
             }
         }
     }
-    else
-    {
-        for (const auto &iter : oFileList)
-        {
-            const char *pszFilePath = iter.second->osFilename.c_str();
-            if (iter.second->osFilename.size() > nPathLen &&
-                memcmp(pszFilePath, osPath.c_str(), nPathLen) == 0 &&
-                pszFilePath[nPathLen] == '/' &&
-                strstr(pszFilePath + nPathLen + 1, "/") == nullptr)
-            {
-                if (nItems == 0)
-                {
-                    papszDir =
-                        static_cast<char **>(CPLCalloc(2, sizeof(char *)));
-                    nAllocatedItems = 1;
-                }
-                else if (nItems >= nAllocatedItems)
-                {
-                    nAllocatedItems = nAllocatedItems * 2;
-                    papszDir = static_cast<char **>(CPLRealloc(
-                        papszDir, (nAllocatedItems + 2) * sizeof(char *)));
-                }
 
-                papszDir[nItems] = CPLStrdup(pszFilePath + nPathLen + 1);
-                papszDir[nItems + 1] = nullptr;
-
-                nItems++;
-                if (nMaxFiles > 0 && nItems > nMaxFiles)
-                    break;
-            }
-        }
+    CPLStringList aosDir;
+    for (const auto &osItem : oSetItems)
+    {
+        aosDir.AddString(osItem);
+        if (nMaxFiles > 0 && aosDir.size() > nMaxFiles)
+            break;
     }
-
-    return papszDir;
+    return aosDir.StealList();
 }
 
 /************************************************************************/
@@ -1038,8 +1087,6 @@ int VSIMemFilesystemHandler::Rename(const char *pszOldPath,
                                     void *)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const std::string osOldPath = NormalizePath(pszOldPath);
     const std::string osNewPath = NormalizePath(pszNewPath);
     if (!STARTS_WITH(pszNewPath, m_osPrefix.c_str()))
@@ -1048,31 +1095,48 @@ int VSIMemFilesystemHandler::Rename(const char *pszOldPath,
     if (osOldPath.compare(osNewPath) == 0)
         return 0;
 
-    if (oFileList.find(osOldPath) == oFileList.end())
+    const auto apoLocks = LockAllShardsExclusive();
+
+    const auto &oOldFileList = GetShard(osOldPath).oFileList;
+    if (oOldFileList.find(osOldPath) == oOldFileList.end())
     {
         errno = ENOENT;
         return -1;
     }
 
-    std::map<std::string, std::shared_ptr<VSIMemFile>>::iterator it =
-        oFileList.find(osOldPath);
-    while (it != oFileList.end() && it->first.find(osOldPath) == 0)
+    // Detach the file, or the directory and its content, from all shards
+    // before re-inserting them under their new name.
+    std::vector<std::pair<std::string, std::shared_ptr<VSIMemFile>>> aoMoved;
+    for (auto &oShard : aoShards)
     {
-        const std::string osRemainder = it->first.substr(osOldPath.size());
-        if (osRemainder.empty() || osRemainder[0] == '/')
-        {
-            const std::string osNewFullPath = osNewPath + osRemainder;
-            Unlink_unlocked(osNewFullPath.c_str());
-            oFileList[osNewFullPath] = it->second;
-            it->second->osFilename = osNewFullPath;
-            oFileList.erase(it++);
-        }
-        else
+        auto &oFileList = oShard.oFileList;
+        for (auto it = oFileList.lower_bound(osOldPath);
+             it != oFileList.end() &&
+             it->first.compare(0, osOldPath.size(), osOldPath) == 0;
+             /* no automatic increment */)
         {
-            ++it;
+            const std::string osRemainder = it->first.substr(osOldPath.size());
+            if (osRemainder.empty() || osRemainder[0] == '/')
+            {
+                aoMoved.emplace_back(osNewPath + osRemainder,
+                                     std::move(it->second));
+                it = oFileList.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
         }
     }
 
+    for (auto &oMoved : aoMoved)
+    {
+        oMoved.second->osFilename = oMoved.first;
+        // Replaces any existing file with the same name
+        GetShard(oMoved.first).oFileList[oMoved.first] =
+            std::move(oMoved.second);
+    }
+
     return 0;
 }
 
@@ -1234,9 +1298,10 @@ VSILFILE *VSIFileFromMemBuffer(const char *pszFilename, GByte *pabyData,
 
     if (!osFilename.empty())
     {
-        CPLMutexHolder oHolder(&poHandler->hMutex);
-        poHandler->Unlink_unlocked(osFilename);
-        poHandler->oFileList[poFile->osFilename] = poFile;
+        auto &oShard = poHandler->GetShard(osFilename);
+        CPL_EXCLUSIVE_LOCK oLock(oShard.oMutex);
+        // Replaces any existing file with the same name
+        oShard.oFileList[poFile->osFilename] = poFile;
 #ifdef DEBUG_VERBOSE
         CPLDebug("VSIMEM", "VSIFileFromMemBuffer() %s: ref_count=%d (after)",
                  poFile->osFilename.c_str(),
@@ -1289,12 +1354,14 @@ GByte *VSIGetMemFileBuffer(const char *pszFilename, vsi_l_offset *pnDataLength,
     const std::string osFilename =
         VSIMemFilesystemHandler::NormalizePath(pszFilename);
 
-    CPLMutexHolder oHolder(&poHandler->hMutex);
+    auto &oShard = poHandler->GetShard(osFilename);
+    CPL_EXCLUSIVE_LOCK oLock(oShard.oMutex);
 
-    if (poHandler->oFileList.find(osFilename) == poHandler->oFileList.end())
+    const auto oIter = oShard.oFileList.find(osFilename);
+    if (oIter == oShard.oFileList.end())
         return nullptr;
 
-    std::shared_ptr<VSIMemFile> poFile = poHandler->oFileList[osFilename];
+    std::shared_ptr<VSIMemFile> poFile = oIter->second;
     GByte *pabyData = poFile->pabyData;
     if (pnDataLength != nullptr)
         *pnDataLength = poFile->nLength;
@@ -1307,7 +1374,7 @@ GByte *VSIGetMemFileBuffer(const char *pszFilename, vsi_l_offset *pnDataLength,
         else
             poFile->bOwnData = false;
 
-        poHandler->oFileList.erase(poHandler->oFileList.find(osFilename));
+        oShard.oFileList.erase(oIter);
 #ifdef DEBUG_VERBOSE
         CPLDebug("VSIMEM", "VSIGetMemFileBuffer() %s: ref_count=%d (before)",
                  poFile->osFilename.c_str(),
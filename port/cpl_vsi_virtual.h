@@ -22,7 +22,9 @@
 #include "cpl_vsi_error.h"
 #include "cpl_string.h"
 
+#include <condition_variable>
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -39,6 +41,14 @@
 #undef CopyFile
 #endif
 
+class VSIAsyncReadRequest;
+
+/** Callback of VSIVirtualHandle::AsyncReadMultiRange(), called once for each
+ * range with its index and whether it could be entirely read.
+ * @since GDAL 3.13
+ */
+typedef std::function<void(int iRange, bool bSuccess)> VSIAsyncReadCallback;
+
 /************************************************************************/
 /*                           VSIVirtualHandle                           */
 /************************************************************************/
@@ -127,6 +137,12 @@ struct CPL_DLL VSIVirtualHandle
         return 0;
     }
 
+    virtual bool HasAsyncRead() const;
+    virtual std::unique_ptr<VSIAsyncReadRequest>
+    AsyncReadMultiRange(int nRanges, void **ppData,
+                        const vsi_l_offset *panOffsets, const size_t *panSizes,
+                        const VSIAsyncReadCallback &cbk);
+
     virtual size_t Write(const void *pBuffer, size_t nBytes) = 0;
     size_t Write(const void *pBuffer, size_t nSize, size_t nCount);
 
@@ -210,6 +226,37 @@ struct VSIVirtualHandleCloser
 typedef std::unique_ptr<VSIVirtualHandle, VSIVirtualHandleCloser>
     VSIVirtualHandleUniquePtr;
 
+/************************************************************************/
+/*                         VSIAsyncReadRequest                          */
+/************************************************************************/
+
+/** Pending asynchronous read, as returned by
+ * VSIVirtualHandle::AsyncReadMultiRange().
+ *
+ * Implementations call SetRangeDone() exactly once for each range. The
+ * destructor waits for all ranges to be completed, so the destination buffers
+ * must remain valid until then.
+ *
+ * @since GDAL 3.13
+ */
+class CPL_DLL VSIAsyncReadRequest
+{
+    CPL_DISALLOW_COPY_ASSIGN(VSIAsyncReadRequest)
+
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    int m_nRemainingRanges = 0;
+    bool m_bSuccess = true;
+    const VSIAsyncReadCallback m_cbk;
+
+  public:
+    VSIAsyncReadRequest(int nRanges, const VSIAsyncReadCallback &cbk);
+    ~VSIAsyncReadRequest();
+
+    void SetRangeDone(int iRange, bool bSuccess);
+    bool Wait();
+};
+
 /************************************************************************/
 /*                          VSIProxyFileHandle                          */
 /************************************************************************/
@@ -260,6 +307,20 @@ class VSIProxyFileHandle /* non final */ : public VSIVirtualHandle
         return m_nativeHandle->GetAdviseReadTotalBytesLimit();
     }
 
+    bool HasAsyncRead() const override
+    {
+        return m_nativeHandle->HasAsyncRead();
+    }
+
+    std::unique_ptr<VSIAsyncReadRequest>
+    AsyncReadMultiRange(int nRanges, void **ppData,
+                        const vsi_l_offset *panOffsets, const size_t *panSizes,
+                        const VSIAsyncReadCallback &cbk) override
+    {
+        return m_nativeHandle->AsyncReadMultiRange(nRanges, ppData, panOffsets,
+                                                   panSizes, cbk);
+    }
+
     size_t Write(const void *pBuffer, size_t nBytes) override
     {
         return m_nativeHandle->Write(pBuffer, nBytes);
@@ -786,6 +847,13 @@ VSIVirtualHandle *VSICreateGZipWritable(VSIVirtualHandle *poBaseHandle,
                                         size_t nSOZIPIndexEltSize,
                                         std::vector<uint8_t> *panSOZIPIndex);
 
+class CPLWorkerThreadPool;
+CPLWorkerThreadPool *VSIGetAsyncReadThreadPool();
+void VSIAsyncReadRangeWithPRead(const VSIVirtualHandle *poHandle,
+                                VSIAsyncReadRequest *poRequest, int iRange,
+                                void *pData, size_t nSize,
+                                vsi_l_offset nOffset);
+
 VSIVirtualHandle *
 VSICreateUploadOnCloseFile(VSIVirtualHandleUniquePtr &&poWritableHandle,
                            VSIVirtualHandleUniquePtr &&poTmpFile,
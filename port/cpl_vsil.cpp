@@ -39,6 +39,7 @@
 #include "cpl_string.h"
 #include "cpl_vsi_virtual.h"
 #include "cpl_vsil_curl_class.h"
+#include "cpl_worker_thread_pool.h"
 
 // To avoid aliasing to GetDiskFreeSpace to GetDiskFreeSpaceA on Windows
 #ifdef GetDiskFreeSpace
@@ -2112,7 +2113,15 @@ int VSIFilesystemHandler::CopyFile(const char *pszSource, const char *pszTarget,
         pszSource = "(unknown filename)";
 
     int ret = 0;
-    constexpr size_t nBufferSize = 10 * 4096;
+    // Use a large buffer for large files, so that network file systems
+    // can split each read into several parallel range requests.
+    constexpr size_t nSmallBufferSize = 10 * 4096;
+    constexpr size_t nLargeBufferSize = 16 * 1024 * 1024;
+    const size_t nBufferSize =
+        nSourceSize != static_cast<vsi_l_offset>(-1) &&
+                nSourceSize >= nLargeBufferSize
+            ? nLargeBufferSize
+            : nSmallBufferSize;
     std::vector<GByte> abyBuffer(nBufferSize, 0);
     GUIntBig nOffset = 0;
     while (true)
@@ -4384,9 +4393,15 @@ void VSIFileManager::RemoveHandler(const std::string &osPrefix)
 /*                       VSICleanupFileManager()                        */
 /************************************************************************/
 
+static void VSIDestroyAsyncReadThreadPool();
+
 void VSICleanupFileManager()
 
 {
+    // Must be done before destroying the file system handlers, as pending
+    // jobs of the pool may use their file handles.
+    VSIDestroyAsyncReadThreadPool();
+
     if (poManager)
     {
         delete poManager;
@@ -4511,6 +4526,210 @@ size_t VSIVirtualHandle::PRead(CPL_UNUSED void *pBuffer,
     return 0;
 }
 
+/************************************************************************/
+/*                            HasAsyncRead()                            */
+/************************************************************************/
+
+/** Returns whether AsyncReadMultiRange() is actually asynchronous for this
+ * file handle.
+ *
+ * When it returns false, AsyncReadMultiRange() can still be used, but the
+ * ranges are read before it returns.
+ *
+ * @since GDAL 3.13
+ */
+bool VSIVirtualHandle::HasAsyncRead() const
+{
+    return false;
+}
+
+/************************************************************************/
+/*                        AsyncReadMultiRange()                         */
+/************************************************************************/
+
+/** Start reading several ranges of the file, without waiting for the data.
+ *
+ * The callback is called exactly once for each range, when its data has been
+ * stored in ppData[iRange] or when reading it has failed. It may be called
+ * from another thread, concurrently for several ranges, and even before this
+ * method returns. It should return quickly and defer any heavy processing
+ * (e.g. decompression) to a thread pool, so as not to delay the reading of
+ * the other ranges.
+ *
+ * The panOffsets and panSizes arrays are no longer needed once this method
+ * has returned, but the buffers pointed by ppData must remain valid until the
+ * request has completed. The file handle must not be closed before that
+ * either.
+ *
+ * The base implementation reads the ranges sequentially before returning.
+ * Implementations for which HasAsyncRead() returns true start the reads in
+ * the background.
+ *
+ * @param nRanges Size of the ppData, panOffsets and panSizes arrays.
+ * @param ppData Array of destination buffers, one for each range.
+ * @param panOffsets Array containing the start offset of each range.
+ * @param panSizes Array containing the size (in bytes) of each range.
+ * @param cbk Callback called once for each range.
+ * @return the request, on which VSIAsyncReadRequest::Wait() may be called to
+ * wait for the completion of all ranges. Never null.
+ * @since GDAL 3.13
+ */
+std::unique_ptr<VSIAsyncReadRequest> VSIVirtualHandle::AsyncReadMultiRange(
+    int nRanges, void **ppData, const vsi_l_offset *panOffsets,
+    const size_t *panSizes, const VSIAsyncReadCallback &cbk)
+{
+    auto poRequest = std::make_unique<VSIAsyncReadRequest>(nRanges, cbk);
+    const vsi_l_offset nCurOffset = Tell();
+    for (int i = 0; i < nRanges; i++)
+    {
+        const bool bSuccess = Seek(panOffsets[i], SEEK_SET) == 0 &&
+                              Read(ppData[i], panSizes[i]) == panSizes[i];
+        poRequest->SetRangeDone(i, bSuccess);
+    }
+    Seek(nCurOffset, SEEK_SET);
+    return poRequest;
+}
+
+/************************************************************************/
+/*                        VSIAsyncReadRequest()                         */
+/************************************************************************/
+
+/** Constructor.
+ *
+ * @param nRanges Number of ranges of the request.
+ * @param cbk Callback to call from SetRangeDone(), or an empty function.
+ */
+VSIAsyncReadRequest::VSIAsyncReadRequest(int nRanges,
+                                         const VSIAsyncReadCallback &cbk)
+    : m_nRemainingRanges(nRanges), m_cbk(cbk)
+{
+}
+
+/************************************************************************/
+/*                        ~VSIAsyncReadRequest()                        */
+/************************************************************************/
+
+/** Destructor. Waits for the completion of all ranges. */
+VSIAsyncReadRequest::~VSIAsyncReadRequest()
+{
+    Wait();
+}
+
+/************************************************************************/
+/*                            SetRangeDone()                            */
+/************************************************************************/
+
+/** Called by the file handle implementation when a range has been read.
+ *
+ * @param iRange Index of the range.
+ * @param bSuccess Whether the range has been entirely read.
+ */
+void VSIAsyncReadRequest::SetRangeDone(int iRange, bool bSuccess)
+{
+    if (m_cbk)
+        m_cbk(iRange, bSuccess);
+    std::lock_guard oLock(m_oMutex);
+    if (!bSuccess)
+        m_bSuccess = false;
+    --m_nRemainingRanges;
+    if (m_nRemainingRanges == 0)
+        m_oCV.notify_all();
+}
+
+/************************************************************************/
+/*                                Wait()                                */
+/************************************************************************/
+
+/** Wait until all ranges have been read, and their callback has returned.
+ *
+ * @return true if all ranges have been successfully read.
+ */
+bool VSIAsyncReadRequest::Wait()
+{
+    std::unique_lock oLock(m_oMutex);
+    m_oCV.wait(oLock, [this] { return m_nRemainingRanges == 0; });
+    return m_bSuccess;
+}
+
+#ifndef DOXYGEN_SKIP
+
+/************************************************************************/
+/*                     VSIGetAsyncReadThreadPool()                      */
+/************************************************************************/
+
+static CPLWorkerThreadPool *gpoAsyncReadThreadPool = nullptr;
+
+static std::mutex &GetAsyncReadThreadPoolMutex()
+{
+    static std::mutex gMutexAsyncReadThreadPool;
+    return gMutexAsyncReadThreadPool;
+}
+
+// Thread pool used by AsyncReadMultiRange() implementations to issue
+// blocking reads in the background. Returns nullptr if it cannot be created.
+CPLWorkerThreadPool *VSIGetAsyncReadThreadPool()
+{
+    std::lock_guard oLock(GetAsyncReadThreadPoolMutex());
+    if (gpoAsyncReadThreadPool == nullptr)
+    {
+        const int nThreads = std::max(
+            1,
+            atoi(CPLGetConfigOption("CPL_VSIL_ASYNC_READ_NUM_THREADS", "8")));
+        gpoAsyncReadThreadPool = new CPLWorkerThreadPool();
+        if (!gpoAsyncReadThreadPool->Setup(nThreads, nullptr, nullptr, false))
+        {
+            delete gpoAsyncReadThreadPool;
+            gpoAsyncReadThreadPool = nullptr;
+        }
+    }
+    return gpoAsyncReadThreadPool;
+}
+
+static void VSIDestroyAsyncReadThreadPool()
+{
+    std::lock_guard oLock(GetAsyncReadThreadPoolMutex());
+    delete gpoAsyncReadThreadPool;
+    gpoAsyncReadThreadPool = nullptr;
+}
+
+/************************************************************************/
+/*                     VSIAsyncReadRangeWithPRead()                     */
+/************************************************************************/
+
+// Read a range of an asynchronous request with PRead() from the thread pool
+// returned by VSIGetAsyncReadThreadPool() (or synchronously if there is no
+// thread pool), and complete it in poRequest.
+void VSIAsyncReadRangeWithPRead(const VSIVirtualHandle *poHandle,
+                                VSIAsyncReadRequest *poRequest, int iRange,
+                                void *pData, size_t nSize, vsi_l_offset nOffset)
+{
+    const auto task = [poHandle, poRequest, iRange, pData, nSize, nOffset]()
+    {
+        // PRead() may return less than requested without being at end of
+        // file, as pread() does.
+        GByte *pabyData = static_cast<GByte *>(pData);
+        size_t nRemaining = nSize;
+        vsi_l_offset nCurOffset = nOffset;
+        while (nRemaining > 0)
+        {
+            const size_t nRead =
+                poHandle->PRead(pabyData, nRemaining, nCurOffset);
+            if (nRead == 0 || nRead > nRemaining)
+                break;
+            pabyData += nRead;
+            nRemaining -= nRead;
+            nCurOffset += nRead;
+        }
+        poRequest->SetRangeDone(iRange, nRemaining == 0);
+    };
+
+    auto poPool = VSIGetAsyncReadThreadPool();
+    if (!poPool || !poPool->SubmitJob(task))
+        task();
+}
+
+#endif  // #ifndef DOXYGEN_SKIP
+
 #ifndef DOXYGEN_SKIP
 /************************************************************************/
 /*                 VSIProxyFileHandle::CancelCreation()                 */
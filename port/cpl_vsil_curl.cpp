@@ -32,6 +32,7 @@
 #include "cpl_time.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
+#include "cpl_worker_thread_pool.h"
 #include "cpl_http.h"
 #include "cpl_mem_cache.h"
 
@@ -533,6 +534,7 @@ VSICurlHandle::VSICurlHandle(VSICurlFilesystemHandlerBase *poFSIn,
 
 VSICurlHandle::~VSICurlHandle()
 {
+    StopReadAhead();
     if (m_oThreadAdviseRead.joinable())
     {
         m_oThreadAdviseRead.join();
@@ -1556,7 +1558,8 @@ retry:
                             std::min<size_t>(sWriteFuncData.nSize - nOffset,
                                              knDOWNLOAD_CHUNK_SIZE);
                         poFS->AddRegion(m_pszURL, nOffset, nToCache,
-                                        sWriteFuncData.pBuffer + nOffset);
+                                        sWriteFuncData.pBuffer + nOffset,
+                                        m_bCached);
                         nOffset += nToCache;
                     }
                 }
@@ -2383,13 +2386,17 @@ void VSICurlHandle::DownloadRegionPostProcess(const vsi_l_offset startOffset,
 #endif
         const size_t nChunkSize =
             std::min(static_cast<size_t>(knDOWNLOAD_CHUNK_SIZE), nSize);
-        poFS->AddRegion(m_pszURL, l_startOffset, nChunkSize, pBuffer);
+        poFS->AddRegion(m_pszURL, l_startOffset, nChunkSize, pBuffer,
+                        m_bCached);
         l_startOffset += nChunkSize;
         pBuffer += nChunkSize;
         nSize -= nChunkSize;
     }
 }
 
+// Minimum size of each of the range requests of ReadInParallel()
+constexpr size_t knPARALLEL_READ_MIN_PART_SIZE = 1024 * 1024;
+
 /************************************************************************/
 /*                                Read()                                */
 /************************************************************************/
@@ -2417,7 +2424,11 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nBytes)
     while (nBufferRequestSize)
     {
         // Don't try to read after end of file.
-        poFS->GetCachedFileProp(m_pszURL, oFileProp);
+        {
+            // Read-ahead jobs may concurrently access oFileProp
+            std::lock_guard<std::mutex> oLock(m_oMutex);
+            poFS->GetCachedFileProp(m_pszURL, oFileProp);
+        }
         if (oFileProp.bHasComputedFileSize && iterOffset >= oFileProp.fileSize)
         {
             if (iterOffset == curOffset)
@@ -2432,14 +2443,71 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nBytes)
 
         const vsi_l_offset nOffsetToDownload =
             (iterOffset / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
+
+        // Large reads of data that is not cached are split into several
+        // range requests issued in parallel, directly into the output buffer.
+        // As those bypass the region cache, this is not done when the disk
+        // cache must be fed, or when part of the range is already cached.
+        if (!m_poReadAhead && !pfnReadCbk &&
+            nBufferRequestSize >= 2 * knPARALLEL_READ_MIN_PART_SIZE &&
+            oFileProp.bHasComputedFileSize && SupportsRangeHeader() &&
+            !(m_bCached && VSICURLDiskCacheIsEnabled()))
+        {
+            const size_t nToRead = static_cast<size_t>(
+                std::min<vsi_l_offset>(nBufferRequestSize,
+                                       oFileProp.fileSize - iterOffset));
+            bool bCanReadInParallel =
+                nToRead >= 2 * knPARALLEL_READ_MIN_PART_SIZE;
+            for (vsi_l_offset nChunkOffset = nOffsetToDownload;
+                 bCanReadInParallel && nChunkOffset < iterOffset + nToRead;
+                 nChunkOffset += knDOWNLOAD_CHUNK_SIZE)
+            {
+                bCanReadInParallel =
+                    poFS->GetRegion(m_pszURL, nChunkOffset, false) == nullptr;
+            }
+            const int nRet = bCanReadInParallel
+                                 ? ReadInParallel(pBuffer, nToRead, iterOffset)
+                                 : 1;
+            if (nRet < 0)
+            {
+                if (!bInterrupted)
+                    bError = true;
+                return 0;
+            }
+            else if (nRet == 0)
+            {
+                pBuffer = static_cast<char *>(pBuffer) + nToRead;
+                iterOffset += nToRead;
+                nBufferRequestSize -= nToRead;
+                continue;
+            }
+        }
+
         std::string osRegion;
-        std::shared_ptr<std::string> psRegion =
-            poFS->GetRegion(m_pszURL, nOffsetToDownload);
-        if (psRegion != nullptr)
+        bool bGotRegion = false;
+        bool bGotReadAheadRegion = false;
+        if (m_poReadAhead)
         {
-            osRegion = *psRegion;
+            bGotRegion = GetReadAheadRegion(nOffsetToDownload, osRegion);
+            bGotReadAheadRegion = bGotRegion;
+            if (!bGotRegion)
+            {
+                // Not a forward sequential read anymore
+                NetworkStatisticsLogger::LogReadAheadMiss();
+                StopReadAhead();
+            }
         }
-        else
+        if (!bGotRegion)
+        {
+            std::shared_ptr<std::string> psRegion =
+                poFS->GetRegion(m_pszURL, nOffsetToDownload, m_bCached);
+            if (psRegion != nullptr)
+            {
+                osRegion = *psRegion;
+                bGotRegion = true;
+            }
+        }
+        if (!bGotRegion)
         {
             if (nOffsetToDownload == lastDownloadedOffset)
             {
@@ -2450,13 +2518,41 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nBytes)
                 constexpr int MAX_CHUNK_SIZE_INCREASE_FACTOR = 128;
                 if (nBlocksToDownload < MAX_CHUNK_SIZE_INCREASE_FACTOR)
                     nBlocksToDownload *= 2;
+                ++m_nSequentialDownloads;
             }
             else
             {
                 // Random reads. Cancel the above heuristics.
                 nBlocksToDownload = 1;
+                m_nSequentialDownloads = 0;
             }
 
+            // After a few consecutive sequential downloads, assume a forward
+            // scan of the file, and prefetch ahead of the reader with
+            // several parallel requests of growing size.
+            constexpr int SEQUENTIAL_DOWNLOADS_BEFORE_READ_AHEAD = 3;
+            if (m_nSequentialDownloads >=
+                    SEQUENTIAL_DOWNLOADS_BEFORE_READ_AHEAD &&
+                StartReadAhead(nOffsetToDownload,
+                               static_cast<size_t>(nBlocksToDownload) *
+                                   knDOWNLOAD_CHUNK_SIZE))
+            {
+                bGotRegion = GetReadAheadRegion(nOffsetToDownload, osRegion);
+                bGotReadAheadRegion = bGotRegion;
+                if (!bGotRegion)
+                    StopReadAhead();
+            }
+        }
+        if (bGotReadAheadRegion)
+        {
+            // Chunks of the read-ahead window are dropped once read past, so
+            // put them in the region cache, and the disk cache, as
+            // DownloadRegion() does.
+            poFS->AddRegion(m_pszURL, nOffsetToDownload, osRegion.size(),
+                            osRegion.data(), m_bCached);
+        }
+        if (!bGotRegion)
+        {
             // Ensure that we will request at least the number of blocks
             // to satisfy the remaining buffer size to read.
             const vsi_l_offset nEndOffsetToDownload =
@@ -2474,10 +2570,11 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nBytes)
             // this should not cause bugs. Just missed optimization.
             for (int i = 1; i < nBlocksToDownload; i++)
             {
-                if (poFS->GetRegion(m_pszURL, nOffsetToDownload +
-                                                  static_cast<vsi_l_offset>(i) *
-                                                      knDOWNLOAD_CHUNK_SIZE) !=
-                    nullptr)
+                if (poFS->GetRegion(m_pszURL,
+                                    nOffsetToDownload +
+                                        static_cast<vsi_l_offset>(i) *
+                                            knDOWNLOAD_CHUNK_SIZE,
+                                    m_bCached) != nullptr)
                 {
                     nBlocksToDownload = i;
                     break;
@@ -2535,6 +2632,279 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nBytes)
     return ret;
 }
 
+/************************************************************************/
+/*                           ReadInParallel()                           */
+/************************************************************************/
+
+// Read nSize bytes at nOffset with up to
+// CPL_VSIL_CURL_PARALLEL_READ_NUM_CONNECTIONS parallel range requests.
+// Returns 0 on success, -1 on error, and 1 if the caller should fall back
+// to a regular download.
+int VSICurlHandle::ReadInParallel(void *pBuffer, size_t nSize,
+                                  vsi_l_offset nOffset)
+{
+    const int nConnections = atoi(
+        CPLGetConfigOption("CPL_VSIL_CURL_PARALLEL_READ_NUM_CONNECTIONS", "4"));
+    if (nConnections <= 1)
+        return 1;
+
+    UpdateQueryString();
+
+    bool bHasExpired = false;
+    CPLStringList aosHTTPOptions(m_aosHTTPOptions);
+    const std::string osURL(
+        GetRedirectURLIfValid(bHasExpired, aosHTTPOptions));
+    if (bHasExpired)
+        return 1;
+
+    // Bound the size of each request, as its content is held in memory
+    // before being copied in the output buffer.
+    constexpr size_t MAX_PART_SIZE = 64 * 1024 * 1024;
+    GByte *pabyBuffer = static_cast<GByte *>(pBuffer);
+    while (nSize > 0)
+    {
+        const size_t nBatchSize = static_cast<size_t>(std::min<uint64_t>(
+            nSize, static_cast<uint64_t>(nConnections) * MAX_PART_SIZE));
+        const int nParts = static_cast<int>(std::max<size_t>(
+            1, std::min<size_t>(nConnections,
+                                nBatchSize / knPARALLEL_READ_MIN_PART_SIZE)));
+        const size_t nPartSize = cpl::div_round_up(nBatchSize, nParts);
+
+        std::vector<void *> apData;
+        std::vector<vsi_l_offset> anOffsets;
+        std::vector<size_t> anSizes;
+        for (size_t nPos = 0; nPos < nBatchSize; nPos += nPartSize)
+        {
+            apData.push_back(pabyBuffer + nPos);
+            anOffsets.push_back(nOffset + nPos);
+            anSizes.push_back(std::min(nPartSize, nBatchSize - nPos));
+        }
+
+        if (ReadMultiRangeParallel(static_cast<int>(apData.size()),
+                                   apData.data(), anOffsets.data(),
+                                   anSizes.data(),
+                                   /* bMergeConsecutiveRanges = */ false,
+                                   osURL, aosHTTPOptions) != 0)
+        {
+            return -1;
+        }
+
+        pabyBuffer += nBatchSize;
+        nOffset += nBatchSize;
+        nSize -= nBatchSize;
+    }
+    return 0;
+}
+
+/************************************************************************/
+/*                           StartReadAhead()                           */
+/************************************************************************/
+
+// Start prefetching the file from nOffset, with several parallel range
+// requests of exponentially growing size, running ahead of Read().
+bool VSICurlHandle::StartReadAhead(vsi_l_offset nOffset,
+                                   size_t nInitialRangeSize)
+{
+    CPLAssert(!m_poReadAhead);
+
+    if (pfnReadCbk || !SupportsRangeHeader() ||
+        !oFileProp.bHasComputedFileSize || nOffset >= oFileProp.fileSize ||
+        !CPLTestBool(CPLGetConfigOption("CPL_VSIL_CURL_READ_AHEAD", "YES")))
+    {
+        return false;
+    }
+
+    const size_t nTotalBytesLimit = static_cast<size_t>(
+        std::min<unsigned long long>(
+            std::numeric_limits<size_t>::max(),
+            // 32 MB
+            std::strtoull(
+                CPLGetConfigOption("CPL_VSIL_CURL_READ_AHEAD_TOTAL_BYTES_LIMIT",
+                                   "33554432"),
+                nullptr, 10)));
+    const int nMaxInFlight = atoi(
+        CPLGetConfigOption("CPL_VSIL_CURL_READ_AHEAD_NUM_CONNECTIONS", "4"));
+    const size_t nChunkSize =
+        static_cast<size_t>(VSICURLGetDownloadChunkSize());
+    if (nTotalBytesLimit < 2 * nChunkSize || nMaxInFlight <= 0 ||
+        VSIGetAsyncReadThreadPool() == nullptr)
+    {
+        return false;
+    }
+
+    auto poReadAhead = std::make_unique<ReadAheadState>();
+    poReadAhead->nFileSize = oFileProp.fileSize;
+    poReadAhead->nNextOffset = nOffset;
+    poReadAhead->nTotalBytesLimit = nTotalBytesLimit;
+    poReadAhead->nMaxInFlight = nMaxInFlight;
+    // Ranges are a multiple of the chunk size, so that they can be split
+    // in regions at the same offsets as DownloadRegion() would use.
+    poReadAhead->nMaxRangeSize = std::max(
+        nChunkSize, nTotalBytesLimit / nMaxInFlight / nChunkSize * nChunkSize);
+    poReadAhead->nRangeSize =
+        std::min(std::max(nChunkSize, nInitialRangeSize),
+                 poReadAhead->nMaxRangeSize);
+
+    CPLDebug(poFS->GetDebugKey(),
+             "Sequential read detected on %s. Starting read-ahead at "
+             "offset " CPL_FRMT_GUIB,
+             m_osFilename.c_str(), nOffset);
+
+    m_poReadAhead = std::move(poReadAhead);
+    {
+        std::lock_guard<std::mutex> oLock(m_poReadAhead->oMutex);
+        SubmitReadAheadRanges();
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                       SubmitReadAheadRanges()                        */
+/************************************************************************/
+
+// Must be called with m_poReadAhead->oMutex held.
+void VSICurlHandle::SubmitReadAheadRanges()
+{
+    ReadAheadState *poState = m_poReadAhead.get();
+    auto poThreadPool = VSIGetAsyncReadThreadPool();
+    const vsi_l_offset nFileSize = poState->nFileSize;
+    while (!poState->bStop && poState->nInFlight < poState->nMaxInFlight &&
+           poState->nNextOffset < nFileSize &&
+           (poState->oMapRanges.empty() ||
+            poState->nBufferedBytes + poState->nRangeSize <=
+                poState->nTotalBytesLimit))
+    {
+        const vsi_l_offset nOffset = poState->nNextOffset;
+        auto poRange = std::make_shared<ReadAheadRange>();
+        poRange->nSize = static_cast<size_t>(std::min<vsi_l_offset>(
+            poState->nRangeSize, nFileSize - nOffset));
+        poState->oMapRanges[nOffset] = poRange;
+        poState->nBufferedBytes += poRange->nSize;
+        poState->nNextOffset += poRange->nSize;
+        poState->nRangeSize =
+            std::min(2 * poState->nRangeSize, poState->nMaxRangeSize);
+        ++poState->nInFlight;
+
+        // The job can safely reference this and poState, as StopReadAhead()
+        // waits for all of them to be finished.
+        poThreadPool->SubmitJob(
+            [this, poState, poRange, nOffset]()
+            {
+                NetworkStatisticsFileSystem oContextFS(
+                    poFS->GetFSPrefix().c_str());
+                NetworkStatisticsFile oContextFile(m_osFilename.c_str());
+                NetworkStatisticsAction oContextAction("ReadAhead");
+
+                std::string osData;
+                bool bOK = false;
+                if (!poState->bStop && !m_bInterrupt)
+                {
+                    osData.resize(poRange->nSize);
+                    const size_t nRet = DownloadRange(
+                        &osData[0], osData.size(), nOffset, &poState->bStop);
+                    if (nRet != static_cast<size_t>(-1))
+                    {
+                        osData.resize(nRet);
+                        bOK = true;
+                    }
+                }
+
+                std::lock_guard<std::mutex> oLock(poState->oMutex);
+                poRange->osData = std::move(osData);
+                poRange->bError = !bOK;
+                poRange->bDone = true;
+                --poState->nInFlight;
+                poState->oCV.notify_all();
+            });
+    }
+}
+
+/************************************************************************/
+/*                         GetReadAheadRegion()                         */
+/************************************************************************/
+
+// Returns in osRegion the content of the chunk at nOffset, if it is part
+// of the read-ahead window and could be downloaded.
+bool VSICurlHandle::GetReadAheadRegion(vsi_l_offset nOffset,
+                                       std::string &osRegion)
+{
+    ReadAheadState *poState = m_poReadAhead.get();
+    std::unique_lock<std::mutex> oLock(poState->oMutex);
+
+    // Discard ranges that have been read past
+    auto &oMapRanges = poState->oMapRanges;
+    while (!oMapRanges.empty() &&
+           oMapRanges.begin()->first + oMapRanges.begin()->second->nSize <=
+               nOffset)
+    {
+        poState->nBufferedBytes -= oMapRanges.begin()->second->nSize;
+        oMapRanges.erase(oMapRanges.begin());
+    }
+
+    if (oMapRanges.empty() || nOffset < oMapRanges.begin()->first)
+        return false;
+    auto oIter = oMapRanges.upper_bound(nOffset);
+    --oIter;
+    const vsi_l_offset nRangeOffset = oIter->first;
+    auto poRange = oIter->second;
+    if (nOffset >= nRangeOffset + poRange->nSize)
+        return false;
+
+    if (poRange->bDone)
+    {
+        NetworkStatisticsLogger::LogReadAheadHit();
+    }
+    else
+    {
+        NetworkStatisticsLogger::LogReadAheadWait();
+        // coverity[missing_lock:FALSE]
+        while (!poRange->bDone)
+            poState->oCV.wait(oLock);
+    }
+
+    // Let DownloadRegion() deal with errors and truncated responses
+    if (poRange->bError || poRange->osData.size() != poRange->nSize)
+        return false;
+    const size_t nOffsetInRange = static_cast<size_t>(nOffset - nRangeOffset);
+    poRange->bUsed = true;
+    osRegion.assign(poRange->osData, nOffsetInRange,
+                    static_cast<size_t>(VSICURLGetDownloadChunkSize()));
+
+    SubmitReadAheadRanges();
+    return true;
+}
+
+/************************************************************************/
+/*                           StopReadAhead()                            */
+/************************************************************************/
+
+void VSICurlHandle::StopReadAhead()
+{
+    if (!m_poReadAhead)
+        return;
+
+    size_t nDiscardedBytes = 0;
+    {
+        ReadAheadState *poState = m_poReadAhead.get();
+        std::unique_lock<std::mutex> oLock(poState->oMutex);
+        poState->bStop = true;
+        // coverity[missing_lock:FALSE]
+        while (poState->nInFlight > 0)
+            poState->oCV.wait(oLock);
+        for (const auto &kv : poState->oMapRanges)
+        {
+            if (!kv.second->bUsed)
+                nDiscardedBytes += kv.second->osData.size();
+        }
+    }
+    m_poReadAhead.reset();
+    m_nSequentialDownloads = 0;
+
+    NetworkStatisticsFileSystem oContextFS(poFS->GetFSPrefix().c_str());
+    NetworkStatisticsFile oContextFile(m_osFilename.c_str());
+    NetworkStatisticsLogger::LogReadAheadDiscardedBytes(nDiscardedBytes);
+}
+
 /************************************************************************/
 /*                           ReadMultiRange()                           */
 /************************************************************************/
@@ -2546,6 +2916,8 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
     if (bInterrupted && bStopOnInterruptUntilUninstall)
         return FALSE;
 
+    StopReadAhead();
+
     poFS->GetCachedFileProp(m_pszURL, oFileProp);
     if (oFileProp.eExists == EXIST_NO)
         return -1;
@@ -2580,6 +2952,29 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
                                                 panSizes);
     }
 
+    static const CPLCachedConfigOption oMergeConsecutiveRanges(
+        "GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE");
+    const bool bMergeConsecutiveRanges = oMergeConsecutiveRanges.GetBool();
+
+    return ReadMultiRangeParallel(nRanges, ppData, panOffsets, panSizes,
+                                  bMergeConsecutiveRanges, osURL,
+                                  aosHTTPOptions);
+}
+
+/************************************************************************/
+/*                       ReadMultiRangeParallel()                       */
+/************************************************************************/
+
+// Download the ranges with parallel GET requests, one per range or group
+// of consecutive ranges if bMergeConsecutiveRanges is set.
+int VSICurlHandle::ReadMultiRangeParallel(int const nRanges,
+                                          void **const ppData,
+                                          const vsi_l_offset *const panOffsets,
+                                          const size_t *const panSizes,
+                                          bool bMergeConsecutiveRanges,
+                                          const std::string &osURL,
+                                          const CPLStringList &aosHTTPOptions)
+{
     CURLM *hMultiHandle = poFS->GetCurlMultiHandleFor(osURL);
 #ifdef CURLPIPE_MULTIPLEX
     // Enable HTTP/2 multiplexing (ignored if an older version of HTTP is
@@ -2588,7 +2983,9 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
     // recommended for example by Google Cloud Storage.
     // For HTTP/1.1, parallel connections work better since you can get
     // results out of order.
-    if (CPLTestBool(CPLGetConfigOption("GDAL_HTTP_MULTIPLEX", "YES")))
+    static const CPLCachedConfigOption oMultiplex("GDAL_HTTP_MULTIPLEX",
+                                                  "YES");
+    if (oMultiplex.GetBool())
     {
         curl_multi_setopt(hMultiHandle, CURLMOPT_PIPELINING,
                           CURLPIPE_MULTIPLEX);
@@ -2619,9 +3016,6 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
         anSortedSizes[i] = panSizes[anSortOrder[i]];
     }
 
-    const bool bMergeConsecutiveRanges = CPLTestBool(
-        CPLGetConfigOption("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE"));
-
     // Build list of merged requests upfront, each with its own retry context
     struct MergedRequest
     {
@@ -3297,15 +3691,31 @@ size_t VSICurlHandle::PRead(void *pBuffer, size_t nSize,
         }
     }
 
-    // poFS has a global mutex
-    poFS->GetCachedFileProp(m_pszURL, oFileProp);
-    if (oFileProp.eExists == EXIST_NO)
-        return static_cast<size_t>(-1);
-
     NetworkStatisticsFileSystem oContextFS(poFS->GetFSPrefix().c_str());
     NetworkStatisticsFile oContextFile(m_osFilename.c_str());
     NetworkStatisticsAction oContextAction("PRead");
 
+    return DownloadRange(pBuffer, nSize, nOffset, &m_bInterrupt);
+}
+
+/************************************************************************/
+/*                           DownloadRange()                            */
+/************************************************************************/
+
+// Thread-safe download of a single range, shared by PRead() and the
+// read-ahead of Read(). Returns static_cast<size_t>(-1) on error.
+size_t VSICurlHandle::DownloadRange(void *pBuffer, size_t nSize,
+                                    vsi_l_offset nOffset,
+                                    std::atomic<bool> *pbInterrupt) const
+{
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        // poFS has a global mutex
+        poFS->GetCachedFileProp(m_pszURL, oFileProp);
+        if (oFileProp.eExists == EXIST_NO)
+            return static_cast<size_t>(-1);
+    }
+
     CPLStringList aosHTTPOptions(m_aosHTTPOptions);
     std::string osURL;
     {
@@ -3375,7 +3785,7 @@ size_t VSICurlHandle::PRead(void *pBuffer, size_t nSize,
     unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HTTPHEADER, headers);
 
     CURLM *hMultiHandle = poFS->GetCurlMultiHandleFor(osURL);
-    VSICURLMultiPerform(hMultiHandle, hCurlHandle, &m_bInterrupt);
+    VSICURLMultiPerform(hMultiHandle, hCurlHandle, pbInterrupt);
 
     {
         std::lock_guard<std::mutex> oLock(m_oMutex);
@@ -3398,7 +3808,7 @@ size_t VSICurlHandle::PRead(void *pBuffer, size_t nSize,
     if ((response_code != 206 && response_code != 225) ||
         sWriteFuncData.nSize == 0)
     {
-        if (!m_bInterrupt)
+        if (!*pbInterrupt)
         {
             CPLDebug(poFS->GetDebugKey(),
                      "Request for %s failed with response_code=%ld", rangeStr,
@@ -3476,6 +3886,8 @@ static CURLM *VSICURLMultiInit()
 void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
                                const size_t *panSizes)
 {
+    StopReadAhead();
+
     if (!CPLTestBool(
             CPLGetConfigOption("GDAL_HTTP_ENABLE_ADVISE_READ", "TRUE")))
         return;
@@ -3510,8 +3922,9 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
         return;
     }
 
-    const bool bMergeConsecutiveRanges = CPLTestBool(
-        CPLGetConfigOption("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE"));
+    static const CPLCachedConfigOption oMergeConsecutiveRanges(
+        "GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE");
+    const bool bMergeConsecutiveRanges = oMergeConsecutiveRanges.GetBool();
 
     try
     {
@@ -3584,7 +3997,9 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
         // recommended for example by Google Cloud Storage.
         // For HTTP/1.1, parallel connections work better since you can get
         // results out of order.
-        if (CPLTestBool(CPLGetConfigOption("GDAL_HTTP_MULTIPLEX", "YES")))
+        static const CPLCachedConfigOption oMultiplex("GDAL_HTTP_MULTIPLEX",
+                                                      "YES");
+        if (oMultiplex.GetBool())
         {
             curl_multi_setopt(m_hCurlMultiHandleForAdviseRead,
                               CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
@@ -3763,6 +4178,7 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
                                  "Request for %s range %s failed with "
                                  "response_code=%ld",
                                  osURL.c_str(), rangeStr, response_code);
+                        m_aoAdviseReadRanges[iReq]->bError = true;
                     }
                 }
                 else
@@ -3779,10 +4195,17 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
 
                 if (!bToRetry)
                 {
-                    std::lock_guard<std::mutex> oLock(
-                        m_aoAdviseReadRanges[iReq]->oMutex);
-                    m_aoAdviseReadRanges[iReq]->bDone = true;
-                    m_aoAdviseReadRanges[iReq]->oCV.notify_all();
+                    std::vector<std::function<void()>> aoDoneCallbacks;
+                    {
+                        std::lock_guard<std::mutex> oLock(
+                            m_aoAdviseReadRanges[iReq]->oMutex);
+                        m_aoAdviseReadRanges[iReq]->bDone = true;
+                        m_aoAdviseReadRanges[iReq]->oCV.notify_all();
+                        std::swap(aoDoneCallbacks,
+                                  m_aoAdviseReadRanges[iReq]->aoDoneCallbacks);
+                    }
+                    for (const auto &cbk : aoDoneCallbacks)
+                        cbk();
                 }
             };
 
@@ -3862,6 +4285,86 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
     m_oThreadAdviseRead = std::thread(task, l_osURL);
 }
 
+/************************************************************************/
+/*                        AsyncReadMultiRange()                         */
+/************************************************************************/
+
+std::unique_ptr<VSIAsyncReadRequest>
+VSICurlHandle::AsyncReadMultiRange(int nRanges, void **ppData,
+                                   const vsi_l_offset *panOffsets,
+                                   const size_t *panSizes,
+                                   const VSIAsyncReadCallback &cbk)
+{
+    auto poRequest = std::make_unique<VSIAsyncReadRequest>(nRanges, cbk);
+    VSIAsyncReadRequest *poRequestRaw = poRequest.get();
+
+    // The ranges are downloaded in parallel by the AdviseRead() thread, and
+    // each of them is completed as soon as the download of the AdviseRead()
+    // range containing it is done.
+    AdviseRead(nRanges, panOffsets, panSizes);
+
+    size_t iAdviseRange = 0;
+    for (int i = 0; i < nRanges; ++i)
+    {
+        void *pData = ppData[i];
+        const size_t nSize = panSizes[i];
+        const vsi_l_offset nOffset = panOffsets[i];
+
+        // Ranges are generally sorted, so start looking from the range
+        // that contained the previous one.
+        AdviseReadRange *poRange = nullptr;
+        for (size_t j = 0; j < m_aoAdviseReadRanges.size(); ++j)
+        {
+            const size_t k = (iAdviseRange + j) % m_aoAdviseReadRanges.size();
+            auto &poCandidate = m_aoAdviseReadRanges[k];
+            if (nOffset >= poCandidate->nStartOffset &&
+                nOffset + nSize <=
+                    poCandidate->nStartOffset + poCandidate->nSize)
+            {
+                poRange = poCandidate.get();
+                iAdviseRange = k;
+                break;
+            }
+        }
+        if (!poRange || nSize == 0)
+        {
+            VSIAsyncReadRangeWithPRead(this, poRequestRaw, i, pData, nSize,
+                                       nOffset);
+            continue;
+        }
+
+        // Called from the AdviseRead() thread, so it must not use PRead(),
+        // which could wait for another range.
+        const auto CopyFromRange = [poRequestRaw, poRange, i, pData, nSize,
+                                    nOffset]()
+        {
+            const vsi_l_offset nEndOffset =
+                poRange->nStartOffset + poRange->abyData.size();
+            const bool bOK = !poRange->bError && nOffset + nSize <= nEndOffset;
+            if (bOK)
+            {
+                memcpy(pData,
+                       poRange->abyData.data() +
+                           static_cast<size_t>(nOffset - poRange->nStartOffset),
+                       nSize);
+            }
+            poRequestRaw->SetRangeDone(i, bOK);
+        };
+
+        bool bDone;
+        {
+            std::lock_guard<std::mutex> oLock(poRange->oMutex);
+            bDone = poRange->bDone;
+            if (!bDone)
+                poRange->aoDoneCallbacks.push_back(CopyFromRange);
+        }
+        if (bDone)
+            CopyFromRange();
+    }
+
+    return poRequest;
+}
+
 /************************************************************************/
 /*                               Write()                                */
 /************************************************************************/
@@ -3917,6 +4420,9 @@ int VSICurlHandle::Flush()
 
 int VSICurlHandle::Close()
 {
+    // Read-ahead jobs call virtual methods, so they must be finished before
+    // the destructor of derived classes runs.
+    StopReadAhead();
     return 0;
 }
 
@@ -4080,19 +4586,38 @@ VSICurlFilesystemHandlerBase::GetRegionCache()
 
 std::shared_ptr<std::string>
 VSICurlFilesystemHandlerBase::GetRegion(const char *pszURL,
-                                        vsi_l_offset nFileOffsetStart)
+                                        vsi_l_offset nFileOffsetStart,
+                                        bool bAllowDiskCache)
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
     nFileOffsetStart =
         (nFileOffsetStart / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
 
-    std::shared_ptr<std::string> out;
-    if (GetRegionCache()->tryGet(
-            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), out))
     {
-        return out;
+        CPLMutexHolder oHolder(&hMutex);
+
+        std::shared_ptr<std::string> out;
+        if (GetRegionCache()->tryGet(
+                FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
+                out))
+        {
+            return out;
+        }
+    }
+
+    // Disk I/O is done without holding hMutex
+    if (bAllowDiskCache)
+    {
+        const std::string osKey = GetDiskCacheKey(pszURL, nFileOffsetStart);
+        auto value = std::make_shared<std::string>();
+        if (!osKey.empty() && VSICURLDiskCacheGetRegion(osKey, *value))
+        {
+            CPLMutexHolder oHolder(&hMutex);
+            GetRegionCache()->insert(
+                FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
+                value);
+            return value;
+        }
     }
 
     return nullptr;
@@ -4104,15 +4629,68 @@ VSICurlFilesystemHandlerBase::GetRegion(const char *pszURL,
 
 void VSICurlFilesystemHandlerBase::AddRegion(const char *pszURL,
                                              vsi_l_offset nFileOffsetStart,
-                                             size_t nSize, const char *pData)
+                                             size_t nSize, const char *pData,
+                                             bool bAllowDiskCache)
 {
-    CPLMutexHolder oHolder(&hMutex);
+    {
+        CPLMutexHolder oHolder(&hMutex);
+
+        auto value = std::make_shared<std::string>();
+        value->assign(pData, nSize);
+        GetRegionCache()->insert(
+            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
+            std::move(value));
+    }
+
+    if (bAllowDiskCache)
+    {
+        const std::string osKey = GetDiskCacheKey(pszURL, nFileOffsetStart);
+        if (!osKey.empty())
+            VSICURLDiskCacheAddRegion(osKey, pData, nSize);
+    }
+}
+
+/************************************************************************/
+/*                          GetDiskCacheKey()                           */
+/************************************************************************/
+
+/** Returns the key under which a region is stored in the persistent disk
+ * cache, or an empty string if it must not be stored there.
+ *
+ * The key includes the ETag, or failing that the modification time, of the
+ * file, so that regions of a file modified on the server are never reused.
+ * Files for which none of them is known are not cached on disk.
+ */
+std::string
+VSICurlFilesystemHandlerBase::GetDiskCacheKey(const char *pszURL,
+                                              vsi_l_offset nFileOffsetStart)
+{
+    if (!VSICURLDiskCacheIsEnabled())
+        return std::string();
+
+    FileProp oFileProp;
+    if (!GetCachedFileProp(pszURL, oFileProp) ||
+        oFileProp.eExists != EXIST_YES || !oFileProp.bHasComputedFileSize)
+    {
+        return std::string();
+    }
 
-    auto value = std::make_shared<std::string>();
-    value->assign(pData, nSize);
-    GetRegionCache()->insert(
-        FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
-        std::move(value));
+    std::string osKey(pszURL);
+    if (!oFileProp.ETag.empty())
+        osKey += "\netag=" + oFileProp.ETag;
+    else if (oFileProp.mTime > 0)
+        osKey += CPLSPrintf("\nmtime=" CPL_FRMT_GIB,
+                            static_cast<GIntBig>(oFileProp.mTime));
+    else
+        return std::string();
+    // Regions are aligned on the chunk size, which may differ between
+    // processes.
+    osKey += CPLSPrintf("\nsize=" CPL_FRMT_GUIB "\nchunk_size=%d"
+                        "\noffset=" CPL_FRMT_GUIB,
+                        static_cast<GUIntBig>(oFileProp.fileSize),
+                        VSICURLGetDownloadChunkSize(),
+                        static_cast<GUIntBig>(nFileOffsetStart));
+    return osKey;
 }
 
 /************************************************************************/
@@ -4401,6 +4979,12 @@ const char *VSICurlFilesystemHandlerBase::GetActualURL(const char *pszFilename)
     "  <Option name='CPL_VSIL_CURL_CACHE_SIZE' type='integer' "                \
     "description='Size in bytes of the global /vsicurl/ cache' "               \
     "default='16384000'/>"                                                     \
+    "  <Option name='CPL_VSIL_CURL_DISK_CACHE_DIR' type='string' "             \
+    "description='Directory of the persistent disk cache of downloaded "       \
+    "regions'/>"                                                               \
+    "  <Option name='CPL_VSIL_CURL_DISK_CACHE_SIZE' type='integer' "           \
+    "description='Maximum size in bytes of the persistent disk cache' "        \
+    "default='1073741824'/>"                                                   \
     "  <Option name='CPL_VSIL_CURL_IGNORE_GLACIER_STORAGE' type='boolean' "    \
     "description='Whether to skip files with Glacier storage class in "        \
     "directory listing.' default='YES'/>"                                      \
@@ -6212,6 +6796,51 @@ void NetworkStatisticsLogger::LogDELETE()
     }
 }
 
+void NetworkStatisticsLogger::LogReadAheadHit()
+{
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    for (auto counters : gInstance.GetCountersForContext())
+    {
+        counters->nReadAheadHits++;
+    }
+}
+
+void NetworkStatisticsLogger::LogReadAheadWait()
+{
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    for (auto counters : gInstance.GetCountersForContext())
+    {
+        counters->nReadAheadWaits++;
+    }
+}
+
+void NetworkStatisticsLogger::LogReadAheadMiss()
+{
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    for (auto counters : gInstance.GetCountersForContext())
+    {
+        counters->nReadAheadMisses++;
+    }
+}
+
+void NetworkStatisticsLogger::LogReadAheadDiscardedBytes(
+    size_t nDiscardedBytes)
+{
+    if (!IsEnabled() || nDiscardedBytes == 0)
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    for (auto counters : gInstance.GetCountersForContext())
+    {
+        counters->nReadAheadDiscardedBytes += nDiscardedBytes;
+    }
+}
+
 void NetworkStatisticsLogger::Reset()
 {
     std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
@@ -6241,6 +6870,16 @@ void NetworkStatisticsLogger::Stats::AsJSON(CPLJSONObject &oJSON) const
     if (counters.nDELETE)
         oMethods.Add("DELETE/count", counters.nDELETE);
     oJSON.Add("methods", oMethods);
+    if (counters.nReadAheadHits || counters.nReadAheadWaits ||
+        counters.nReadAheadMisses || counters.nReadAheadDiscardedBytes)
+    {
+        CPLJSONObject oReadAhead;
+        oReadAhead.Add("hit_count", counters.nReadAheadHits);
+        oReadAhead.Add("wait_count", counters.nReadAheadWaits);
+        oReadAhead.Add("miss_count", counters.nReadAheadMisses);
+        oReadAhead.Add("discarded_bytes", counters.nReadAheadDiscardedBytes);
+        oJSON.Add("read_ahead", oReadAhead);
+    }
     CPLJSONObject oFiles;
     bool bFilesAdded = false;
     for (const auto &kv : children)
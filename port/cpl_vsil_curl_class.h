@@ -30,6 +30,7 @@
 #include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <functional>
 #include <set>
 #include <map>
 #include <memory>
@@ -291,10 +292,14 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
     }
 
     std::shared_ptr<std::string> GetRegion(const char *pszURL,
-                                           vsi_l_offset nFileOffsetStart);
+                                           vsi_l_offset nFileOffsetStart,
+                                           bool bAllowDiskCache);
 
     void AddRegion(const char *pszURL, vsi_l_offset nFileOffsetStart,
-                   size_t nSize, const char *pData);
+                   size_t nSize, const char *pData, bool bAllowDiskCache);
+
+    std::string GetDiskCacheKey(const char *pszURL,
+                                vsi_l_offset nFileOffsetStart);
 
     std::pair<bool, std::string>
     NotifyStartDownloadRegion(const std::string &osURL,
@@ -410,6 +415,13 @@ class VSICurlHandle /* non final*/ : public VSIVirtualHandle
     int ReadMultiRangeSingleGet(int nRanges, void **ppData,
                                 const vsi_l_offset *panOffsets,
                                 const size_t *panSizes);
+    int ReadMultiRangeParallel(int nRanges, void **ppData,
+                               const vsi_l_offset *panOffsets,
+                               const size_t *panSizes,
+                               bool bMergeConsecutiveRanges,
+                               const std::string &osURL,
+                               const CPLStringList &aosHTTPOptions);
+    int ReadInParallel(void *pBuffer, size_t nSize, vsi_l_offset nOffset);
     std::string GetRedirectURLIfValid(bool &bHasExpired,
                                       CPLStringList &aosHTTPOptions) const;
 
@@ -421,6 +433,7 @@ class VSICurlHandle /* non final*/ : public VSIVirtualHandle
     {
         bool bDone = false;
         bool bToRetry = true;
+        bool bError = false;
         double dfSleepDelay = 0.0;
         std::mutex oMutex{};
         std::condition_variable oCV{};
@@ -428,6 +441,8 @@ class VSICurlHandle /* non final*/ : public VSIVirtualHandle
         size_t nSize = 0;
         std::vector<GByte> abyData{};
         CPLHTTPRetryContext retryContext;
+        // Used by AsyncReadMultiRange(): called once bDone is set
+        std::vector<std::function<void()>> aoDoneCallbacks{};
 
         explicit AdviseReadRange(const CPLHTTPRetryParameters &oRetryParameters)
             : retryContext(oRetryParameters)
@@ -444,6 +459,43 @@ class VSICurlHandle /* non final*/ : public VSIVirtualHandle
     std::thread m_oThreadAdviseRead{};
     CURLM *m_hCurlMultiHandleForAdviseRead = nullptr;
 
+    // Used by the sequential read-ahead of Read()
+    struct ReadAheadRange
+    {
+        size_t nSize = 0;
+        bool bDone = false;
+        bool bError = false;
+        bool bUsed = false;
+        std::string osData{};
+    };
+
+    struct ReadAheadState
+    {
+        std::mutex oMutex{};
+        std::condition_variable oCV{};
+        std::atomic<bool> bStop{false};
+        std::map<vsi_l_offset, std::shared_ptr<ReadAheadRange>> oMapRanges{};
+        vsi_l_offset nFileSize = 0;
+        vsi_l_offset nNextOffset = 0;
+        size_t nRangeSize = 0;
+        size_t nMaxRangeSize = 0;
+        size_t nBufferedBytes = 0;
+        size_t nTotalBytesLimit = 0;
+        int nMaxInFlight = 0;
+        int nInFlight = 0;
+    };
+
+    int m_nSequentialDownloads = 0;
+    std::unique_ptr<ReadAheadState> m_poReadAhead{};
+
+    bool StartReadAhead(vsi_l_offset nOffset, size_t nInitialRangeSize);
+    void SubmitReadAheadRanges();
+    bool GetReadAheadRegion(vsi_l_offset nOffset, std::string &osRegion);
+    void StopReadAhead();
+
+    size_t DownloadRange(void *pBuffer, size_t nSize, vsi_l_offset nOffset,
+                         std::atomic<bool> *pbInterrupt) const;
+
   protected:
     virtual struct curl_slist *GetCurlHeaders(const std::string & /*osVerb*/,
                                               struct curl_slist *psHeaders)
@@ -466,6 +518,13 @@ class VSICurlHandle /* non final*/ : public VSIVirtualHandle
         return false;
     }
 
+    // Whether ranges can be requested with a Range header, as done by the
+    // read-ahead and the parallel reads of Read().
+    virtual bool SupportsRangeHeader()
+    {
+        return true;
+    }
+
     virtual bool IsDirectoryFromExists(const char * /*pszVerb*/,
                                        int /*response_code*/)
     {
@@ -519,6 +578,16 @@ class VSICurlHandle /* non final*/ : public VSIVirtualHandle
 
     size_t GetAdviseReadTotalBytesLimit() const override;
 
+    bool HasAsyncRead() const override
+    {
+        return true;
+    }
+
+    std::unique_ptr<VSIAsyncReadRequest>
+    AsyncReadMultiRange(int nRanges, void **ppData,
+                        const vsi_l_offset *panOffsets, const size_t *panSizes,
+                        const VSIAsyncReadCallback &cbk) override;
+
     bool IsKnownFileSize() const
     {
         return oFileProp.bHasComputedFileSize;
@@ -1123,6 +1192,10 @@ class NetworkStatisticsLogger
         GIntBig nPUTUploadedBytes = 0;
         GIntBig nPOSTDownloadedBytes = 0;
         GIntBig nPOSTUploadedBytes = 0;
+        GIntBig nReadAheadHits = 0;
+        GIntBig nReadAheadWaits = 0;
+        GIntBig nReadAheadMisses = 0;
+        GIntBig nReadAheadDiscardedBytes = 0;
     };
 
     enum class ContextPathType
@@ -1202,6 +1275,14 @@ class NetworkStatisticsLogger
 
     static void LogDELETE();
 
+    static void LogReadAheadHit();
+
+    static void LogReadAheadWait();
+
+    static void LogReadAheadMiss();
+
+    static void LogReadAheadDiscardedBytes(size_t nDiscardedBytes);
+
     static void Reset();
 
     static std::string GetReportAsSerializedJSON();
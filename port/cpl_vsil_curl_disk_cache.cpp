@@ -0,0 +1,690 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Persistent disk cache of the regions downloaded by /vsicurl/ and
+ *           related file systems
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "cpl_vsil_curl_priv.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <ctime>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_multiproc.h"
+#include "cpl_sha256.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
+
+#include "cpl_zlib_header.h"  // to avoid warnings when including zlib.h
+
+//! @cond Doxygen_Suppress
+
+namespace
+{
+
+// Layout of a cache entry, whose filename is the SHA-256 hash of its key:
+// - 8 bytes: DISK_CACHE_MAGIC
+// - uint32 LSB: CRC32 of the data
+// - uint64 LSB: size of the data
+// - data
+// The key itself is not stored, as URLs may contain credentials in their
+// query string (signed URLs, SAS tokens, etc.)
+constexpr const char DISK_CACHE_MAGIC[] = "GDALVCC3";
+constexpr size_t DISK_CACHE_MAGIC_SIZE = 8;
+constexpr size_t DISK_CACHE_HEADER_SIZE =
+    DISK_CACHE_MAGIC_SIZE + sizeof(uint32_t) + sizeof(uint64_t);
+
+// Entries are not scoped to the credentials used to download them, so the
+// cache directories are only made accessible to their owner.
+constexpr int DISK_CACHE_DIR_MODE = 0700;
+
+constexpr GIntBig DISK_CACHE_SIZE_DEFAULT = 1024 * 1024 * 1024;
+
+// Once the cache exceeds its maximum size, least recently used entries are
+// removed until it is below that fraction of the maximum size.
+constexpr double DISK_CACHE_LOW_WATER_RATIO = 0.8;
+
+// Entries are rewritten when hit if they are older than that delay (in
+// seconds), so that their modification time approximates their last use.
+constexpr int DISK_CACHE_REFRESH_DELAY = 3600;
+
+// Delay (in seconds) after which temporary files left behind by a crashed
+// process are removed.
+constexpr int DISK_CACHE_STALE_TEMP_FILE_DELAY = 3600;
+
+constexpr const char DISK_CACHE_LOCK_FILENAME[] = ".lock";
+constexpr const char DISK_CACHE_TEMP_FILE_MARKER[] = ".tmp.";
+
+/************************************************************************/
+/*                          VSICurlDiskCache                            */
+/************************************************************************/
+
+class VSICurlDiskCache
+{
+  public:
+    static VSICurlDiskCache &Get();
+
+    bool GetConfig(std::string &osDir, GIntBig &nMaxSize);
+
+    bool GetRegion(const std::string &osKey, std::string &osData);
+    void AddRegion(const std::string &osKey, const char *pData, size_t nSize);
+    bool Clear();
+    CPLStringList GetStatistics();
+
+  private:
+    std::mutex m_oMutex{};
+    std::string m_osDir{};
+    GIntBig m_nMaxSize = 0;
+
+    // Whether m_nEstimatedSize comes from a scan of the cache directory
+    bool m_bSizeKnown = false;
+    GIntBig m_nEstimatedSize = 0;
+    bool m_bEvictionInProgress = false;
+
+    std::atomic<GUIntBig> m_nHits{0};
+    std::atomic<GUIntBig> m_nMisses{0};
+    std::atomic<GUIntBig> m_nBytesRead{0};
+    std::atomic<GUIntBig> m_nWrites{0};
+    std::atomic<GUIntBig> m_nBytesWritten{0};
+    std::atomic<GUIntBig> m_nEvictedFiles{0};
+    std::atomic<GUIntBig> m_nEvictedBytes{0};
+    std::atomic<GUIntBig> m_nTempFileCounter{0};
+
+    VSICurlDiskCache() = default;
+
+    static std::string GetEntryFilename(const std::string &osDir,
+                                        const std::string &osKey);
+    static uint32_t GetChecksum(const char *pData, size_t nSize);
+    bool WriteEntry(const std::string &osDir, const std::string &osFilename,
+                    const char *pData, size_t nSize);
+    bool Evict(const std::string &osDir, GIntBig nMaxSize, GIntBig nTargetSize,
+               GIntBig &nNewSize);
+
+    CPL_DISALLOW_COPY_ASSIGN(VSICurlDiskCache)
+};
+
+/************************************************************************/
+/*                                Get()                                 */
+/************************************************************************/
+
+VSICurlDiskCache &VSICurlDiskCache::Get()
+{
+    static VSICurlDiskCache oCache;
+    return oCache;
+}
+
+/************************************************************************/
+/*                             GetConfig()                              */
+/************************************************************************/
+
+/** Returns whether the disk cache is enabled, and its current settings.
+ * Configuration options are re-read at each call, so that they can be
+ * changed during the life-time of the process.
+ */
+bool VSICurlDiskCache::GetConfig(std::string &osDir, GIntBig &nMaxSize)
+{
+    const char *pszDir =
+        CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_DIR", nullptr);
+    if (pszDir == nullptr || pszDir[0] == '\0')
+        return false;
+
+    GIntBig nConfigMaxSize = DISK_CACHE_SIZE_DEFAULT;
+    const char *pszMaxSize =
+        CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_SIZE", nullptr);
+    if (pszMaxSize &&
+        (CPLParseMemorySize(pszMaxSize, &nConfigMaxSize, nullptr) != CE_None ||
+         nConfigMaxSize <= 0))
+    {
+        CPLErrorOnce(CE_Warning, CPLE_AppDefined,
+                     "Invalid value for CPL_VSIL_CURL_DISK_CACHE_SIZE. "
+                     "Using default value of " CPL_FRMT_GIB " instead.",
+                     DISK_CACHE_SIZE_DEFAULT);
+        nConfigMaxSize = DISK_CACHE_SIZE_DEFAULT;
+    }
+
+    std::lock_guard oLock(m_oMutex);
+    if (m_osDir != pszDir)
+    {
+        m_osDir = pszDir;
+        m_bSizeKnown = false;
+        m_nEstimatedSize = 0;
+    }
+    m_nMaxSize = nConfigMaxSize;
+    osDir = m_osDir;
+    nMaxSize = m_nMaxSize;
+    return true;
+}
+
+/************************************************************************/
+/*                          GetEntryFilename()                          */
+/************************************************************************/
+
+/* static */
+std::string VSICurlDiskCache::GetEntryFilename(const std::string &osDir,
+                                               const std::string &osKey)
+{
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(osKey.data(), osKey.size(), abyHash);
+    char *pszHex = CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash);
+    const std::string osHex(pszHex);
+    CPLFree(pszHex);
+
+    // Spread entries among 256 sub-directories
+    const std::string osSubDir =
+        CPLFormFilenameSafe(osDir.c_str(), osHex.substr(0, 2).c_str(), nullptr);
+    return CPLFormFilenameSafe(osSubDir.c_str(), osHex.substr(2).c_str(),
+                               nullptr);
+}
+
+/************************************************************************/
+/*                            GetChecksum()                             */
+/************************************************************************/
+
+/* static */
+uint32_t VSICurlDiskCache::GetChecksum(const char *pData, size_t nSize)
+{
+    uLong nCRC = crc32(0L, nullptr, 0);
+    const GByte *pabyData = reinterpret_cast<const GByte *>(pData);
+    while (nSize > 0)
+    {
+        // crc32() takes a uInt size
+        const size_t nChunkSize =
+            std::min<size_t>(nSize, std::numeric_limits<uInt>::max());
+        nCRC = crc32(nCRC, pabyData, static_cast<uInt>(nChunkSize));
+        pabyData += nChunkSize;
+        nSize -= nChunkSize;
+    }
+    return static_cast<uint32_t>(nCRC);
+}
+
+/************************************************************************/
+/*                             GetRegion()                              */
+/************************************************************************/
+
+bool VSICurlDiskCache::GetRegion(const std::string &osKey, std::string &osData)
+{
+    std::string osDir;
+    GIntBig nMaxSize = 0;
+    if (!GetConfig(osDir, nMaxSize))
+        return false;
+
+    const std::string osFilename = GetEntryFilename(osDir, osKey);
+    VSIStatBufL sStat;
+    if (VSIStatL(osFilename.c_str(), &sStat) != 0)
+    {
+        m_nMisses++;
+        return false;
+    }
+
+    // Check the header, and the checksum of the data, to guard against
+    // truncated or corrupted files.
+    bool bOK = false;
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(osFilename.c_str(), "rb"));
+    GByte abyMagic[DISK_CACHE_MAGIC_SIZE];
+    uint32_t nChecksum = 0;
+    uint64_t nDataSize = 0;
+    if (fp && fp->Read(abyMagic, sizeof(abyMagic)) == sizeof(abyMagic) &&
+        memcmp(abyMagic, DISK_CACHE_MAGIC, DISK_CACHE_MAGIC_SIZE) == 0 &&
+        fp->Read(&nChecksum, sizeof(nChecksum)) == sizeof(nChecksum) &&
+        fp->Read(&nDataSize, sizeof(nDataSize)) == sizeof(nDataSize))
+    {
+        CPL_LSBPTR32(&nChecksum);
+        CPL_LSBPTR64(&nDataSize);
+        if (static_cast<vsi_l_offset>(sStat.st_size) ==
+            DISK_CACHE_HEADER_SIZE + nDataSize)
+        {
+            osData.resize(static_cast<size_t>(nDataSize));
+            bOK = fp->Read(osData.data(), osData.size()) == osData.size() &&
+                  GetChecksum(osData.data(), osData.size()) == nChecksum;
+        }
+    }
+    fp.reset();
+
+    if (!bOK)
+    {
+        CPLDebug("VSICURL", "Removing invalid disk cache entry %s",
+                 osFilename.c_str());
+        VSIUnlink(osFilename.c_str());
+        osData.clear();
+        m_nMisses++;
+        return false;
+    }
+
+    m_nHits++;
+    m_nBytesRead += osData.size();
+
+    // Refresh the modification time of entries that are used, so that
+    // eviction removes the least recently used ones first.
+    if (static_cast<GIntBig>(time(nullptr)) -
+            static_cast<GIntBig>(sStat.st_mtime) >
+        DISK_CACHE_REFRESH_DELAY)
+    {
+        WriteEntry(osDir, osFilename, osData.data(), osData.size());
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                             WriteEntry()                             */
+/************************************************************************/
+
+/** Atomically (re)write a cache entry, by writing it to a temporary file
+ * that is then renamed. Concurrent readers, in this process or another one,
+ * thus never see partially written entries.
+ */
+bool VSICurlDiskCache::WriteEntry(const std::string &osDir,
+                                  const std::string &osFilename,
+                                  const char *pData, size_t nSize)
+{
+    const std::string osTmpFilename =
+        std::string(osFilename)
+            .append(DISK_CACHE_TEMP_FILE_MARKER)
+            .append(CPLSPrintf("%d." CPL_FRMT_GUIB, CPLGetCurrentProcessID(),
+                               static_cast<GUIntBig>(++m_nTempFileCounter)));
+
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(osTmpFilename.c_str(), "wb"));
+    if (!fp)
+    {
+        // Create the cache directory and/or the sub-directory on demand
+        VSIMkdirRecursive(CPLGetPathSafe(osFilename.c_str()).c_str(),
+                          DISK_CACHE_DIR_MODE);
+        fp.reset(VSIFOpenL(osTmpFilename.c_str(), "wb"));
+        if (!fp)
+        {
+            CPLDebug("VSICURL", "Cannot create %s in disk cache %s",
+                     osTmpFilename.c_str(), osDir.c_str());
+            return false;
+        }
+    }
+
+    uint32_t nChecksum = GetChecksum(pData, nSize);
+    CPL_LSBPTR32(&nChecksum);
+    uint64_t nDataSize = static_cast<uint64_t>(nSize);
+    CPL_LSBPTR64(&nDataSize);
+    bool bOK =
+        fp->Write(DISK_CACHE_MAGIC, DISK_CACHE_MAGIC_SIZE) ==
+            DISK_CACHE_MAGIC_SIZE &&
+        fp->Write(&nChecksum, sizeof(nChecksum)) == sizeof(nChecksum) &&
+        fp->Write(&nDataSize, sizeof(nDataSize)) == sizeof(nDataSize) &&
+        fp->Write(pData, nSize) == nSize;
+    bOK = VSIFCloseL(fp.release()) == 0 && bOK;
+
+    if (bOK)
+        bOK = VSIRename(osTmpFilename.c_str(), osFilename.c_str()) == 0;
+    if (!bOK)
+    {
+        // The rename may fail on Windows if another process has just
+        // written the same entry, which is fine.
+        VSIUnlink(osTmpFilename.c_str());
+    }
+    return bOK;
+}
+
+/************************************************************************/
+/*                             AddRegion()                              */
+/************************************************************************/
+
+void VSICurlDiskCache::AddRegion(const std::string &osKey, const char *pData,
+                                 size_t nSize)
+{
+    std::string osDir;
+    GIntBig nMaxSize = 0;
+    if (!GetConfig(osDir, nMaxSize))
+        return;
+
+    const std::string osFilename = GetEntryFilename(osDir, osKey);
+    if (!WriteEntry(osDir, osFilename, pData, nSize))
+        return;
+
+    m_nWrites++;
+    m_nBytesWritten += nSize;
+
+    const GIntBig nEntrySize =
+        static_cast<GIntBig>(DISK_CACHE_HEADER_SIZE + nSize);
+    const GIntBig nTargetSize =
+        static_cast<GIntBig>(DISK_CACHE_LOW_WATER_RATIO * nMaxSize);
+    {
+        std::lock_guard oLock(m_oMutex);
+        m_nEstimatedSize += nEntrySize;
+        if (m_bEvictionInProgress ||
+            (m_bSizeKnown && m_nEstimatedSize <= nMaxSize))
+        {
+            return;
+        }
+        m_bEvictionInProgress = true;
+    }
+
+    GIntBig nNewSize = 0;
+    const bool bEvicted = Evict(osDir, nMaxSize, nTargetSize, nNewSize);
+
+    std::lock_guard oLock(m_oMutex);
+    m_bEvictionInProgress = false;
+    if (osDir == m_osDir)
+    {
+        m_bSizeKnown = true;
+        // If another process was already evicting, assume it will bring
+        // the cache back to its low water mark.
+        m_nEstimatedSize = bEvicted ? nNewSize : nTargetSize;
+    }
+}
+
+/************************************************************************/
+/*                               Evict()                                */
+/************************************************************************/
+
+/** Scan the cache directory and, if its size exceeds nMaxSize, remove the
+ * least recently used entries until it goes below nTargetSize.
+ *
+ * Returns false if another process or thread holds the lock of the cache.
+ */
+bool VSICurlDiskCache::Evict(const std::string &osDir, GIntBig nMaxSize,
+                             GIntBig nTargetSize, GIntBig &nNewSize)
+{
+    const std::string osLockFilename =
+        CPLFormFilenameSafe(osDir.c_str(), DISK_CACHE_LOCK_FILENAME, nullptr);
+    CPLLockFileHandle hLock = nullptr;
+    CPLStringList aosLockOptions;
+    aosLockOptions.SetNameValue("WAIT_TIME", "0");
+    if (CPLLockFileEx(osLockFilename.c_str(), &hLock, aosLockOptions.List()) !=
+        CLFS_OK)
+    {
+        return false;
+    }
+
+    struct Entry
+    {
+        std::string osFilename{};
+        GIntBig nMTime = 0;
+        GIntBig nSize = 0;
+    };
+
+    std::vector<Entry> aoEntries;
+    nNewSize = 0;
+    const GIntBig nNow = static_cast<GIntBig>(time(nullptr));
+    VSIDIR *psDir = VSIOpenDir(osDir.c_str(), 1, nullptr);
+    if (psDir)
+    {
+        while (const VSIDIREntry *psEntry = VSIGetNextDirEntry(psDir))
+        {
+            if (!VSI_ISREG(psEntry->nMode) ||
+                strcmp(psEntry->pszName, DISK_CACHE_LOCK_FILENAME) == 0)
+            {
+                continue;
+            }
+            Entry oEntry;
+            oEntry.osFilename =
+                CPLFormFilenameSafe(osDir.c_str(), psEntry->pszName, nullptr);
+            oEntry.nMTime = psEntry->nMTime;
+            oEntry.nSize = static_cast<GIntBig>(psEntry->nSize);
+            if (strstr(psEntry->pszName, DISK_CACHE_TEMP_FILE_MARKER))
+            {
+                if (nNow - oEntry.nMTime > DISK_CACHE_STALE_TEMP_FILE_DELAY)
+                    VSIUnlink(oEntry.osFilename.c_str());
+                continue;
+            }
+            nNewSize += oEntry.nSize;
+            aoEntries.push_back(std::move(oEntry));
+        }
+        VSICloseDir(psDir);
+    }
+
+    if (nNewSize > nMaxSize)
+    {
+        std::sort(aoEntries.begin(), aoEntries.end(),
+                  [](const Entry &a, const Entry &b)
+                  { return a.nMTime < b.nMTime; });
+        for (const auto &oEntry : aoEntries)
+        {
+            if (nNewSize <= nTargetSize)
+                break;
+            if (VSIUnlink(oEntry.osFilename.c_str()) == 0)
+            {
+                nNewSize -= oEntry.nSize;
+                m_nEvictedFiles++;
+                m_nEvictedBytes += oEntry.nSize;
+            }
+        }
+        CPLDebug("VSICURL", "Disk cache %s trimmed to " CPL_FRMT_GIB " bytes",
+                 osDir.c_str(), nNewSize);
+    }
+
+    CPLUnlockFileEx(hLock);
+    return true;
+}
+
+/************************************************************************/
+/*                               Clear()                                */
+/************************************************************************/
+
+bool VSICurlDiskCache::Clear()
+{
+    std::string osDir;
+    GIntBig nMaxSize = 0;
+    if (!GetConfig(osDir, nMaxSize))
+        return false;
+
+    GIntBig nNewSize = 0;
+    if (!Evict(osDir, -1, -1, nNewSize))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Disk cache %s is locked by another process", osDir.c_str());
+        return false;
+    }
+
+    std::lock_guard oLock(m_oMutex);
+    if (osDir == m_osDir)
+    {
+        m_bSizeKnown = true;
+        m_nEstimatedSize = nNewSize;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                           GetStatistics()                            */
+/************************************************************************/
+
+CPLStringList VSICurlDiskCache::GetStatistics()
+{
+    CPLStringList aosStats;
+    std::string osDir;
+    GIntBig nMaxSize = 0;
+    if (GetConfig(osDir, nMaxSize))
+    {
+        aosStats.SetNameValue("DIR", osDir.c_str());
+        aosStats.SetNameValue("MAX_SIZE", CPLSPrintf(CPL_FRMT_GIB, nMaxSize));
+    }
+    const auto AddCounter = [&aosStats](const char *pszName, GUIntBig nValue)
+    { aosStats.SetNameValue(pszName, CPLSPrintf(CPL_FRMT_GUIB, nValue)); };
+    AddCounter("HITS", m_nHits);
+    AddCounter("MISSES", m_nMisses);
+    AddCounter("BYTES_READ", m_nBytesRead);
+    AddCounter("WRITES", m_nWrites);
+    AddCounter("BYTES_WRITTEN", m_nBytesWritten);
+    AddCounter("EVICTED_FILES", m_nEvictedFiles);
+    AddCounter("EVICTED_BYTES", m_nEvictedBytes);
+    return aosStats;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                     VSICURLDiskCacheIsEnabled()                      */
+/************************************************************************/
+
+bool VSICURLDiskCacheIsEnabled()
+{
+    const char *pszDir =
+        CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_DIR", nullptr);
+    return pszDir != nullptr && pszDir[0] != '\0';
+}
+
+/************************************************************************/
+/*                     VSICURLDiskCacheGetRegion()                      */
+/************************************************************************/
+
+bool VSICURLDiskCacheGetRegion(const std::string &osKey, std::string &osData)
+{
+    return VSICurlDiskCache::Get().GetRegion(osKey, osData);
+}
+
+/************************************************************************/
+/*                     VSICURLDiskCacheAddRegion()                      */
+/************************************************************************/
+
+void VSICURLDiskCacheAddRegion(const std::string &osKey, const char *pData,
+                               size_t nSize)
+{
+    VSICurlDiskCache::Get().AddRegion(osKey, pData, nSize);
+}
+
+//! @endcond
+
+/************************************************************************/
+/*                   VSICurlDiskCacheGetStatistics()                    */
+/************************************************************************/
+
+/**
+ * \brief Return statistics on the persistent disk cache of /vsicurl/ (and
+ * related file systems).
+ *
+ * The disk cache is enabled by setting the CPL_VSIL_CURL_DISK_CACHE_DIR
+ * configuration option. The returned list contains the following KEY=VALUE
+ * items, the counters being those of the current process:
+ * <ul>
+ * <li>DIR: cache directory (only if the cache is enabled)</li>
+ * <li>MAX_SIZE: maximum size of the cache in bytes (only if the cache is
+ * enabled)</li>
+ * <li>HITS: number of regions read from the cache</li>
+ * <li>MISSES: number of regions looked up but not found in the cache</li>
+ * <li>BYTES_READ: number of bytes read from the cache</li>
+ * <li>WRITES: number of regions written to the cache</li>
+ * <li>BYTES_WRITTEN: number of bytes written to the cache</li>
+ * <li>EVICTED_FILES: number of entries removed to honour MAX_SIZE, or by
+ * VSICurlDiskCacheClear()</li>
+ * <li>EVICTED_BYTES: number of bytes removed to honour MAX_SIZE, or by
+ * VSICurlDiskCacheClear()</li>
+ * </ul>
+ *
+ * @return a NULL terminated list of strings, to be freed with CSLDestroy().
+ * @since GDAL 3.13
+ */
+
+char **VSICurlDiskCacheGetStatistics(void)
+{
+    return VSICurlDiskCache::Get().GetStatistics().StealList();
+}
+
+/************************************************************************/
+/*                       VSICurlDiskCacheClear()                        */
+/************************************************************************/
+
+/**
+ * \brief Remove all entries of the persistent disk cache of /vsicurl/ (and
+ * related file systems).
+ *
+ * This does nothing if the CPL_VSIL_CURL_DISK_CACHE_DIR configuration option
+ * is not set.
+ *
+ * Note that VSICurlClearCache() only clears in-memory caches, and leaves
+ * the disk cache untouched.
+ *
+ * @return TRUE in case of success.
+ * @since GDAL 3.13
+ */
+
+int VSICurlDiskCacheClear(void)
+{
+    return VSICurlDiskCache::Get().Clear();
+}
+
+/************************************************************************/
+/*                      VSICurlDiskCachePrewarm()                       */
+/************************************************************************/
+
+/**
+ * \brief Populate the persistent disk cache of /vsicurl/ (and related file
+ * systems) with a range of a file.
+ *
+ * This is typically used to download in advance the headers and frequently
+ * accessed tiles of cloud optimized files, so that later processes can read
+ * them from the local disk. The CPL_VSIL_CURL_DISK_CACHE_DIR configuration
+ * option must be set.
+ *
+ * @param pszFilename Filename, starting with /vsicurl/, /vsis3/, /vsigs/,
+ * /vsiaz/, etc.
+ * @param nOffset Offset of the range to download.
+ * @param nSize Size of the range to download, or 0 to download up to the end
+ * of the file.
+ * @return TRUE in case of success.
+ * @since GDAL 3.13
+ */
+
+int VSICurlDiskCachePrewarm(const char *pszFilename, vsi_l_offset nOffset,
+                            vsi_l_offset nSize)
+{
+    if (!VSICURLDiskCacheIsEnabled())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "CPL_VSIL_CURL_DISK_CACHE_DIR configuration option is not "
+                 "set");
+        return FALSE;
+    }
+
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(pszFilename, "rb"));
+    if (!fp)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot open %s", pszFilename);
+        return FALSE;
+    }
+
+    if (nSize == 0)
+    {
+        if (fp->Seek(0, SEEK_END) != 0)
+            return FALSE;
+        const vsi_l_offset nFileSize = fp->Tell();
+        if (nOffset >= nFileSize)
+            return TRUE;
+        nSize = nFileSize - nOffset;
+    }
+    if (fp->Seek(nOffset, SEEK_SET) != 0)
+        return FALSE;
+
+    constexpr size_t BUFFER_SIZE = 1024 * 1024;
+    std::vector<GByte> abyBuffer(
+        static_cast<size_t>(std::min<vsi_l_offset>(nSize, BUFFER_SIZE)));
+    while (nSize > 0)
+    {
+        const size_t nToRead =
+            static_cast<size_t>(std::min<vsi_l_offset>(nSize, BUFFER_SIZE));
+        const size_t nRead = fp->Read(abyBuffer.data(), nToRead);
+        if (nRead < nToRead)
+        {
+            if (fp->Error())
+            {
+                CPLError(CE_Failure, CPLE_FileIO, "Cannot read %s",
+                         pszFilename);
+                return FALSE;
+            }
+            break;
+        }
+        nSize -= nRead;
+    }
+    return TRUE;
+}
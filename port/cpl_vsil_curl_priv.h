@@ -15,6 +15,8 @@
 
 #include "cpl_vsi_virtual.h"
 
+#include <string>
+
 /* NOTE: this is private API for GDAL internal use. */
 /* May change without notice. */
 /* Used by the MBTiles driver for now. */
@@ -35,4 +37,10 @@ int VSICurlUninstallReadCbk(VSILFILE *fp);
 
 void VSICurlAuthParametersChanged();
 
+// Persistent disk cache of downloaded regions (cpl_vsil_curl_disk_cache.cpp)
+bool VSICURLDiskCacheIsEnabled();
+bool VSICURLDiskCacheGetRegion(const std::string &osKey, std::string &osData);
+void VSICURLDiskCacheAddRegion(const std::string &osKey, const char *pData,
+                               size_t nSize);
+
 #endif  // CPL_VSIL_CURL_PRIV_H_INCLUDED
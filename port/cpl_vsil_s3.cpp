@@ -3617,9 +3617,20 @@ int IVSIS3LikeFSHandler::CopyFile(const char *pszSource, const char *pszTarget,
     bool bUsingStreaming = false;
     if (!fpSource)
     {
-        if (STARTS_WITH(pszSource, osPrefix.c_str()) &&
-            CPLTestBool(CPLGetConfigOption(
-                "VSIS3_COPYFILE_USE_STREAMING_SOURCE", "YES")))
+        // Large files are by default downloaded with a regular handle, so
+        // that the big reads of the base CopyFile() are split into parallel
+        // range requests.
+        const char *pszUseStreaming =
+            CPLGetConfigOption("VSIS3_COPYFILE_USE_STREAMING_SOURCE", nullptr);
+        const bool bUseStreaming =
+            pszUseStreaming
+                ? CPLTestBool(pszUseStreaming)
+                : !(nSourceSize != static_cast<vsi_l_offset>(-1) &&
+                    nSourceSize >= 16 * 1024 * 1024 &&
+                    atoi(CPLGetConfigOption(
+                        "CPL_VSIL_CURL_PARALLEL_READ_NUM_CONNECTIONS", "4")) >
+                        1);
+        if (STARTS_WITH(pszSource, osPrefix.c_str()) && bUseStreaming)
         {
             // Try to get a streaming path from the source path
             auto poSourceFSHandler = dynamic_cast<IVSIS3LikeFSHandler *>(
@@ -14,10 +14,12 @@
 #include "cpl_port.h"
 #include "cpl_vsi.h"
 
+#include <algorithm>
 #include <cerrno>
 #include <cstddef>
 #include <cstring>
 #include <limits>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_multiproc.h"
@@ -52,6 +54,15 @@ class VSISubFileHandle final : public VSIVirtualHandle
     int Eof() override;
     int Error() override;
     int Close() override;
+
+    bool HasPRead() const override;
+    size_t PRead(void *pBuffer, size_t nSize,
+                 vsi_l_offset nOffset) const override;
+    bool HasAsyncRead() const override;
+    std::unique_ptr<VSIAsyncReadRequest>
+    AsyncReadMultiRange(int nRanges, void **ppData,
+                        const vsi_l_offset *panOffsets, const size_t *panSizes,
+                        const VSIAsyncReadCallback &cbk) override;
 };
 
 /************************************************************************/
@@ -206,6 +217,72 @@ size_t VSISubFileHandle::Read(void *pBuffer, size_t nByteToRead)
     return nRet;
 }
 
+/************************************************************************/
+/*                              HasPRead()                              */
+/************************************************************************/
+
+bool VSISubFileHandle::HasPRead() const
+{
+    return fp->HasPRead();
+}
+
+/************************************************************************/
+/*                               PRead()                                */
+/************************************************************************/
+
+size_t VSISubFileHandle::PRead(void *pBuffer, size_t nSize,
+                               vsi_l_offset nOffset) const
+{
+    if (nSubregionSize != 0)
+    {
+        if (nOffset >= nSubregionSize)
+            return 0;
+        nSize = static_cast<size_t>(std::min(
+            static_cast<vsi_l_offset>(nSize), nSubregionSize - nOffset));
+    }
+    if (nOffset > std::numeric_limits<vsi_l_offset>::max() - nSubregionOffset)
+        return 0;
+    return fp->PRead(pBuffer, nSize, nOffset + nSubregionOffset);
+}
+
+/************************************************************************/
+/*                            HasAsyncRead()                            */
+/************************************************************************/
+
+bool VSISubFileHandle::HasAsyncRead() const
+{
+    return fp->HasAsyncRead();
+}
+
+/************************************************************************/
+/*                        AsyncReadMultiRange()                         */
+/************************************************************************/
+
+std::unique_ptr<VSIAsyncReadRequest> VSISubFileHandle::AsyncReadMultiRange(
+    int nRanges, void **ppData, const vsi_l_offset *panOffsets,
+    const size_t *panSizes, const VSIAsyncReadCallback &cbk)
+{
+    std::vector<vsi_l_offset> anOffsets;
+    anOffsets.reserve(nRanges);
+    for (int i = 0; i < nRanges; ++i)
+    {
+        if ((nSubregionSize != 0 &&
+             (panOffsets[i] > nSubregionSize ||
+              panSizes[i] > nSubregionSize - panOffsets[i])) ||
+            panOffsets[i] >
+                std::numeric_limits<vsi_l_offset>::max() - nSubregionOffset)
+        {
+            // Ranges not fully inside the subregion are reported as failed
+            // by the default implementation, through Seek() and Read().
+            return VSIVirtualHandle::AsyncReadMultiRange(
+                nRanges, ppData, panOffsets, panSizes, cbk);
+        }
+        anOffsets.push_back(panOffsets[i] + nSubregionOffset);
+    }
+    return fp->AsyncReadMultiRange(nRanges, ppData, anOffsets.data(), panSizes,
+                                   cbk);
+}
+
 /************************************************************************/
 /*                               Write()                                */
 /************************************************************************/
@@ -64,6 +64,11 @@
 #ifdef HAVE_PREAD_BSD
 #include <sys/uio.h>
 #endif
+#if defined(__linux) && defined(HAVE_LINUX_IO_URING)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
 
 #if defined(__MACH__) && defined(__APPLE__)
 #define HAS_CASE_INSENSITIVE_FILE_SYSTEM
@@ -74,8 +79,12 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <cstdlib>
 #include <limits>
+#include <memory>
 #include <new>
+#include <vector>
 
 #include "cpl_config.h"
 #include "cpl_conv.h"
@@ -83,6 +92,13 @@
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_vsi_error.h"
+#include "cpl_worker_thread_pool.h"
+
+#if defined(__linux) && defined(HAVE_LINUX_IO_URING) &&                      \
+    defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) &&            \
+    defined(HAVE_PREAD64)
+#define VSI_USE_IO_URING
+#endif
 
 #if defined(UNIX_STDIO_64)
 
@@ -286,9 +302,33 @@ class VSIUnixStdioHandle final : public VSIVirtualHandle
     bool HasPRead() const override;
     size_t PRead(void * /*pBuffer*/, size_t /* nSize */,
                  vsi_l_offset /*nOffset*/) const override;
+    int ReadMultiRange(int nRanges, void **ppData,
+                       const vsi_l_offset *panOffsets,
+                       const size_t *panSizes) override;
+    bool HasAsyncRead() const override;
+    std::unique_ptr<VSIAsyncReadRequest>
+    AsyncReadMultiRange(int nRanges, void **ppData,
+                        const vsi_l_offset *panOffsets, const size_t *panSizes,
+                        const VSIAsyncReadCallback &cbk) override;
+#endif
+#ifdef HAVE_POSIX_FADVISE
+    void AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
+                    const size_t *panSizes) override;
+    size_t GetAdviseReadTotalBytesLimit() const override;
 #endif
 
     void CancelCreation() override;
+
+  private:
+#if defined(HAVE_PREAD64) || (defined(HAVE_PREAD_BSD) && SIZEOF_OFF_T == 8)
+    bool PReadFully(void *pBuffer, size_t nSize, vsi_l_offset nOffset) const;
+#endif
+#ifdef VSI_USE_IO_URING
+    int ReadMultiRangeIOURing(int nRanges, void *const *ppData,
+                              const vsi_l_offset *panOffsets,
+                              const size_t *panSizes,
+                              VSIAsyncReadRequest *poRequest);
+#endif
 };
 
 /************************************************************************/
@@ -898,8 +938,635 @@ size_t VSIUnixStdioHandle::PRead(void *pBuffer, size_t nSize,
     return pread(fd, pBuffer, nSize, static_cast<off_t>(nOffset));
 #endif
 }
+
+/************************************************************************/
+/*                             PReadFully()                             */
+/************************************************************************/
+
+// Loop over PRead() until nSize bytes have been read, retrying on EINTR.
+// Returns false on error or if the end of file is reached before.
+bool VSIUnixStdioHandle::PReadFully(void *pBuffer, size_t nSize,
+                                    vsi_l_offset nOffset) const
+{
+    GByte *pabyBuffer = static_cast<GByte *>(pBuffer);
+    while (nSize > 0)
+    {
+        errno = 0;
+        const size_t nRead = PRead(pabyBuffer, nSize, nOffset);
+        if (nRead == static_cast<size_t>(-1))
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        if (nRead == 0)
+            return false;
+        pabyBuffer += nRead;
+        nSize -= nRead;
+        nOffset += nRead;
+    }
+    return true;
+}
+
+#ifdef VSI_USE_IO_URING
+
+/************************************************************************/
+/* ==================================================================== */
+/*                              VSIIOURing                              */
+/* ==================================================================== */
+/************************************************************************/
+
+namespace
+{
+
+// Minimal io_uring submission/completion queue pair, driven through the raw
+// system calls so that liburing is not required. Only used to issue
+// IORING_OP_READ requests from ReadMultiRange().
+class VSIIOURing
+{
+    CPL_DISALLOW_COPY_ASSIGN(VSIIOURing)
+
+    int m_fd = -1;
+    unsigned m_nSQEntries = 0;
+
+    void *m_pSQRing = nullptr;
+    size_t m_nSQRingSize = 0;
+    void *m_pCQRing = nullptr;
+    size_t m_nCQRingSize = 0;
+    io_uring_sqe *m_pasSQE = nullptr;
+    size_t m_nSQESize = 0;
+
+    unsigned *m_pnSQHead = nullptr;
+    unsigned *m_pnSQTail = nullptr;
+    unsigned m_nSQMask = 0;
+    unsigned *m_panSQArray = nullptr;
+    unsigned m_nSQTail = 0;  // Local tail, published by Submit()
+
+    unsigned *m_pnCQHead = nullptr;
+    unsigned *m_pnCQTail = nullptr;
+    unsigned m_nCQMask = 0;
+    io_uring_cqe *m_pasCQE = nullptr;
+
+  public:
+    VSIIOURing() = default;
+    ~VSIIOURing();
+
+    int Init(unsigned nEntries);
+
+    unsigned GetQueueDepth() const
+    {
+        return m_nSQEntries;
+    }
+
+    io_uring_sqe *GetSQE();
+    int Submit(unsigned nMinComplete);
+    unsigned DiscardUnsubmitted();
+    bool PopCQE(uint64_t &nUserData, int &nRes);
+};
+
+/************************************************************************/
+/*                            ~VSIIOURing()                             */
+/************************************************************************/
+
+VSIIOURing::~VSIIOURing()
+{
+    if (m_pasSQE)
+        munmap(m_pasSQE, m_nSQESize);
+    if (m_pCQRing && m_pCQRing != m_pSQRing)
+        munmap(m_pCQRing, m_nCQRingSize);
+    if (m_pSQRing)
+        munmap(m_pSQRing, m_nSQRingSize);
+    if (m_fd >= 0)
+        close(m_fd);
+}
+
+/************************************************************************/
+/*                                Init()                                */
+/************************************************************************/
+
+// Returns 0 on success, or an errno value.
+int VSIIOURing::Init(unsigned nEntries)
+{
+    io_uring_params sParams;
+    memset(&sParams, 0, sizeof(sParams));
+    m_fd = static_cast<int>(syscall(__NR_io_uring_setup, nEntries, &sParams));
+    if (m_fd < 0)
+        return errno;
+
+    m_nSQRingSize =
+        sParams.sq_off.array + sParams.sq_entries * sizeof(unsigned);
+    m_nCQRingSize =
+        sParams.cq_off.cqes + sParams.cq_entries * sizeof(io_uring_cqe);
+    const bool bSingleMMap = (sParams.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (bSingleMMap)
+    {
+        m_nSQRingSize = std::max(m_nSQRingSize, m_nCQRingSize);
+        m_nCQRingSize = m_nSQRingSize;
+    }
+
+    void *pRing = mmap(nullptr, m_nSQRingSize, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQ_RING);
+    if (pRing == MAP_FAILED)
+        return errno;
+    m_pSQRing = pRing;
+
+    if (bSingleMMap)
+    {
+        m_pCQRing = m_pSQRing;
+    }
+    else
+    {
+        pRing = mmap(nullptr, m_nCQRingSize, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_CQ_RING);
+        if (pRing == MAP_FAILED)
+            return errno;
+        m_pCQRing = pRing;
+    }
+
+    m_nSQESize = sParams.sq_entries * sizeof(io_uring_sqe);
+    pRing = mmap(nullptr, m_nSQESize, PROT_READ | PROT_WRITE,
+                 MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQES);
+    if (pRing == MAP_FAILED)
+        return errno;
+    m_pasSQE = static_cast<io_uring_sqe *>(pRing);
+
+    GByte *pabySQ = static_cast<GByte *>(m_pSQRing);
+    m_pnSQHead = reinterpret_cast<unsigned *>(pabySQ + sParams.sq_off.head);
+    m_pnSQTail = reinterpret_cast<unsigned *>(pabySQ + sParams.sq_off.tail);
+    m_nSQMask =
+        *reinterpret_cast<unsigned *>(pabySQ + sParams.sq_off.ring_mask);
+    m_panSQArray =
+        reinterpret_cast<unsigned *>(pabySQ + sParams.sq_off.array);
+    m_nSQTail = *m_pnSQTail;
+
+    GByte *pabyCQ = static_cast<GByte *>(m_pCQRing);
+    m_pnCQHead = reinterpret_cast<unsigned *>(pabyCQ + sParams.cq_off.head);
+    m_pnCQTail = reinterpret_cast<unsigned *>(pabyCQ + sParams.cq_off.tail);
+    m_nCQMask =
+        *reinterpret_cast<unsigned *>(pabyCQ + sParams.cq_off.ring_mask);
+    m_pasCQE = reinterpret_cast<io_uring_cqe *>(pabyCQ + sParams.cq_off.cqes);
+
+    m_nSQEntries = sParams.sq_entries;
+    return 0;
+}
+
+/************************************************************************/
+/*                               GetSQE()                               */
+/************************************************************************/
+
+// Returns a zeroed submission queue entry, or nullptr if the queue is full.
+io_uring_sqe *VSIIOURing::GetSQE()
+{
+    const unsigned nHead = __atomic_load_n(m_pnSQHead, __ATOMIC_ACQUIRE);
+    if (m_nSQTail - nHead >= m_nSQEntries)
+        return nullptr;
+    const unsigned nIdx = m_nSQTail & m_nSQMask;
+    io_uring_sqe *psSQE = &m_pasSQE[nIdx];
+    memset(psSQE, 0, sizeof(*psSQE));
+    m_panSQArray[nIdx] = nIdx;
+    ++m_nSQTail;
+    return psSQE;
+}
+
+/************************************************************************/
+/*                               Submit()                               */
+/************************************************************************/
+
+// Submits pending entries and waits for at least nMinComplete completions.
+// Returns 0 on success, or a negative errno value.
+int VSIIOURing::Submit(unsigned nMinComplete)
+{
+    __atomic_store_n(m_pnSQTail, m_nSQTail, __ATOMIC_RELEASE);
+    const unsigned nToSubmit =
+        m_nSQTail - __atomic_load_n(m_pnSQHead, __ATOMIC_ACQUIRE);
+    const long nRet =
+        syscall(__NR_io_uring_enter, m_fd, nToSubmit, nMinComplete,
+                nMinComplete ? IORING_ENTER_GETEVENTS : 0, nullptr, 0);
+    return nRet < 0 ? -errno : 0;
+}
+
+/************************************************************************/
+/*                         DiscardUnsubmitted()                         */
+/************************************************************************/
+
+// Drops the entries that the kernel has not consumed yet, and returns their
+// number.
+unsigned VSIIOURing::DiscardUnsubmitted()
+{
+    const unsigned nHead = __atomic_load_n(m_pnSQHead, __ATOMIC_ACQUIRE);
+    const unsigned nDiscarded = m_nSQTail - nHead;
+    m_nSQTail = nHead;
+    __atomic_store_n(m_pnSQTail, m_nSQTail, __ATOMIC_RELEASE);
+    return nDiscarded;
+}
+
+/************************************************************************/
+/*                               PopCQE()                               */
+/************************************************************************/
+
+bool VSIIOURing::PopCQE(uint64_t &nUserData, int &nRes)
+{
+    const unsigned nHead = *m_pnCQHead;
+    if (nHead == __atomic_load_n(m_pnCQTail, __ATOMIC_ACQUIRE))
+        return false;
+    const io_uring_cqe &sCQE = m_pasCQE[nHead & m_nCQMask];
+    nUserData = sCQE.user_data;
+    nRes = sCQE.res;
+    __atomic_store_n(m_pnCQHead, nHead + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+// Set once io_uring has been found not to be usable (disabled by seccomp,
+// kernel without IORING_OP_READ, ...), to avoid retrying on each call.
+std::atomic<bool> gbIOURingUnavailable{false};
+
+/************************************************************************/
+/*                       GetThreadLocalIOURing()                        */
+/************************************************************************/
+
+VSIIOURing *GetThreadLocalIOURing()
+{
+    static thread_local std::unique_ptr<VSIIOURing> tlsRing;
+    static thread_local bool tlsbInitDone = false;
+    if (!tlsbInitDone)
+    {
+        tlsbInitDone = true;
+        auto poRing = std::make_unique<VSIIOURing>();
+        constexpr unsigned QUEUE_DEPTH = 64;
+        const int nErr = poRing->Init(QUEUE_DEPTH);
+        if (nErr == 0)
+        {
+            tlsRing = std::move(poRing);
+        }
+        else if (!gbIOURingUnavailable.exchange(true))
+        {
+            // e.g. RLIMIT_MEMLOCK reached. This disables io_uring for the
+            // whole process, so report it once.
+            CPLDebug("VSI",
+                     "Cannot create an io_uring ring of %u entries: %s. "
+                     "Using pread() from now on",
+                     QUEUE_DEPTH, VSIStrerror(nErr));
+        }
+    }
+    return tlsRing.get();
+}
+
+/************************************************************************/
+/*                         IsIOURingAvailable()                         */
+/************************************************************************/
+
+bool IsIOURingAvailable()
+{
+    if (gbIOURingUnavailable ||
+        !CPLTestBool(CPLGetConfigOption("CPL_VSIL_USE_IO_URING", "YES")))
+    {
+        return false;
+    }
+    // Check once that io_uring can be set up (not blocked by seccomp, ...)
+    static const bool bCanSetup = []()
+    {
+        VSIIOURing oRing;
+        const int nErr = oRing.Init(1);
+        if (nErr != 0)
+        {
+            CPLDebug("VSI", "io_uring cannot be used: %s. Using pread()",
+                     VSIStrerror(nErr));
+            gbIOURingUnavailable = true;
+        }
+        return nErr == 0;
+    }();
+    return bCanSetup;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                       ReadMultiRangeIOURing()                        */
+/************************************************************************/
+
+// Reads the ranges by keeping up to GetQueueDepth() reads in flight in the
+// thread local io_uring. Short or failed reads are completed with pread(), so
+// that the result is the same as the pread() based path.
+// If poRequest is not null, the completion of each range is reported to it,
+// and all ranges are attempted even if some of them fail.
+// This never returns while reads are in flight, as the kernel may write into
+// their buffers until their completion has been received.
+int VSIUnixStdioHandle::ReadMultiRangeIOURing(int nRanges, void *const *ppData,
+                                              const vsi_l_offset *panOffsets,
+                                              const size_t *panSizes,
+                                              VSIAsyncReadRequest *poRequest)
+{
+    VSIIOURing *poRing = GetThreadLocalIOURing();
+    if (!poRing)
+        return 1;
+
+    std::vector<bool> abDone(nRanges);
+    const unsigned nQueueDepth = poRing->GetQueueDepth();
+    unsigned nInFlight = 0;
+    int iNextRange = 0;
+    bool bFailed = false;
+    bool bRingUsable = true;
+    bool bSubmitFailed = false;
+    // Must be the last access to this object for the range, as the file may
+    // be closed once the last range of an asynchronous request is done.
+    const auto RangeDone = [&abDone, &bFailed, poRequest](int i, bool bOK)
+    {
+        abDone[i] = true;
+        if (!bOK)
+            bFailed = true;
+        if (poRequest)
+            poRequest->SetRangeDone(i, bOK);
+    };
+    while (true)
+    {
+        while (iNextRange < nRanges && (!bFailed || poRequest))
+        {
+            const int i = iNextRange;
+            // Ranges that cannot be expressed in a single request are read
+            // synchronously.
+            if (!bRingUsable || panSizes[i] == 0 ||
+                panSizes[i] >
+                    static_cast<size_t>(std::numeric_limits<int>::max()))
+            {
+                ++iNextRange;
+                RangeDone(i, PReadFully(ppData[i], panSizes[i], panOffsets[i]));
+                continue;
+            }
+            if (nInFlight == nQueueDepth)
+                break;
+            io_uring_sqe *psSQE = poRing->GetSQE();
+            if (!psSQE)
+                break;
+            psSQE->opcode = IORING_OP_READ;
+            psSQE->fd = fd;
+            psSQE->addr = reinterpret_cast<uintptr_t>(ppData[i]);
+            psSQE->len = static_cast<unsigned>(panSizes[i]);
+            psSQE->off = panOffsets[i];
+            psSQE->user_data = static_cast<uint64_t>(i);
+            ++nInFlight;
+            ++iNextRange;
+        }
+        if (nInFlight == 0)
+            break;
+
+        const int nRet = poRing->Submit(1);
+        if (nRet < 0 && nRet != -EINTR && nRet != -EAGAIN && nRet != -EBUSY)
+        {
+            if (!bSubmitFailed)
+            {
+                CPLDebug("VSI", "io_uring_enter() failed: %s. Using pread()",
+                         VSIStrerror(-nRet));
+                bSubmitFailed = true;
+                gbIOURingUnavailable = true;
+                bRingUsable = false;
+                nInFlight -= poRing->DiscardUnsubmitted();
+            }
+            else
+            {
+                // The kernel still owns the buffers of the reads in flight
+                // and posts their completions even if waiting for them
+                // fails: poll for them.
+                CPLSleep(0.001);
+            }
+        }
+
+        uint64_t nUserData = 0;
+        int nRes = 0;
+        while (poRing->PopCQE(nUserData, nRes))
+        {
+            --nInFlight;
+            const int i = static_cast<int>(nUserData);
+            size_t nRead = 0;
+            if (nRes >= 0)
+            {
+                nRead = static_cast<size_t>(nRes);
+            }
+            else if (nRes == -EINVAL || nRes == -EOPNOTSUPP)
+            {
+                // Kernel too old to support IORING_OP_READ
+                if (!gbIOURingUnavailable.exchange(true))
+                {
+                    CPLDebug("VSI", "io_uring read failed: %s. Using pread()",
+                             VSIStrerror(-nRes));
+                }
+                bRingUsable = false;
+            }
+            RangeDone(i, nRead == panSizes[i] ||
+                             PReadFully(static_cast<GByte *>(ppData[i]) + nRead,
+                                        panSizes[i] - nRead,
+                                        panOffsets[i] + nRead));
+        }
+    }
+
+    // Read with pread() the ranges whose request has been discarded after
+    // a failure of io_uring_enter()
+    for (int i = 0; i < iNextRange && (!bFailed || poRequest); ++i)
+    {
+        if (!abDone[i])
+            RangeDone(i, PReadFully(ppData[i], panSizes[i], panOffsets[i]));
+    }
+
+    return bFailed ? -1 : 0;
+}
+
+#endif  // VSI_USE_IO_URING
+
+/************************************************************************/
+/*                           ReadMultiRange()                           */
+/************************************************************************/
+
+int VSIUnixStdioHandle::ReadMultiRange(int nRanges, void **ppData,
+                                       const vsi_l_offset *panOffsets,
+                                       const size_t *panSizes)
+{
+    if (eAccessMode == AccessMode::WRITE_ONLY)
+    {
+        bError = true;
+        errno = EINVAL;
+        return -1;
+    }
+
+    // Make pending buffered writes visible to positional reads
+    if (m_bBufferDirty && Flush() != 0)
+    {
+        bError = true;
+        return -1;
+    }
+
+#ifdef VSI_USE_IO_URING
+    if (nRanges > 1 && IsIOURingAvailable())
+    {
+        const int nRet = ReadMultiRangeIOURing(nRanges, ppData, panOffsets,
+                                               panSizes, nullptr);
+        if (nRet <= 0)
+            return nRet;
+    }
 #endif
 
+    for (int i = 0; i < nRanges; ++i)
+    {
+        if (!PReadFully(ppData[i], panSizes[i], panOffsets[i]))
+            return -1;
+    }
+    return 0;
+}
+
+/************************************************************************/
+/*                            HasAsyncRead()                            */
+/************************************************************************/
+
+bool VSIUnixStdioHandle::HasAsyncRead() const
+{
+#ifdef VSI_USE_IO_URING
+    return IsIOURingAvailable() &&
+           CPLTestBool(CPLGetConfigOption("CPL_VSIL_LOCAL_ASYNC_READ", "NO"));
+#else
+    return false;
+#endif
+}
+
+/************************************************************************/
+/*                        AsyncReadMultiRange()                         */
+/************************************************************************/
+
+std::unique_ptr<VSIAsyncReadRequest> VSIUnixStdioHandle::AsyncReadMultiRange(
+    int nRanges, void **ppData, const vsi_l_offset *panOffsets,
+    const size_t *panSizes, const VSIAsyncReadCallback &cbk)
+{
+    auto poRequest = std::make_unique<VSIAsyncReadRequest>(nRanges, cbk);
+
+    // Make pending buffered writes visible to positional reads
+    if (eAccessMode == AccessMode::WRITE_ONLY ||
+        (m_bBufferDirty && Flush() != 0))
+    {
+        bError = true;
+        for (int i = 0; i < nRanges; ++i)
+            poRequest->SetRangeDone(i, false);
+        return poRequest;
+    }
+
+    // Reads are only done in the background when explicitly enabled
+    if (!HasAsyncRead())
+    {
+        for (int i = 0; i < nRanges; ++i)
+        {
+            poRequest->SetRangeDone(
+                i, PReadFully(ppData[i], panSizes[i], panOffsets[i]));
+        }
+        return poRequest;
+    }
+
+#ifdef VSI_USE_IO_URING
+    // All ranges are submitted from a single job of the I/O thread pool,
+    // which keeps them in flight in its io_uring.
+    CPLWorkerThreadPool *poPool = nullptr;
+    if (nRanges > 1 && IsIOURingAvailable())
+    {
+        poPool = VSIGetAsyncReadThreadPool();
+    }
+    if (poPool)
+    {
+        VSIAsyncReadRequest *poRequestRaw = poRequest.get();
+        std::vector<void *> apData(ppData, ppData + nRanges);
+        std::vector<vsi_l_offset> anOffsets(panOffsets, panOffsets + nRanges);
+        std::vector<size_t> anSizes(panSizes, panSizes + nRanges);
+        const auto task = [this, poRequestRaw, apData = std::move(apData),
+                           anOffsets = std::move(anOffsets),
+                           anSizes = std::move(anSizes)]()
+        {
+            const int nCount = static_cast<int>(apData.size());
+            if (ReadMultiRangeIOURing(nCount, apData.data(), anOffsets.data(),
+                                      anSizes.data(), poRequestRaw) > 0)
+            {
+                for (int i = 0; i < nCount; ++i)
+                {
+                    poRequestRaw->SetRangeDone(
+                        i, PReadFully(apData[i], anSizes[i], anOffsets[i]));
+                }
+            }
+        };
+        if (poPool->SubmitJob(task))
+            return poRequest;
+    }
+#endif
+
+    for (int i = 0; i < nRanges; ++i)
+    {
+        VSIAsyncReadRangeWithPRead(this, poRequest.get(), i, ppData[i],
+                                   panSizes[i], panOffsets[i]);
+    }
+    return poRequest;
+}
+#endif
+
+#ifdef HAVE_POSIX_FADVISE
+
+/************************************************************************/
+/*                 GetLocalAdviseReadTotalBytesLimit()                  */
+/************************************************************************/
+
+static size_t GetLocalAdviseReadTotalBytesLimit()
+{
+    return static_cast<size_t>(std::min<unsigned long long>(
+        std::numeric_limits<size_t>::max(),
+        // 100 MB
+        std::strtoull(CPLGetConfigOption(
+                          "CPL_VSIL_LOCAL_ADVISE_READ_TOTAL_BYTES_LIMIT",
+                          "104857600"),
+                      nullptr, 10)));
+}
+
+/************************************************************************/
+/*                             AdviseRead()                             */
+/************************************************************************/
+
+void VSIUnixStdioHandle::AdviseRead(int nRanges,
+                                    const vsi_l_offset *panOffsets,
+                                    const size_t *panSizes)
+{
+    // Nothing is buffered here: the ranges are only passed to the kernel as
+    // posix_fadvise(POSIX_FADV_WILLNEED) hints, so that it starts reading
+    // them into the page cache in the background, and the following Read() /
+    // PRead() calls are less likely to block on I/O.
+    // CPL_VSIL_LOCAL_ADVISE_READ_TOTAL_BYTES_LIMIT (100 MB by default) only
+    // bounds the total size of the hinted ranges, not any memory allocation.
+    const size_t nLimit = GetLocalAdviseReadTotalBytesLimit();
+    size_t nAccSize = 0;
+    for (int i = 0; i < nRanges; ++i)
+    {
+        if (panSizes[i] > nLimit - nAccSize)
+        {
+            CPLDebug("VSI", "Trying to request too many bytes in AdviseRead()");
+            break;
+        }
+        nAccSize += panSizes[i];
+        if (panSizes[i] > 0)
+        {
+            CPL_IGNORE_RET_VAL(posix_fadvise(
+                fd, static_cast<off_t>(panOffsets[i]),
+                static_cast<off_t>(panSizes[i]), POSIX_FADV_WILLNEED));
+        }
+    }
+}
+
+/************************************************************************/
+/*                    GetAdviseReadTotalBytesLimit()                    */
+/************************************************************************/
+
+size_t VSIUnixStdioHandle::GetAdviseReadTotalBytesLimit() const
+{
+    // Only advertised when asynchronous reads are enabled, so that drivers
+    // such as GeoTIFF keep their usual read strategy on local files
+    // otherwise.
+#if defined(HAVE_PREAD64) || (defined(HAVE_PREAD_BSD) && SIZEOF_OFF_T == 8)
+    if (HasAsyncRead())
+        return GetLocalAdviseReadTotalBytesLimit();
+#endif
+    return 0;
+}
+
+#endif  // HAVE_POSIX_FADVISE
+
 /************************************************************************/
 /* ==================================================================== */
 /*                       VSIUnixStdioFilesystemHandler                  */
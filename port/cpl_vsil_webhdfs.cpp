@@ -121,6 +121,14 @@ class VSIWebHDFSHandle final : public VSICurlHandle
 
     std::string DownloadRegion(vsi_l_offset startOffset, int nBlocks) override;
 
+  protected:
+    // WebHDFS needs the offset and length to be passed as parameters of the
+    // OPEN operation.
+    bool SupportsRangeHeader() override
+    {
+        return false;
+    }
+
   public:
     VSIWebHDFSHandle(VSIWebHDFSFSHandler *poFS, const char *pszFilename,
                      const char *pszURL);
@@ -21,6 +21,7 @@
 #include "cpl_vsi.h"
 
 static thread_local CPLWorkerThreadPool *threadLocalCurrentThreadPool = nullptr;
+static thread_local CPLWorkerThread *threadLocalCurrentWorkerThread = nullptr;
 
 /************************************************************************/
 /*                        CPLWorkerThreadPool()                         */
@@ -93,6 +94,13 @@ void CPLWorkerThreadPool::WorkerThreadFunction(void *user_data)
     CPLWorkerThreadPool *poTP = psWT->poTP;
 
     threadLocalCurrentThreadPool = poTP;
+    threadLocalCurrentWorkerThread = psWT;
+
+    if (poTP->m_bWorkStealing)
+    {
+        std::unique_lock oLock(poTP->m_oWorkStealingMutex);
+        poTP->m_apoWorkStealingWT.push_back(psWT);
+    }
 
     if (psWT->pfnInitFunc)
         psWT->pfnInitFunc(psWT->pInitData);
@@ -140,6 +148,12 @@ bool CPLWorkerThreadPool::SubmitJob(std::function<void()> task)
     }
 #endif
 
+    if (IsCalledFromWorkStealingWorker())
+    {
+        SubmitJobToWorkerQueue(std::move(task));
+        return true;
+    }
+
     bool bMustIncrementWaitingWorkerThreadsAfterSubmission = false;
     if (threadLocalCurrentThreadPool == this)
     {
@@ -249,6 +263,13 @@ bool CPLWorkerThreadPool::SubmitJobs(CPLThreadFunc pfnFunc,
     }
 #endif
 
+    if (IsCalledFromWorkStealingWorker())
+    {
+        for (void *pData : apData)
+            SubmitJobToWorkerQueue([=] { pfnFunc(pData); });
+        return true;
+    }
+
     if (threadLocalCurrentThreadPool == this)
     {
         // If SubmitJob() is called from a worker thread of this queue,
@@ -336,6 +357,17 @@ void CPLWorkerThreadPool::WaitCompletion(int nMaxRemainingJobs)
 {
     if (nMaxRemainingJobs < 0)
         nMaxRemainingJobs = 0;
+    if (IsCalledFromWorkStealingWorker())
+    {
+        // Help running pending jobs rather than blocking a worker thread
+        do
+        {
+            std::lock_guard<std::mutex> oGuard(m_mutex);
+            if (nPendingJobs <= nMaxRemainingJobs)
+                return;
+        } while (RunPendingJob());
+    }
+
     std::unique_lock<std::mutex> oGuard(m_mutex);
     m_cv.wait(oGuard, [this, nMaxRemainingJobs]
               { return nPendingJobs <= nMaxRemainingJobs; });
@@ -411,8 +443,10 @@ bool CPLWorkerThreadPool::Setup(int nThreads, CPLThreadFunc pfnInitFunc,
 {
     CPLAssert(nThreads > 0);
 
+    // In work-stealing mode, threads are started immediately, so that jobs
+    // submitted from a worker thread never need to start a new one.
     if (nThreads > static_cast<int>(aWT.size()) && pfnInitFunc == nullptr &&
-        pasInitData == nullptr && !bWaitallStarted)
+        pasInitData == nullptr && !bWaitallStarted && !m_bWorkStealing)
     {
         std::lock_guard<std::mutex> oGuard(m_mutex);
         if (nThreads > m_nMaxThreads)
@@ -467,7 +501,12 @@ void CPLWorkerThreadPool::DeclareJobFinished()
 {
     std::lock_guard<std::mutex> oGuard(m_mutex);
     nPendingJobs--;
-    m_cv.notify_one();
+    // In work-stealing mode, several worker threads may wait in
+    // WaitCompletion() for different numbers of remaining jobs.
+    if (m_bWorkStealing)
+        m_cv.notify_all();
+    else
+        m_cv.notify_one();
 }
 
 /************************************************************************/
@@ -480,6 +519,17 @@ CPLWorkerThreadPool::GetNextJob(CPLWorkerThread *psWorkerThread)
     std::unique_lock<std::mutex> oGuard(m_mutex);
     while (true)
     {
+        if (m_bWorkStealing && m_nJobsInWorkerQueues > 0)
+        {
+            // Do not hold the mutex of the pool while looking at the queues
+            // of worker threads
+            oGuard.unlock();
+            auto task = GetJobFromWorkerQueues(psWorkerThread);
+            if (task)
+                return task;
+            oGuard.lock();
+        }
+
         if (eState == CPLWTS_STOP)
             return std::function<void()>();
 
@@ -520,6 +570,28 @@ CPLWorkerThreadPool::GetNextJob(CPLWorkerThread *psWorkerThread)
 
         m_cv.notify_one();
 
+        // Check again, now that we are registered as waiting, for jobs
+        // submitted to worker queues. See SubmitJobToWorkerQueue().
+        if (m_bWorkStealing && m_nJobsInWorkerQueues > 0)
+        {
+            // Unregister ourselves, so that a wake-up intended for a sleeping
+            // thread is not lost on us while we run the job.
+            for (CPLList **ppsIter = &psWaitingWorkerThreadsList; *ppsIter;
+                 ppsIter = &((*ppsIter)->psNext))
+            {
+                if ((*ppsIter)->pData == psWorkerThread)
+                {
+                    CPLList *psToFree = *ppsIter;
+                    *ppsIter = psToFree->psNext;
+                    CPLFree(psToFree);
+                    psWorkerThread->bMarkedAsWaiting = false;
+                    nWaitingWorkerThreads--;
+                    break;
+                }
+            }
+            continue;
+        }
+
 #if DEBUG_VERBOSE
         CPLDebug("JOB", "%p sleeping", psWorkerThread);
 #endif
@@ -538,6 +610,178 @@ CPLWorkerThreadPool::GetNextJob(CPLWorkerThread *psWorkerThread)
     }
 }
 
+/************************************************************************/
+/*                          SetWorkStealing()                           */
+/************************************************************************/
+
+/** Set whether the pool works in work-stealing mode.
+ *
+ * In that mode, each worker thread has its own queue of jobs, where the
+ * jobs submitted from that thread (that is from a job being run by the pool)
+ * are queued. A worker thread runs the most recently submitted job of its
+ * own queue first, and when it is empty, steals the oldest job of the queue
+ * of another worker thread, before falling back to the jobs submitted from
+ * outside the pool.
+ *
+ * Contrary to the default mode, where a job submitted from a worker thread
+ * is run synchronously when no other thread is available, jobs can thus be
+ * recursively split into smaller jobs. A worker thread waiting for the
+ * completion of jobs, with WaitCompletion(), runs pending jobs instead of
+ * blocking.
+ *
+ * This method must be called before Setup().
+ *
+ * @since GDAL 3.13
+ */
+void CPLWorkerThreadPool::SetWorkStealing(bool bWorkStealing)
+{
+    CPLAssert(aWT.empty());
+    m_bWorkStealing = bWorkStealing;
+}
+
+/************************************************************************/
+/*                   IsCalledFromWorkStealingWorker()                   */
+/************************************************************************/
+
+bool CPLWorkerThreadPool::IsCalledFromWorkStealingWorker() const
+{
+    return m_bWorkStealing && threadLocalCurrentThreadPool == this &&
+           threadLocalCurrentWorkerThread != nullptr;
+}
+
+/************************************************************************/
+/*                       SubmitJobToWorkerQueue()                       */
+/************************************************************************/
+
+void CPLWorkerThreadPool::SubmitJobToWorkerQueue(std::function<void()> &&task)
+{
+    std::unique_lock<std::mutex> oGuard(m_mutex);
+    nPendingJobs++;
+    {
+        auto psWT = threadLocalCurrentWorkerThread;
+        std::lock_guard<std::mutex> oGuardJobs(psWT->m_mutexJobs);
+        psWT->m_aoJobs.push_back(std::move(task));
+    }
+    // Done while holding the mutex of the pool, to pair with the check of
+    // GetNextJob() before a worker thread goes to sleep.
+    m_nJobsInWorkerQueues++;
+    WakeUpWaitingWorkerThread(oGuard);
+}
+
+/************************************************************************/
+/*                     WakeUpWaitingWorkerThread()                      */
+/************************************************************************/
+
+void CPLWorkerThreadPool::WakeUpWaitingWorkerThread(
+    std::unique_lock<std::mutex> &oGuard)
+{
+    if (psWaitingWorkerThreadsList == nullptr)
+        return;
+
+    CPLWorkerThread *psWorkerThread =
+        static_cast<CPLWorkerThread *>(psWaitingWorkerThreadsList->pData);
+
+    CPLAssert(psWorkerThread->bMarkedAsWaiting);
+    psWorkerThread->bMarkedAsWaiting = false;
+
+    CPLList *psToFree = psWaitingWorkerThreadsList;
+    psWaitingWorkerThreadsList = psWaitingWorkerThreadsList->psNext;
+    nWaitingWorkerThreads--;
+
+#ifndef __COVERITY__
+    {
+        std::lock_guard<std::mutex> oGuardWT(psWorkerThread->m_mutex);
+        oGuard.unlock();
+        psWorkerThread->m_cv.notify_one();
+    }
+#endif
+
+    CPLFree(psToFree);
+}
+
+/************************************************************************/
+/*                         GetJobFromOwnQueue()                         */
+/************************************************************************/
+
+std::function<void()>
+CPLWorkerThreadPool::GetJobFromOwnQueue(CPLWorkerThread *psWT)
+{
+    // Most recent job first, as it is the most likely to have its data in
+    // the CPU caches.
+    std::lock_guard<std::mutex> oGuard(psWT->m_mutexJobs);
+    if (psWT->m_aoJobs.empty())
+        return std::function<void()>();
+    auto task = std::move(psWT->m_aoJobs.back());
+    psWT->m_aoJobs.pop_back();
+    m_nJobsInWorkerQueues--;
+    return task;
+}
+
+/************************************************************************/
+/*                       GetJobFromWorkerQueues()                       */
+/************************************************************************/
+
+std::function<void()>
+CPLWorkerThreadPool::GetJobFromWorkerQueues(CPLWorkerThread *psWT)
+{
+    auto task = GetJobFromOwnQueue(psWT);
+    if (task || m_nJobsInWorkerQueues == 0)
+        return task;
+
+    // Then steal the oldest job of another worker thread, starting with
+    // the one following us, so that thieves do not all target the same queue.
+    std::shared_lock oLock(m_oWorkStealingMutex);
+    const size_t nWT = m_apoWorkStealingWT.size();
+    size_t iStart = 0;
+    for (size_t i = 0; i < nWT; ++i)
+    {
+        if (m_apoWorkStealingWT[i] == psWT)
+        {
+            iStart = i + 1;
+            break;
+        }
+    }
+    for (size_t i = 0; i < nWT; ++i)
+    {
+        CPLWorkerThread *psVictim = m_apoWorkStealingWT[(iStart + i) % nWT];
+        if (psVictim == psWT)
+            continue;
+        std::lock_guard<std::mutex> oGuard(psVictim->m_mutexJobs);
+        if (!psVictim->m_aoJobs.empty())
+        {
+            auto task = std::move(psVictim->m_aoJobs.front());
+            psVictim->m_aoJobs.pop_front();
+            m_nJobsInWorkerQueues--;
+            return task;
+        }
+    }
+
+    return std::function<void()>();
+}
+
+/************************************************************************/
+/*                           RunPendingJob()                            */
+/************************************************************************/
+
+/* Run, from a worker thread in work-stealing mode that waits for the      */
+/* completion of jobs, a job of its own queue. Returns false if there was  */
+/* none.                                                                    */
+/* Jobs are not stolen from other threads at that point: a stolen job      */
+/* would run on top of the waiting one, which could then be blocked by it  */
+/* while the stolen job waits for a job that depends on the waiting one.   */
+/* As jobs are only stolen by idle threads, a waiting thread only depends  */
+/* on jobs in its own queue, or running on other threads.                  */
+
+bool CPLWorkerThreadPool::RunPendingJob()
+{
+    auto task = GetJobFromOwnQueue(threadLocalCurrentWorkerThread);
+    if (!task)
+        return false;
+    task();
+    DeclareJobFinished();
+    return true;
+}
+
 /************************************************************************/
 /*                           CreateJobQueue()                           */
 /************************************************************************/
@@ -634,6 +878,19 @@ bool CPLJobQueue::SubmitJob(std::function<void()> task)
  */
 void CPLJobQueue::WaitCompletion(int nMaxRemainingJobs)
 {
+    if (m_poPool->IsCalledFromWorkStealingWorker())
+    {
+        // Run pending jobs of the queue of the current thread, which are
+        // most likely ours, rather than blocking a worker thread. Once it is
+        // empty, our remaining jobs are being run by other threads.
+        do
+        {
+            std::lock_guard<std::mutex> oGuard(m_mutex);
+            if (m_nPendingJobs <= nMaxRemainingJobs)
+                return;
+        } while (m_poPool->RunPendingJob());
+    }
+
     std::unique_lock<std::mutex> oGuard(m_mutex);
     m_cv.wait(oGuard, [this, nMaxRemainingJobs]
               { return m_nPendingJobs <= nMaxRemainingJobs; });
@@ -16,11 +16,14 @@
 #include "cpl_multiproc.h"
 #include "cpl_list.h"
 
+#include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <shared_mutex>
 #include <vector>
 
 /**
@@ -45,6 +48,10 @@ struct CPLWorkerThread
 
     std::mutex m_mutex{};
     std::condition_variable m_cv{};
+
+    // Jobs submitted by this thread, in work-stealing mode
+    std::mutex m_mutexJobs{};
+    std::deque<std::function<void()>> m_aoJobs{};
 };
 
 typedef enum
@@ -77,10 +84,25 @@ class CPL_DLL CPLWorkerThreadPool
 
     int m_nMaxThreads = 0;
 
+    bool m_bWorkStealing = false;
+    // Worker threads whose job queue can be stolen from, and total number of
+    // jobs in those queues
+    std::shared_mutex m_oWorkStealingMutex{};
+    std::vector<CPLWorkerThread *> m_apoWorkStealingWT{};
+    std::atomic<int> m_nJobsInWorkerQueues{0};
+
     static void WorkerThreadFunction(void *user_data);
 
     void DeclareJobFinished();
     std::function<void()> GetNextJob(CPLWorkerThread *psWorkerThread);
+    std::function<void()> GetJobFromOwnQueue(CPLWorkerThread *psWT);
+    std::function<void()> GetJobFromWorkerQueues(CPLWorkerThread *psWT);
+    void SubmitJobToWorkerQueue(std::function<void()> &&task);
+    void WakeUpWaitingWorkerThread(std::unique_lock<std::mutex> &oGuard);
+    bool IsCalledFromWorkStealingWorker() const;
+    bool RunPendingJob();
+
+    friend class CPLJobQueue;
 
   public:
     CPLWorkerThreadPool();
@@ -91,6 +113,14 @@ class CPL_DLL CPLWorkerThreadPool
     bool Setup(int nThreads, CPLThreadFunc pfnInitFunc, void **pasInitData,
                bool bWaitallStarted);
 
+    void SetWorkStealing(bool bWorkStealing);
+
+    /** Return whether the pool is in work-stealing mode */
+    bool IsWorkStealing() const
+    {
+        return m_bWorkStealing;
+    }
+
     CPLJobQueuePtr CreateJobQueue();
 
     bool SubmitJob(std::function<void()> task);
@@ -2,6 +2,7 @@
 
 import glob
 import os
+import re
 
 options = {}
 
@@ -22,6 +23,8 @@ def collect_config_options(filename):
         l = lines[i][0:-1].strip()
         if l.startswith("/*"):
             continue
+        # "CPLCachedConfigOption oVar(" is handled as "CPLGetConfigOption("
+        l = re.sub(r"CPLCachedConfigOption \w+\(", "CPLGetConfigOption(", l)
 
         found = False
         for func_name in func_names:
@@ -228,6 +228,16 @@ void CPLErrorReset();
 void VSICurlClearCache();
 void VSICurlPartialClearCache( const char* utf8_path );
 
+#if defined(SWIGPYTHON)
+%apply (char **dictAndCSLDestroy) { char ** };
+char** VSICurlDiskCacheGetStatistics();
+%clear char **;
+
+bool VSICurlDiskCacheClear();
+bool VSICurlDiskCachePrewarm( const char* utf8_path, GIntBig offset = 0,
+                              GIntBig size = 0 );
+#endif
+
 #ifndef SWIGJAVA
 %feature( "kwargs" ) EscapeString;
 #endif
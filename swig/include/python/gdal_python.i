@@ -4488,7 +4488,7 @@ def DEMProcessingOptions(options=None, colorFilename=None, format=None,
               zFactor=None, scale=None, xscale=None, yscale=None, azimuth=None, altitude=None,
               combined=False, multiDirectional=False, igor=False,
               slopeFormat=None, trigonometric=False, zeroForFlat=False,
-              addAlpha=None, colorSelection=None,
+              addAlpha=None, colorSelection=None, numThreads=None,
               callback=None, callback_data=None):
     """Create a DEMProcessingOptions() object that can be passed to gdal.DEMProcessing()
 
@@ -4536,6 +4536,8 @@ def DEMProcessingOptions(options=None, colorFilename=None, format=None,
         adds an alpha band to the output file (only for processing = 'color-relief')
     colorSelection : any
         (color-relief only) Determines how color entries are selected from an input value. Can be "nearest_color_entry", "exact_color_entry" or "linear_interpolation". Defaults to "linear_interpolation"
+    numThreads : any
+        number of worker threads (integer or "ALL_CPUS"). Not used by color-relief.
     callback : any
         callback method
     callback_data : any
@@ -4597,6 +4599,8 @@ def DEMProcessingOptions(options=None, colorFilename=None, format=None,
                 raise ValueError("Unsupported value for colorSelection")
         if addAlpha:
             new_options += ['-alpha']
+        if numThreads is not None:
+            new_options += ['-num_threads', str(numThreads)]
 
     if return_option_list:
         return new_options